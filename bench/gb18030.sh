@@ -0,0 +1,41 @@
+#!/bin/sh
+# GB18030 four-byte conversion benchmark.
+# usage: bench/gb18030.sh ENCFORCE [BASELINE_ENCFORCE]
+#
+# Builds 200k lines drawn mostly from code points GB18030 maps to
+# four-byte sequences (Hangul, Thai, Latin-1, Latin Extended-A, emoji),
+# then times single-threaded gb18030 decode and encode of them.
+
+BIN=${1:-./encforce}
+BASE=$2
+DIR=${BENCH_DIR:-/tmp/encforce-bench}
+LINES=${BENCH_LINES:-200000}
+
+mkdir -p "$DIR" || exit 1
+if [ ! -s "$DIR/gb18030.$LINES.gb" ]; then
+    python3 - "$DIR/gb18030.$LINES" "$LINES" <<'PY' || exit 1
+import random, sys
+random.seed(1)
+pools = [(0xAC00, 0xD7A3), (0x0E01, 0x0E5B), (0x00C0, 0x00FF),
+         (0x0100, 0x017F), (0x1F600, 0x1F64F)]
+with open(sys.argv[1] + ".u8", "w", encoding="utf-8") as u8, \
+     open(sys.argv[1] + ".gb", "wb") as gb:
+    for _ in range(int(sys.argv[2])):
+        s = "".join(chr(random.randint(*random.choice(pools)))
+                    for _ in range(random.randint(8, 24)))
+        u8.write(s + "\n")
+        gb.write(s.encode("gb18030") + b"\n")
+PY
+fi
+
+run() {
+    start=$(date +%s%N)
+    "$1" -j1 -e gb18030 -m "$2" -f "$3" > /dev/null 2>&1
+    end=$(date +%s%N)
+    printf '%-24s %-7s %6d ms\n' "$1" "$2" $(( (end - start) / 1000000 ))
+}
+
+for b in $BASE $BIN; do
+    run "$b" decode "$DIR/gb18030.$LINES.gb"
+    run "$b" encode "$DIR/gb18030.$LINES.u8"
+done
@@ -0,0 +1,14 @@
+#!/bin/sh
+# Binary size report; start-up latency is bench/startup.sh.
+# usage: bench/size.sh ENCFORCE [BASELINE_ENCFORCE]
+#
+# Reports section sizes and the file size of each binary.
+
+BIN=${1:-./encforce}
+BASE=$2
+
+for b in $BASE $BIN; do
+    echo "== $b"
+    size "$b"
+    printf '  file size      %8d bytes\n' $(wc -c < "$b")
+done
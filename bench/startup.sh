@@ -0,0 +1,31 @@
+#!/bin/sh
+# Startup latency benchmark: the short encforce "string" invocations
+# scripts make, one process per string.
+# usage: bench/startup.sh ENCFORCE [BASELINE_ENCFORCE]
+#
+# Prints the mean wall time of RUNS invocations: listing encodings, then
+# each mode for an ASCII and a non-ASCII argument.
+
+BIN=${1:-./encforce}
+BASE=$2
+RUNS=${BENCH_RUNS:-200}
+
+mean_us() {
+    start=$(date +%s%N)
+    i=0
+    while [ $i -lt $RUNS ]; do
+        "$@" > /dev/null 2>&1
+        i=$((i + 1))
+    done
+    end=$(date +%s%N)
+    echo $(( (end - start) / RUNS / 1000 ))
+}
+
+for b in $BASE $BIN; do
+    echo "== $b"
+    printf '  -l                    %8d us\n' $(mean_us "$b" -l)
+    for m in decode encode both; do
+        printf '  -m %-9s %-8s %8d us\n' $m '"hello"' $(mean_us "$b" -j1 -m $m hello)
+        printf '  -m %-9s %-8s %8d us\n' $m '"café"' $(mean_us "$b" -j1 -m $m café)
+    done
+done
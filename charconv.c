@@ -13,6 +13,76 @@
 #include "charconv.h"
 #include "sb_tables.h"
 #include "cjk_data.h"
+#include "strategy_tables.h"
+
+/* ===== Strategy specialization ===== */
+/*
+ * Each converter is written once as an always-inline body taking the
+ * strategy first; its callable wrapper switches on the strategy and calls
+ * the body with it as a constant, one copy per (converter, strategy). The
+ * strategy switch in the escape writers then folds away, leaving each
+ * copy's error path as straight-line code (or a bare return -1 for
+ * strict).
+ */
+#define STRATEGY_BODY static inline __attribute__((always_inline))
+#define STRATEGY_CASE(s, fn, ...) case s: return fn(s, __VA_ARGS__);
+
+#define DS_LIST(X, ...) \
+    X(DS_STRICT, __VA_ARGS__) \
+    X(DS_REPLACEMENT_FFFD, __VA_ARGS__) \
+    X(DS_REPLACEMENT_QUESTION, __VA_ARGS__) \
+    X(DS_REPLACEMENT_SUB, __VA_ARGS__) \
+    X(DS_SKIP, __VA_ARGS__) \
+    X(DS_LATIN1_FALLBACK, __VA_ARGS__) \
+    X(DS_CP1252_FALLBACK, __VA_ARGS__) \
+    X(DS_HEX_ESCAPE_X, __VA_ARGS__) \
+    X(DS_HEX_ESCAPE_PERCENT, __VA_ARGS__) \
+    X(DS_HEX_ESCAPE_ANGLE, __VA_ARGS__) \
+    X(DS_HEX_ESCAPE_0X, __VA_ARGS__) \
+    X(DS_HEX_ESCAPE_BRACKET, __VA_ARGS__) \
+    X(DS_OCTAL_ESCAPE, __VA_ARGS__) \
+    X(DS_CARET_NOTATION, __VA_ARGS__) \
+    X(DS_UNICODE_ESCAPE_U, __VA_ARGS__) \
+    X(DS_BYTE_VALUE_DECIMAL, __VA_ARGS__) \
+    X(DS_BYTE_VALUE_BACKSLASH_DEC, __VA_ARGS__) \
+    X(DS_DOUBLE_PERCENT, __VA_ARGS__)
+
+#define ES_LIST(X, ...) \
+    X(ES_STRICT, __VA_ARGS__) \
+    X(ES_REPLACEMENT_QUESTION, __VA_ARGS__) \
+    X(ES_REPLACEMENT_SUB, __VA_ARGS__) \
+    X(ES_REPLACEMENT_SPACE, __VA_ARGS__) \
+    X(ES_REPLACEMENT_ZWSP, __VA_ARGS__) \
+    X(ES_REPLACEMENT_UNDERSCORE, __VA_ARGS__) \
+    X(ES_SKIP, __VA_ARGS__) \
+    X(ES_HTML_DECIMAL, __VA_ARGS__) \
+    X(ES_HTML_HEX, __VA_ARGS__) \
+    X(ES_HTML_NAMED, __VA_ARGS__) \
+    X(ES_XML_NUMERIC, __VA_ARGS__) \
+    X(ES_URL_ENCODING, __VA_ARGS__) \
+    X(ES_DOUBLE_URL_ENCODING, __VA_ARGS__) \
+    X(ES_HEX_ESCAPE_X, __VA_ARGS__) \
+    X(ES_UNICODE_ESCAPE_U4, __VA_ARGS__) \
+    X(ES_UNICODE_ESCAPE_U8, __VA_ARGS__) \
+    X(ES_UNICODE_ESCAPE_XBRACE, __VA_ARGS__) \
+    X(ES_UNICODE_ESCAPE_UPLUS, __VA_ARGS__) \
+    X(ES_UNICODE_ESCAPE_UBRACE, __VA_ARGS__) \
+    X(ES_PYTHON_NAMED_ESCAPE, __VA_ARGS__) \
+    X(ES_JAVA_SURROGATE_PAIRS, __VA_ARGS__) \
+    X(ES_CSS_ESCAPE, __VA_ARGS__) \
+    X(ES_JSON_ESCAPE, __VA_ARGS__) \
+    X(ES_PUNYCODE, __VA_ARGS__) \
+    X(ES_TRANSLITERATION, __VA_ARGS__) \
+    X(ES_BASE64_INLINE, __VA_ARGS__) \
+    X(ES_QUOTED_PRINTABLE, __VA_ARGS__) \
+    X(ES_NCR_DECIMAL, __VA_ARGS__)
+
+#define SPECIALIZE_DS(fn, ...) \
+    switch (strategy) { DS_LIST(STRATEGY_CASE, fn, __VA_ARGS__) } \
+    return -1
+#define SPECIALIZE_ES(fn, ...) \
+    switch (strategy) { ES_LIST(STRATEGY_CASE, fn, __VA_ARGS__) } \
+    return -1
 
 /* ===== Strategy name arrays ===== */
 const char *charconv_decode_strategy_names[DS_COUNT] = {
@@ -177,6 +247,10 @@ const struct translit_entry charconv_translit_table[] = {
     {0x0176, "Y"}, {0x0177, "y"}, {0x0178, "Y"},
     {0x0179, "Z"}, {0x017A, "z"}, {0x017B, "Z"}, {0x017C, "z"},
     {0x017D, "Z"}, {0x017E, "z"},
+    {0x0149, "'n"}, {0x014A, "N"}, {0x014B, "n"}, {0x0166, "T"},
+    {0x0167, "t"}, {0x0180, "b"}, {0x0189, "D"}, {0x0191, "F"},
+    {0x0192, "f"}, {0x0197, "I"}, {0x0268, "i"}, {0x01E4, "G"},
+    {0x01E5, "g"}, {0x0237, "j"}, {0x0251, "a"}, {0x0261, "g"},
     /* Greek */
     {0x0391, "A"}, {0x0392, "B"}, {0x0393, "G"}, {0x0394, "D"},
     {0x0395, "E"}, {0x0396, "Z"}, {0x0397, "E"}, {0x0398, "Th"},
@@ -208,6 +282,12 @@ const struct translit_entry charconv_translit_table[] = {
     {0x0444, "f"}, {0x0445, "kh"}, {0x0446, "ts"}, {0x0447, "ch"},
     {0x0448, "sh"}, {0x0449, "shch"}, {0x044A, "\""}, {0x044B, "y"},
     {0x044C, "'"}, {0x044D, "e"}, {0x044E, "yu"}, {0x044F, "ya"},
+    {0x0401, "Yo"}, {0x0451, "yo"}, {0x0402, "Dj"}, {0x0452, "dj"},
+    {0x0404, "Ye"}, {0x0454, "ye"}, {0x0405, "Dz"}, {0x0455, "dz"},
+    {0x0406, "I"}, {0x0456, "i"}, {0x0407, "Yi"}, {0x0457, "yi"},
+    {0x0408, "J"}, {0x0458, "j"}, {0x0409, "Lj"}, {0x0459, "lj"},
+    {0x040A, "Nj"}, {0x045A, "nj"}, {0x040B, "C"}, {0x045B, "c"},
+    {0x040F, "Dz"}, {0x045F, "dz"}, {0x0490, "G"}, {0x0491, "g"},
     /* Symbols */
     {0x00A9, "(c)"}, {0x00AE, "(R)"}, {0x2122, "(TM)"},
     {0x00D7, "x"}, {0x00F7, "/"},
@@ -216,6 +296,15 @@ const struct translit_entry charconv_translit_table[] = {
     {0x00AB, "<<"}, {0x00BB, ">>"},
     {0x00BC, "1/4"}, {0x00BD, "1/2"}, {0x00BE, "3/4"},
     {0x20AC, "EUR"}, {0x00A3, "GBP"}, {0x00A5, "JPY"},
+    {0x00A2, "c"}, {0x20B9, "INR"}, {0x20BD, "RUB"}, {0x20A9, "KRW"},
+    {0x20AA, "ILS"}, {0x20BA, "TRY"}, {0x20B4, "UAH"}, {0x20AB, "VND"},
+    {0x00A1, "!"}, {0x00BF, "?"}, {0x00B1, "+/-"}, {0x2022, "*"},
+    {0x2010, "-"}, {0x2012, "-"}, {0x2015, "--"}, {0x2212, "-"},
+    {0x201A, "'"}, {0x201B, "'"}, {0x201E, "\""}, {0x201F, "\""},
+    {0x2039, "<"}, {0x203A, ">"}, {0x2032, "'"}, {0x2044, "/"},
+    {0x2190, "<-"}, {0x2192, "->"}, {0x2194, "<->"},
+    {0x21D0, "<="}, {0x21D2, "=>"}, {0x21D4, "<=>"},
+    {0x2260, "!="}, {0x2264, "<="}, {0x2265, ">="}, {0x2248, "~"},
     {0, NULL}
 };
 
@@ -281,8 +370,53 @@ int charconv_is_valid_utf8(const unsigned char *data, int len) {
     return 1;
 }
 
+/* ===== Escape formatting ===== */
+/*
+ * The strategies' escapes, written straight into the output without
+ * sprintf. fmt_hex matches %0NX: at least `digits` digits, more when the
+ * value needs them.
+ */
+static const char hex_lower[] = "0123456789abcdef";
+static const char hex_upper[] = "0123456789ABCDEF";
+
+static inline int fmt_hex(char *out, uint32_t v, int digits, const char *set) {
+    int n = 1;
+    while (n < 8 && (v >> (4 * n))) n++;
+    if (n < digits) n = digits;
+    for (int i = n - 1; i >= 0; i--, v >>= 4) out[i] = set[v & 15];
+    return n;
+}
+
+static inline int fmt_dec(char *out, uint32_t v) {
+    char buf[10];
+    int n = 0;
+    do { buf[n++] = '0' + v % 10; v /= 10; } while (v);
+    for (int i = 0; i < n; i++) out[i] = buf[n - 1 - i];
+    return n;
+}
+
+/* pre, v in hex, post */
+static inline int put_hex(char *out, const char *pre, uint32_t v, int digits,
+    const char *set, const char *post)
+{
+    int n = strlen(pre), m = strlen(post);
+    memcpy(out, pre, n);
+    n += fmt_hex(out + n, v, digits, set);
+    memcpy(out + n, post, m);
+    return n + m;
+}
+
+/* pre, v in decimal, post */
+static inline int put_dec(char *out, const char *pre, uint32_t v, const char *post) {
+    int n = strlen(pre), m = strlen(post);
+    memcpy(out, pre, n);
+    n += fmt_dec(out + n, v);
+    memcpy(out + n, post, m);
+    return n + m;
+}
+
 /* ===== Decode strategy application ===== */
-static int apply_decode_strategy(int strategy, unsigned char byte, char *out) {
+STRATEGY_BODY int apply_decode_strategy(int strategy, unsigned char byte, char *out) {
     switch (strategy) {
     case DS_STRICT:
         return -1;
@@ -295,32 +429,29 @@ static int apply_decode_strategy(int strategy, unsigned char byte, char *out) {
         out[0] = 0x1A; return 1;
     case DS_SKIP:
         return 0;
-    case DS_LATIN1_FALLBACK: {
-        unsigned char buf[4];
-        int n = charconv_utf8_encode((uint32_t)byte, buf);
-        memcpy(out, buf, n);
-        return n;
-    }
+    case DS_LATIN1_FALLBACK:
+        return charconv_utf8_encode((uint32_t)byte, (unsigned char *)out);
     case DS_CP1252_FALLBACK: {
         uint32_t cp = windows_1252_to_unicode[byte];
         if (cp == 0xFFFD) { out[0] = '?'; return 1; }
-        unsigned char buf[4];
-        int n = charconv_utf8_encode(cp, buf);
-        memcpy(out, buf, n);
-        return n;
+        return charconv_utf8_encode(cp, (unsigned char *)out);
     }
     case DS_HEX_ESCAPE_X:
-        return sprintf(out, "\\x%02x", byte);
+        return put_hex(out, "\\x", byte, 2, hex_lower, "");
     case DS_HEX_ESCAPE_PERCENT:
-        return sprintf(out, "%%%02X", byte);
+        return put_hex(out, "%", byte, 2, hex_upper, "");
     case DS_HEX_ESCAPE_ANGLE:
-        return sprintf(out, "<%02X>", byte);
+        return put_hex(out, "<", byte, 2, hex_upper, ">");
     case DS_HEX_ESCAPE_0X:
-        return sprintf(out, "0x%02X", byte);
+        return put_hex(out, "0x", byte, 2, hex_upper, "");
     case DS_HEX_ESCAPE_BRACKET:
-        return sprintf(out, "[%02X]", byte);
+        return put_hex(out, "[", byte, 2, hex_upper, "]");
     case DS_OCTAL_ESCAPE:
-        return sprintf(out, "\\%03o", byte);
+        out[0] = '\\';
+        out[1] = '0' + (byte >> 6);
+        out[2] = '0' + ((byte >> 3) & 7);
+        out[3] = '0' + (byte & 7);
+        return 4;
     case DS_CARET_NOTATION:
         if (byte < 0x20) {
             out[0] = '^'; out[1] = byte + 0x40;
@@ -329,21 +460,21 @@ static int apply_decode_strategy(int strategy, unsigned char byte, char *out) {
             out[0] = '^'; out[1] = '?';
             return 2;
         }
-        return sprintf(out, "\\x%02x", byte);
+        return put_hex(out, "\\x", byte, 2, hex_lower, "");
     case DS_UNICODE_ESCAPE_U:
-        return sprintf(out, "\\u%04X", byte);
+        return put_hex(out, "\\u", byte, 4, hex_upper, "");
     case DS_BYTE_VALUE_DECIMAL:
-        return sprintf(out, "{%u}", byte);
+        return put_dec(out, "{", byte, "}");
     case DS_BYTE_VALUE_BACKSLASH_DEC:
-        return sprintf(out, "\\%u", byte);
+        return put_dec(out, "\\", byte, "");
     case DS_DOUBLE_PERCENT:
-        return sprintf(out, "%%%%%02X", byte);
+        return put_hex(out, "%%", byte, 2, hex_upper, "");
     }
     return -1;
 }
 
 /* UTF-16 error handler: matches Rust handle_decode_error_utf16 */
-static int apply_decode_strategy_utf16(int strategy, uint16_t unit, char *out) {
+STRATEGY_BODY int apply_decode_strategy_utf16(int strategy, uint16_t unit, char *out) {
     switch (strategy) {
     case DS_STRICT:
         return -1;
@@ -357,11 +488,13 @@ static int apply_decode_strategy_utf16(int strategy, uint16_t unit, char *out) {
     case DS_SKIP:
         return 0;
     case DS_HEX_ESCAPE_X:
-        return sprintf(out, "\\x%04x", unit);
-    case DS_HEX_ESCAPE_PERCENT:
-        return sprintf(out, "%%%02X%%%02X", (unit >> 8) & 0xFF, unit & 0xFF);
+        return put_hex(out, "\\x", unit, 4, hex_lower, "");
+    case DS_HEX_ESCAPE_PERCENT: {
+        int n = put_hex(out, "%", (unit >> 8) & 0xFF, 2, hex_upper, "");
+        return n + put_hex(out + n, "%", unit & 0xFF, 2, hex_upper, "");
+    }
     case DS_UNICODE_ESCAPE_U:
-        return sprintf(out, "\\u%04X", unit);
+        return put_hex(out, "\\u", unit, 4, hex_upper, "");
     default:
         /* All other strategies fall back to FFFD */
         out[0] = 0xEF; out[1] = 0xBF; out[2] = 0xBD;
@@ -370,7 +503,7 @@ static int apply_decode_strategy_utf16(int strategy, uint16_t unit, char *out) {
 }
 
 /* UTF-32 error handler: matches Rust handle_decode_error_utf32 */
-static int apply_decode_strategy_utf32(int strategy, uint32_t codepoint, char *out) {
+STRATEGY_BODY int apply_decode_strategy_utf32(int strategy, uint32_t codepoint, char *out) {
     switch (strategy) {
     case DS_STRICT:
         return -1;
@@ -384,7 +517,7 @@ static int apply_decode_strategy_utf32(int strategy, uint32_t codepoint, char *o
     case DS_SKIP:
         return 0;
     case DS_UNICODE_ESCAPE_U:
-        return sprintf(out, "\\U%08X", codepoint);
+        return put_hex(out, "\\U", codepoint, 8, hex_upper, "");
     default:
         /* All other strategies fall back to FFFD */
         out[0] = 0xEF; out[1] = 0xBF; out[2] = 0xBD;
@@ -392,6 +525,41 @@ static int apply_decode_strategy_utf32(int strategy, uint32_t codepoint, char *o
     }
 }
 
+/*
+ * Append a strategy's text for one error at out[*opos]. It is written in
+ * place when the longest text fits, else staged so a near-full buffer
+ * still fails exactly as before. Returns -1 for strict or no room.
+ */
+#define DS_TEXT_MAX 32
+#define ES_TEXT_MAX 64
+
+#define PUT_ERROR(max, apply)                                           \
+    char buf_[max];                                                     \
+    char *dst_ = outsize - *opos >= (max) ? (char *)out + *opos : buf_; \
+    int n_ = apply;                                                     \
+    if (n_ < 0 || *opos + n_ > outsize) return -1;                      \
+    if (dst_ == buf_) memcpy(out + *opos, buf_, n_);                    \
+    *opos += n_;                                                        \
+    return 0
+
+STRATEGY_BODY int put_decode_error(int strategy, unsigned char byte,
+    unsigned char *out, int *opos, int outsize)
+{
+    PUT_ERROR(DS_TEXT_MAX, apply_decode_strategy(strategy, byte, dst_));
+}
+
+STRATEGY_BODY int put_decode_error_utf16(int strategy, uint16_t unit,
+    unsigned char *out, int *opos, int outsize)
+{
+    PUT_ERROR(DS_TEXT_MAX, apply_decode_strategy_utf16(strategy, unit, dst_));
+}
+
+STRATEGY_BODY int put_decode_error_utf32(int strategy, uint32_t cp,
+    unsigned char *out, int *opos, int outsize)
+{
+    PUT_ERROR(DS_TEXT_MAX, apply_decode_strategy_utf32(strategy, cp, dst_));
+}
+
 /* ===== Punycode (RFC 3492) for single-character IDNA encoding ===== */
 static int punycode_encode_idna(uint32_t *codepoints, int cplen, char *out) {
     #define PC_BASE 36
@@ -416,7 +584,8 @@ static int punycode_encode_idna(uint32_t *codepoints, int cplen, char *out) {
         return pos;
     }
 
-    pos += sprintf(out, "xn--");
+    memcpy(out, "xn--", 4);
+    pos += 4;
 
     /* Copy basic code points */
     int b = 0;
@@ -475,7 +644,17 @@ static int punycode_encode_idna(uint32_t *codepoints, int cplen, char *out) {
 }
 
 /* ===== Encode strategy application ===== */
-static int apply_encode_strategy(int strategy, uint32_t codepoint,
+
+/* Length-prefixed strategy_tables.h text for cp, or NULL */
+static inline const char *strategy_text(const uint8_t *page, const uint16_t (*index)[256],
+                                        const char *pool, uint32_t limit, uint32_t cp)
+{
+    if (cp >= limit) return NULL;
+    uint16_t off = index[page[cp >> 8]][cp & 0xFF];
+    return off ? pool + off : NULL;
+}
+
+STRATEGY_BODY int apply_encode_strategy(int strategy, uint32_t codepoint,
     const unsigned char *utf8_bytes, int utf8_len, char *out)
 {
     switch (strategy) {
@@ -495,74 +674,82 @@ static int apply_encode_strategy(int strategy, uint32_t codepoint,
     case ES_SKIP:
         return 0;
     case ES_HTML_DECIMAL:
-        return sprintf(out, "&#%u;", codepoint);
+        return put_dec(out, "&#", codepoint, ";");
     case ES_HTML_HEX:
-        return sprintf(out, "&#x%X;", codepoint);
+        return put_hex(out, "&#x", codepoint, 1, hex_upper, ";");
     case ES_HTML_NAMED: {
-        for (int i = 0; charconv_html_entities[i].name; i++) {
-            if (charconv_html_entities[i].codepoint == codepoint)
-                return sprintf(out, "&%s;", charconv_html_entities[i].name);
+        const char *t = strategy_text(html_named_page, html_named_index,
+                                      html_named_pool, HTML_NAMED_LIMIT, codepoint);
+        if (t) {
+            int n = (unsigned char)t[0];
+            out[0] = '&';
+            memcpy(out + 1, t + 1, n);
+            out[n + 1] = ';';
+            return n + 2;
         }
-        return sprintf(out, "&#%u;", codepoint);
+        return put_dec(out, "&#", codepoint, ";");
     }
     case ES_XML_NUMERIC:
-        return sprintf(out, "&#%u;", codepoint);
+        return put_dec(out, "&#", codepoint, ";");
     case ES_URL_ENCODING: {
         int pos = 0;
         for (int i = 0; i < utf8_len; i++)
-            pos += sprintf(out + pos, "%%%02X", utf8_bytes[i]);
+            pos += put_hex(out + pos, "%", utf8_bytes[i], 2, hex_upper, "");
         return pos;
     }
     case ES_DOUBLE_URL_ENCODING: {
         int pos = 0;
         for (int i = 0; i < utf8_len; i++)
-            pos += sprintf(out + pos, "%%25%02X", utf8_bytes[i]);
+            pos += put_hex(out + pos, "%25", utf8_bytes[i], 2, hex_upper, "");
         return pos;
     }
     case ES_HEX_ESCAPE_X: {
         int pos = 0;
         for (int i = 0; i < utf8_len; i++)
-            pos += sprintf(out + pos, "\\x%02x", utf8_bytes[i]);
+            pos += put_hex(out + pos, "\\x", utf8_bytes[i], 2, hex_lower, "");
         return pos;
     }
     case ES_UNICODE_ESCAPE_U4:
         if (codepoint <= 0xFFFF)
-            return sprintf(out, "\\u%04X", codepoint);
+            return put_hex(out, "\\u", codepoint, 4, hex_upper, "");
         else {
             uint32_t adj = codepoint - 0x10000;
             uint16_t hi = 0xD800 + (adj >> 10);
             uint16_t lo = 0xDC00 + (adj & 0x3FF);
-            return sprintf(out, "\\u%04X\\u%04X", hi, lo);
+            int n = put_hex(out, "\\u", hi, 4, hex_upper, "");
+            return n + put_hex(out + n, "\\u", lo, 4, hex_upper, "");
         }
     case ES_UNICODE_ESCAPE_U8:
-        return sprintf(out, "\\U%08X", codepoint);
+        return put_hex(out, "\\U", codepoint, 8, hex_upper, "");
     case ES_UNICODE_ESCAPE_XBRACE:
-        return sprintf(out, "\\x{%X}", codepoint);
+        return put_hex(out, "\\x{", codepoint, 1, hex_upper, "}");
     case ES_UNICODE_ESCAPE_UPLUS:
-        return sprintf(out, "U+%04X", codepoint);
+        return put_hex(out, "U+", codepoint, 4, hex_upper, "");
     case ES_UNICODE_ESCAPE_UBRACE:
-        return sprintf(out, "\\u{%X}", codepoint);
+        return put_hex(out, "\\u{", codepoint, 1, hex_upper, "}");
     case ES_PYTHON_NAMED_ESCAPE:
-        return sprintf(out, "\\N{U+%04X}", codepoint);
+        return put_hex(out, "\\N{U+", codepoint, 4, hex_upper, "}");
     case ES_JAVA_SURROGATE_PAIRS:
         if (codepoint <= 0xFFFF)
-            return sprintf(out, "\\u%04X", codepoint);
+            return put_hex(out, "\\u", codepoint, 4, hex_upper, "");
         else {
             uint32_t adj = codepoint - 0x10000;
             uint16_t hi = 0xD800 + (adj >> 10);
             uint16_t lo = 0xDC00 + (adj & 0x3FF);
-            return sprintf(out, "\\u%04X\\u%04X", hi, lo);
+            int n = put_hex(out, "\\u", hi, 4, hex_upper, "");
+            return n + put_hex(out + n, "\\u", lo, 4, hex_upper, "");
         }
     case ES_CSS_ESCAPE:
-        return sprintf(out, "\\%06X", codepoint);
+        return put_hex(out, "\\", codepoint, 6, hex_upper, "");
     case ES_JSON_ESCAPE:
         if (codepoint <= 0xFFFF)
-            return sprintf(out, "\\u%04x", codepoint);
+            return put_hex(out, "\\u", codepoint, 4, hex_lower, "");
         else {
             uint32_t adj = codepoint - 0x10000;
             uint16_t hi = 0xD800 + (adj >> 10);
             uint16_t lo = 0xDC00 + (adj & 0x3FF);
-            return sprintf(out, "\\u%04x\\u%04x", hi, lo);
+            int n = put_hex(out, "\\u", hi, 4, hex_lower, "");
+            return n + put_hex(out + n, "\\u", lo, 4, hex_lower, "");
         }
     case ES_PUNYCODE: {
         /* RFC 3492 punycode with xn-- prefix */
@@ -570,12 +757,12 @@ static int apply_encode_strategy(int strategy, uint32_t codepoint,
         return punycode_encode_idna(cps, 1, out);
     }
     case ES_TRANSLITERATION: {
-        for (int i = 0; charconv_translit_table[i].ascii; i++) {
-            if (charconv_translit_table[i].codepoint == codepoint) {
-                int slen = strlen(charconv_translit_table[i].ascii);
-                memcpy(out, charconv_translit_table[i].ascii, slen);
-                return slen;
-            }
+        const char *t = strategy_text(translit_page, translit_index,
+                                      translit_pool, TRANSLIT_LIMIT, codepoint);
+        if (t) {
+            int n = (unsigned char)t[0];
+            memcpy(out, t + 1, n);
+            return n;
         }
         out[0] = '?'; return 1;
     }
@@ -583,7 +770,8 @@ static int apply_encode_strategy(int strategy, uint32_t codepoint,
         /* Base64 encode the UTF-8 bytes (RFC 4648) */
         static const char b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
         int pos = 0;
-        pos += sprintf(out + pos, "[base64:");
+        memcpy(out, "[base64:", 8);
+        pos += 8;
         int i = 0;
         while (i < utf8_len) {
             int start = i;
@@ -603,15 +791,28 @@ static int apply_encode_strategy(int strategy, uint32_t codepoint,
     case ES_QUOTED_PRINTABLE: {
         int pos = 0;
         for (int i = 0; i < utf8_len; i++)
-            pos += sprintf(out + pos, "=%02X", utf8_bytes[i]);
+            pos += put_hex(out + pos, "=", utf8_bytes[i], 2, hex_upper, "");
         return pos;
     }
     case ES_NCR_DECIMAL:
-        return sprintf(out, "&#%u;", codepoint);
+        return put_dec(out, "&#", codepoint, ";");
     }
     return -1;
 }
 
+int charconv_encode_error(int strategy, uint32_t cp, char *out) {
+    unsigned char utf8[4];
+    int len = charconv_utf8_encode(cp, utf8);
+    return apply_encode_strategy(strategy, cp, utf8, len, out);
+}
+
+STRATEGY_BODY int put_encode_error(int strategy, uint32_t cp,
+    const unsigned char *utf8_bytes, int utf8_len,
+    unsigned char *out, int *opos, int outsize)
+{
+    PUT_ERROR(ES_TEXT_MAX, apply_encode_strategy(strategy, cp, utf8_bytes, utf8_len, dst_));
+}
+
 /* ===== Reverse map for single-byte encode ===== */
 
 static int sb_reverse_cmp(const void *a, const void *b) {
@@ -628,7 +829,7 @@ void charconv_init_reverse_maps(struct CharEncoding *encodings, int count) {
         if (!encodings[e].to_unicode) continue;
         if (encodings[e].reverse_map) continue; /* already built */
 
-        const uint32_t *table = encodings[e].to_unicode;
+        const uint16_t *table = encodings[e].to_unicode;
         /* Count valid entries */
         int n = 0;
         for (int b = 0; b < 256; b++) {
@@ -674,12 +875,29 @@ static int sb_reverse_lookup(const struct sb_reverse_entry *map, int size, uint3
     return -1;
 }
 
+/* ===== Chunked conversion helpers ===== */
+/*
+ * With a non-final state, converters stop starting new sequences once
+ * fewer than maxseq bytes remain, so every sequence they do start is
+ * complete. The rest is left for the next chunk (st->consumed).
+ */
+static inline int chunk_end(const struct charconv_state *st, int inlen, int maxseq) {
+    if (!st || st->final) return inlen;
+    return inlen - maxseq + 1 > 0 ? inlen - maxseq + 1 : 0;
+}
+
+static inline int chunk_final(const struct charconv_state *st) {
+    return !st || st->final;
+}
+
 /* ===== Single-byte decode ===== */
-static int sb_decode(const struct CharEncoding *enc,
+STRATEGY_BODY int sb_decode_s(int strategy,
+    const struct CharEncoding *enc,
     const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
-    const uint32_t *table = enc->to_unicode;
+    const uint16_t *table = enc->to_unicode;
     int opos = 0;
     *had_errors = 0;
 
@@ -687,12 +905,7 @@ static int sb_decode(const struct CharEncoding *enc,
         uint32_t cp = table[in[i]];
         if (cp == 0xFFFD || cp == 0xFFFF) {
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, in[i], strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, in[i], out, &opos, outsize) < 0) return -1;
         } else {
             unsigned char buf[4];
             int n = charconv_utf8_encode(cp, buf);
@@ -701,18 +914,30 @@ static int sb_decode(const struct CharEncoding *enc,
             opos += n;
         }
     }
+    if (st) st->consumed = inlen;
     return opos;
 }
 
+static int sb_decode(const struct CharEncoding *enc,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_DS(sb_decode_s, enc, in, inlen, out, outsize, had_errors, st);
+}
+
 /* ===== Single-byte encode ===== */
-static int sb_encode(const struct CharEncoding *enc,
+STRATEGY_BODY int sb_encode_s(int strategy,
+    const struct CharEncoding *enc,
     const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 4);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         int consumed;
         uint32_t cp = charconv_utf8_decode(in + i, inlen - i, &consumed);
         if (consumed == 0) consumed = 1;
@@ -732,36 +957,38 @@ static int sb_encode(const struct CharEncoding *enc,
             out[opos++] = (unsigned char)found;
         } else {
             *had_errors = 1;
-            char strbuf[64];
-            int slen = apply_encode_strategy(strategy, cp, in + i, consumed, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_encode_error(strategy, cp, in + i, consumed, out, &opos, outsize) < 0) return -1;
         }
         i += consumed;
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int sb_encode(const struct CharEncoding *enc,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_ES(sb_encode_s, enc, in, inlen, out, outsize, had_errors, st);
+}
+
 /* ===== UTF-8 decode (validate + apply strategy) ===== */
-static int utf8_decode_conv(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int utf8_decode_conv_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 4);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         int consumed;
         uint32_t cp = charconv_utf8_decode(in + i, inlen - i, &consumed);
         if (cp == 0xFFFFFFFF) {
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, in[i], strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, in[i], out, &opos, outsize) < 0) return -1;
             if (consumed == 0) consumed = 1;
             i += consumed;
         } else {
@@ -772,29 +999,42 @@ static int utf8_decode_conv(const unsigned char *in, int inlen,
             i += consumed;
         }
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int utf8_decode_conv(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_DS(utf8_decode_conv_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* ===== UTF-8 encode (passthrough — UTF-8 can encode all Unicode) ===== */
 static int utf8_encode_conv(const unsigned char *in, int inlen,
     unsigned char *out, int outsize,
     int strategy __attribute__((unused)),
-    int *had_errors)
+    int *had_errors,
+    struct charconv_state *st)
 {
     *had_errors = 0;
     if (inlen > outsize) return -1;
     memcpy(out, in, inlen);
+    if (st) st->consumed = inlen;
     return inlen;
 }
 
 /* ===== UTF-16 decode ===== */
-static int utf16_decode_impl(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors, int big_endian)
+STRATEGY_BODY int utf16_decode_impl_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors, int big_endian,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 4);
     *had_errors = 0;
 
-    while (i + 1 < inlen) {
+    while (i + 1 < inlen && i < end) {
         uint16_t unit = big_endian
             ? ((uint16_t)in[i] << 8) | in[i+1]
             : (uint16_t)in[i] | ((uint16_t)in[i+1] << 8);
@@ -818,22 +1058,12 @@ static int utf16_decode_impl(const unsigned char *in, int inlen,
             }
             /* Invalid surrogate */
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy_utf16(strategy, unit, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error_utf16(strategy, unit, out, &opos, outsize) < 0) return -1;
             i += 2;
         } else if (unit >= 0xDC00 && unit <= 0xDFFF) {
             /* Orphan low surrogate */
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy_utf16(strategy, unit, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error_utf16(strategy, unit, out, &opos, outsize) < 0) return -1;
             i += 2;
         } else {
             unsigned char buf[4];
@@ -845,42 +1075,61 @@ static int utf16_decode_impl(const unsigned char *in, int inlen,
         }
     }
     /* Trailing byte — Rust passes byte as u16 (0x00XX) */
-    if (i < inlen) {
+    if (i < inlen && chunk_final(st)) {
         *had_errors = 1;
-        char strbuf[32];
-        int slen = apply_decode_strategy_utf16(strategy, (uint16_t)in[i], strbuf);
-        if (slen < 0) return -1;
-        if (opos + slen > outsize) return -1;
-        memcpy(out + opos, strbuf, slen);
-        opos += slen;
+        if (put_decode_error_utf16(strategy, (uint16_t)in[i], out, &opos, outsize) < 0) return -1;
+        i++;
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int utf16_decode_impl(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors, int big_endian,
+    struct charconv_state *st)
+{
+    SPECIALIZE_DS(utf16_decode_impl_s, in, inlen, out, outsize, had_errors, big_endian, st);
+}
+
 /* UTF-16 with BOM detection */
 static int utf16_decode_bom(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
 {
+    int skip = 0, big_endian = 1;
+
+    if (st && st->started)
+        return utf16_decode_impl(in, inlen, out, outsize, strategy, had_errors,
+            st->big_endian, st);
     if (inlen >= 2) {
-        if (in[0] == 0xFE && in[1] == 0xFF)
-            return utf16_decode_impl(in + 2, inlen - 2, out, outsize, strategy, had_errors, 1);
-        if (in[0] == 0xFF && in[1] == 0xFE)
-            return utf16_decode_impl(in + 2, inlen - 2, out, outsize, strategy, had_errors, 0);
+        if (in[0] == 0xFE && in[1] == 0xFF) skip = 2;
+        if (in[0] == 0xFF && in[1] == 0xFE) { skip = 2; big_endian = 0; }
+    } else if (!chunk_final(st)) {
+        /* Too short to tell whether a BOM follows */
+        *had_errors = 0;
+        st->consumed = 0;
+        return 0;
     }
     /* Default: BE */
-    return utf16_decode_impl(in, inlen, out, outsize, strategy, had_errors, 1);
+    if (st) { st->started = 1; st->big_endian = big_endian; }
+    int n = utf16_decode_impl(in + skip, inlen - skip, out, outsize, strategy,
+        had_errors, big_endian, st);
+    if (st) st->consumed += skip;
+    return n;
 }
 
 /* ===== UTF-16 encode ===== */
 static int utf16_encode_impl(const unsigned char *in, int inlen,
     unsigned char *out, int outsize,
     int strategy __attribute__((unused)),
-    int *had_errors, int big_endian)
+    int *had_errors, int big_endian,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 4);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         int consumed;
         uint32_t cp = charconv_utf8_decode(in + i, inlen - i, &consumed);
         if (consumed == 0) consumed = 1;
@@ -915,22 +1164,31 @@ static int utf16_encode_impl(const unsigned char *in, int inlen,
         }
         i += consumed;
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
 /* UTF-16 with BOM encode (BE with BOM prefix) */
 static int utf16_encode_bom(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
 {
-    if (outsize < 2) return -1;
-    out[0] = 0xFE; out[1] = 0xFF; /* BE BOM */
-    int n = utf16_encode_impl(in, inlen, out + 2, outsize - 2, strategy, had_errors, 1);
-    return n < 0 ? -1 : n + 2;
+    int bom = 0;
+    if (!st || !st->started) {
+        if (outsize < 2) return -1;
+        out[0] = 0xFE; out[1] = 0xFF; /* BE BOM */
+        bom = 2;
+        if (st) st->started = 1;
+    }
+    int n = utf16_encode_impl(in, inlen, out + bom, outsize - bom, strategy, had_errors, 1, st);
+    return n < 0 ? -1 : n + bom;
 }
 
 /* ===== UTF-32 decode ===== */
-static int utf32_decode_impl(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors, int big_endian)
+STRATEGY_BODY int utf32_decode_impl_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors, int big_endian,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
     *had_errors = 0;
@@ -946,12 +1204,7 @@ static int utf32_decode_impl(const unsigned char *in, int inlen,
 
         if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy_utf32(strategy, cp, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error_utf32(strategy, cp, out, &opos, outsize) < 0) return -1;
         } else {
             unsigned char buf[4];
             int n = charconv_utf8_encode(cp, buf);
@@ -962,35 +1215,61 @@ static int utf32_decode_impl(const unsigned char *in, int inlen,
         i += 4;
     }
     /* Trailing bytes — Rust marks as errors but generates no output */
-    if (i < inlen) {
+    if (i < inlen && chunk_final(st)) {
         *had_errors = 1;
+        i = inlen;
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int utf32_decode_impl(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors, int big_endian,
+    struct charconv_state *st)
+{
+    SPECIALIZE_DS(utf32_decode_impl_s, in, inlen, out, outsize, had_errors, big_endian, st);
+}
+
 /* UTF-32 with BOM detection */
 static int utf32_decode_bom(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
 {
+    int skip = 0, big_endian = 1;
+
+    if (st && st->started)
+        return utf32_decode_impl(in, inlen, out, outsize, strategy, had_errors,
+            st->big_endian, st);
     if (inlen >= 4) {
-        if (in[0] == 0x00 && in[1] == 0x00 && in[2] == 0xFE && in[3] == 0xFF)
-            return utf32_decode_impl(in + 4, inlen - 4, out, outsize, strategy, had_errors, 1);
-        if (in[0] == 0xFF && in[1] == 0xFE && in[2] == 0x00 && in[3] == 0x00)
-            return utf32_decode_impl(in + 4, inlen - 4, out, outsize, strategy, had_errors, 0);
+        if (in[0] == 0x00 && in[1] == 0x00 && in[2] == 0xFE && in[3] == 0xFF) skip = 4;
+        if (in[0] == 0xFF && in[1] == 0xFE && in[2] == 0x00 && in[3] == 0x00) {
+            skip = 4;
+            big_endian = 0;
+        }
+    } else if (!chunk_final(st)) {
+        *had_errors = 0;
+        st->consumed = 0;
+        return 0;
     }
-    return utf32_decode_impl(in, inlen, out, outsize, strategy, had_errors, 1);
+    if (st) { st->started = 1; st->big_endian = big_endian; }
+    int n = utf32_decode_impl(in + skip, inlen - skip, out, outsize, strategy,
+        had_errors, big_endian, st);
+    if (st) st->consumed += skip;
+    return n;
 }
 
 /* ===== UTF-32 encode ===== */
 static int utf32_encode_impl(const unsigned char *in, int inlen,
     unsigned char *out, int outsize,
     int strategy __attribute__((unused)),
-    int *had_errors, int big_endian)
+    int *had_errors, int big_endian,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 4);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         int consumed;
         uint32_t cp = charconv_utf8_decode(in + i, inlen - i, &consumed);
         if (consumed == 0) consumed = 1;
@@ -1010,21 +1289,30 @@ static int utf32_encode_impl(const unsigned char *in, int inlen,
         }
         i += consumed;
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
 static int utf32_encode_bom(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
 {
-    if (outsize < 4) return -1;
-    out[0] = 0x00; out[1] = 0x00; out[2] = 0xFE; out[3] = 0xFF;
-    int n = utf32_encode_impl(in, inlen, out + 4, outsize - 4, strategy, had_errors, 1);
-    return n < 0 ? -1 : n + 4;
+    int bom = 0;
+    if (!st || !st->started) {
+        if (outsize < 4) return -1;
+        out[0] = 0x00; out[1] = 0x00; out[2] = 0xFE; out[3] = 0xFF;
+        bom = 4;
+        if (st) st->started = 1;
+    }
+    int n = utf32_encode_impl(in, inlen, out + bom, outsize - bom, strategy, had_errors, 1, st);
+    return n < 0 ? -1 : n + bom;
 }
 
 /* ===== UTF-7 decode ===== */
-static int utf7_decode(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int utf7_decode_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     static const int b64val[128] = {
         -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
@@ -1038,10 +1326,47 @@ static int utf7_decode(const unsigned char *in, int inlen,
     };
 
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 2);
+    int in_b64 = st ? st->mode : 0;
+    uint32_t accum = st ? st->accum : 0;
+    int bits = st ? st->bits : 0;
     *had_errors = 0;
 
-    while (i < inlen) {
-        if (in[i] == '+') {
+    while (i < end) {
+        if (in_b64) {
+            /* Base64 encoded section */
+            while (i < end && in[i] != '-') {
+                if (in[i] >= 128 || b64val[in[i]] < 0) {
+                    *had_errors = 1;
+                    break;
+                }
+                accum = (accum << 6) | b64val[in[i]];
+                bits += 6;
+                i++;
+                while (bits >= 16) {
+                    bits -= 16;
+                    uint16_t unit = (accum >> bits) & 0xFFFF;
+                    /* Handle surrogate pairs */
+                    if (unit >= 0xD800 && unit <= 0xDBFF) {
+                        /* Need more data for low surrogate */
+                        /* Continue accumulating */
+                    } else if (unit >= 0xDC00 && unit <= 0xDFFF) {
+                        /* This shouldn't happen standalone - error */
+                        *had_errors = 1;
+                    } else {
+                        unsigned char buf[4];
+                        int n = charconv_utf8_encode((uint32_t)unit, buf);
+                        if (opos + n > outsize) return -1;
+                        memcpy(out + opos, buf, n);
+                        opos += n;
+                    }
+                }
+            }
+            /* Section continues in the next chunk */
+            if (i >= end && !chunk_final(st)) break;
+            if (i < inlen && in[i] == '-') i++;
+            in_b64 = 0;
+        } else if (in[i] == '+') {
             i++;
             if (i < inlen && in[i] == '-') {
                 /* +- = literal + */
@@ -1049,69 +1374,98 @@ static int utf7_decode(const unsigned char *in, int inlen,
                 out[opos++] = '+';
                 i++;
             } else {
-                /* Base64 encoded section */
-                uint32_t accum = 0;
-                int bits = 0;
-                while (i < inlen && in[i] != '-') {
-                    if (in[i] >= 128 || b64val[in[i]] < 0) {
-                        *had_errors = 1;
-                        break;
-                    }
-                    accum = (accum << 6) | b64val[in[i]];
-                    bits += 6;
-                    i++;
-                    while (bits >= 16) {
-                        bits -= 16;
-                        uint16_t unit = (accum >> bits) & 0xFFFF;
-                        /* Handle surrogate pairs */
-                        if (unit >= 0xD800 && unit <= 0xDBFF) {
-                            /* Need more data for low surrogate */
-                            /* Continue accumulating */
-                        } else if (unit >= 0xDC00 && unit <= 0xDFFF) {
-                            /* This shouldn't happen standalone - error */
-                            *had_errors = 1;
-                        } else {
-                            unsigned char buf[4];
-                            int n = charconv_utf8_encode((uint32_t)unit, buf);
-                            if (opos + n > outsize) return -1;
-                            memcpy(out + opos, buf, n);
-                            opos += n;
-                        }
-                    }
-                }
-                if (i < inlen && in[i] == '-') i++;
+                in_b64 = 1;
+                accum = 0;
+                bits = 0;
             }
         } else if (in[i] >= 0x80) {
             /* Bytes >= 0x80 are not valid in UTF-7 direct mode */
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, in[i], strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, in[i], out, &opos, outsize) < 0) return -1;
             i++;
         } else {
             if (opos >= outsize) return -1;
             out[opos++] = in[i++];
         }
     }
+    if (st) {
+        st->mode = in_b64;
+        st->accum = accum;
+        st->bits = bits;
+        st->consumed = i;
+    }
     return opos;
 }
 
+static int utf7_decode(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_DS(utf7_decode_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* UTF-7 encode */
 static int utf7_encode(const unsigned char *in, int inlen,
     unsigned char *out, int outsize,
     int strategy __attribute__((unused)),
-    int *had_errors)
+    int *had_errors, struct charconv_state *st)
 {
     static const char b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 4);
+    int in_run = st ? st->mode : 0;
+    uint32_t accum = st ? st->accum : 0;
+    int bits = st ? st->bits : 0;
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         int consumed;
         uint32_t cp = charconv_utf8_decode(in + i, inlen - i, &consumed);
+
+        if (in_run) {
+            if (cp >= 0x20 && cp <= 0x7E && cp != '+') {
+                /* Flush remaining bits */
+                if (bits > 0) {
+                    if (opos >= outsize) return -1;
+                    out[opos++] = b64[(accum << (6 - bits)) & 0x3F];
+                }
+                /* Add terminating - only if next char could be confused with base64 */
+                unsigned char c = in[i];
+                int is_b64 = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
+                             (c >= '0' && c <= '9') || c == '+' || c == '/' || c == '-';
+                if (is_b64) {
+                    if (opos >= outsize) return -1;
+                    out[opos++] = '-';
+                }
+                in_run = 0;
+                continue;
+            }
+
+            /* Encode as UTF-16 */
+            if (cp < 0x10000) {
+                accum = (accum << 16) | cp;
+                bits += 16;
+            } else {
+                uint32_t adj = cp - 0x10000;
+                accum = (accum << 16) | (0xD800 + (adj >> 10));
+                bits += 16;
+                while (bits >= 6) {
+                    bits -= 6;
+                    if (opos >= outsize) return -1;
+                    out[opos++] = b64[(accum >> bits) & 0x3F];
+                }
+                accum = (accum << 16) | (0xDC00 + (adj & 0x3FF));
+                bits += 16;
+            }
+            while (bits >= 6) {
+                bits -= 6;
+                if (opos >= outsize) return -1;
+                out[opos++] = b64[(accum >> bits) & 0x3F];
+            }
+            i += consumed;
+            continue;
+        }
+
         if (consumed == 0) consumed = 1;
         if (cp == 0xFFFFFFFF) { i += consumed; continue; }
 
@@ -1127,67 +1481,39 @@ static int utf7_encode(const unsigned char *in, int inlen,
             /* Encode as base64 block */
             if (opos >= outsize) return -1;
             out[opos++] = '+';
-            /* Collect codepoints for encoding */
-            uint32_t accum = 0;
-            int bits = 0;
-            while (i < inlen) {
-                uint32_t cp2 = charconv_utf8_decode(in + i, inlen - i, &consumed);
-                if (consumed == 0) break;
-                if (cp2 >= 0x20 && cp2 <= 0x7E && cp2 != '+') break;
-
-                /* Encode as UTF-16 */
-                if (cp2 < 0x10000) {
-                    accum = (accum << 16) | cp2;
-                    bits += 16;
-                } else {
-                    uint32_t adj = cp2 - 0x10000;
-                    accum = (accum << 16) | (0xD800 + (adj >> 10));
-                    bits += 16;
-                    while (bits >= 6) {
-                        bits -= 6;
-                        if (opos >= outsize) return -1;
-                        out[opos++] = b64[(accum >> bits) & 0x3F];
-                    }
-                    accum = (accum << 16) | (0xDC00 + (adj & 0x3FF));
-                    bits += 16;
-                }
-                while (bits >= 6) {
-                    bits -= 6;
-                    if (opos >= outsize) return -1;
-                    out[opos++] = b64[(accum >> bits) & 0x3F];
-                }
-                i += consumed;
-            }
-            /* Flush remaining bits */
-            if (bits > 0) {
-                if (opos >= outsize) return -1;
-                out[opos++] = b64[(accum << (6 - bits)) & 0x3F];
-            }
-            /* Add terminating - only if next char could be confused with base64 */
-            if (i < inlen) {
-                int nc;
-                charconv_utf8_decode(in + i, inlen - i, &nc);
-                unsigned char c = in[i];
-                int is_b64 = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
-                             (c >= '0' && c <= '9') || c == '+' || c == '/' || c == '-';
-                if (is_b64) {
-                    if (opos >= outsize) return -1;
-                    out[opos++] = '-';
-                }
-            }
+            accum = 0;
+            bits = 0;
+            in_run = 1;
+        }
+    }
+    if (in_run && chunk_final(st)) {
+        /* Flush remaining bits */
+        if (bits > 0) {
+            if (opos >= outsize) return -1;
+            out[opos++] = b64[(accum << (6 - bits)) & 0x3F];
         }
+        in_run = 0;
+    }
+    if (st) {
+        st->mode = in_run;
+        st->accum = accum;
+        st->bits = bits;
+        st->consumed = i;
     }
     return opos;
 }
 
 /* ===== CESU-8 decode ===== */
-static int cesu8_decode(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int cesu8_decode_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 6);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         /* Check for CESU-8 surrogate pair: ED Ax xx ED Bx xx */
         if (i + 5 < inlen && in[i] == 0xED &&
             (in[i+1] & 0xF0) == 0xA0 && (in[i+2] & 0xC0) == 0x80 &&
@@ -1210,12 +1536,7 @@ static int cesu8_decode(const unsigned char *in, int inlen,
         uint32_t cp = charconv_utf8_decode(in + i, inlen - i, &consumed);
         if (cp == 0xFFFFFFFF) {
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, in[i], strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, in[i], out, &opos, outsize) < 0) return -1;
             if (consumed == 0) consumed = 1;
             i += consumed;
         } else {
@@ -1225,19 +1546,29 @@ static int cesu8_decode(const unsigned char *in, int inlen,
             i += consumed;
         }
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int cesu8_decode(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_DS(cesu8_decode_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* CESU-8 encode */
 static int cesu8_encode(const unsigned char *in, int inlen,
     unsigned char *out, int outsize,
     int strategy __attribute__((unused)),
-    int *had_errors)
+    int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 4);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         int consumed;
         uint32_t cp = charconv_utf8_decode(in + i, inlen - i, &consumed);
         if (consumed == 0) consumed = 1;
@@ -1265,6 +1596,7 @@ static int cesu8_encode(const unsigned char *in, int inlen,
         }
         i += consumed;
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
@@ -1281,13 +1613,16 @@ static int cjk_encode_lookup(const struct cjk_encode_entry *table, int size, uin
 }
 
 /* ===== Shift_JIS decode ===== */
-static int shiftjis_decode(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int shiftjis_decode_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 2);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         unsigned char b = in[i];
         if (b <= 0x7F) {
             /* ASCII (with WHATWG overrides) */
@@ -1313,24 +1648,14 @@ static int shiftjis_decode(const unsigned char *in, int inlen,
             /* Lead byte */
             if (i + 1 >= inlen) {
                 *had_errors = 1;
-                char strbuf[32];
-                int slen = apply_decode_strategy(strategy, b, strbuf);
-                if (slen < 0) return -1;
-                if (opos + slen > outsize) return -1;
-                memcpy(out + opos, strbuf, slen);
-                opos += slen;
+                if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
                 i++;
                 continue;
             }
             unsigned char trail = in[i + 1];
             if (trail < 0x40 || trail == 0x7F || trail > 0xFC) {
                 *had_errors = 1;
-                char strbuf[32];
-                int slen = apply_decode_strategy(strategy, b, strbuf);
-                if (slen < 0) return -1;
-                if (opos + slen > outsize) return -1;
-                memcpy(out + opos, strbuf, slen);
-                opos += slen;
+                if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
                 i++;
                 continue;
             }
@@ -1353,35 +1678,36 @@ static int shiftjis_decode(const unsigned char *in, int inlen,
             }
             /* Unmapped */
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, b, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
             i++;
         } else {
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, b, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
             i++;
         }
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int shiftjis_decode(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_DS(shiftjis_decode_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* Shift_JIS encode */
-static int shiftjis_encode(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int shiftjis_encode_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 4);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         int consumed;
         uint32_t cp = charconv_utf8_decode(in + i, inlen - i, &consumed);
         if (consumed == 0) consumed = 1;
@@ -1423,25 +1749,31 @@ static int shiftjis_encode(const unsigned char *in, int inlen,
 
         /* Unmappable */
         *had_errors = 1;
-        char strbuf[64];
-        int slen = apply_encode_strategy(strategy, cp, in + i, consumed, strbuf);
-        if (slen < 0) return -1;
-        if (opos + slen > outsize) return -1;
-        memcpy(out + opos, strbuf, slen);
-        opos += slen;
+        if (put_encode_error(strategy, cp, in + i, consumed, out, &opos, outsize) < 0) return -1;
         i += consumed;
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int shiftjis_encode(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_ES(shiftjis_encode_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* ===== EUC-JP decode ===== */
-static int eucjp_decode(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int eucjp_decode_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 3);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         unsigned char b = in[i];
         if (b <= 0x7F) {
             if (opos >= outsize) return -1;
@@ -1459,12 +1791,7 @@ static int eucjp_decode(const unsigned char *in, int inlen,
                 i += 2;
             } else {
                 *had_errors = 1;
-                char strbuf[32];
-                int slen = apply_decode_strategy(strategy, b, strbuf);
-                if (slen < 0) return -1;
-                if (opos + slen > outsize) return -1;
-                memcpy(out + opos, strbuf, slen);
-                opos += slen;
+                if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
                 i++;
             }
         } else if (b == 0x8F) {
@@ -1484,12 +1811,7 @@ static int eucjp_decode(const unsigned char *in, int inlen,
                 }
             }
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, b, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
             i++;
         } else if (b >= 0xA1 && b <= 0xFE) {
             /* JIS X 0208 */
@@ -1507,35 +1829,36 @@ static int eucjp_decode(const unsigned char *in, int inlen,
                 }
             }
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, b, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
             i++;
         } else {
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, b, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
             i++;
         }
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int eucjp_decode(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_DS(eucjp_decode_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* EUC-JP encode */
-static int eucjp_encode(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int eucjp_encode_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 4);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         int consumed;
         uint32_t cp = charconv_utf8_decode(in + i, inlen - i, &consumed);
         if (consumed == 0) consumed = 1;
@@ -1579,26 +1902,32 @@ static int eucjp_encode(const unsigned char *in, int inlen,
         }
 
         *had_errors = 1;
-        char strbuf[64];
-        int slen = apply_encode_strategy(strategy, cp, in + i, consumed, strbuf);
-        if (slen < 0) return -1;
-        if (opos + slen > outsize) return -1;
-        memcpy(out + opos, strbuf, slen);
-        opos += slen;
+        if (put_encode_error(strategy, cp, in + i, consumed, out, &opos, outsize) < 0) return -1;
         i += consumed;
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int eucjp_encode(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_ES(eucjp_encode_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* ===== ISO-2022-JP decode ===== */
-static int iso2022jp_decode(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int iso2022jp_decode_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
-    int mode = 0; /* 0=ASCII, 1=JIS_Roman, 2=JIS0208 */
+    int mode = st ? st->mode : 0; /* 0=ASCII, 1=JIS_Roman, 2=JIS0208 */
+    int end = chunk_end(st, inlen, 3);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         if (in[i] == 0x1B) {
             /* Escape sequence */
             if (i + 2 < inlen) {
@@ -1608,12 +1937,7 @@ static int iso2022jp_decode(const unsigned char *in, int inlen,
                 if (in[i+1] == '$' && in[i+2] == 'B') { mode = 2; i += 3; continue; }
             }
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, in[i], strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, in[i], out, &opos, outsize) < 0) return -1;
             i++;
             continue;
         }
@@ -1635,12 +1959,7 @@ static int iso2022jp_decode(const unsigned char *in, int inlen,
                 }
             }
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, in[i], strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, in[i], out, &opos, outsize) < 0) return -1;
             i++;
         } else {
             /* ASCII or JIS Roman */
@@ -1648,12 +1967,7 @@ static int iso2022jp_decode(const unsigned char *in, int inlen,
                 /* Bytes >= 0x80 are not valid in ISO-2022-JP.
                  * Use 0xFF as error byte to match encoding_rs behavior. */
                 *had_errors = 1;
-                char strbuf[32];
-                int slen = apply_decode_strategy(strategy, 0xFF, strbuf);
-                if (slen < 0) return -1;
-                if (opos + slen > outsize) return -1;
-                memcpy(out + opos, strbuf, slen);
-                opos += slen;
+                if (put_decode_error(strategy, 0xFF, out, &opos, outsize) < 0) return -1;
                 i++;
             } else {
                 uint32_t cp = in[i];
@@ -1670,18 +1984,32 @@ static int iso2022jp_decode(const unsigned char *in, int inlen,
             }
         }
     }
+    if (st) {
+        st->mode = mode;
+        st->consumed = i;
+    }
     return opos;
 }
 
+static int iso2022jp_decode(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_DS(iso2022jp_decode_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* ISO-2022-JP encode */
-static int iso2022jp_encode(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int iso2022jp_encode_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
-    int mode = 0; /* 0=ASCII, 2=JIS0208 */
+    int mode = st ? st->mode : 0; /* 0=ASCII, 2=JIS0208 */
+    int end = chunk_end(st, inlen, 4);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         int consumed;
         uint32_t cp = charconv_utf8_decode(in + i, inlen - i, &consumed);
         if (consumed == 0) consumed = 1;
@@ -1719,30 +2047,40 @@ static int iso2022jp_encode(const unsigned char *in, int inlen,
             out[opos++] = 0x1B; out[opos++] = '('; out[opos++] = 'B';
             mode = 0;
         }
-        char strbuf[64];
-        int slen = apply_encode_strategy(strategy, cp, in + i, consumed, strbuf);
-        if (slen < 0) return -1;
-        if (opos + slen > outsize) return -1;
-        memcpy(out + opos, strbuf, slen);
-        opos += slen;
+        if (put_encode_error(strategy, cp, in + i, consumed, out, &opos, outsize) < 0) return -1;
         i += consumed;
     }
     /* Return to ASCII at end */
-    if (mode != 0) {
+    if (mode != 0 && chunk_final(st)) {
         if (opos + 3 > outsize) return -1;
         out[opos++] = 0x1B; out[opos++] = '('; out[opos++] = 'B';
+        mode = 0;
+    }
+    if (st) {
+        st->mode = mode;
+        st->consumed = i;
     }
     return opos;
 }
 
+static int iso2022jp_encode(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_ES(iso2022jp_encode_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* ===== GBK decode ===== */
-static int gbk_decode_fn(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int gbk_decode_fn_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 2);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         unsigned char b = in[i];
         if (b <= 0x7F) {
             if (opos >= outsize) return -1;
@@ -1751,12 +2089,7 @@ static int gbk_decode_fn(const unsigned char *in, int inlen,
         } else if (b >= 0x81 && b <= 0xFE) {
             if (i + 1 >= inlen) {
                 *had_errors = 1;
-                char strbuf[32];
-                int slen = apply_decode_strategy(strategy, b, strbuf);
-                if (slen < 0) return -1;
-                if (opos + slen > outsize) return -1;
-                memcpy(out + opos, strbuf, slen);
-                opos += slen;
+                if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
                 i++; continue;
             }
             unsigned char trail = in[i+1];
@@ -1774,35 +2107,36 @@ static int gbk_decode_fn(const unsigned char *in, int inlen,
                 }
             }
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, b, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
             i++;
         } else {
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, b, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
             i++;
         }
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int gbk_decode_fn(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_DS(gbk_decode_fn_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* GBK encode */
-static int gbk_encode_fn(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int gbk_encode_fn_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 4);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         int consumed;
         uint32_t cp = charconv_utf8_decode(in + i, inlen - i, &consumed);
         if (consumed == 0) consumed = 1;
@@ -1826,44 +2160,62 @@ static int gbk_encode_fn(const unsigned char *in, int inlen,
         }
 
         *had_errors = 1;
-        char strbuf[64];
-        int slen = apply_encode_strategy(strategy, cp, in + i, consumed, strbuf);
-        if (slen < 0) return -1;
-        if (opos + slen > outsize) return -1;
-        memcpy(out + opos, strbuf, slen);
-        opos += slen;
+        if (put_encode_error(strategy, cp, in + i, consumed, out, &opos, outsize) < 0) return -1;
         i += consumed;
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int gbk_encode_fn(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_ES(gbk_encode_fn_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* ===== GB18030 decode (GBK + four-byte sequences) ===== */
+/* Map x through the linear blocks / detail rows of a gb18030 direct index */
+static inline uint32_t gb18030_index(const uint32_t *block, const uint16_t *detail, uint32_t x) {
+    uint32_t v = block[x >> GB18030_BLOCK_SHIFT];
+    uint32_t low = x & ((1u << GB18030_BLOCK_SHIFT) - 1);
+    if (v & GB18030_MIXED)
+        return detail[((v & ~GB18030_MIXED) << GB18030_BLOCK_SHIFT) + low];
+    return v + low;
+}
+
+/* Past the index only the last two ranges apply: the BMP tail and the supplementary planes */
+static inline const struct gb18030_range *gb18030_tail_range(int last) {
+    return &gb18030_ranges[GB18030_RANGES_SIZE - (last ? 1 : 2)];
+}
+
 static uint32_t gb18030_ranges_lookup(uint32_t pointer) {
-    /* Binary search in ranges for the codepoint */
-    int lo = 0, hi = GB18030_RANGES_SIZE - 1;
-    while (lo <= hi) {
-        int mid = (lo + hi) / 2;
-        if (mid + 1 < GB18030_RANGES_SIZE && pointer >= gb18030_ranges[mid].pointer &&
-            pointer < gb18030_ranges[mid + 1].pointer) {
-            return gb18030_ranges[mid].codepoint + (pointer - gb18030_ranges[mid].pointer);
-        }
-        if (pointer < gb18030_ranges[mid].pointer) hi = mid - 1;
-        else lo = mid + 1;
-    }
-    /* Check last range */
-    if (hi >= 0 && pointer >= gb18030_ranges[hi].pointer) {
-        return gb18030_ranges[hi].codepoint + (pointer - gb18030_ranges[hi].pointer);
-    }
-    return 0xFFFFFFFF;
+    if (pointer < GB18030_PTR_LIMIT)
+        return gb18030_index(gb18030_ptr_block, gb18030_ptr_detail, pointer);
+    const struct gb18030_range *r =
+        gb18030_tail_range(pointer >= gb18030_ranges[GB18030_RANGES_SIZE - 1].pointer);
+    return r->codepoint + (pointer - r->pointer);
 }
 
-static int gb18030_decode_fn(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+/* Four-byte pointer for cp (> 0x7F) */
+static uint32_t gb18030_ranges_pointer(uint32_t cp) {
+    if (cp < GB18030_CP_LIMIT)
+        return gb18030_index(gb18030_cp_block, gb18030_cp_detail, cp);
+    const struct gb18030_range *r =
+        gb18030_tail_range(cp >= gb18030_ranges[GB18030_RANGES_SIZE - 1].codepoint);
+    return r->pointer + (cp - r->codepoint);
+}
+
+STRATEGY_BODY int gb18030_decode_fn_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 4);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         unsigned char b = in[i];
         if (b <= 0x7F) {
             if (opos >= outsize) return -1;
@@ -1906,35 +2258,36 @@ static int gb18030_decode_fn(const unsigned char *in, int inlen,
                 }
             }
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, b, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
             i++;
         } else {
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, b, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
             i++;
         }
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int gb18030_decode_fn(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_DS(gb18030_decode_fn_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* GB18030 encode */
-static int gb18030_encode_fn(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int gb18030_encode_fn_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 4);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         int consumed;
         uint32_t cp = charconv_utf8_decode(in + i, inlen - i, &consumed);
         if (consumed == 0) consumed = 1;
@@ -1958,47 +2311,41 @@ static int gb18030_encode_fn(const unsigned char *in, int inlen,
             i += consumed; continue;
         }
 
-        /* Try four-byte (ranges) */
-        int found = 0;
-        for (int r = GB18030_RANGES_SIZE - 1; r >= 0; r--) {
-            if (cp >= gb18030_ranges[r].codepoint) {
-                uint32_t offset = cp - gb18030_ranges[r].codepoint;
-                uint32_t ptr = gb18030_ranges[r].pointer + offset;
-                int b4 = ptr % 10; ptr /= 10;
-                int b3 = ptr % 126; ptr /= 126;
-                int b2 = ptr % 10; ptr /= 10;
-                int b1 = ptr;
-                if (opos + 4 > outsize) return -1;
-                out[opos++] = (unsigned char)(b1 + 0x81);
-                out[opos++] = (unsigned char)(b2 + 0x30);
-                out[opos++] = (unsigned char)(b3 + 0x81);
-                out[opos++] = (unsigned char)(b4 + 0x30);
-                found = 1;
-                break;
-            }
-        }
-        if (found) { i += consumed; continue; }
-
-        *had_errors = 1;
-        char strbuf[64];
-        int slen = apply_encode_strategy(strategy, cp, in + i, consumed, strbuf);
-        if (slen < 0) return -1;
-        if (opos + slen > outsize) return -1;
-        memcpy(out + opos, strbuf, slen);
-        opos += slen;
+        /* Four-byte (ranges) */
+        uint32_t ptr = gb18030_ranges_pointer(cp);
+        int b4 = ptr % 10; ptr /= 10;
+        int b3 = ptr % 126; ptr /= 126;
+        int b2 = ptr % 10; ptr /= 10;
+        int b1 = ptr;
+        if (opos + 4 > outsize) return -1;
+        out[opos++] = (unsigned char)(b1 + 0x81);
+        out[opos++] = (unsigned char)(b2 + 0x30);
+        out[opos++] = (unsigned char)(b3 + 0x81);
+        out[opos++] = (unsigned char)(b4 + 0x30);
         i += consumed;
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int gb18030_encode_fn(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_ES(gb18030_encode_fn_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* ===== Big5 decode ===== */
-static int big5_decode_fn(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int big5_decode_fn_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 2);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         unsigned char b = in[i];
         if (b <= 0x7F) {
             if (opos >= outsize) return -1;
@@ -2007,12 +2354,7 @@ static int big5_decode_fn(const unsigned char *in, int inlen,
         } else if (b >= 0x81 && b <= 0xFE) {
             if (i + 1 >= inlen) {
                 *had_errors = 1;
-                char strbuf[32];
-                int slen = apply_decode_strategy(strategy, b, strbuf);
-                if (slen < 0) return -1;
-                if (opos + slen > outsize) return -1;
-                memcpy(out + opos, strbuf, slen);
-                opos += slen;
+                if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
                 i++; continue;
             }
             unsigned char trail = in[i+1];
@@ -2021,6 +2363,8 @@ static int big5_decode_fn(const unsigned char *in, int inlen,
                 int pointer = (b - 0x81) * 157 + trail - offset;
                 if (pointer >= 0 && pointer < BIG5_DECODE_SIZE && big5_decode[pointer] != 0) {
                     uint32_t cp = big5_decode[pointer];
+                    if ((cp & 0xF800) == CJK_DECODE_SUPP)
+                        cp = big5_decode_supp[cp - CJK_DECODE_SUPP];
                     unsigned char buf[4];
                     int n = charconv_utf8_encode(cp, buf);
                     if (opos + n > outsize) return -1;
@@ -2030,35 +2374,36 @@ static int big5_decode_fn(const unsigned char *in, int inlen,
                 }
             }
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, b, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
             i++;
         } else {
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, b, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
             i++;
         }
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int big5_decode_fn(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_DS(big5_decode_fn_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* Big5 encode */
-static int big5_encode_fn(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int big5_encode_fn_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 4);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         int consumed;
         uint32_t cp = charconv_utf8_decode(in + i, inlen - i, &consumed);
         if (consumed == 0) consumed = 1;
@@ -2082,25 +2427,31 @@ static int big5_encode_fn(const unsigned char *in, int inlen,
         }
 
         *had_errors = 1;
-        char strbuf[64];
-        int slen = apply_encode_strategy(strategy, cp, in + i, consumed, strbuf);
-        if (slen < 0) return -1;
-        if (opos + slen > outsize) return -1;
-        memcpy(out + opos, strbuf, slen);
-        opos += slen;
+        if (put_encode_error(strategy, cp, in + i, consumed, out, &opos, outsize) < 0) return -1;
         i += consumed;
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int big5_encode_fn(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_ES(big5_encode_fn_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* ===== EUC-KR decode ===== */
-static int euckr_decode_fn(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int euckr_decode_fn_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 2);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         unsigned char b = in[i];
         if (b <= 0x7F) {
             if (opos >= outsize) return -1;
@@ -2109,12 +2460,7 @@ static int euckr_decode_fn(const unsigned char *in, int inlen,
         } else if (b >= 0x81 && b <= 0xFE) {
             if (i + 1 >= inlen) {
                 *had_errors = 1;
-                char strbuf[32];
-                int slen = apply_decode_strategy(strategy, b, strbuf);
-                if (slen < 0) return -1;
-                if (opos + slen > outsize) return -1;
-                memcpy(out + opos, strbuf, slen);
-                opos += slen;
+                if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
                 i++; continue;
             }
             unsigned char trail = in[i+1];
@@ -2131,35 +2477,36 @@ static int euckr_decode_fn(const unsigned char *in, int inlen,
                 }
             }
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, b, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
             i++;
         } else {
             *had_errors = 1;
-            char strbuf[32];
-            int slen = apply_decode_strategy(strategy, b, strbuf);
-            if (slen < 0) return -1;
-            if (opos + slen > outsize) return -1;
-            memcpy(out + opos, strbuf, slen);
-            opos += slen;
+            if (put_decode_error(strategy, b, out, &opos, outsize) < 0) return -1;
             i++;
         }
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
+static int euckr_decode_fn(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_DS(euckr_decode_fn_s, in, inlen, out, outsize, had_errors, st);
+}
+
 /* EUC-KR encode */
-static int euckr_encode_fn(const unsigned char *in, int inlen,
-    unsigned char *out, int outsize, int strategy, int *had_errors)
+STRATEGY_BODY int euckr_encode_fn_s(int strategy,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int *had_errors,
+    struct charconv_state *st)
 {
     int opos = 0, i = 0;
+    int end = chunk_end(st, inlen, 4);
     *had_errors = 0;
 
-    while (i < inlen) {
+    while (i < end) {
         int consumed;
         uint32_t cp = charconv_utf8_decode(in + i, inlen - i, &consumed);
         if (consumed == 0) consumed = 1;
@@ -2182,105 +2529,187 @@ static int euckr_encode_fn(const unsigned char *in, int inlen,
         }
 
         *had_errors = 1;
-        char strbuf[64];
-        int slen = apply_encode_strategy(strategy, cp, in + i, consumed, strbuf);
-        if (slen < 0) return -1;
-        if (opos + slen > outsize) return -1;
-        memcpy(out + opos, strbuf, slen);
-        opos += slen;
+        if (put_encode_error(strategy, cp, in + i, consumed, out, &opos, outsize) < 0) return -1;
         i += consumed;
     }
+    if (st) st->consumed = i;
     return opos;
 }
 
-/* ===== Main dispatch: charconv_decode ===== */
-int charconv_decode(const struct CharEncoding *enc,
+static int euckr_encode_fn(const unsigned char *in, int inlen,
+    unsigned char *out, int outsize, int strategy, int *had_errors,
+    struct charconv_state *st)
+{
+    SPECIALIZE_ES(euckr_encode_fn_s, in, inlen, out, outsize, had_errors, st);
+}
+
+/* ===== Main dispatch: decode ===== */
+static int decode_dispatch(const struct CharEncoding *enc,
     const unsigned char *in, int inlen,
     unsigned char *out, int outsize,
-    int strategy, int *had_errors)
+    int strategy, int *had_errors, struct charconv_state *st)
 {
     switch (enc->type) {
     case ENC_TYPE_SINGLE_BYTE:
-        return sb_decode(enc, in, inlen, out, outsize, strategy, had_errors);
+        return sb_decode(enc, in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_UTF8:
-        return utf8_decode_conv(in, inlen, out, outsize, strategy, had_errors);
+        return utf8_decode_conv(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_UTF7:
-        return utf7_decode(in, inlen, out, outsize, strategy, had_errors);
+        return utf7_decode(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_UTF16:
-        return utf16_decode_bom(in, inlen, out, outsize, strategy, had_errors);
+        return utf16_decode_bom(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_UTF16BE:
-        return utf16_decode_impl(in, inlen, out, outsize, strategy, had_errors, 1);
+        return utf16_decode_impl(in, inlen, out, outsize, strategy, had_errors, 1, st);
     case ENC_TYPE_UTF16LE:
-        return utf16_decode_impl(in, inlen, out, outsize, strategy, had_errors, 0);
+        return utf16_decode_impl(in, inlen, out, outsize, strategy, had_errors, 0, st);
     case ENC_TYPE_UTF32:
-        return utf32_decode_bom(in, inlen, out, outsize, strategy, had_errors);
+        return utf32_decode_bom(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_UTF32BE:
-        return utf32_decode_impl(in, inlen, out, outsize, strategy, had_errors, 1);
+        return utf32_decode_impl(in, inlen, out, outsize, strategy, had_errors, 1, st);
     case ENC_TYPE_UTF32LE:
-        return utf32_decode_impl(in, inlen, out, outsize, strategy, had_errors, 0);
+        return utf32_decode_impl(in, inlen, out, outsize, strategy, had_errors, 0, st);
     case ENC_TYPE_CESU8:
-        return cesu8_decode(in, inlen, out, outsize, strategy, had_errors);
+        return cesu8_decode(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_SHIFT_JIS:
-        return shiftjis_decode(in, inlen, out, outsize, strategy, had_errors);
+        return shiftjis_decode(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_EUC_JP:
-        return eucjp_decode(in, inlen, out, outsize, strategy, had_errors);
+        return eucjp_decode(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_ISO2022JP:
-        return iso2022jp_decode(in, inlen, out, outsize, strategy, had_errors);
+        return iso2022jp_decode(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_GBK:
-        return gbk_decode_fn(in, inlen, out, outsize, strategy, had_errors);
+        return gbk_decode_fn(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_GB18030:
-        return gb18030_decode_fn(in, inlen, out, outsize, strategy, had_errors);
+        return gb18030_decode_fn(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_BIG5:
-        return big5_decode_fn(in, inlen, out, outsize, strategy, had_errors);
+        return big5_decode_fn(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_EUC_KR:
-        return euckr_decode_fn(in, inlen, out, outsize, strategy, had_errors);
+        return euckr_decode_fn(in, inlen, out, outsize, strategy, had_errors, st);
     default:
         return -1;
     }
 }
 
-/* ===== Main dispatch: charconv_encode ===== */
-int charconv_encode(const struct CharEncoding *enc,
+/* ===== Main dispatch: encode ===== */
+static int encode_dispatch(const struct CharEncoding *enc,
     const unsigned char *in, int inlen,
     unsigned char *out, int outsize,
-    int strategy, int *had_errors)
+    int strategy, int *had_errors, struct charconv_state *st)
 {
     switch (enc->type) {
     case ENC_TYPE_SINGLE_BYTE:
-        return sb_encode(enc, in, inlen, out, outsize, strategy, had_errors);
+        return sb_encode(enc, in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_UTF8:
-        return utf8_encode_conv(in, inlen, out, outsize, strategy, had_errors);
+        return utf8_encode_conv(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_UTF7:
-        return utf7_encode(in, inlen, out, outsize, strategy, had_errors);
+        return utf7_encode(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_UTF16:
-        return utf16_encode_bom(in, inlen, out, outsize, strategy, had_errors);
+        return utf16_encode_bom(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_UTF16BE:
-        return utf16_encode_impl(in, inlen, out, outsize, strategy, had_errors, 1);
+        return utf16_encode_impl(in, inlen, out, outsize, strategy, had_errors, 1, st);
     case ENC_TYPE_UTF16LE:
-        return utf16_encode_impl(in, inlen, out, outsize, strategy, had_errors, 0);
+        return utf16_encode_impl(in, inlen, out, outsize, strategy, had_errors, 0, st);
     case ENC_TYPE_UTF32:
-        return utf32_encode_bom(in, inlen, out, outsize, strategy, had_errors);
+        return utf32_encode_bom(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_UTF32BE:
-        return utf32_encode_impl(in, inlen, out, outsize, strategy, had_errors, 1);
+        return utf32_encode_impl(in, inlen, out, outsize, strategy, had_errors, 1, st);
     case ENC_TYPE_UTF32LE:
-        return utf32_encode_impl(in, inlen, out, outsize, strategy, had_errors, 0);
+        return utf32_encode_impl(in, inlen, out, outsize, strategy, had_errors, 0, st);
     case ENC_TYPE_CESU8:
-        return cesu8_encode(in, inlen, out, outsize, strategy, had_errors);
+        return cesu8_encode(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_SHIFT_JIS:
-        return shiftjis_encode(in, inlen, out, outsize, strategy, had_errors);
+        return shiftjis_encode(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_EUC_JP:
-        return eucjp_encode(in, inlen, out, outsize, strategy, had_errors);
+        return eucjp_encode(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_ISO2022JP:
-        return iso2022jp_encode(in, inlen, out, outsize, strategy, had_errors);
+        return iso2022jp_encode(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_GBK:
-        return gbk_encode_fn(in, inlen, out, outsize, strategy, had_errors);
+        return gbk_encode_fn(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_GB18030:
-        return gb18030_encode_fn(in, inlen, out, outsize, strategy, had_errors);
+        return gb18030_encode_fn(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_BIG5:
-        return big5_encode_fn(in, inlen, out, outsize, strategy, had_errors);
+        return big5_encode_fn(in, inlen, out, outsize, strategy, had_errors, st);
     case ENC_TYPE_EUC_KR:
-        return euckr_encode_fn(in, inlen, out, outsize, strategy, had_errors);
+        return euckr_encode_fn(in, inlen, out, outsize, strategy, had_errors, st);
     default:
         return -1;
     }
 }
+
+int charconv_decode(const struct CharEncoding *enc,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize,
+    int strategy, int *had_errors)
+{
+    return decode_dispatch(enc, in, inlen, out, outsize, strategy, had_errors, NULL);
+}
+
+int charconv_encode(const struct CharEncoding *enc,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize,
+    int strategy, int *had_errors)
+{
+    return encode_dispatch(enc, in, inlen, out, outsize, strategy, had_errors, NULL);
+}
+
+/* ===== Chunked conversion ===== */
+void charconv_state_init(struct charconv_state *st) {
+    memset(st, 0, sizeof(*st));
+}
+
+static int chunk_convert(const struct CharEncoding *enc, struct charconv_state *st,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize,
+    int strategy, int *had_errors, int encode)
+{
+    int final = st->final;
+    int opos = 0, err, n;
+
+    if (st->carrylen > 0) {
+        /* Finish the carried sequence using the head of this chunk */
+        unsigned char bridge[2 * CHARCONV_CARRY_MAX];
+        int take = inlen < CHARCONV_CARRY_MAX ? inlen : CHARCONV_CARRY_MAX;
+        int blen = st->carrylen + take;
+        memcpy(bridge, st->carry, st->carrylen);
+        memcpy(bridge + st->carrylen, in, take);
+        st->final = final && take == inlen;
+        n = encode ? encode_dispatch(enc, bridge, blen, out, outsize, strategy, &err, st)
+                   : decode_dispatch(enc, bridge, blen, out, outsize, strategy, &err, st);
+        st->final = final;
+        if (n < 0) return -1;
+        if (err) *had_errors = 1;
+        opos = n;
+        if (st->consumed < st->carrylen || take == inlen) {
+            /* Whole chunk went into the bridge */
+            st->carrylen = blen - st->consumed;
+            memmove(st->carry, bridge + st->consumed, st->carrylen);
+            return opos;
+        }
+        in += st->consumed - st->carrylen;
+        inlen -= st->consumed - st->carrylen;
+        st->carrylen = 0;
+    }
+
+    n = encode ? encode_dispatch(enc, in, inlen, out + opos, outsize - opos, strategy, &err, st)
+               : decode_dispatch(enc, in, inlen, out + opos, outsize - opos, strategy, &err, st);
+    if (n < 0) return -1;
+    if (err) *had_errors = 1;
+    st->carrylen = inlen - st->consumed;
+    memcpy(st->carry, in + st->consumed, st->carrylen);
+    return opos + n;
+}
+
+int charconv_decode_chunk(const struct CharEncoding *enc, struct charconv_state *st,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize,
+    int strategy, int *had_errors)
+{
+    return chunk_convert(enc, st, in, inlen, out, outsize, strategy, had_errors, 0);
+}
+
+int charconv_encode_chunk(const struct CharEncoding *enc, struct charconv_state *st,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize,
+    int strategy, int *had_errors)
+{
+    return chunk_convert(enc, st, in, inlen, out, outsize, strategy, had_errors, 1);
+}
@@ -97,8 +97,8 @@ struct sb_reverse_entry {
 struct CharEncoding {
     const char *name;
     int type;                              /* ENC_TYPE_* */
-    const uint32_t *to_unicode;            /* [256] for single-byte, NULL otherwise */
-    struct sb_reverse_entry *reverse_map;   /* Built at init for single-byte encode */
+    const uint16_t *to_unicode;            /* [256] for single-byte, NULL otherwise */
+    const struct sb_reverse_entry *reverse_map; /* Sorted by codepoint; NULL: see charconv_init_reverse_maps */
     int reverse_map_size;                  /* Number of entries in reverse map */
     int is_ascii_compatible;
 };
@@ -123,13 +123,61 @@ int charconv_encode(const struct CharEncoding *enc,
     unsigned char *out, int outsize,
     int strategy, int *had_errors);
 
+/* ===== Chunked conversion ===== */
+#define CHARCONV_CARRY_MAX 16
+
+/*
+ * State for converting one logical string in pieces. Carries incomplete
+ * multibyte sequences, the ISO-2022-JP charset, UTF-7 base64 bits and the
+ * UTF-16/32 byte order from the BOM between calls.
+ */
+struct charconv_state {
+    int final;              /* caller: set before passing the last chunk */
+    int consumed;           /* input bytes used by the last converter call */
+    int started;            /* BOM read (decode) or written (encode) */
+    int big_endian;
+    int mode;               /* ISO-2022-JP charset, UTF-7 in base64 */
+    uint32_t accum;         /* UTF-7 pending bits */
+    int bits;
+    unsigned char carry[CHARCONV_CARRY_MAX];
+    int carrylen;
+};
+
+void charconv_state_init(struct charconv_state *st);
+
 /*
- * Build reverse maps for all single-byte encodings (call once at startup).
+ * Chunked decode/encode: same as charconv_decode/encode on the
+ * concatenation of all chunks. A trailing incomplete sequence is held in
+ * the state and converted with the next chunk; set st->final on the last
+ * one (it may be empty). *had_errors is set, never cleared, so it covers
+ * the whole string. Returns output length for this chunk, or -1.
+ */
+int charconv_decode_chunk(const struct CharEncoding *enc, struct charconv_state *st,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize,
+    int strategy, int *had_errors);
+
+int charconv_encode_chunk(const struct CharEncoding *enc, struct charconv_state *st,
+    const unsigned char *in, int inlen,
+    unsigned char *out, int outsize,
+    int strategy, int *had_errors);
+
+/*
+ * Build reverse maps for single-byte encodings that have none
+ * (reverse_map NULL). The built-in tables in sb_tables.c come with
+ * generated NAME_from_unicode maps, so only custom tables need this.
  * encodings: array of CharEncoding structs
  * count: number of encodings
  */
 void charconv_init_reverse_maps(struct CharEncoding *encodings, int count);
 
+/*
+ * Text encode strategy writes in place of code point cp when the target
+ * encoding can't represent it (at most 64 bytes).
+ * Returns its length, or -1 for ES_STRICT.
+ */
+int charconv_encode_error(int strategy, uint32_t cp, char *out);
+
 /*
  * Check if byte sequence is valid UTF-8.
  * Returns 1 if valid, 0 if not.
@@ -4,8 +4,9 @@
  * Each encoding entry embeds a CharEncoding struct (for charconv API)
  * plus aliases and runtime availability flag.
  *
- * Single-byte tables are in sb_tables.h (auto-generated from Rust source).
- * CJK tables are in cjk_data.h (auto-generated from WHATWG indexes).
+ * Single-byte tables are in sb_tables.c (auto-generated from Rust source).
+ * CJK tables are in cjk_data.c (auto-generated from WHATWG indexes).
+ * Both are compiled once and declared extern by their headers.
  */
 
 #ifndef ENC_TABLES_H
@@ -32,199 +33,199 @@ struct Encoding {
 
 static struct Encoding encodings[] = {
     /* === 1. ASCII === */
-    { {"ASCII", ENC_TYPE_SINGLE_BYTE, ascii_to_unicode, NULL, 0, 1},
+    { {"ASCII", ENC_TYPE_SINGLE_BYTE, ascii_to_unicode, ascii_from_unicode, ASCII_FROM_UNICODE_SIZE, 1},
       {"US-ASCII", "ANSI_X3.4-1968", "iso-ir-6", "csASCII", "us-ascii", "646", NULL}, 0 },
 
     /* === 2-16. ISO 8859 family === */
-    { {"ISO-8859-1", ENC_TYPE_SINGLE_BYTE, iso_8859_1_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-1", ENC_TYPE_SINGLE_BYTE, iso_8859_1_to_unicode, iso_8859_1_from_unicode, ISO_8859_1_FROM_UNICODE_SIZE, 1},
       {"Latin-1", "latin1", "iso-ir-100", "csISOLatin1", "l1", "IBM819", "iso88591", NULL}, 0 },
-    { {"ISO-8859-2", ENC_TYPE_SINGLE_BYTE, iso_8859_2_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-2", ENC_TYPE_SINGLE_BYTE, iso_8859_2_to_unicode, iso_8859_2_from_unicode, ISO_8859_2_FROM_UNICODE_SIZE, 1},
       {"Latin-2", "latin2", "iso-ir-101", "csISOLatin2", "l2", "iso88592", NULL}, 0 },
-    { {"ISO-8859-3", ENC_TYPE_SINGLE_BYTE, iso_8859_3_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-3", ENC_TYPE_SINGLE_BYTE, iso_8859_3_to_unicode, iso_8859_3_from_unicode, ISO_8859_3_FROM_UNICODE_SIZE, 1},
       {"Latin-3", "latin3", "iso-ir-109", "csISOLatin3", "l3", "iso88593", NULL}, 0 },
-    { {"ISO-8859-4", ENC_TYPE_SINGLE_BYTE, iso_8859_4_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-4", ENC_TYPE_SINGLE_BYTE, iso_8859_4_to_unicode, iso_8859_4_from_unicode, ISO_8859_4_FROM_UNICODE_SIZE, 1},
       {"Latin-4", "latin4", "iso-ir-110", "csISOLatin4", "l4", "iso88594", NULL}, 0 },
-    { {"ISO-8859-5", ENC_TYPE_SINGLE_BYTE, iso_8859_5_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-5", ENC_TYPE_SINGLE_BYTE, iso_8859_5_to_unicode, iso_8859_5_from_unicode, ISO_8859_5_FROM_UNICODE_SIZE, 1},
       {"Cyrillic", "iso-ir-144", "csISOLatinCyrillic", "iso88595", NULL}, 0 },
-    { {"ISO-8859-6", ENC_TYPE_SINGLE_BYTE, iso_8859_6_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-6", ENC_TYPE_SINGLE_BYTE, iso_8859_6_to_unicode, iso_8859_6_from_unicode, ISO_8859_6_FROM_UNICODE_SIZE, 1},
       {"Arabic", "iso-ir-127", "csISOLatinArabic", "ECMA-114", "ASMO-708", "iso88596", NULL}, 0 },
-    { {"ISO-8859-7", ENC_TYPE_SINGLE_BYTE, iso_8859_7_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-7", ENC_TYPE_SINGLE_BYTE, iso_8859_7_to_unicode, iso_8859_7_from_unicode, ISO_8859_7_FROM_UNICODE_SIZE, 1},
       {"Greek", "iso-ir-126", "csISOLatinGreek", "ECMA-118", "ELOT_928", "iso88597", NULL}, 0 },
-    { {"ISO-8859-8", ENC_TYPE_SINGLE_BYTE, iso_8859_8_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-8", ENC_TYPE_SINGLE_BYTE, iso_8859_8_to_unicode, iso_8859_8_from_unicode, ISO_8859_8_FROM_UNICODE_SIZE, 1},
       {"Hebrew", "iso-ir-138", "csISOLatinHebrew", "iso88598", NULL}, 0 },
-    { {"ISO-8859-9", ENC_TYPE_SINGLE_BYTE, iso_8859_9_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-9", ENC_TYPE_SINGLE_BYTE, iso_8859_9_to_unicode, iso_8859_9_from_unicode, ISO_8859_9_FROM_UNICODE_SIZE, 1},
       {"Latin-5", "latin5", "iso-ir-148", "csISOLatin5", "l5", "Turkish", "iso88599", NULL}, 0 },
-    { {"ISO-8859-10", ENC_TYPE_SINGLE_BYTE, iso_8859_10_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-10", ENC_TYPE_SINGLE_BYTE, iso_8859_10_to_unicode, iso_8859_10_from_unicode, ISO_8859_10_FROM_UNICODE_SIZE, 1},
       {"Latin-6", "latin6", "iso-ir-157", "csISOLatin6", "l6", "Nordic", "iso885910", NULL}, 0 },
-    { {"ISO-8859-11", ENC_TYPE_SINGLE_BYTE, iso_8859_11_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-11", ENC_TYPE_SINGLE_BYTE, iso_8859_11_to_unicode, iso_8859_11_from_unicode, ISO_8859_11_FROM_UNICODE_SIZE, 1},
       {"Thai", "TIS-620", "windows-874", "CP874", "iso885911", NULL}, 0 },
-    { {"ISO-8859-13", ENC_TYPE_SINGLE_BYTE, iso_8859_13_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-13", ENC_TYPE_SINGLE_BYTE, iso_8859_13_to_unicode, iso_8859_13_from_unicode, ISO_8859_13_FROM_UNICODE_SIZE, 1},
       {"Latin-7", "latin7", "Baltic", "iso885913", NULL}, 0 },
-    { {"ISO-8859-14", ENC_TYPE_SINGLE_BYTE, iso_8859_14_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-14", ENC_TYPE_SINGLE_BYTE, iso_8859_14_to_unicode, iso_8859_14_from_unicode, ISO_8859_14_FROM_UNICODE_SIZE, 1},
       {"Latin-8", "latin8", "iso-ir-199", "Celtic", "iso-celtic", "iso885914", NULL}, 0 },
-    { {"ISO-8859-15", ENC_TYPE_SINGLE_BYTE, iso_8859_15_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-15", ENC_TYPE_SINGLE_BYTE, iso_8859_15_to_unicode, iso_8859_15_from_unicode, ISO_8859_15_FROM_UNICODE_SIZE, 1},
       {"Latin-9", "latin9", "latin0", "iso-ir-203", "csISOLatin9", "iso885915", NULL}, 0 },
-    { {"ISO-8859-16", ENC_TYPE_SINGLE_BYTE, iso_8859_16_to_unicode, NULL, 0, 1},
+    { {"ISO-8859-16", ENC_TYPE_SINGLE_BYTE, iso_8859_16_to_unicode, iso_8859_16_from_unicode, ISO_8859_16_FROM_UNICODE_SIZE, 1},
       {"Latin-10", "latin10", "iso-ir-226", "Romanian", "iso885916", NULL}, 0 },
 
     /* === 17-25. Windows code pages === */
-    { {"Windows-1250", ENC_TYPE_SINGLE_BYTE, windows_1250_to_unicode, NULL, 0, 1},
+    { {"Windows-1250", ENC_TYPE_SINGLE_BYTE, windows_1250_to_unicode, windows_1250_from_unicode, WINDOWS_1250_FROM_UNICODE_SIZE, 1},
       {"CP1250", "cp1250", "x-cp1250", "win1250", "windows1250", NULL}, 0 },
-    { {"Windows-1251", ENC_TYPE_SINGLE_BYTE, windows_1251_to_unicode, NULL, 0, 1},
+    { {"Windows-1251", ENC_TYPE_SINGLE_BYTE, windows_1251_to_unicode, windows_1251_from_unicode, WINDOWS_1251_FROM_UNICODE_SIZE, 1},
       {"CP1251", "cp1251", "x-cp1251", "win1251", "windows1251", NULL}, 0 },
-    { {"Windows-1252", ENC_TYPE_SINGLE_BYTE, windows_1252_to_unicode, NULL, 0, 1},
+    { {"Windows-1252", ENC_TYPE_SINGLE_BYTE, windows_1252_to_unicode, windows_1252_from_unicode, WINDOWS_1252_FROM_UNICODE_SIZE, 1},
       {"CP1252", "cp1252", "x-cp1252", "win1252", "windows1252", NULL}, 0 },
-    { {"Windows-1253", ENC_TYPE_SINGLE_BYTE, windows_1253_to_unicode, NULL, 0, 1},
+    { {"Windows-1253", ENC_TYPE_SINGLE_BYTE, windows_1253_to_unicode, windows_1253_from_unicode, WINDOWS_1253_FROM_UNICODE_SIZE, 1},
       {"CP1253", "cp1253", "x-cp1253", "win1253", "windows1253", NULL}, 0 },
-    { {"Windows-1254", ENC_TYPE_SINGLE_BYTE, windows_1254_to_unicode, NULL, 0, 1},
+    { {"Windows-1254", ENC_TYPE_SINGLE_BYTE, windows_1254_to_unicode, windows_1254_from_unicode, WINDOWS_1254_FROM_UNICODE_SIZE, 1},
       {"CP1254", "cp1254", "x-cp1254", "win1254", "windows1254", NULL}, 0 },
-    { {"Windows-1255", ENC_TYPE_SINGLE_BYTE, windows_1255_to_unicode, NULL, 0, 1},
+    { {"Windows-1255", ENC_TYPE_SINGLE_BYTE, windows_1255_to_unicode, windows_1255_from_unicode, WINDOWS_1255_FROM_UNICODE_SIZE, 1},
       {"CP1255", "cp1255", "x-cp1255", "win1255", "windows1255", NULL}, 0 },
-    { {"Windows-1256", ENC_TYPE_SINGLE_BYTE, windows_1256_to_unicode, NULL, 0, 1},
+    { {"Windows-1256", ENC_TYPE_SINGLE_BYTE, windows_1256_to_unicode, windows_1256_from_unicode, WINDOWS_1256_FROM_UNICODE_SIZE, 1},
       {"CP1256", "cp1256", "x-cp1256", "win1256", "windows1256", NULL}, 0 },
-    { {"Windows-1257", ENC_TYPE_SINGLE_BYTE, windows_1257_to_unicode, NULL, 0, 1},
+    { {"Windows-1257", ENC_TYPE_SINGLE_BYTE, windows_1257_to_unicode, windows_1257_from_unicode, WINDOWS_1257_FROM_UNICODE_SIZE, 1},
       {"CP1257", "cp1257", "x-cp1257", "win1257", "windows1257", NULL}, 0 },
-    { {"Windows-1258", ENC_TYPE_SINGLE_BYTE, windows_1258_to_unicode, NULL, 0, 1},
+    { {"Windows-1258", ENC_TYPE_SINGLE_BYTE, windows_1258_to_unicode, windows_1258_from_unicode, WINDOWS_1258_FROM_UNICODE_SIZE, 1},
       {"CP1258", "cp1258", "x-cp1258", "win1258", "windows1258", NULL}, 0 },
 
     /* === 26-41. DOS code pages (standard) === */
-    { {"CP437", ENC_TYPE_SINGLE_BYTE, cp437_to_unicode, NULL, 0, 1},
+    { {"CP437", ENC_TYPE_SINGLE_BYTE, cp437_to_unicode, cp437_from_unicode, CP437_FROM_UNICODE_SIZE, 1},
       {"IBM437", "ibm437", "437", "csPC8CodePage437", "DOS-US", NULL}, 0 },
-    { {"CP437-DOC", ENC_TYPE_SINGLE_BYTE, cp437_doc_to_unicode, NULL, 0, 0},
+    { {"CP437-DOC", ENC_TYPE_SINGLE_BYTE, cp437_doc_to_unicode, cp437_doc_from_unicode, CP437_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM437-DOC", "437-DOC", "DOS-US-DOC", NULL}, 0 },
-    { {"CP850", ENC_TYPE_SINGLE_BYTE, cp850_to_unicode, NULL, 0, 1},
+    { {"CP850", ENC_TYPE_SINGLE_BYTE, cp850_to_unicode, cp850_from_unicode, CP850_FROM_UNICODE_SIZE, 1},
       {"IBM850", "ibm850", "850", "csPC850Multilingual", "DOS-Latin-1", NULL}, 0 },
-    { {"CP852", ENC_TYPE_SINGLE_BYTE, cp852_to_unicode, NULL, 0, 1},
+    { {"CP852", ENC_TYPE_SINGLE_BYTE, cp852_to_unicode, cp852_from_unicode, CP852_FROM_UNICODE_SIZE, 1},
       {"IBM852", "ibm852", "852", "DOS-Latin-2", NULL}, 0 },
-    { {"CP866", ENC_TYPE_SINGLE_BYTE, cp866_to_unicode, NULL, 0, 1},
+    { {"CP866", ENC_TYPE_SINGLE_BYTE, cp866_to_unicode, cp866_from_unicode, CP866_FROM_UNICODE_SIZE, 1},
       {"IBM866", "ibm866", "866", "csIBM866", "DOS-Cyrillic", NULL}, 0 },
-    { {"CP737", ENC_TYPE_SINGLE_BYTE, cp737_to_unicode, NULL, 0, 1},
+    { {"CP737", ENC_TYPE_SINGLE_BYTE, cp737_to_unicode, cp737_from_unicode, CP737_FROM_UNICODE_SIZE, 1},
       {"IBM737", "ibm737", "737", "DOS-Greek", NULL}, 0 },
-    { {"CP855", ENC_TYPE_SINGLE_BYTE, cp855_to_unicode, NULL, 0, 1},
+    { {"CP855", ENC_TYPE_SINGLE_BYTE, cp855_to_unicode, cp855_from_unicode, CP855_FROM_UNICODE_SIZE, 1},
       {"IBM855", "ibm855", "855", "csIBM855", NULL}, 0 },
-    { {"CP857", ENC_TYPE_SINGLE_BYTE, cp857_to_unicode, NULL, 0, 1},
+    { {"CP857", ENC_TYPE_SINGLE_BYTE, cp857_to_unicode, cp857_from_unicode, CP857_FROM_UNICODE_SIZE, 1},
       {"IBM857", "ibm857", "857", "csIBM857", "DOS-Turkish", NULL}, 0 },
-    { {"CP865", ENC_TYPE_SINGLE_BYTE, cp865_to_unicode, NULL, 0, 1},
+    { {"CP865", ENC_TYPE_SINGLE_BYTE, cp865_to_unicode, cp865_from_unicode, CP865_FROM_UNICODE_SIZE, 1},
       {"IBM865", "ibm865", "865", "csIBM865", "DOS-Nordic", NULL}, 0 },
-    { {"CP858", ENC_TYPE_SINGLE_BYTE, cp858_to_unicode, NULL, 0, 1},
+    { {"CP858", ENC_TYPE_SINGLE_BYTE, cp858_to_unicode, cp858_from_unicode, CP858_FROM_UNICODE_SIZE, 1},
       {"IBM858", "ibm858", "858", NULL}, 0 },
-    { {"CP860", ENC_TYPE_SINGLE_BYTE, cp860_to_unicode, NULL, 0, 1},
+    { {"CP860", ENC_TYPE_SINGLE_BYTE, cp860_to_unicode, cp860_from_unicode, CP860_FROM_UNICODE_SIZE, 1},
       {"IBM860", "ibm860", "860", "csIBM860", "DOS-Portuguese", NULL}, 0 },
-    { {"CP861", ENC_TYPE_SINGLE_BYTE, cp861_to_unicode, NULL, 0, 1},
+    { {"CP861", ENC_TYPE_SINGLE_BYTE, cp861_to_unicode, cp861_from_unicode, CP861_FROM_UNICODE_SIZE, 1},
       {"IBM861", "ibm861", "861", "csIBM861", "DOS-Icelandic", NULL}, 0 },
-    { {"CP862", ENC_TYPE_SINGLE_BYTE, cp862_to_unicode, NULL, 0, 1},
+    { {"CP862", ENC_TYPE_SINGLE_BYTE, cp862_to_unicode, cp862_from_unicode, CP862_FROM_UNICODE_SIZE, 1},
       {"IBM862", "ibm862", "862", "DOS-Hebrew", NULL}, 0 },
-    { {"CP863", ENC_TYPE_SINGLE_BYTE, cp863_to_unicode, NULL, 0, 1},
+    { {"CP863", ENC_TYPE_SINGLE_BYTE, cp863_to_unicode, cp863_from_unicode, CP863_FROM_UNICODE_SIZE, 1},
       {"IBM863", "ibm863", "863", "csIBM863", "DOS-Canadian-French", NULL}, 0 },
-    { {"CP864", ENC_TYPE_SINGLE_BYTE, cp864_to_unicode, NULL, 0, 1},
+    { {"CP864", ENC_TYPE_SINGLE_BYTE, cp864_to_unicode, cp864_from_unicode, CP864_FROM_UNICODE_SIZE, 1},
       {"IBM864", "ibm864", "864", "csIBM864", "DOS-Arabic", NULL}, 0 },
-    { {"CP869", ENC_TYPE_SINGLE_BYTE, cp869_to_unicode, NULL, 0, 1},
+    { {"CP869", ENC_TYPE_SINGLE_BYTE, cp869_to_unicode, cp869_from_unicode, CP869_FROM_UNICODE_SIZE, 1},
       {"IBM869", "ibm869", "869", "csIBM869", "DOS-Greek-2", NULL}, 0 },
 
     /* === 42-55. DOS code pages (DOC graphical variants) === */
-    { {"CP850-DOC", ENC_TYPE_SINGLE_BYTE, cp850_doc_to_unicode, NULL, 0, 0},
+    { {"CP850-DOC", ENC_TYPE_SINGLE_BYTE, cp850_doc_to_unicode, cp850_doc_from_unicode, CP850_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM850-DOC", "850-DOC", "DOS-Latin-1-DOC", NULL}, 0 },
-    { {"CP852-DOC", ENC_TYPE_SINGLE_BYTE, cp852_doc_to_unicode, NULL, 0, 0},
+    { {"CP852-DOC", ENC_TYPE_SINGLE_BYTE, cp852_doc_to_unicode, cp852_doc_from_unicode, CP852_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM852-DOC", "852-DOC", "DOS-Latin-2-DOC", NULL}, 0 },
-    { {"CP866-DOC", ENC_TYPE_SINGLE_BYTE, cp866_doc_to_unicode, NULL, 0, 0},
+    { {"CP866-DOC", ENC_TYPE_SINGLE_BYTE, cp866_doc_to_unicode, cp866_doc_from_unicode, CP866_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM866-DOC", "866-DOC", "DOS-Cyrillic-DOC", NULL}, 0 },
-    { {"CP737-DOC", ENC_TYPE_SINGLE_BYTE, cp737_doc_to_unicode, NULL, 0, 0},
+    { {"CP737-DOC", ENC_TYPE_SINGLE_BYTE, cp737_doc_to_unicode, cp737_doc_from_unicode, CP737_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM737-DOC", "737-DOC", "DOS-Greek-DOC", NULL}, 0 },
-    { {"CP855-DOC", ENC_TYPE_SINGLE_BYTE, cp855_doc_to_unicode, NULL, 0, 0},
+    { {"CP855-DOC", ENC_TYPE_SINGLE_BYTE, cp855_doc_to_unicode, cp855_doc_from_unicode, CP855_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM855-DOC", "855-DOC", NULL}, 0 },
-    { {"CP857-DOC", ENC_TYPE_SINGLE_BYTE, cp857_doc_to_unicode, NULL, 0, 0},
+    { {"CP857-DOC", ENC_TYPE_SINGLE_BYTE, cp857_doc_to_unicode, cp857_doc_from_unicode, CP857_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM857-DOC", "857-DOC", "DOS-Turkish-DOC", NULL}, 0 },
-    { {"CP865-DOC", ENC_TYPE_SINGLE_BYTE, cp865_doc_to_unicode, NULL, 0, 0},
+    { {"CP865-DOC", ENC_TYPE_SINGLE_BYTE, cp865_doc_to_unicode, cp865_doc_from_unicode, CP865_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM865-DOC", "865-DOC", "DOS-Nordic-DOC", NULL}, 0 },
-    { {"CP858-DOC", ENC_TYPE_SINGLE_BYTE, cp858_doc_to_unicode, NULL, 0, 0},
+    { {"CP858-DOC", ENC_TYPE_SINGLE_BYTE, cp858_doc_to_unicode, cp858_doc_from_unicode, CP858_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM858-DOC", "858-DOC", NULL}, 0 },
-    { {"CP860-DOC", ENC_TYPE_SINGLE_BYTE, cp860_doc_to_unicode, NULL, 0, 0},
+    { {"CP860-DOC", ENC_TYPE_SINGLE_BYTE, cp860_doc_to_unicode, cp860_doc_from_unicode, CP860_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM860-DOC", "860-DOC", "DOS-Portuguese-DOC", NULL}, 0 },
-    { {"CP861-DOC", ENC_TYPE_SINGLE_BYTE, cp861_doc_to_unicode, NULL, 0, 0},
+    { {"CP861-DOC", ENC_TYPE_SINGLE_BYTE, cp861_doc_to_unicode, cp861_doc_from_unicode, CP861_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM861-DOC", "861-DOC", "DOS-Icelandic-DOC", NULL}, 0 },
-    { {"CP862-DOC", ENC_TYPE_SINGLE_BYTE, cp862_doc_to_unicode, NULL, 0, 0},
+    { {"CP862-DOC", ENC_TYPE_SINGLE_BYTE, cp862_doc_to_unicode, cp862_doc_from_unicode, CP862_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM862-DOC", "862-DOC", "DOS-Hebrew-DOC", NULL}, 0 },
-    { {"CP863-DOC", ENC_TYPE_SINGLE_BYTE, cp863_doc_to_unicode, NULL, 0, 0},
+    { {"CP863-DOC", ENC_TYPE_SINGLE_BYTE, cp863_doc_to_unicode, cp863_doc_from_unicode, CP863_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM863-DOC", "863-DOC", "DOS-Canadian-French-DOC", NULL}, 0 },
-    { {"CP864-DOC", ENC_TYPE_SINGLE_BYTE, cp864_doc_to_unicode, NULL, 0, 0},
+    { {"CP864-DOC", ENC_TYPE_SINGLE_BYTE, cp864_doc_to_unicode, cp864_doc_from_unicode, CP864_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM864-DOC", "864-DOC", "DOS-Arabic-DOC", NULL}, 0 },
-    { {"CP869-DOC", ENC_TYPE_SINGLE_BYTE, cp869_doc_to_unicode, NULL, 0, 0},
+    { {"CP869-DOC", ENC_TYPE_SINGLE_BYTE, cp869_doc_to_unicode, cp869_doc_from_unicode, CP869_DOC_FROM_UNICODE_SIZE, 0},
       {"IBM869-DOC", "869-DOC", "DOS-Greek-2-DOC", NULL}, 0 },
 
     /* === 56-57. KOI8 === */
-    { {"KOI8-R", ENC_TYPE_SINGLE_BYTE, koi8_r_to_unicode, NULL, 0, 1},
+    { {"KOI8-R", ENC_TYPE_SINGLE_BYTE, koi8_r_to_unicode, koi8_r_from_unicode, KOI8_R_FROM_UNICODE_SIZE, 1},
       {"koi8-r", "koi8r", "csKOI8R", NULL}, 0 },
-    { {"KOI8-U", ENC_TYPE_SINGLE_BYTE, koi8_u_to_unicode, NULL, 0, 1},
+    { {"KOI8-U", ENC_TYPE_SINGLE_BYTE, koi8_u_to_unicode, koi8_u_from_unicode, KOI8_U_FROM_UNICODE_SIZE, 1},
       {"koi8-u", "koi8u", NULL}, 0 },
 
     /* === 58-68. Mac === */
-    { {"MacRoman", ENC_TYPE_SINGLE_BYTE, mac_roman_to_unicode, NULL, 0, 1},
+    { {"MacRoman", ENC_TYPE_SINGLE_BYTE, mac_roman_to_unicode, mac_roman_from_unicode, MAC_ROMAN_FROM_UNICODE_SIZE, 1},
       {"macintosh", "mac", "x-mac-roman", "csMacintosh", "macroman", NULL}, 0 },
-    { {"MacCyrillic", ENC_TYPE_SINGLE_BYTE, mac_cyrillic_to_unicode, NULL, 0, 1},
+    { {"MacCyrillic", ENC_TYPE_SINGLE_BYTE, mac_cyrillic_to_unicode, mac_cyrillic_from_unicode, MAC_CYRILLIC_FROM_UNICODE_SIZE, 1},
       {"x-mac-cyrillic", "mac-cyrillic", "maccyrillic", NULL}, 0 },
-    { {"MacGreek", ENC_TYPE_SINGLE_BYTE, mac_greek_to_unicode, NULL, 0, 1},
+    { {"MacGreek", ENC_TYPE_SINGLE_BYTE, mac_greek_to_unicode, mac_greek_from_unicode, MAC_GREEK_FROM_UNICODE_SIZE, 1},
       {"x-mac-greek", "mac-greek", "macgreek", NULL}, 0 },
-    { {"MacTurkish", ENC_TYPE_SINGLE_BYTE, mac_turkish_to_unicode, NULL, 0, 1},
+    { {"MacTurkish", ENC_TYPE_SINGLE_BYTE, mac_turkish_to_unicode, mac_turkish_from_unicode, MAC_TURKISH_FROM_UNICODE_SIZE, 1},
       {"x-mac-turkish", "mac-turkish", "macturkish", NULL}, 0 },
-    { {"MacCentralEurope", ENC_TYPE_SINGLE_BYTE, mac_central_europe_to_unicode, NULL, 0, 1},
+    { {"MacCentralEurope", ENC_TYPE_SINGLE_BYTE, mac_central_europe_to_unicode, mac_central_europe_from_unicode, MAC_CENTRAL_EUROPE_FROM_UNICODE_SIZE, 1},
       {"x-mac-centraleurroman", "x-mac-ce", "mac-centraleurope", "macce", NULL}, 0 },
-    { {"MacIcelandic", ENC_TYPE_SINGLE_BYTE, mac_icelandic_to_unicode, NULL, 0, 1},
+    { {"MacIcelandic", ENC_TYPE_SINGLE_BYTE, mac_icelandic_to_unicode, mac_icelandic_from_unicode, MAC_ICELANDIC_FROM_UNICODE_SIZE, 1},
       {"x-mac-icelandic", "mac-icelandic", "maciceland", NULL}, 0 },
-    { {"MacCroatian", ENC_TYPE_SINGLE_BYTE, mac_croatian_to_unicode, NULL, 0, 1},
+    { {"MacCroatian", ENC_TYPE_SINGLE_BYTE, mac_croatian_to_unicode, mac_croatian_from_unicode, MAC_CROATIAN_FROM_UNICODE_SIZE, 1},
       {"x-mac-croatian", "mac-croatian", "maccroatian", NULL}, 0 },
-    { {"MacRomanian", ENC_TYPE_SINGLE_BYTE, mac_romanian_to_unicode, NULL, 0, 1},
+    { {"MacRomanian", ENC_TYPE_SINGLE_BYTE, mac_romanian_to_unicode, mac_romanian_from_unicode, MAC_ROMANIAN_FROM_UNICODE_SIZE, 1},
       {"x-mac-romanian", "mac-romanian", "macromania", NULL}, 0 },
-    { {"MacArabic", ENC_TYPE_SINGLE_BYTE, mac_arabic_to_unicode, NULL, 0, 1},
+    { {"MacArabic", ENC_TYPE_SINGLE_BYTE, mac_arabic_to_unicode, mac_arabic_from_unicode, MAC_ARABIC_FROM_UNICODE_SIZE, 1},
       {"x-mac-arabic", "mac-arabic", "macarabic", NULL}, 0 },
-    { {"MacHebrew", ENC_TYPE_SINGLE_BYTE, mac_hebrew_to_unicode, NULL, 0, 1},
+    { {"MacHebrew", ENC_TYPE_SINGLE_BYTE, mac_hebrew_to_unicode, mac_hebrew_from_unicode, MAC_HEBREW_FROM_UNICODE_SIZE, 1},
       {"x-mac-hebrew", "mac-hebrew", "machebrew", NULL}, 0 },
-    { {"MacThai", ENC_TYPE_SINGLE_BYTE, mac_thai_to_unicode, NULL, 0, 1},
+    { {"MacThai", ENC_TYPE_SINGLE_BYTE, mac_thai_to_unicode, mac_thai_from_unicode, MAC_THAI_FROM_UNICODE_SIZE, 1},
       {"x-mac-thai", "mac-thai", "macthai", NULL}, 0 },
 
     /* === 69-78. EBCDIC === */
-    { {"CP037", ENC_TYPE_SINGLE_BYTE, cp037_to_unicode, NULL, 0, 0},
+    { {"CP037", ENC_TYPE_SINGLE_BYTE, cp037_to_unicode, cp037_from_unicode, CP037_FROM_UNICODE_SIZE, 0},
       {"IBM037", "ebcdic-cp-us", "ebcdic-cp-ca", "csIBM037", "cp037", NULL}, 0 },
-    { {"CP500", ENC_TYPE_SINGLE_BYTE, cp500_to_unicode, NULL, 0, 0},
+    { {"CP500", ENC_TYPE_SINGLE_BYTE, cp500_to_unicode, cp500_from_unicode, CP500_FROM_UNICODE_SIZE, 0},
       {"IBM500", "ebcdic-international", "ebcdic-cp-be", "csIBM500", "cp500", NULL}, 0 },
-    { {"CP875", ENC_TYPE_SINGLE_BYTE, cp875_to_unicode, NULL, 0, 0},
+    { {"CP875", ENC_TYPE_SINGLE_BYTE, cp875_to_unicode, cp875_from_unicode, CP875_FROM_UNICODE_SIZE, 0},
       {"IBM875", "ebcdic-greek", "cp875", NULL}, 0 },
-    { {"CP1026", ENC_TYPE_SINGLE_BYTE, cp1026_to_unicode, NULL, 0, 0},
+    { {"CP1026", ENC_TYPE_SINGLE_BYTE, cp1026_to_unicode, cp1026_from_unicode, CP1026_FROM_UNICODE_SIZE, 0},
       {"IBM1026", "ebcdic-cp-tr", "cp1026", NULL}, 0 },
-    { {"CP1140", ENC_TYPE_SINGLE_BYTE, cp1140_to_unicode, NULL, 0, 0},
+    { {"CP1140", ENC_TYPE_SINGLE_BYTE, cp1140_to_unicode, cp1140_from_unicode, CP1140_FROM_UNICODE_SIZE, 0},
       {"IBM1140", "ebcdic-us-37+euro", "cp1140", NULL}, 0 },
-    { {"CP1141", ENC_TYPE_SINGLE_BYTE, cp1141_to_unicode, NULL, 0, 0},
+    { {"CP1141", ENC_TYPE_SINGLE_BYTE, cp1141_to_unicode, cp1141_from_unicode, CP1141_FROM_UNICODE_SIZE, 0},
       {"IBM1141", "ebcdic-de-273+euro", "cp1141", NULL}, 0 },
-    { {"CP1142", ENC_TYPE_SINGLE_BYTE, cp1142_to_unicode, NULL, 0, 0},
+    { {"CP1142", ENC_TYPE_SINGLE_BYTE, cp1142_to_unicode, cp1142_from_unicode, CP1142_FROM_UNICODE_SIZE, 0},
       {"IBM1142", "ebcdic-dk-277+euro", "ebcdic-no-277+euro", "cp1142", NULL}, 0 },
-    { {"CP1143", ENC_TYPE_SINGLE_BYTE, cp1143_to_unicode, NULL, 0, 0},
+    { {"CP1143", ENC_TYPE_SINGLE_BYTE, cp1143_to_unicode, cp1143_from_unicode, CP1143_FROM_UNICODE_SIZE, 0},
       {"IBM1143", "ebcdic-fi-278+euro", "ebcdic-se-278+euro", "cp1143", NULL}, 0 },
-    { {"CP1144", ENC_TYPE_SINGLE_BYTE, cp1144_to_unicode, NULL, 0, 0},
+    { {"CP1144", ENC_TYPE_SINGLE_BYTE, cp1144_to_unicode, cp1144_from_unicode, CP1144_FROM_UNICODE_SIZE, 0},
       {"IBM1144", "ebcdic-it-280+euro", "cp1144", NULL}, 0 },
-    { {"CP1145", ENC_TYPE_SINGLE_BYTE, cp1145_to_unicode, NULL, 0, 0},
+    { {"CP1145", ENC_TYPE_SINGLE_BYTE, cp1145_to_unicode, cp1145_from_unicode, CP1145_FROM_UNICODE_SIZE, 0},
       {"IBM1145", "ebcdic-es-284+euro", "cp1145", NULL}, 0 },
 
     /* === 79-89. Legacy === */
-    { {"HP-Roman8", ENC_TYPE_SINGLE_BYTE, hp_roman8_to_unicode, NULL, 0, 1},
+    { {"HP-Roman8", ENC_TYPE_SINGLE_BYTE, hp_roman8_to_unicode, hp_roman8_from_unicode, HP_ROMAN8_FROM_UNICODE_SIZE, 1},
       {"hp-roman8", "roman8", "r8", "csHPRoman8", "hproman8", NULL}, 0 },
-    { {"DEC-MCS", ENC_TYPE_SINGLE_BYTE, dec_mcs_to_unicode, NULL, 0, 1},
+    { {"DEC-MCS", ENC_TYPE_SINGLE_BYTE, dec_mcs_to_unicode, dec_mcs_from_unicode, DEC_MCS_FROM_UNICODE_SIZE, 1},
       {"dec-mcs", "csDECMCS", "dec", NULL}, 0 },
-    { {"JIS_X0201", ENC_TYPE_SINGLE_BYTE, jis_x0201_to_unicode, NULL, 0, 1},
+    { {"JIS_X0201", ENC_TYPE_SINGLE_BYTE, jis_x0201_to_unicode, jis_x0201_from_unicode, JIS_X0201_FROM_UNICODE_SIZE, 1},
       {"JIS_X0201-1976", "x0201", "csHalfWidthKatakana", NULL}, 0 },
-    { {"KZ-1048", ENC_TYPE_SINGLE_BYTE, kz_1048_to_unicode, NULL, 0, 1},
+    { {"KZ-1048", ENC_TYPE_SINGLE_BYTE, kz_1048_to_unicode, kz_1048_from_unicode, KZ_1048_FROM_UNICODE_SIZE, 1},
       {"STRK1048-2002", "RK1048", "csKZ1048", "kz1048", NULL}, 0 },
-    { {"GSM-03.38", ENC_TYPE_SINGLE_BYTE, gsm_03_38_to_unicode, NULL, 0, 0},
+    { {"GSM-03.38", ENC_TYPE_SINGLE_BYTE, gsm_03_38_to_unicode, gsm_03_38_from_unicode, GSM_03_38_FROM_UNICODE_SIZE, 0},
       {"GSM", "gsm-default-alphabet", "gsm7", "gsm0338", NULL}, 0 },
-    { {"VISCII", ENC_TYPE_SINGLE_BYTE, viscii_to_unicode, NULL, 0, 1},
+    { {"VISCII", ENC_TYPE_SINGLE_BYTE, viscii_to_unicode, viscii_from_unicode, VISCII_FROM_UNICODE_SIZE, 1},
       {"viscii", "csVISCII", "viscii1.1-1", NULL}, 0 },
-    { {"ATASCII", ENC_TYPE_SINGLE_BYTE, atascii_to_unicode, NULL, 0, 0},
+    { {"ATASCII", ENC_TYPE_SINGLE_BYTE, atascii_to_unicode, atascii_from_unicode, ATASCII_FROM_UNICODE_SIZE, 0},
       {"atascii", "atari-ascii", "atari", NULL}, 0 },
-    { {"PETSCII", ENC_TYPE_SINGLE_BYTE, petscii_to_unicode, NULL, 0, 0},
+    { {"PETSCII", ENC_TYPE_SINGLE_BYTE, petscii_to_unicode, petscii_from_unicode, PETSCII_FROM_UNICODE_SIZE, 0},
       {"petscii", "commodore", "c64", NULL}, 0 },
-    { {"Adobe-Standard-Encoding", ENC_TYPE_SINGLE_BYTE, adobe_standard_to_unicode, NULL, 0, 1},
+    { {"Adobe-Standard-Encoding", ENC_TYPE_SINGLE_BYTE, adobe_standard_to_unicode, adobe_standard_from_unicode, ADOBE_STANDARD_FROM_UNICODE_SIZE, 1},
       {"adobe-standard", "csAdobeStandardEncoding", NULL}, 0 },
-    { {"Adobe-Symbol-Encoding", ENC_TYPE_SINGLE_BYTE, adobe_symbol_to_unicode, NULL, 0, 0},
+    { {"Adobe-Symbol-Encoding", ENC_TYPE_SINGLE_BYTE, adobe_symbol_to_unicode, adobe_symbol_from_unicode, ADOBE_SYMBOL_FROM_UNICODE_SIZE, 0},
       {"adobe-symbol", "symbol", NULL}, 0 },
-    { {"T.61-8bit", ENC_TYPE_SINGLE_BYTE, t61_to_unicode, NULL, 0, 1},
+    { {"T.61-8bit", ENC_TYPE_SINGLE_BYTE, t61_to_unicode, t61_from_unicode, T61_FROM_UNICODE_SIZE, 1},
       {"T.61", "iso-ir-102", "csISO102T617bit", "t61", NULL}, 0 },
 
     /* === 90-98. UTF encodings === */
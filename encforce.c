@@ -8,6 +8,7 @@
  * throughput on large inputs.
  */
 
+#define _GNU_SOURCE             /* fopencookie */
 #include <sys/types.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -16,10 +17,27 @@
 #include <getopt.h>
 #include <unistd.h>
 #include <strings.h>
+#include <poll.h>
+#include <errno.h>
+#include <time.h>
+#include <stdarg.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <signal.h>
+#include <pthread.h>
 
 #ifdef __APPLE__
 #include <sys/sysctl.h>
 #endif
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 #include "yarn.h"
 #include "charconv.h"
@@ -35,6 +53,11 @@
 #define SCRATCH_SIZE (13*MAXLINE)   /* worst case: base64_inline encode = 13:1 */
 #define DEDUP_CAPACITY 8192
 #define MAX_SINGLE_OUTPUT SCRATCH_SIZE
+#define MAXRECORD (MAXCHUNK/2 - 1)  /* longest record that fits a read buffer */
+#define LONGCHUNK (MAXLINE/4)       /* input piece for records >= MAXLINE */
+#define LONGMID (4*LONGCHUNK)       /* transcode intermediate (<= 3 bytes/byte) */
+#define MAXENC (sizeof(encodings) / sizeof(encodings[0]))
+#define MAXSTRAT (DS_COUNT > ES_COUNT ? DS_COUNT : ES_COUNT)
 
 /* ===== Modes ===== */
 enum Mode {
@@ -49,11 +72,23 @@ enum Mode {
 enum OutputFormat {
     FMT_LINES = 0,
     FMT_JSON = 1,
-    FMT_TSV = 2
+    FMT_TSV = 2,
+    FMT_BINARY = 3,
+    FMT_ARROW = 4
+};
+
+/* ===== Input record formats ===== */
+enum InputFormat {
+    REC_LINES = 0,      /* newline-terminated, CR stripped, $HEX[] decoded */
+    REC_NUL = 1,        /* NUL-terminated, bytes taken as-is */
+    REC_LENGTH = 2      /* 4-byte little-endian length, then the bytes */
 };
 
 /* ===== Job structure ===== */
 #define JOB_PROCESS 1
+#define JOB_WHOLE 2
+#define JOB_RECORDS 3     /* records in a buffer the caller owns (--serve, argv) */
+#define JOB_SPLIT 4       /* take sources of another job's transcode line */
 #define JOB_DONE 99
 
 struct LineInfo {
@@ -61,14 +96,30 @@ struct LineInfo {
     unsigned int len;
 };
 
+/* The current line's results from encodings shared with later ones */
+struct Fan {
+    int count;
+    struct {
+        int strategy, had_errors, off, len;
+    } r[MAXENC * MAXSTRAT];
+    short first[MAXENC], num[MAXENC];   /* each encoding's run in r */
+    unsigned char *buf;
+    int used, size;
+};
+
 struct JOB {
     struct JOB *next;
     char *readbuf;
     struct LineInfo *readindex;
     int numline;
-    int startline;
+    int64_t startline;  /* index of the first record in readbuf */
+    int64_t recno;      /* index of the record being processed */
     int func;
-    /* Per-thread output buffer */
+    int piece;          /* JOB_WHOLE: index into Whole.pieces */
+    int turn;           /* nonzero: writes after turns before it (--serve, argv) */
+    struct Split *help; /* JOB_SPLIT: the line being helped */
+    /* Per-thread output buffer, written to out (stdout, or a --serve client) */
+    FILE *out;
     char *outbuf;
     int outlen;
     int outsize;
@@ -79,6 +130,28 @@ struct JOB {
     /* Per-thread scratch space */
     char *scratch;
     int scratch_size;
+    unsigned char *mid;         /* transcode: the line decoded as the source */
+    struct Split *split;        /* transcode_split state, kept between lines */
+    /* Record being converted in pieces (output == NULL in emit_result) */
+    struct LongConv *lconv;
+    /* -F arrow: pending rows; arrow_sink sends output_append to the output column */
+    struct ArrowBatch *arrow;
+    int arrow_sink;
+    /* emit_result: write position inside a whole-result reservation */
+    char *cursor;
+    int reserved;
+    /* Encodings converting the current line alike (decode, then encode):
+       first member of each one's group, and whether a group has others */
+    short rep[MAXENC];
+    char shared[MAXENC];
+    struct Fan fan;
+    /* Strategy text for unencodable code points, by (cp, strategy) */
+    struct ErrText *errtext;
+    /* Strict single-byte conversions of the current line, LANE_STRIDE apart */
+    unsigned char *lanes;
+    int lane_len[MAXENC];       /* LANE_NONE, LANE_ERROR or the length */
+    uint32_t *cps;              /* encode lanes: the line's code points */
+    int ncp;
 };
 
 /* ===== Globals ===== */
@@ -102,12 +175,19 @@ static int Cacheindex;
 /* Options */
 static enum Mode OpMode = MODE_BOTH;
 static enum OutputFormat OutFormat = FMT_LINES;
+static enum InputFormat InFormat = REC_LINES;
 static int DoHex = 1;
 static int DoVerbose = 0;
 static int DoUnique = 1;
 static int DoNoErrors = 0;
 static int DoSuggest = 0;
 static int MaxDepth = 1;
+static int DoStream = 0;
+static int StreamDelay = 10;        /* ms to wait for more input after first byte */
+static int StreamLines = 1000;      /* dispatch early after this many lines */
+static int Stream_eof = 0;
+static int Stream_error = 0;      /* errno of a failed read in --stream mode */
+static int DoWholeFile = 0;
 static char *FilterPattern __attribute__((unused)) = NULL;
 
 /* Encoding filter lists */
@@ -133,15 +213,16 @@ static int get_nprocs(void) {
 #endif
 }
 
-/* ===== findeol: find newline in buffer ===== */
+/* ===== findeol: find end of record (newline, or NUL with -0) in buffer ===== */
 static inline char *findeol(const char *s, int64_t l) {
     if (l <= 0) return NULL;
-    return memchr(s, '\n', l);
+    return memchr(s, InFormat == REC_NUL ? '\0' : '\n', l);
 }
 
 /* ===== FNV-1a hash for dedup ===== */
-static inline uint64_t fnv1a(const unsigned char *data, int len) {
-    uint64_t h = 0xcbf29ce484222325ULL;
+#define FNV1A_INIT 0xcbf29ce484222325ULL
+
+static inline uint64_t fnv1a_update(uint64_t h, const unsigned char *data, int len) {
     for (int i = 0; i < len; i++) {
         h ^= data[i];
         h *= 0x100000001b3ULL;
@@ -149,6 +230,10 @@ static inline uint64_t fnv1a(const unsigned char *data, int len) {
     return h;
 }
 
+static inline uint64_t fnv1a(const unsigned char *data, int len) {
+    return fnv1a_update(FNV1A_INIT, data, len);
+}
+
 /* ===== Hex utilities ===== */
 static const char hexdigits[] = "0123456789abcdef";
 
@@ -159,9 +244,200 @@ static inline int hexval(unsigned char c) {
     return -1;
 }
 
+/* ===== SIMD kernels ===== */
+/*
+ * Byte scanning and hex expansion for the output formatters. x86 uses
+ * SSE2 (baseline on x86-64) for the scans and SSSE3 pshufb for hex,
+ * picked at startup; AArch64 uses NEON; anything else runs the scalar
+ * loops, which also finish the tails.
+ */
+static const char hexdigits_upper[] = "0123456789ABCDEF";
+
+static void hex_encode_scalar(char *dst, const unsigned char *src, int len) {
+    for (int i = 0; i < len; i++) {
+        dst[2 * i] = hexdigits[src[i] >> 4];
+        dst[2 * i + 1] = hexdigits[src[i] & 0x0F];
+    }
+}
+
+#if defined(__SSE2__)
+__attribute__((target("ssse3")))
+static void hex_encode_ssse3(char *dst, const unsigned char *src, int len) {
+    const __m128i lut = _mm_loadu_si128((const __m128i *)hexdigits);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    int i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+        __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(v, nibble));
+        _mm_storeu_si128((__m128i *)(dst + 2 * i), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i *)(dst + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+    hex_encode_scalar(dst + 2 * i, src + i, len - i);
+}
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+static void hex_encode_neon(char *dst, const unsigned char *src, int len) {
+    const uint8x16_t lut = vld1q_u8((const uint8_t *)hexdigits);
+    int i = 0;
+    for (; i + 16 <= len; i += 16) {
+        uint8x16_t v = vld1q_u8(src + i);
+        uint8x16x2_t out;
+        out.val[0] = vqtbl1q_u8(lut, vshrq_n_u8(v, 4));
+        out.val[1] = vqtbl1q_u8(lut, vandq_u8(v, vdupq_n_u8(0x0F)));
+        vst2q_u8((uint8_t *)dst + 2 * i, out);
+    }
+    hex_encode_scalar(dst + 2 * i, src + i, len - i);
+}
+#endif
+
+/* Write 2*len lowercase hex digits for src to dst */
+static void (*hex_encode)(char *dst, const unsigned char *src, int len) = hex_encode_scalar;
+
+/*
+ * Map every byte through a 256-byte table. A 16-entry pshufb needs a
+ * compare and blend per nibble and loses to the scalar loop, so x86 only
+ * vectorizes with AVX-512 VBMI, where two vpermi2b cover the table and a
+ * masked load takes the tail; AArch64 uses four 64-byte tbl lookups.
+ */
+static void byte_translate_scalar(unsigned char *dst, const unsigned char *src, int len,
+    const unsigned char *map)
+{
+    for (int i = 0; i < len; i++) dst[i] = map[src[i]];
+}
+
+#if defined(__SSE2__)
+__attribute__((target("avx512f,avx512bw,avx512vbmi")))
+static void byte_translate_vbmi(unsigned char *dst, const unsigned char *src, int len,
+    const unsigned char *map)
+{
+    const __m512i t0 = _mm512_loadu_si512(map), t1 = _mm512_loadu_si512(map + 64);
+    const __m512i t2 = _mm512_loadu_si512(map + 128), t3 = _mm512_loadu_si512(map + 192);
+    for (int i = 0; i < len; i += 64) {
+        __mmask64 k = len - i >= 64 ? ~0ULL : (1ULL << (len - i)) - 1;
+        __m512i v = _mm512_maskz_loadu_epi8(k, src + i);
+        __m512i lo = _mm512_permutex2var_epi8(t0, v, t1);
+        __m512i hi = _mm512_permutex2var_epi8(t2, v, t3);
+        __m512i r = _mm512_mask_blend_epi8(_mm512_movepi8_mask(v), lo, hi);
+        _mm512_mask_storeu_epi8(dst + i, k, r);
+    }
+}
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+static void byte_translate_neon(unsigned char *dst, const unsigned char *src, int len,
+    const unsigned char *map)
+{
+    const uint8x16x4_t t0 = vld1q_u8_x4(map), t1 = vld1q_u8_x4(map + 64);
+    const uint8x16x4_t t2 = vld1q_u8_x4(map + 128), t3 = vld1q_u8_x4(map + 192);
+    const uint8x16_t step = vdupq_n_u8(64);
+    int i = 0;
+    for (; i + 16 <= len; i += 16) {
+        /* Out-of-range indices leave the previous lookup in place */
+        uint8x16_t v = vld1q_u8(src + i);
+        uint8x16_t r = vqtbl4q_u8(t0, v);
+        v = vsubq_u8(v, step);
+        r = vqtbx4q_u8(r, t1, v);
+        v = vsubq_u8(v, step);
+        r = vqtbx4q_u8(r, t2, v);
+        v = vsubq_u8(v, step);
+        r = vqtbx4q_u8(r, t3, v);
+        vst1q_u8(dst + i, r);
+    }
+    byte_translate_scalar(dst + i, src + i, len - i, map);
+}
+#endif
+
+static void (*byte_translate)(unsigned char *dst, const unsigned char *src, int len,
+    const unsigned char *map) = byte_translate_scalar;
+
+static void simd_init(void) {
+#if defined(__SSE2__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("ssse3"))
+        hex_encode = hex_encode_ssse3;
+    if (__builtin_cpu_supports("avx512vbmi") && __builtin_cpu_supports("avx512bw"))
+        byte_translate = byte_translate_vbmi;
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    hex_encode = hex_encode_neon;
+    byte_translate = byte_translate_neon;
+#endif
+}
+
+/* Length of the leading run of s that JSON can copy verbatim */
+static int json_plain_len(const unsigned char *s, int len) {
+    int i = 0;
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"'), bslash = _mm_set1_epi8('\\');
+    const __m128i ctl = _mm_set1_epi8(0x1F);
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, bslash));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(_mm_max_epu8(v, ctl), ctl));
+        int bits = _mm_movemask_epi8(m);
+        if (bits) return i + __builtin_ctz(bits);
+    }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    for (; i + 16 <= len; i += 16) {
+        uint8x16_t v = vld1q_u8(s + i);
+        uint8x16_t m = vorrq_u8(vceqq_u8(v, vdupq_n_u8('"')), vceqq_u8(v, vdupq_n_u8('\\')));
+        m = vorrq_u8(m, vcleq_u8(v, vdupq_n_u8(0x1F)));
+        if (vmaxvq_u8(m)) break;
+    }
+#endif
+    for (; i < len; i++)
+        if (s[i] < 0x20 || s[i] == '"' || s[i] == '\\') break;
+    return i;
+}
+
+/* JSON-escape s into dst (room for 6*len bytes); returns bytes written */
+static int json_escape(char *dst, const unsigned char *s, int len) {
+    char *d = dst;
+    int i = 0;
+    while (i < len) {
+        int n = json_plain_len(s + i, len - i);
+        memcpy(d, s + i, n);
+        d += n;
+        i += n;
+        if (i == len) break;
+
+        unsigned char c = s[i++];
+        *d++ = '\\';
+        switch (c) {
+        case '"': *d++ = '"'; break;
+        case '\\': *d++ = '\\'; break;
+        case '\n': *d++ = 'n'; break;
+        case '\r': *d++ = 'r'; break;
+        case '\t': *d++ = 't'; break;
+        default:
+            *d++ = 'u'; *d++ = '0'; *d++ = '0';
+            *d++ = hexdigits_upper[c >> 4];
+            *d++ = hexdigits_upper[c & 0x0F];
+            break;
+        }
+    }
+    return d - dst;
+}
+
 /* Check if output bytes need $HEX[] encoding */
 static int needs_hex(const unsigned char *data, int len) {
-    for (int i = 0; i < len; i++)
+    int i = 0;
+#if defined(__SSE2__)
+    /* Signed compare: < 0x20 also catches bytes >= 0x80 */
+    const __m128i space = _mm_set1_epi8(0x20), del = _mm_set1_epi8(0x7F);
+    const __m128i colon = _mm_set1_epi8(':');
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i m = _mm_or_si128(_mm_cmplt_epi8(v, space), _mm_cmpeq_epi8(v, del));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, colon));
+        if (_mm_movemask_epi8(m)) return 1;
+    }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    for (; i + 16 <= len; i += 16) {
+        uint8x16_t v = vld1q_u8(data + i);
+        uint8x16_t m = vorrq_u8(vcltq_u8(v, vdupq_n_u8(0x20)), vcgtq_u8(v, vdupq_n_u8(0x7E)));
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(':')));
+        if (vmaxvq_u8(m)) return 1;
+    }
+#endif
+    for (; i < len; i++)
         if (data[i] < 0x20 || data[i] > 0x7E || data[i] == ':')
             return 1;
     return 0;
@@ -169,48 +445,110 @@ static int needs_hex(const unsigned char *data, int len) {
 
 
 /* ===== Dedup ===== */
+/*
+ * Open addressing on result hashes, 0 marking a free slot. The table
+ * doubles at half full: transcoding one short line can give tens of
+ * thousands of distinct results, and a full table would both probe every
+ * slot and let duplicates through. A grown table is dropped back to
+ * DEDUP_CAPACITY for the next line.
+ */
 static void dedup_reset(struct JOB *job) {
+    if (job->dedup_capacity > DEDUP_CAPACITY) {
+        free(job->dedup_hashes);
+        job->dedup_hashes = malloc(DEDUP_CAPACITY * sizeof(uint64_t));
+        job->dedup_capacity = DEDUP_CAPACITY;
+        if (!job->dedup_hashes) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(1);
+        }
+    }
     job->dedup_count = 0;
     memset(job->dedup_hashes, 0, sizeof(uint64_t) * job->dedup_capacity);
 }
 
+static void dedup_grow(struct JOB *job) {
+    int cap = 2 * job->dedup_capacity, mask = cap - 1;
+    uint64_t *h = calloc(cap, sizeof(uint64_t));
+
+    if (!h) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    for (int i = 0; i < job->dedup_capacity; i++) {
+        uint64_t v = job->dedup_hashes[i];
+        if (!v) continue;
+        int pos = (int)(v & mask);
+        while (h[pos]) pos = (pos + 1) & mask;
+        h[pos] = v;
+    }
+    free(job->dedup_hashes);
+    job->dedup_hashes = h;
+    job->dedup_capacity = cap;
+}
+
 /* Returns 1 if hash is new (inserted), 0 if already seen */
 static int dedup_insert(struct JOB *job, uint64_t hash) {
     if (!DoUnique) return 1;
-    int cap = job->dedup_capacity;
-    int idx = (int)(hash % (uint64_t)cap);
-    for (int probe = 0; probe < cap; probe++) {
-        int pos = (idx + probe) % cap;
+    if (2 * (job->dedup_count + 1) > job->dedup_capacity) dedup_grow(job);
+    int mask = job->dedup_capacity - 1;
+    for (int pos = (int)(hash & mask); ; pos = (pos + 1) & mask) {
         if (job->dedup_hashes[pos] == 0) {
             job->dedup_hashes[pos] = hash;
             job->dedup_count++;
             return 1;
         }
-        if (job->dedup_hashes[pos] == hash) {
+        if (job->dedup_hashes[pos] == hash)
             return 0;  /* Already seen */
-        }
     }
-    /* Table full, just accept */
-    return 1;
 }
 
 /* ===== Output buffering ===== */
+static void arrow_flush(struct JOB *job);
+static void arrow_sink_append(struct JOB *job, const char *data, int len);
+
+/*
+ * Jobs with a turn write in turn order: each waits for Out_turn to reach
+ * its turn before writing, and moves it on when done (end_turn).
+ */
+static lock *Out_turn;
+
+static void wait_turn(struct JOB *job) {
+    if (!job->turn) return;
+    possess(Out_turn);
+    wait_for(Out_turn, TO_BE, job->turn);
+    release(Out_turn);
+}
+
+static void end_turn(struct JOB *job) {
+    if (!job->turn) return;
+    wait_turn(job);
+    possess(Out_turn);
+    twist(Out_turn, BY, +1);
+}
+
 static void flush_output(struct JOB *job) {
+    if (job->arrow) arrow_flush(job);
     if (job->outlen == 0) return;
+    wait_turn(job);
     possess(Output_lock);
-    fwrite(job->outbuf, 1, job->outlen, stdout);
+    fwrite(job->outbuf, 1, job->outlen, job->out);
+    if (DoStream) fflush(job->out);
     release(Output_lock);
     job->outlen = 0;
 }
 
 static void output_append(struct JOB *job, const char *data, int len) {
     if (len <= 0) return;
+    if (job->arrow_sink) {
+        arrow_sink_append(job, data, len);
+        return;
+    }
     if (job->outlen + len >= job->outsize) {
         flush_output(job);
         if (len >= job->outsize) {
             /* Single line bigger than buffer: write directly */
             possess(Output_lock);
-            fwrite(data, 1, len, stdout);
+            fwrite(data, 1, len, job->out);
             release(Output_lock);
             return;
         }
@@ -219,327 +557,2265 @@ static void output_append(struct JOB *job, const char *data, int len) {
     job->outlen += len;
 }
 
+/*
+ * Reserve n bytes (at most OUTBUFSIZE) at the end of the job's output
+ * and return where to write them; output_commit then keeps what was
+ * written. Writes straight to outbuf, so not for the arrow sink.
+ */
+static inline char *output_reserve(struct JOB *job, int n) {
+    if (job->outlen + n > job->outsize) flush_output(job);
+    return job->outbuf + job->outlen;
+}
+
+static inline void output_commit(struct JOB *job, int n) {
+    job->outlen += n;
+}
+
 /* ===== Format and output one result ===== */
+#define EMIT_PIECE 16384    /* input bytes formatted per reservation */
+
 /* Helper: append small string to job output */
 static void emit_str(struct JOB *job, const char *s) {
     output_append(job, s, strlen(s));
 }
 
+/* Helper: append hex digits (no quotes) to job output */
+static void emit_hex_chars(struct JOB *job, const unsigned char *data, int len) {
+    while (len > 0) {
+        int n = len < EMIT_PIECE ? len : EMIT_PIECE;
+        hex_encode(output_reserve(job, 2 * n), data, n);
+        output_commit(job, 2 * n);
+        data += n;
+        len -= n;
+    }
+}
+
+/* Helper: append open, hex digits, close; one reservation for short data */
+static void emit_hex_framed(struct JOB *job, const char *open, int olen,
+    const unsigned char *data, int len, char close)
+{
+    if (len > EMIT_PIECE) {
+        output_append(job, open, olen);
+        emit_hex_chars(job, data, len);
+        output_append(job, &close, 1);
+        return;
+    }
+    char *p = output_reserve(job, olen + 2 * len + 1);
+    memcpy(p, open, olen);
+    hex_encode(p + olen, data, len);
+    p[olen + 2 * len] = close;
+    output_commit(job, olen + 2 * len + 1);
+}
+
 /* Helper: append data, using $HEX[] encoding if needed */
 static void emit_data(struct JOB *job, const unsigned char *data, int len) {
-    if (DoHex && needs_hex(data, len)) {
-        char hexbuf[8192];
-        /* For large data, write in chunks */
-        output_append(job, "$HEX[", 5);
-        int pos = 0;
-        for (int i = 0; i < len; i++) {
-            hexbuf[pos++] = hexdigits[data[i] >> 4];
-            hexbuf[pos++] = hexdigits[data[i] & 0x0F];
-            if (pos >= 8000) {
-                output_append(job, hexbuf, pos);
-                pos = 0;
-            }
-        }
-        if (pos > 0) output_append(job, hexbuf, pos);
-        output_append(job, "]", 1);
-    } else {
+    if (DoHex && needs_hex(data, len))
+        emit_hex_framed(job, "$HEX[", 5, data, len, ']');
+    else
         output_append(job, (const char *)data, len);
+}
+
+/* Helper: append JSON-escaped characters (no quotes) to job output */
+static void emit_json_chars(struct JOB *job, const unsigned char *s, int slen) {
+    while (slen > 0) {
+        int n = slen < EMIT_PIECE ? slen : EMIT_PIECE;
+        output_commit(job, json_escape(output_reserve(job, 6 * n), s, n));
+        s += n;
+        slen -= n;
     }
 }
 
 /* Helper: append JSON-escaped string to job output */
 static void emit_json_str(struct JOB *job, const unsigned char *s, int slen) {
-    char buf[4096];
-    int pos = 0;
-    buf[pos++] = '"';
-    for (int i = 0; i < slen; i++) {
-        if (pos >= 4000) {
-            output_append(job, buf, pos);
-            pos = 0;
-        }
-        unsigned char c = s[i];
-        if (c == '"') { buf[pos++] = '\\'; buf[pos++] = '"'; }
-        else if (c == '\\') { buf[pos++] = '\\'; buf[pos++] = '\\'; }
-        else if (c == '\n') { buf[pos++] = '\\'; buf[pos++] = 'n'; }
-        else if (c == '\r') { buf[pos++] = '\\'; buf[pos++] = 'r'; }
-        else if (c == '\t') { buf[pos++] = '\\'; buf[pos++] = 't'; }
-        else if (c < 0x20) {
-            pos += sprintf(buf + pos, "\\u%04X", c);
-        } else {
-            buf[pos++] = c;
-        }
+    if (slen > EMIT_PIECE) {
+        output_append(job, "\"", 1);
+        emit_json_chars(job, s, slen);
+        output_append(job, "\"", 1);
+        return;
     }
-    buf[pos++] = '"';
-    output_append(job, buf, pos);
+    char *p = output_reserve(job, 6 * slen + 2);
+    int n = json_escape(p + 1, s, slen);
+    p[0] = p[n + 1] = '"';
+    output_commit(job, n + 2);
 }
 
 /* Helper: append hex string to job output */
 static void emit_hex_str(struct JOB *job, const unsigned char *data, int len) {
-    char buf[4096];
-    int pos = 0;
-    buf[pos++] = '"';
-    for (int i = 0; i < len; i++) {
-        if (pos >= 4000) {
-            output_append(job, buf, pos);
-            pos = 0;
-        }
-        buf[pos++] = hexdigits[data[i] >> 4];
-        buf[pos++] = hexdigits[data[i] & 0x0F];
-    }
-    buf[pos++] = '"';
-    output_append(job, buf, pos);
+    emit_hex_framed(job, "\"", 1, data, len, '"');
 }
 
-static void emit_result(struct JOB *job,
-    const unsigned char *input, int input_len,
-    const unsigned char *output, int output_len,
-    const char *operation, const char *enc_name,
-    const char *target_enc, const char *strategy_name,
-    int had_errors, int is_first_for_line, int is_json_array)
-{
-    char tmp[256];
-    (void)had_errors;  /* Filtering done in caller */
+/* ===== Long records ===== */
+/*
+ * Records of MAXLINE bytes or more are converted LONGCHUNK bytes at a
+ * time with the charconv chunk API, so scratch stays fixed-size. Each
+ * candidate result is converted once to hash/filter it and again for
+ * every output field that is actually written.
+ */
+enum OutForm { OUT_DATA, OUT_JSON, OUT_RAW, OUT_HEX, OUT_SCAN };
 
-    switch (OutFormat) {
-    case FMT_LINES:
-        if (DoVerbose) {
-            if (is_first_for_line && !is_json_array) {
-                emit_str(job, "[input: ");
-                emit_data(job, input, input_len);
-                emit_str(job, "]\n");
-            }
-            sprintf(tmp, "  %s %s", operation, enc_name);
-            emit_str(job, tmp);
-            if (target_enc) {
-                sprintf(tmp, " -> %s", target_enc);
-                emit_str(job, tmp);
-            }
-            if (had_errors && strategy_name) {
-                sprintf(tmp, " (%s)", strategy_name);
-                emit_str(job, tmp);
-            }
-            emit_str(job, ": ");
+struct LongConv {
+    const unsigned char *input;
+    int input_len;
+    int op;                     /* MODE_DECODE, MODE_ENCODE or MODE_TRANSCODE */
+    const struct CharEncoding *src, *tgt;
+    int strategy;
+    /* Filled in by an OUT_SCAN pass */
+    int out_len;
+    uint64_t hash;
+    int identity;               /* output == input */
+    int nh;                     /* output needs $HEX[] */
+    int had_errors;             /* decode/encode (transcode: encode side) */
+    int dec_errors;             /* transcode decode side */
+    int whole;                  /* --whole-file: pieces run on the thread pool */
+};
+
+static int whole_scan(struct LongConv *lc);
+static void whole_split(const struct CharEncoding *enc, int op);
+static void whole_emit(struct JOB *job, enum OutForm form);
+
+static int long_convert(struct JOB *job, struct LongConv *lc, enum OutForm form) {
+    unsigned char *out = (unsigned char *)job->scratch, *mid = NULL;
+    int outsize = job->scratch_size, midsize = 0;
+    struct charconv_state dst, est;
+    int pos = 0, err = 0, dec_err = 0;
+
+    if (lc->whole) return whole_scan(lc);
+    if (lc->op == MODE_TRANSCODE) {
+        mid = out;
+        midsize = LONGMID;
+        out += LONGMID;
+        outsize -= LONGMID;
+    }
+    if (form == OUT_SCAN) {
+        lc->out_len = 0;
+        lc->hash = FNV1A_INIT;
+        lc->identity = 1;
+        lc->nh = 0;
+    }
+    charconv_state_init(&dst);
+    charconv_state_init(&est);
+
+    do {
+        int n = lc->input_len - pos;
+        int on;
+        if (n > LONGCHUNK) n = LONGCHUNK;
+        dst.final = est.final = (pos + n == lc->input_len);
+
+        if (lc->op == MODE_DECODE) {
+            on = charconv_decode_chunk(lc->src, &dst, lc->input + pos, n,
+                out, outsize, lc->strategy, &err);
+        } else if (lc->op == MODE_ENCODE) {
+            on = charconv_encode_chunk(lc->src, &est, lc->input + pos, n,
+                out, outsize, lc->strategy, &err);
+        } else {
+            int mid_len = charconv_decode_chunk(lc->src, &dst, lc->input + pos, n,
+                mid, midsize, DS_REPLACEMENT_FFFD, &dec_err);
+            if (mid_len < 0) return -1;
+            on = charconv_encode_chunk(lc->tgt, &est, mid, mid_len,
+                out, outsize, lc->strategy, &err);
         }
-        emit_data(job, output, output_len);
-        output_append(job, "\n", 1);
-        break;
+        if (on < 0) return -1;
 
-    case FMT_JSON:
-        emit_str(job, "{\"op\":");
-        emit_json_str(job, (const unsigned char *)operation, strlen(operation));
-        emit_str(job, ",\"enc\":");
-        emit_json_str(job, (const unsigned char *)enc_name, strlen(enc_name));
-        if (target_enc) {
-            emit_str(job, ",\"target\":");
-            emit_json_str(job, (const unsigned char *)target_enc, strlen(target_enc));
-        }
-        if (strategy_name) {
-            emit_str(job, ",\"strategy\":");
-            emit_json_str(job, (const unsigned char *)strategy_name, strlen(strategy_name));
-        }
-        emit_str(job, ",\"output\":");
-        emit_json_str(job, output, output_len);
-        emit_str(job, "}");
-        break;
+        switch (form) {
+        case OUT_SCAN:
+            lc->hash = fnv1a_update(lc->hash, out, on);
+            if (lc->identity && (lc->out_len + on > lc->input_len ||
+                    memcmp(out, lc->input + lc->out_len, on) != 0))
+                lc->identity = 0;
+            if (!lc->nh) lc->nh = needs_hex(out, on);
+            lc->out_len += on;
+            break;
+        case OUT_DATA:
+            if (DoHex && lc->nh) emit_hex_chars(job, out, on);
+            else output_append(job, (const char *)out, on);
+            break;
+        case OUT_JSON:
+            emit_json_chars(job, out, on);
+            break;
+        case OUT_RAW:
+            output_append(job, (const char *)out, on);
+            break;
+        case OUT_HEX:
+            emit_hex_chars(job, out, on);
+            break;
+        }
+        pos += n;
+    } while (pos < lc->input_len);
 
-    case FMT_TSV:
-        output_append(job, (const char *)input, input_len);
-        output_append(job, "\t", 1);
-        emit_hex_str(job, input, input_len);
-        output_append(job, "\t", 1);
-        emit_str(job, operation);
-        output_append(job, "\t", 1);
-        emit_str(job, enc_name);
-        output_append(job, "\t", 1);
-        emit_str(job, target_enc ? target_enc : "");
-        output_append(job, "\t", 1);
-        emit_str(job, strategy_name ? strategy_name : "");
-        output_append(job, "\t", 1);
-        output_append(job, (const char *)output, output_len);
-        output_append(job, "\t", 1);
-        emit_hex_str(job, output, output_len);
-        output_append(job, "\n", 1);
-        break;
+    if (form == OUT_SCAN) {
+        if (lc->out_len != lc->input_len) lc->identity = 0;
+        lc->had_errors = err;
+        lc->dec_errors = dec_err;
     }
+    return 0;
 }
 
-/* ===== Process one line through the transform pipeline ===== */
-static void process_line(struct JOB *job, const unsigned char *input, int input_len) {
-    unsigned char *scratch = (unsigned char *)job->scratch;
-    int scratch_size = job->scratch_size;
-    int is_utf8 = charconv_is_valid_utf8(input, input_len);
-    int first_result = 1;
-    int result_count = 0;
+/* Write one output field of job->lconv's current result */
+static void emit_long(struct JOB *job, enum OutForm form) {
+    struct LongConv *lc = job->lconv;
+    const char *open = "", *close = "";
 
-    dedup_reset(job);
+    if (form == OUT_DATA && DoHex && lc->nh) { open = "$HEX["; close = "]"; }
+    else if (form == OUT_JSON || form == OUT_HEX) { open = close = "\""; }
+    emit_str(job, open);
+    if (lc->whole) whole_emit(job, form);
+    else long_convert(job, lc, form);
+    emit_str(job, close);
+}
 
-    /* JSON: emit header for this input line */
-    if (OutFormat == FMT_JSON) {
-        emit_str(job, "{\"input\":");
-        emit_json_str(job, input, input_len);
-        emit_str(job, ",\"input_hex\":");
-        emit_hex_str(job, input, input_len);
-        emit_str(job, ",\"results\":[");
+/* Helper: append result output, re-converting long records on the fly */
+static void emit_output(struct JOB *job, const unsigned char *output, int output_len,
+    enum OutForm form)
+{
+    if (!output) {
+        emit_long(job, form);
+        return;
+    }
+    switch (form) {
+    case OUT_DATA: emit_data(job, output, output_len); break;
+    case OUT_JSON: emit_json_str(job, output, output_len); break;
+    case OUT_RAW: output_append(job, (const char *)output, output_len); break;
+    case OUT_HEX: emit_hex_str(job, output, output_len); break;
+    case OUT_SCAN: break;
     }
+}
 
-    /* DECODE mode */
-    if (OpMode & MODE_DECODE) {
-        for (int e = 0; e < Num_encodings; e++) {
-            if (!encodings[e].available) continue;
+/* ===== Binary output ===== */
+/*
+ * -F binary writes a header with the name tables, then one record per
+ * result; all integers little-endian:
+ *   header: "ENCFBIN" 0x01, then four tables (operations, encodings,
+ *           decode strategies, encode strategies), each a u16 count
+ *           followed by u8 length + name bytes per entry
+ *   record: u64 input index, u8 operation, u16 encoding,
+ *           u16 target (0xFFFF: none), u8 strategy (0xFF: none),
+ *           u8 flags (BIN_FLAG_*), u32 output length, output bytes
+ * --render turns it back into text.
+ */
+#define BIN_MAGIC "ENCFBIN\x01"
+#define BIN_RECHDR 19
+#define BIN_NONE8 0xFF
+#define BIN_NONE16 0xFFFF
+#define BIN_FLAG_ERRORS 1
 
-            /* Try with each strategy */
-            for (int s = 0; s < DS_COUNT; s++) {
-                int had_errors = 0;
-                int out_len = charconv_decode(&encodings[e].enc, input, input_len,
-                    scratch, scratch_size, s, &had_errors);
+static const char *op_names[] = { "decode", "encode", "transcode" };
 
-                if (out_len < 0) continue;
+/* Index into op_names for a MODE_* value */
+static inline int op_index(int op) {
+    return op == MODE_DECODE ? 0 : op == MODE_ENCODE ? 1 : 2;
+}
 
-                /* If strict succeeded without errors, skip remaining strategies */
-                if (s == DS_STRICT && !had_errors) {
-                    /* Also skip identity results (output == input) */
-                    if (out_len == input_len && memcmp(scratch, input, out_len) == 0)
-                        break;
+static inline void put_le16(unsigned char *p, unsigned v) {
+    p[0] = v; p[1] = v >> 8;
+}
 
-                    /* Dedup */
-                    uint64_t hash = fnv1a(scratch, out_len);
-                    if (!dedup_insert(job, hash)) break;
+static inline void put_le32(unsigned char *p, uint32_t v) {
+    p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
 
-                    const char *strat_name = NULL;
-                    if (OutFormat == FMT_JSON && result_count > 0)
-                        output_append(job, ",", 1);
-                    emit_result(job, input, input_len, scratch, out_len,
-                        "decode", encodings[e].enc.name, NULL, strat_name,
-                        had_errors, first_result, OutFormat == FMT_JSON);
-                    first_result = 0;
-                    result_count++;
-                    break;
-                }
+static inline void put_le64(unsigned char *p, uint64_t v) {
+    put_le32(p, (uint32_t)v);
+    put_le32(p + 4, (uint32_t)(v >> 32));
+}
 
-                /* Filter errors if requested */
-                if (DoNoErrors && had_errors) continue;
+static inline unsigned get_le16(const unsigned char *p) {
+    return p[0] | (p[1] << 8);
+}
 
-                /* Dedup */
-                uint64_t hash = fnv1a(scratch, out_len);
-                if (!dedup_insert(job, hash)) continue;
+static inline uint32_t get_le32(const unsigned char *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
 
-                /* Output */
-                const char *strat_name = charconv_decode_strategy_names[s];
-                if (OutFormat == FMT_JSON && result_count > 0)
-                    output_append(job, ",", 1);
+static inline uint64_t get_le64(const unsigned char *p) {
+    return get_le32(p) | ((uint64_t)get_le32(p + 4) << 32);
+}
 
-                emit_result(job, input, input_len, scratch, out_len,
-                    "decode", encodings[e].enc.name, NULL, strat_name,
-                    had_errors, first_result, OutFormat == FMT_JSON);
-                first_result = 0;
-                result_count++;
-            }
-        }
+static void write_name_table(FILE *fo, const char *const *names, int count, size_t stride) {
+    unsigned char n[2];
+    put_le16(n, count);
+    fwrite(n, 1, 2, fo);
+    for (int i = 0; i < count; i++) {
+        const char *name = *(const char *const *)((const char *)names + i * stride);
+        unsigned char len = strlen(name);
+        fwrite(&len, 1, 1, fo);
+        fwrite(name, 1, len, fo);
     }
+}
 
-    /* ENCODE mode */
-    if ((OpMode & MODE_ENCODE) && is_utf8) {
-        for (int e = 0; e < Num_encodings; e++) {
-            if (!encodings[e].available) continue;
+static void write_binary_header(FILE *fo) {
+    fwrite(BIN_MAGIC, 1, 8, fo);
+    write_name_table(fo, op_names, 3, sizeof(op_names[0]));
+    write_name_table(fo, &encodings[0].enc.name, Num_encodings, sizeof(encodings[0]));
+    write_name_table(fo, charconv_decode_strategy_names, DS_COUNT, sizeof(char *));
+    write_name_table(fo, charconv_encode_strategy_names, ES_COUNT, sizeof(char *));
+}
 
-            for (int s = 0; s < ES_COUNT; s++) {
-                int had_errors = 0;
-                int out_len = charconv_encode(&encodings[e].enc, input, input_len,
-                    scratch, scratch_size, s, &had_errors);
+/* ===== Arrow IPC output ===== */
+/*
+ * -F arrow writes an Arrow IPC stream: a Schema message, then one
+ * RecordBatch message per flushed job buffer, then the end-of-stream
+ * marker. Columns (in order): input (binary), op, encoding,
+ * target, strategy (utf8; target and strategy nullable), had_errors
+ * (bool), output (binary). Each job collects rows column by column and
+ * writes them as a batch when full or when it finishes its input.
+ * The flatbuffer metadata is written by the small builder below.
+ */
+#define ARROW_BATCH_ROWS 65536
+#define ARROW_MAX_DATA (1 << 30)   /* per column; offsets are int32 */
+#define ARROW_VERSION_V5 4
+#define ARROW_HDR_SCHEMA 1
+#define ARROW_HDR_RECORDBATCH 3
+#define ARROW_TYPE_BINARY 4
+#define ARROW_TYPE_UTF8 5
+#define ARROW_TYPE_BOOL 6
 
-                if (out_len < 0) continue;
+enum { AC_INPUT, AC_OP, AC_ENC, AC_TARGET, AC_STRATEGY, AC_OUTPUT, AC_COUNT };
 
-                /* If strict succeeded without errors, skip remaining strategies */
-                if (s == ES_STRICT && !had_errors) {
-                    if (out_len == input_len && memcmp(scratch, input, out_len) == 0)
-                        break;
+/* Schema order, with the column each field reads (-1: had_errors) */
+static const struct {
+    const char *name;
+    int type, nullable, col;
+} arrow_fields[] = {
+    { "input", ARROW_TYPE_BINARY, 0, AC_INPUT },
+    { "op", ARROW_TYPE_UTF8, 0, AC_OP },
+    { "encoding", ARROW_TYPE_UTF8, 0, AC_ENC },
+    { "target", ARROW_TYPE_UTF8, 1, AC_TARGET },
+    { "strategy", ARROW_TYPE_UTF8, 1, AC_STRATEGY },
+    { "had_errors", ARROW_TYPE_BOOL, 0, -1 },
+    { "output", ARROW_TYPE_BINARY, 0, AC_OUTPUT },
+};
+#define ARROW_NFIELDS (int)(sizeof(arrow_fields) / sizeof(arrow_fields[0]))
 
-                    uint64_t hash = fnv1a(scratch, out_len);
-                    if (!dedup_insert(job, hash)) break;
+struct ArrowCol {
+    int32_t *offsets;           /* rows + 1 entries */
+    unsigned char *data;
+    int64_t len, cap;
+    unsigned char *valid;       /* validity bitmap */
+    int nulls;
+};
 
-                    if (OutFormat == FMT_JSON && result_count > 0)
-                        output_append(job, ",", 1);
-                    emit_result(job, input, input_len, scratch, out_len,
-                        "encode", encodings[e].enc.name, NULL, NULL,
-                        had_errors, first_result, OutFormat == FMT_JSON);
-                    first_result = 0;
-                    result_count++;
-                    break;
-                }
+struct ArrowBatch {
+    int rows, cap;              /* cap: rows the offsets/bitmaps hold */
+    struct ArrowCol col[AC_COUNT];
+    unsigned char *errors;      /* had_errors bitmap */
+};
 
-                if (DoNoErrors && had_errors) continue;
+static void *arrow_realloc(void *p, size_t size) {
+    p = realloc(p, size);
+    if (!p) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    return p;
+}
 
-                uint64_t hash = fnv1a(scratch, out_len);
-                if (!dedup_insert(job, hash)) continue;
+static void arrow_grow_rows(struct ArrowBatch *ab) {
+    int cap = ab->cap ? ab->cap * 2 : 1024;
+    int oldbytes = ab->cap / 8, bytes = cap / 8;
 
-                const char *strat_name = charconv_encode_strategy_names[s];
-                if (OutFormat == FMT_JSON && result_count > 0)
-                    output_append(job, ",", 1);
+    for (int c = 0; c < AC_COUNT; c++) {
+        struct ArrowCol *col = &ab->col[c];
+        col->offsets = arrow_realloc(col->offsets, (cap + 1) * sizeof(int32_t));
+        col->valid = arrow_realloc(col->valid, bytes);
+        memset(col->valid + oldbytes, 0, bytes - oldbytes);
+    }
+    ab->errors = arrow_realloc(ab->errors, bytes);
+    memset(ab->errors + oldbytes, 0, bytes - oldbytes);
+    ab->cap = cap;
+}
 
-                emit_result(job, input, input_len, scratch, out_len,
-                    "encode", encodings[e].enc.name, NULL, strat_name,
-                    had_errors, first_result, OutFormat == FMT_JSON);
-                first_result = 0;
-                result_count++;
-            }
-        }
+static void arrow_col_append(struct ArrowCol *col, const void *data, int len) {
+    if (col->len + len > col->cap) {
+        while (col->len + len > col->cap)
+            col->cap = col->cap ? col->cap * 2 : 65536;
+        col->data = arrow_realloc(col->data, col->cap);
     }
+    memcpy(col->data + col->len, data, len);
+    col->len += len;
+}
 
-    /* TRANSCODE mode */
-    if (OpMode & MODE_TRANSCODE) {
-        unsigned char *mid = malloc(scratch_size);
-        if (!mid) goto end_transcode;
+/* Close the current row's value in col; NULL value if !present */
+static void arrow_col_end(struct ArrowCol *col, int row, int present) {
+    if (present) col->valid[row >> 3] |= 1 << (row & 7);
+    else col->nulls++;
+    col->offsets[row + 1] = (int32_t)col->len;
+}
 
-        for (int src = 0; src < Num_encodings; src++) {
-            if (!encodings[src].available) continue;
+static void arrow_col_str(struct ArrowCol *col, int row, const char *s) {
+    if (s) arrow_col_append(col, s, strlen(s));
+    arrow_col_end(col, row, s != NULL);
+}
 
-            /* Decode input as source encoding with FFFD replacement */
-            int had_dec_errors = 0;
-            int mid_len = charconv_decode(&encodings[src].enc, input, input_len,
-                mid, scratch_size, DS_REPLACEMENT_FFFD, &had_dec_errors);
-            if (mid_len < 0) continue;
+/* Minimal flatbuffer writer. Objects are appended front to back, so a
+ * parent is written before its children and its offset fields are
+ * patched once the child's position is known. */
+struct FlatBuf {
+    unsigned char buf[2048];
+    int len;
+};
 
-            /* Re-encode decoded text into each target encoding */
-            for (int tgt = 0; tgt < Num_encodings; tgt++) {
-                if (tgt == src) continue;
-                if (!encodings[tgt].available) continue;
+static void fb_pad(struct FlatBuf *fb, int align) {
+    while (fb->len % align) fb->buf[fb->len++] = 0;
+}
 
-                for (int s = 0; s < ES_COUNT; s++) {
-                    int had_enc_errors = 0;
-                    int out_len = charconv_encode(&encodings[tgt].enc, mid, mid_len,
-                        scratch, scratch_size, s, &had_enc_errors);
+static int fb_put(struct FlatBuf *fb, const void *data, int len) {
+    int pos = fb->len;
+    memcpy(fb->buf + pos, data, len);
+    fb->len += len;
+    return pos;
+}
+
+/* Point the uoffset field at pos to target */
+static void fb_patch(struct FlatBuf *fb, int pos, int target) {
+    put_le32(fb->buf + pos, target - pos);
+}
+
+/*
+ * Write a table. size[i] is 0 for an absent field, else 1, 2, 4 or 8
+ * (offset fields are 4 and patched later). Field positions go to pos[].
+ */
+static int fb_table(struct FlatBuf *fb, int n, const int *size, const uint64_t *value, int *pos) {
+    int vt, tab, off = 4;
+    int fieldoff[8];
+
+    /* Lay out fields after the vtable offset, each aligned to its size */
+    fb_pad(fb, 2);
+    vt = fb->len;
+    int vtsize = 4 + 2 * n;
+    int start = vt + vtsize;
+    start += (4 - start % 4) % 4;
+    for (int i = 0; i < n; i++) {
+        if (!size[i]) { fieldoff[i] = 0; continue; }
+        off += (size[i] - (start + off) % size[i]) % size[i];
+        fieldoff[i] = off;
+        off += size[i];
+    }
+    /* Keep the table's end 4-aligned */
+    off += (4 - (start + off) % 4) % 4;
+
+    unsigned char v[4 + 2 * 8];
+    put_le16(v, vtsize);
+    put_le16(v + 2, off);
+    for (int i = 0; i < n; i++)
+        put_le16(v + 4 + 2 * i, fieldoff[i]);
+    fb_put(fb, v, vtsize);
+    fb_pad(fb, 4);
+    tab = fb->len;
+    memset(fb->buf + tab, 0, off);
+    put_le32(fb->buf + tab, tab - vt);
+    for (int i = 0; i < n; i++) {
+        if (!size[i]) continue;
+        unsigned char *p = fb->buf + tab + fieldoff[i];
+        for (int b = 0; b < size[i]; b++)
+            p[b] = (unsigned char)(value[i] >> (8 * b));
+        if (pos) pos[i] = tab + fieldoff[i];
+    }
+    fb->len = tab + off;
+    return tab;
+}
+
+/* Start a vector of count elements of elemsize bytes; returns its position */
+static int fb_vector(struct FlatBuf *fb, int count, int elemsize) {
+    unsigned char n[4];
+    int align = elemsize < 4 ? 4 : elemsize;
+    while ((fb->len + 4) % align) fb->buf[fb->len++] = 0;
+    put_le32(n, count);
+    int pos = fb_put(fb, n, 4);
+    memset(fb->buf + fb->len, 0, count * elemsize);
+    fb->len += count * elemsize;
+    return pos;
+}
+
+static int fb_string(struct FlatBuf *fb, const char *s) {
+    int len = strlen(s);
+    int pos = fb_vector(fb, len + 1, 1);    /* room for the terminating NUL */
+    put_le32(fb->buf + pos, len);
+    memcpy(fb->buf + pos + 4, s, len);
+    return pos;
+}
+
+/* Message table wrapping a header; returns the header offset field */
+static int fb_message(struct FlatBuf *fb, int header_type, int64_t body_len) {
+    static const int size[] = { 2, 1, 4, 8 };
+    uint64_t value[] = { ARROW_VERSION_V5, header_type, 0, (uint64_t)body_len };
+    int pos[4];
+
+    fb->len = 0;
+    fb_put(fb, "\0\0\0\0", 4);
+    fb_patch(fb, 0, fb_table(fb, 4, size, value, pos));
+    return pos[2];
+}
+
+/* Write an encapsulated message: continuation, size, metadata, padding */
+static void arrow_write_meta(FILE *fo, struct FlatBuf *fb) {
+    unsigned char pre[8];
+    fb_pad(fb, 8);
+    put_le32(pre, 0xFFFFFFFF);
+    put_le32(pre + 4, fb->len);
+    fwrite(pre, 1, 8, fo);
+    fwrite(fb->buf, 1, fb->len, fo);
+}
+
+static void write_arrow_schema(FILE *fo) {
+    static const int field_size[] = { 4, 1, 1, 4, 0, 4 };
+    static const int schema_size[] = { 0, 4 };
+    static const uint64_t zero[6];
+    struct FlatBuf fb;
+    int spos[2], fields;
+
+    int header = fb_message(&fb, ARROW_HDR_SCHEMA, 0);
+    fb_patch(&fb, header, fb_table(&fb, 2, schema_size, zero, spos));
+    fields = fb_vector(&fb, ARROW_NFIELDS, 4);
+    fb_patch(&fb, spos[1], fields);
+    for (int i = 0; i < ARROW_NFIELDS; i++) {
+        uint64_t value[] = { 0, arrow_fields[i].nullable, arrow_fields[i].type, 0, 0, 0 };
+        int fpos[6];
+        fb_patch(&fb, fields + 4 + 4 * i, fb_table(&fb, 6, field_size, value, fpos));
+        fb_patch(&fb, fpos[0], fb_string(&fb, arrow_fields[i].name));
+        fb_patch(&fb, fpos[3], fb_table(&fb, 0, NULL, NULL, NULL));
+        fb_patch(&fb, fpos[5], fb_vector(&fb, 0, 4));
+    }
+    arrow_write_meta(fo, &fb);
+}
+
+static void write_arrow_eos(FILE *fo) {
+    unsigned char eos[8];
+    put_le32(eos, 0xFFFFFFFF);
+    put_le32(eos + 4, 0);
+    fwrite(eos, 1, 8, fo);
+}
+
+#define ARROW_PAD8(n) (((n) + 7) & ~(int64_t)7)
+
+/* Write the job's pending rows as one RecordBatch and reset */
+static void arrow_write_batch(struct JOB *job) {
+    static const int batch_size[] = { 8, 4, 4 };
+    static const unsigned char padding[8];
+    struct ArrowBatch *ab = job->arrow;
+    const void *bufdata[3 * ARROW_NFIELDS];
+    int64_t buflen[3 * ARROW_NFIELDS], body = 0;
+    int nbuf = 0, rows = ab->rows, bitmap = (rows + 7) / 8;
+    struct FlatBuf fb;
+    int bpos[3];
+
+    /* Buffers per field: validity, then offsets + data or the bool bits */
+    for (int i = 0; i < ARROW_NFIELDS; i++) {
+        int c = arrow_fields[i].col;
+        if (c < 0) {
+            bufdata[nbuf] = NULL; buflen[nbuf++] = 0;
+            bufdata[nbuf] = ab->errors; buflen[nbuf++] = bitmap;
+            continue;
+        }
+        struct ArrowCol *col = &ab->col[c];
+        bufdata[nbuf] = col->valid; buflen[nbuf++] = col->nulls ? bitmap : 0;
+        bufdata[nbuf] = col->offsets; buflen[nbuf++] = (rows + 1) * sizeof(int32_t);
+        bufdata[nbuf] = col->data; buflen[nbuf++] = col->len;
+    }
+    for (int b = 0; b < nbuf; b++)
+        body += ARROW_PAD8(buflen[b]);
+
+    int header = fb_message(&fb, ARROW_HDR_RECORDBATCH, body);
+    uint64_t value[] = { (uint64_t)rows, 0, 0 };
+    fb_patch(&fb, header, fb_table(&fb, 3, batch_size, value, bpos));
+
+    int nodes = fb_vector(&fb, ARROW_NFIELDS, 16);
+    fb_patch(&fb, bpos[1], nodes);
+    for (int i = 0; i < ARROW_NFIELDS; i++) {
+        int c = arrow_fields[i].col;
+        put_le64(fb.buf + nodes + 4 + 16 * i, rows);
+        put_le64(fb.buf + nodes + 12 + 16 * i, c < 0 ? 0 : ab->col[c].nulls);
+    }
+    int buffers = fb_vector(&fb, nbuf, 16);
+    fb_patch(&fb, bpos[2], buffers);
+    int64_t off = 0;
+    for (int b = 0; b < nbuf; b++) {
+        put_le64(fb.buf + buffers + 4 + 16 * b, off);
+        put_le64(fb.buf + buffers + 12 + 16 * b, buflen[b]);
+        off += ARROW_PAD8(buflen[b]);
+    }
+
+    wait_turn(job);
+    possess(Output_lock);
+    arrow_write_meta(job->out, &fb);
+    for (int b = 0; b < nbuf; b++) {
+        fwrite(bufdata[b], 1, buflen[b], job->out);
+        fwrite(padding, 1, ARROW_PAD8(buflen[b]) - buflen[b], job->out);
+    }
+    if (DoStream) fflush(job->out);
+    release(Output_lock);
+
+    /* Reset for the next batch */
+    for (int c = 0; c < AC_COUNT; c++) {
+        ab->col[c].len = 0;
+        ab->col[c].nulls = 0;
+        memset(ab->col[c].valid, 0, ab->cap / 8);
+    }
+    memset(ab->errors, 0, ab->cap / 8);
+    ab->rows = 0;
+}
+
+/* Add one result row to the job's batch */
+static void arrow_row(struct JOB *job,
+    const unsigned char *input, int input_len,
+    const unsigned char *output, int output_len,
+    const char *operation, const char *enc_name,
+    const char *target_enc, const char *strategy_name, int had_errors)
+{
+    struct ArrowBatch *ab = job->arrow;
+
+    if (!ab) {
+        ab = job->arrow = calloc(1, sizeof(struct ArrowBatch));
+        if (!ab) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(1);
+        }
+    }
+    if (ab->rows == ARROW_BATCH_ROWS ||
+        ab->col[AC_INPUT].len + input_len > ARROW_MAX_DATA ||
+        ab->col[AC_OUTPUT].len + output_len > ARROW_MAX_DATA)
+        arrow_write_batch(job);
+    if (ab->rows == ab->cap) arrow_grow_rows(ab);
+
+    int row = ab->rows;
+    if (row == 0)
+        for (int c = 0; c < AC_COUNT; c++)
+            ab->col[c].offsets[0] = 0;
+    arrow_col_append(&ab->col[AC_INPUT], input, input_len);
+    arrow_col_end(&ab->col[AC_INPUT], row, 1);
+    arrow_col_str(&ab->col[AC_OP], row, operation);
+    arrow_col_str(&ab->col[AC_ENC], row, enc_name);
+    arrow_col_str(&ab->col[AC_TARGET], row, target_enc);
+    arrow_col_str(&ab->col[AC_STRATEGY], row, strategy_name);
+    if (had_errors) ab->errors[row >> 3] |= 1 << (row & 7);
+
+    /* Long records re-convert through output_append: route it here */
+    job->arrow_sink = 1;
+    emit_output(job, output, output_len, OUT_RAW);
+    job->arrow_sink = 0;
+    arrow_col_end(&ab->col[AC_OUTPUT], row, 1);
+    ab->rows++;
+}
+
+static void arrow_flush(struct JOB *job) {
+    if (job->arrow->rows) arrow_write_batch(job);
+}
+
+static void arrow_sink_append(struct JOB *job, const char *data, int len) {
+    arrow_col_append(&job->arrow->col[AC_OUTPUT], data, len);
+}
+
+static void arrow_free(struct JOB *job) {
+    struct ArrowBatch *ab = job->arrow;
+    if (!ab) return;
+    for (int c = 0; c < AC_COUNT; c++) {
+        free(ab->col[c].offsets);
+        free(ab->col[c].data);
+        free(ab->col[c].valid);
+    }
+    free(ab->errors);
+    free(ab);
+    job->arrow = NULL;
+}
+
+/* Write the per-format header that precedes all results */
+static void write_output_header(FILE *fo) {
+    if (OutFormat == FMT_TSV)
+        fprintf(fo, "input\tinput_hex\toperation\tencoding\ttarget\tstrategy\toutput\toutput_hex\n");
+    else if (OutFormat == FMT_BINARY)
+        write_binary_header(fo);
+    else if (OutFormat == FMT_ARROW)
+        write_arrow_schema(fo);
+}
+
+/* ...and the trailer that follows them */
+static void write_output_trailer(FILE *fo) {
+    if (OutFormat == FMT_ARROW)
+        write_arrow_eos(fo);
+}
+
+/* ===== Result labels ===== */
+/*
+ * The fixed text around each result, built once at startup so
+ * emit_result only copies it: the verbose prefix ("  decode NAME"),
+ * the TSV columns ("decode\tNAME\t") and the JSON keys
+ * ("{\"op\":\"decode\",\"enc\":\"NAME\"").
+ */
+enum { LBL_VERBOSE, LBL_TSV, LBL_JSON, LBL_COUNT };
+
+struct Label {
+    char *s;
+    int len;
+};
+
+struct EncLabels {
+    struct Label op[LBL_COUNT][3];      /* by op_index */
+    struct Label target[LBL_COUNT];     /* as a transcode target */
+};
+
+static struct EncLabels *EncLabel;
+static struct Label StratLabel[2][LBL_COUNT][MAXSTRAT];
+static struct Label NoneLabel[LBL_COUNT] = { { "", 0 }, { "\t", 1 }, { "", 0 } };
+static int LabelMax;        /* longest op + target + strategy labels */
+
+static void set_label(struct Label *l, const char *fmt, ...) {
+    char buf[512];
+    va_list ap;
+
+    va_start(ap, fmt);
+    l->len = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    l->s = strdup(buf);
+    if (!l->s) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+}
+
+/* ===== ASCII identity ===== */
+/*
+ * Most input lines are plain ASCII, and most encodings decode and encode
+ * ASCII to itself, so process_line would convert and memcmp only to
+ * drop the result. Each encoding gets the set of ASCII bytes that
+ * convert to themselves, probed once at startup: Shift_JIS loses 0x5C
+ * and 0x7E, ISO-2022-JP loses ESC, UTF-7 loses '+', EBCDIC and
+ * UTF-16/32 keep nothing. Below 0x80 only those excluded bytes ever
+ * start a multibyte sequence or change state, so a line made only of
+ * bytes from the set converts to itself.
+ */
+struct AsciiIdentity {
+    uint64_t dec[2];
+    uint64_t enc[2];
+};
+
+static struct AsciiIdentity *AsciiId;
+static pthread_once_t AsciiOnce = PTHREAD_ONCE_INIT;
+
+static void build_ascii_identity(void) {
+    AsciiId = calloc(Num_encodings, sizeof(struct AsciiIdentity));
+    if (!AsciiId) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    for (int e = 0; e < Num_encodings; e++) {
+        const struct CharEncoding *enc = &encodings[e].enc;
+        if (!encodings[e].available) continue;
+        if (enc->type == ENC_TYPE_SINGLE_BYTE) {
+            /* Straight from the tables the converters use */
+            for (int b = 0; b < 0x80; b++)
+                if (enc->to_unicode[b] == b)
+                    AsciiId[e].dec[b >> 6] |= 1ULL << (b & 63);
+            for (int k = 0; k < enc->reverse_map_size; k++) {
+                const struct sb_reverse_entry *r = &enc->reverse_map[k];
+                if (r->codepoint >= 0x80) break;
+                if (r->byte == r->codepoint)
+                    AsciiId[e].enc[r->byte >> 6] |= 1ULL << (r->byte & 63);
+            }
+            continue;
+        }
+        for (int b = 0; b < 0x80; b++) {
+            unsigned char in = b, out[64];
+            int err = 0;
+            if (charconv_decode(enc, &in, 1, out, sizeof(out), DS_STRICT, &err) == 1 &&
+                !err && out[0] == in)
+                AsciiId[e].dec[b >> 6] |= 1ULL << (b & 63);
+            err = 0;
+            if (charconv_encode(enc, &in, 1, out, sizeof(out), ES_STRICT, &err) == 1 &&
+                !err && out[0] == in)
+                AsciiId[e].enc[b >> 6] |= 1ULL << (b & 63);
+        }
+    }
+}
+
+/* Built on first use: runs with no ASCII-only record never need it */
+static inline const struct AsciiIdentity *ascii_id(int e) {
+    pthread_once(&AsciiOnce, build_ascii_identity);
+    return &AsciiId[e];
+}
+
+/* The set of bytes in a non-empty ASCII line; 0 if it has others */
+static int ascii_bytes(const unsigned char *s, int len, uint64_t set[2]) {
+    uint64_t lo = 0, hi = 0;
+    unsigned char any = 0;
+
+    for (int i = 0; i < len; i++) {
+        unsigned char c = s[i];
+        any |= c;
+        if (c < 64) lo |= 1ULL << c;
+        else hi |= 1ULL << (c & 63);
+    }
+    set[0] = lo;
+    set[1] = hi;
+    return len > 0 && any < 0x80;
+}
+
+static inline int ascii_identity(const uint64_t id[2], const uint64_t set[2]) {
+    return !(set[0] & ~id[0]) && !(set[1] & ~id[1]);
+}
+
+/* ===== Single-byte groups ===== */
+/*
+ * Single-byte encodings that map every byte of a line to the same code
+ * point (an undefined byte counts as one value) decode it identically
+ * under every strategy. Per line, each is pointed at the first such
+ * encoding: with dedup on, the others' results are all duplicates and
+ * are skipped; with it off, the first one's results are replayed under
+ * each other name, so the output is unchanged either way. Encode groups
+ * the same way on the bytes each code point of the line encodes to.
+ */
+static int SbList[MAXENC], SbCount;
+static int SbIndex[MAXENC];             /* position in SbList, or -1 */
+
+/*
+ * The encode groups and the decode/encode lanes take a millisecond or
+ * two to build and only pay off on non-ASCII text: for arguments with
+ * fewer than LINE_TABLES_MIN non-ASCII bytes they are not built, and
+ * every encoding goes through charconv, which gives the same output.
+ */
+#define LINE_TABLES_MIN 32
+static int LineTables;                  /* encode groups and lanes are built */
+static unsigned char SbUniform[256];    /* all single-byte tables agree */
+
+static inline uint32_t sb_cp(const uint16_t *table, unsigned char b) {
+    uint32_t cp = table[b];
+    return cp == 0xFFFF ? 0xFFFD : cp;
+}
+
+static void build_decode_groups(void) {
+    SbCount = 0;
+    for (int e = 0; e < Num_encodings; e++) {
+        SbIndex[e] = -1;
+        if (encodings[e].available && encodings[e].enc.type == ENC_TYPE_SINGLE_BYTE) {
+            SbIndex[e] = SbCount;
+            SbList[SbCount++] = e;
+        }
+    }
+    for (int b = 0; b < 256; b++) {
+        SbUniform[b] = 1;
+        for (int i = 1; i < SbCount; i++)
+            if (sb_cp(encodings[SbList[i]].enc.to_unicode, b) !=
+                sb_cp(encodings[SbList[0]].enc.to_unicode, b))
+                SbUniform[b] = 0;
+    }
+}
+
+static void decode_groups(struct JOB *job, const unsigned char *input, int len) {
+    uint64_t seen[4] = { 0, 0, 0, 0 }, hash[MAXENC];
+    unsigned char bytes[256];
+    int reps[MAXENC], nrep = 0, nb = 0;
+
+    for (int e = 0; e < Num_encodings; e++) {
+        job->rep[e] = e;
+        job->shared[e] = 0;
+    }
+    job->fan.count = job->fan.used = 0;
+    if (SbCount < 2) return;
+
+    /* The bytes of the line on which the tables differ */
+    for (int i = 0; i < len; i++) {
+        unsigned char c = input[i];
+        if (SbUniform[c] || (seen[c >> 6] >> (c & 63)) & 1) continue;
+        seen[c >> 6] |= 1ULL << (c & 63);
+        bytes[nb++] = c;
+    }
+
+    for (int i = 0; i < SbCount; i++) {
+        int e = SbList[i], k;
+        const uint16_t *table = encodings[e].enc.to_unicode;
+        uint64_t h = 0;
+        /* A --serve request may narrow the encodings SbList was built on */
+        if (!encodings[e].available) continue;
+        for (int j = 0; j < nb; j++)
+            h = (h ^ sb_cp(table, bytes[j])) * 0x100000001b3ULL;
+        hash[e] = h;
+        for (k = 0; k < nrep; k++) {
+            const uint16_t *rt = encodings[reps[k]].enc.to_unicode;
+            int j;
+            if (hash[reps[k]] != h) continue;
+            for (j = 0; j < nb; j++)
+                if (sb_cp(rt, bytes[j]) != sb_cp(table, bytes[j])) break;
+            if (j == nb) break;
+        }
+        if (k < nrep) {
+            job->rep[e] = reps[k];
+            job->shared[reps[k]] = 1;
+        } else {
+            reps[nrep++] = e;
+        }
+    }
+}
+
+/*
+ * The encode side: every code point in any single-byte table, sorted,
+ * with the byte each encoding gives it (-1 when unmappable). Rows that
+ * are the same in every encoding are dropped.
+ */
+static uint32_t *SbCp;
+static short *SbCpByte;         /* [row * SbCount + i] for SbList[i] */
+static int SbCpCount;
+
+static int sb_cp_row(uint32_t cp) {
+    int lo = 0, hi = SbCpCount - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (SbCp[mid] == cp) return mid;
+        if (SbCp[mid] < cp) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    return -1;
+}
+
+static void build_encode_groups(void) {
+    int n = 0, rows = 0;
+    unsigned short *row_of;     /* row + 1 by code point; the tables are BMP-only */
+
+    if (SbCount < 2) return;
+    SbCp = malloc(SbCount * 256 * sizeof(uint32_t));
+    row_of = calloc(0x10000, sizeof(unsigned short));
+    if (!SbCp || !row_of) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    for (int i = 0; i < SbCount; i++)
+        for (int b = 0; b < 256; b++)
+            row_of[encodings[SbList[i]].enc.to_unicode[b]] = 1;
+    for (uint32_t cp = 0; cp < 0x10000; cp++)
+        if (row_of[cp]) {
+            SbCp[rows++] = cp;
+            row_of[cp] = rows;
+        }
+    SbCpCount = rows;
+
+    SbCpByte = malloc((size_t)rows * SbCount * sizeof(short));
+    if (!SbCpByte) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    for (int i = 0; i < rows * SbCount; i++) SbCpByte[i] = -1;
+
+    /* The encoder's own reverse maps resolve duplicate table entries */
+    for (int i = 0; i < SbCount; i++) {
+        const struct CharEncoding *enc = &encodings[SbList[i]].enc;
+        for (int k = 0; k < enc->reverse_map_size; k++)
+            SbCpByte[(row_of[enc->reverse_map[k].codepoint] - 1) * SbCount + i] =
+                enc->reverse_map[k].byte;
+    }
+    free(row_of);
+
+    /* Keep only the rows that tell encodings apart */
+    n = 0;
+    for (int row = 0; row < rows; row++) {
+        short *by = &SbCpByte[row * SbCount];
+        int i;
+        for (i = 1; i < SbCount; i++)
+            if (by[i] != by[0]) break;
+        if (i == SbCount) continue;
+        SbCp[n] = SbCp[row];
+        memmove(&SbCpByte[n * SbCount], by, SbCount * sizeof(short));
+        n++;
+    }
+    SbCpCount = n;
+}
+
+#define ENC_GROUP_CPS 256   /* distinct code points grouped on per line */
+
+static void encode_groups(struct JOB *job, const unsigned char *input, int len) {
+    int rows[ENC_GROUP_CPS], nrow = 0, reps[MAXENC], nrep = 0;
+    short slot[2 * ENC_GROUP_CPS];
+    uint64_t hash[MAXENC];
+
+    for (int e = 0; e < Num_encodings; e++) {
+        job->rep[e] = e;
+        job->shared[e] = 0;
+    }
+    job->fan.count = job->fan.used = 0;
+    if (SbCount < 2 || !LineTables) return;
+
+    /* The distinct rows of the line's code points */
+    memset(slot, -1, sizeof(slot));
+    for (int i = 0; i < len; ) {
+        int consumed, row, h;
+        uint32_t cp = charconv_utf8_decode(input + i, len - i, &consumed);
+        i += consumed ? consumed : 1;
+        if ((row = sb_cp_row(cp)) < 0) continue;
+        for (h = row & (2 * ENC_GROUP_CPS - 1); slot[h] >= 0 && slot[h] != row;
+            h = (h + 1) & (2 * ENC_GROUP_CPS - 1))
+            ;
+        if (slot[h] >= 0) continue;
+        if (nrow == ENC_GROUP_CPS) return;  /* too varied to be worth it */
+        slot[h] = row;
+        rows[nrow++] = row;
+    }
+
+    for (int i = 0; i < SbCount; i++) {
+        int e = SbList[i], k;
+        uint64_t h = 0;
+        if (!encodings[e].available) continue;
+        for (int j = 0; j < nrow; j++)
+            h = (h ^ (uint16_t)SbCpByte[rows[j] * SbCount + i]) * 0x100000001b3ULL;
+        hash[i] = h;
+        for (k = 0; k < nrep; k++) {
+            int ri = reps[k], j;
+            if (hash[ri] != h) continue;
+            for (j = 0; j < nrow; j++)
+                if (SbCpByte[rows[j] * SbCount + ri] != SbCpByte[rows[j] * SbCount + i]) break;
+            if (j == nrow) break;
+        }
+        if (k < nrep) {
+            job->rep[e] = SbList[reps[k]];
+            job->shared[SbList[reps[k]]] = 1;
+        } else {
+            reps[nrep++] = i;
+        }
+    }
+}
+
+/*
+ * Strategy text for a code point the target can't encode. The same code
+ * points come back for every target, so keep their text.
+ */
+#define ERRTEXT_SLOTS 1024
+
+struct ErrText {
+    uint32_t cp;
+    signed char strategy, len;
+    char text[64];
+};
+
+static const struct ErrText *err_text(struct JOB *job, uint32_t cp, int strategy) {
+    struct ErrText *t;
+    if (!job->errtext) {
+        job->errtext = malloc(ERRTEXT_SLOTS * sizeof(struct ErrText));
+        if (!job->errtext) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(1);
+        }
+        for (int i = 0; i < ERRTEXT_SLOTS; i++) job->errtext[i].strategy = -1;
+    }
+    t = &job->errtext[(cp * 31 + strategy) & (ERRTEXT_SLOTS - 1)];
+    if (t->strategy != strategy || t->cp != cp) {
+        t->cp = cp;
+        t->strategy = strategy;
+        t->len = charconv_encode_error(strategy, cp, t->text);
+    }
+    return t;
+}
+
+/* ===== Single-byte decode lanes ===== */
+/*
+ * Strict decode of one line into every single-byte encoding still in
+ * play, in one pass over the input: each byte's row of the transposed
+ * table holds its UTF-8 for every encoding (length 0 when undefined),
+ * appended to each encoding's lane with one unaligned 4-byte store. A
+ * lane that hit an undefined byte failed strict, as charconv would.
+ */
+#define LANE_MAXLINE 4096
+#define LANE_STRIDE (3 * LANE_MAXLINE + 4)
+#define LANE_NONE (-2)
+#define LANE_ERROR (-1)
+
+static uint32_t SbUtf8[256][MAXENC];    /* by SbIndex */
+static unsigned char SbUtf8Len[256][MAXENC];
+
+static void build_decode_lanes(void) {
+    for (int i = 0; i < SbCount; i++) {
+        const uint16_t *table = encodings[SbList[i]].enc.to_unicode;
+        for (int b = 0; b < 256; b++) {
+            unsigned char buf[4] = { 0, 0, 0, 0 };
+            uint32_t cp = table[b];
+            if (cp == 0xFFFD || cp == 0xFFFF) continue;
+            SbUtf8Len[b][i] = charconv_utf8_encode(cp, buf);
+            memcpy(&SbUtf8[b][i], buf, 4);
+        }
+    }
+}
+
+static void decode_lanes(struct JOB *job, const unsigned char *input, int len,
+    int is_ascii, const uint64_t ascii_set[2])
+{
+    int lane[MAXENC], pos[MAXENC], nl = 0;
+    unsigned char err[MAXENC];
+
+    for (int e = 0; e < Num_encodings; e++) job->lane_len[e] = LANE_NONE;
+    if (len > LANE_MAXLINE || !LineTables) return;
+    for (int i = 0; i < SbCount; i++) {
+        int e = SbList[i];
+        if (!encodings[e].available || job->rep[e] != e) continue;
+        if (is_ascii && ascii_identity(ascii_id(e)->dec, ascii_set)) continue;
+        pos[nl] = i * LANE_STRIDE;
+        err[nl] = 0;
+        lane[nl++] = i;
+    }
+    if (nl < 2) return;
+    if (!job->lanes) {
+        job->lanes = malloc(SbCount * LANE_STRIDE);
+        if (!job->lanes) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(1);
+        }
+    }
+
+    for (int j = 0; j < len; j++) {
+        const uint32_t *u = SbUtf8[input[j]];
+        const unsigned char *n = SbUtf8Len[input[j]];
+        for (int k = 0; k < nl; k++) {
+            memcpy(job->lanes + pos[k], &u[lane[k]], 4);
+            pos[k] += n[lane[k]];
+            err[k] |= !n[lane[k]];
+        }
+    }
+    for (int k = 0; k < nl; k++)
+        job->lane_len[SbList[lane[k]]] = err[k] ? LANE_ERROR : pos[k] - lane[k] * LANE_STRIDE;
+}
+
+/* Strict decode of e from its lane, or charconv for the rest */
+static int decode_result(struct JOB *job, int e, const unsigned char *input, int input_len,
+    unsigned char *out, int outsize, int strategy, int *had_errors)
+{
+    int n = job->lane_len[e];
+    if (strategy != DS_STRICT || n == LANE_NONE)
+        return charconv_decode(&encodings[e].enc, input, input_len,
+            out, outsize, strategy, had_errors);
+    if (n == LANE_ERROR || n > outsize) {
+        *had_errors = n == LANE_ERROR;
+        return -1;
+    }
+    memcpy(out, job->lanes + SbIndex[e] * LANE_STRIDE, n);
+    return n;
+}
+
+/* ===== Single-byte encode lanes ===== */
+/*
+ * The encode side of the lanes: each code point of the line is decoded
+ * once and its byte gathered for every single-byte encoding in play from
+ * a dense 256-code-point page (-1 where unmappable; pages nothing maps
+ * are NULL). Strict takes the lane as is. A lane with unmappable code
+ * points failed strict, and each fallback strategy rebuilds it from the
+ * pages, splicing in the strategy's text where the lane had a gap.
+ */
+static short *SbPage[256];              /* [cp & 255][SbIndex] for cp >> 8 */
+
+static void build_encode_lanes(void) {
+    for (int i = 0; i < SbCount; i++) {
+        const struct CharEncoding *enc = &encodings[SbList[i]].enc;
+        for (int k = 0; k < enc->reverse_map_size; k++) {
+            uint32_t cp = enc->reverse_map[k].codepoint;
+            if (cp > 0xFFFF) continue;
+            short *page = SbPage[cp >> 8];
+            if (!page) {
+                page = SbPage[cp >> 8] = malloc(256 * SbCount * sizeof(short));
+                if (!page) {
+                    fprintf(stderr, "Memory allocation failed\n");
+                    exit(1);
+                }
+                for (int j = 0; j < 256 * SbCount; j++) page[j] = -1;
+            }
+            page[(cp & 255) * SbCount + i] = enc->reverse_map[k].byte;
+        }
+    }
+}
+
+static inline const short *sb_page_row(uint32_t cp) {
+    const short *page = cp <= 0xFFFF ? SbPage[cp >> 8] : NULL;
+    return page ? page + (cp & 255) * SbCount : NULL;
+}
+
+static void encode_lanes(struct JOB *job, const unsigned char *input, int len,
+    int is_ascii, const uint64_t ascii_set[2])
+{
+    int lane[MAXENC], nl = 0, n = 0;
+    unsigned char bad[MAXENC];
+
+    for (int e = 0; e < Num_encodings; e++) job->lane_len[e] = LANE_NONE;
+    if (len > LANE_MAXLINE || !SbCount || !LineTables) return;
+    for (int i = 0; i < SbCount; i++) {
+        int e = SbList[i];
+        if (!encodings[e].available || job->rep[e] != e) continue;
+        if (is_ascii && ascii_identity(ascii_id(e)->enc, ascii_set)) continue;
+        bad[nl] = 0;
+        lane[nl++] = i;
+    }
+    if (nl < 2) return;
+    if (!job->lanes || !job->cps) {
+        if (!job->lanes) job->lanes = malloc(SbCount * LANE_STRIDE);
+        job->cps = malloc(LANE_MAXLINE * sizeof(uint32_t));
+        if (!job->lanes || !job->cps) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(1);
+        }
+    }
+
+    for (int j = 0; j < len; n++) {
+        int consumed;
+        uint32_t cp = charconv_utf8_decode(input + j, len - j, &consumed);
+        const short *row = sb_page_row(cp);
+        j += consumed ? consumed : 1;
+        job->cps[n] = cp;
+        for (int k = 0; k < nl; k++) {
+            short b = row ? row[lane[k]] : -1;
+            job->lanes[lane[k] * LANE_STRIDE + n] = (unsigned char)b;
+            bad[k] |= b < 0;
+        }
+    }
+    job->ncp = n;
+    for (int k = 0; k < nl; k++)
+        job->lane_len[SbList[lane[k]]] = bad[k] ? LANE_ERROR : n;
+}
+
+/* Encode e from its lane, or charconv when it has none */
+static int encode_result(struct JOB *job, int e, const unsigned char *input, int input_len,
+    unsigned char *out, int outsize, int strategy, int *had_errors)
+{
+    int n = job->lane_len[e], opos = 0, i = SbIndex[e];
+
+    if (n == LANE_NONE)
+        return charconv_encode(&encodings[e].enc, input, input_len,
+            out, outsize, strategy, had_errors);
+    if (n >= 0) {
+        if (n > outsize) return -1;
+        memcpy(out, job->lanes + i * LANE_STRIDE, n);
+        return n;
+    }
+    *had_errors = 1;
+    if (strategy == ES_STRICT) return -1;
+    for (int j = 0; j < job->ncp; j++) {
+        const short *row = sb_page_row(job->cps[j]);
+        if (row && row[i] >= 0) {
+            if (opos >= outsize) return -1;
+            out[opos++] = (unsigned char)row[i];
+            continue;
+        }
+        const struct ErrText *t = err_text(job, job->cps[j], strategy);
+        if (t->len < 0 || opos + t->len > outsize) return -1;
+        memcpy(out + opos, t->text, t->len);
+        opos += t->len;
+    }
+    return opos;
+}
+
+/* ===== Single-byte transcode maps ===== */
+/*
+ * Transcoding between two single-byte encodings is decode with U+FFFD
+ * then encode, one code point per byte, so it composes into a byte map.
+ * Each pair's map is built on first use by asking the encoder for the
+ * code point behind every source byte; bad marks the bytes the target
+ * can't encode, which get the strategy's text for that code point. A
+ * line using none of them is a single table pass under every strategy.
+ */
+struct SbPair {
+    unsigned char map[256];
+    uint64_t bad[4];
+};
+
+static struct SbPair **SbPairs;         /* [src * SbCount + tgt], by SbIndex */
+
+static void build_transcode_maps(void) {
+    if (SbCount < 2) return;
+    SbPairs = calloc((size_t)SbCount * SbCount, sizeof(struct SbPair *));
+    if (!SbPairs) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+}
+
+static const struct SbPair *sb_pair(int src, int tgt) {
+    struct SbPair **slot = &SbPairs[SbIndex[src] * SbCount + SbIndex[tgt]];
+    struct SbPair *p = __atomic_load_n(slot, __ATOMIC_ACQUIRE), *none = NULL;
+    if (p) return p;
+
+    p = calloc(1, sizeof(struct SbPair));
+    if (!p) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    for (int b = 0; b < 256; b++) {
+        unsigned char in[4], out[64];
+        int err = 0;
+        int len = charconv_utf8_encode(sb_cp(encodings[src].enc.to_unicode, b), in);
+        if (charconv_encode(&encodings[tgt].enc, in, len, out, sizeof(out), ES_STRICT, &err) == 1 &&
+            !err)
+            p->map[b] = out[0];
+        else
+            p->bad[b >> 6] |= 1ULL << (b & 63);
+    }
+    /* Another worker may have built it meanwhile; keep theirs */
+    if (!__atomic_compare_exchange_n(slot, &none, p, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        free(p);
+        p = none;
+    }
+    return p;
+}
+
+/* Same result as decoding with U+FFFD and encoding into the target */
+static int sb_pair_convert(struct JOB *job, const struct SbPair *p, const uint16_t *src_table,
+    const unsigned char *in, int len, int clean,
+    unsigned char *out, int outsize, int strategy, int *had_errors)
+{
+    int opos = 0;
+
+    if (clean) {
+        byte_translate(out, in, len, p->map);
+        return len;
+    }
+    if (strategy == ES_STRICT) {
+        *had_errors = 1;
+        return -1;
+    }
+    for (int i = 0; i < len; i++) {
+        unsigned char b = in[i];
+        if (!((p->bad[b >> 6] >> (b & 63)) & 1)) {
+            if (opos >= outsize) return -1;
+            out[opos++] = p->map[b];
+            continue;
+        }
+        const struct ErrText *t = err_text(job, sb_cp(src_table, b), strategy);
+        *had_errors = 1;
+        if (t->len < 0 || opos + t->len > outsize) return -1;
+        memcpy(out + opos, t->text, t->len);
+        opos += t->len;
+    }
+    return opos;
+}
+
+static void fan_record(struct JOB *job, int e, int strategy,
+    const unsigned char *out, int len, int had_errors)
+{
+    struct Fan *f = &job->fan;
+    if (f->num[e] == 0) f->first[e] = f->count;
+    f->num[e]++;
+    if (f->used + len > f->size) {
+        int size = f->size ? 2 * f->size : 65536;
+        while (size < f->used + len) size *= 2;
+        f->buf = realloc(f->buf, size);
+        if (!f->buf) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(1);
+        }
+        f->size = size;
+    }
+    memcpy(f->buf + f->used, out, len);
+    f->r[f->count].strategy = strategy;
+    f->r[f->count].had_errors = had_errors;
+    f->r[f->count].off = f->used;
+    f->r[f->count].len = len;
+    f->count++;
+    f->used += len;
+}
+
+static void emit_result(struct JOB *job,
+    const unsigned char *input, int input_len,
+    const unsigned char *output, int output_len,
+    int op, int enc, int tgt, int strategy,
+    int had_errors, int is_first_for_line, int is_json_array);
+
+/* Emit the results recorded for rep again under encoding e */
+static void fan_replay(struct JOB *job, const unsigned char *input, int input_len,
+    int op, int rep, int e, int *first_result, int *result_count)
+{
+    struct Fan *f = &job->fan;
+    for (int i = f->first[rep]; i < f->first[rep] + f->num[rep]; i++) {
+        if (OutFormat == FMT_JSON && *result_count > 0)
+            output_append(job, ",", 1);
+        emit_result(job, input, input_len, f->buf + f->r[i].off, f->r[i].len,
+            op, e, -1, f->r[i].strategy,
+            f->r[i].had_errors, *first_result, OutFormat == FMT_JSON);
+        *first_result = 0;
+        (*result_count)++;
+    }
+}
+
+/* Names are ASCII, but escape them as any JSON string */
+static const char *json_name(const char *name, char *buf) {
+    buf[json_escape(buf, (const unsigned char *)name, strlen(name))] = 0;
+    return buf;
+}
+
+static void build_labels(void) {
+    char ebuf[6 * 80], nbuf[6 * 80];
+    int opmax = 0, tgtmax = 0, stratmax = 0;
+
+    EncLabel = calloc(Num_encodings, sizeof(struct EncLabels));
+    if (!EncLabel) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    for (int e = 0; e < Num_encodings; e++) {
+        const char *name = encodings[e].enc.name;
+        struct EncLabels *el = &EncLabel[e];
+        json_name(name, ebuf);
+        for (int o = 0; o < 3; o++) {
+            set_label(&el->op[LBL_VERBOSE][o], "  %s %s", op_names[o], name);
+            set_label(&el->op[LBL_TSV][o], "%s\t%s\t", op_names[o], name);
+            set_label(&el->op[LBL_JSON][o], "{\"op\":\"%s\",\"enc\":\"%s\"", op_names[o], ebuf);
+            for (int f = 0; f < LBL_COUNT; f++)
+                if (el->op[f][o].len > opmax) opmax = el->op[f][o].len;
+        }
+        set_label(&el->target[LBL_VERBOSE], " -> %s", name);
+        set_label(&el->target[LBL_TSV], "%s\t", name);
+        set_label(&el->target[LBL_JSON], ",\"target\":\"%s\"", ebuf);
+        for (int f = 0; f < LBL_COUNT; f++)
+            if (el->target[f].len > tgtmax) tgtmax = el->target[f].len;
+    }
+    for (int d = 0; d < 2; d++) {
+        const char *const *names = d == 0 ? charconv_decode_strategy_names : charconv_encode_strategy_names;
+        int count = d == 0 ? DS_COUNT : ES_COUNT;
+        for (int s = 0; s < count; s++) {
+            json_name(names[s], nbuf);
+            set_label(&StratLabel[d][LBL_VERBOSE][s], " (%s)", names[s]);
+            set_label(&StratLabel[d][LBL_TSV][s], "%s\t", names[s]);
+            set_label(&StratLabel[d][LBL_JSON][s], ",\"strategy\":\"%s\"", nbuf);
+            for (int f = 0; f < LBL_COUNT; f++)
+                if (StratLabel[d][f][s].len > stratmax) stratmax = StratLabel[d][f][s].len;
+        }
+    }
+    LabelMax = opmax + tgtmax + stratmax;
+}
+
+/* ===== Result cursor ===== */
+/*
+ * emit_result reserves the worst case for a whole result up front and
+ * writes every piece in place through job->cursor. Results too big for
+ * outbuf, and long records (output == NULL), fall back to the
+ * output_append emitters piece by piece.
+ */
+static void cur_begin(struct JOB *job, int size) {
+    job->reserved = size <= job->outsize;
+    if (job->reserved) job->cursor = output_reserve(job, size);
+}
+
+static void cur_end(struct JOB *job) {
+    if (job->reserved) output_commit(job, job->cursor - (job->outbuf + job->outlen));
+    job->reserved = 0;
+}
+
+static inline void cur_bytes(struct JOB *job, const void *s, int n) {
+    if (!job->reserved) {
+        output_append(job, s, n);
+        return;
+    }
+    memcpy(job->cursor, s, n);
+    job->cursor += n;
+}
+
+static inline void cur_label(struct JOB *job, const struct Label *l) {
+    cur_bytes(job, l->s, l->len);
+}
+
+static void cur_hex(struct JOB *job, const char *open, int olen,
+    const unsigned char *data, int len, char close)
+{
+    if (!job->reserved) {
+        emit_hex_framed(job, open, olen, data, len, close);
+        return;
+    }
+    char *p = job->cursor;
+    memcpy(p, open, olen);
+    hex_encode(p + olen, data, len);
+    p[olen + 2 * len] = close;
+    job->cursor = p + olen + 2 * len + 1;
+}
+
+static void cur_data(struct JOB *job, const unsigned char *data, int len) {
+    if (DoHex && needs_hex(data, len)) cur_hex(job, "$HEX[", 5, data, len, ']');
+    else cur_bytes(job, data, len);
+}
+
+static void cur_json(struct JOB *job, const unsigned char *s, int len) {
+    if (!job->reserved) {
+        emit_json_str(job, s, len);
+        return;
+    }
+    char *p = job->cursor;
+    int n = json_escape(p + 1, s, len);
+    p[0] = p[n + 1] = '"';
+    job->cursor = p + n + 2;
+}
+
+/* An output field: reserved results always have output != NULL */
+static void cur_output(struct JOB *job, const unsigned char *output, int output_len,
+    enum OutForm form)
+{
+    if (!job->reserved) {
+        emit_output(job, output, output_len, form);
+        return;
+    }
+    switch (form) {
+    case OUT_DATA: cur_data(job, output, output_len); break;
+    case OUT_JSON: cur_json(job, output, output_len); break;
+    case OUT_RAW: cur_bytes(job, output, output_len); break;
+    case OUT_HEX: cur_hex(job, "\"", 1, output, output_len, '"'); break;
+    case OUT_SCAN: break;
+    }
+}
+
+/* ===== Direct output ===== */
+/*
+ * Plain lines output (-F lines without -v) is just the result and a
+ * newline, so process_line converts straight into the free tail of
+ * outbuf instead of scratch. emit_result commits it in place, expanding
+ * to $HEX[] backwards over itself when needed; a skipped result is never
+ * committed and the next conversion overwrites it.
+ */
+#define DIRECT_ROOM(n) (2 * (13 * (n) + 16) + 8)    /* 13x growth, then $HEX[] */
+
+static int direct_output(struct JOB *job, int input_len) {
+    return OutFormat == FMT_LINES && !DoVerbose && !job->arrow_sink &&
+        DIRECT_ROOM(input_len) <= job->outsize;
+}
+
+/* Where to convert the next result, and how much room the converter gets */
+static unsigned char *result_buf(struct JOB *job, int direct, int input_len, int *outsize) {
+    if (!direct) {
+        *outsize = job->scratch_size;
+        return (unsigned char *)job->scratch;
+    }
+    if (job->outsize - job->outlen < DIRECT_ROOM(input_len)) flush_output(job);
+    /* Leave room to double the result for $HEX[] */
+    *outsize = (job->outsize - job->outlen - 8) / 2;
+    return (unsigned char *)job->outbuf + job->outlen;
+}
+
+/* Commit a result converted at the end of outbuf */
+static void direct_commit(struct JOB *job, unsigned char *out, int len) {
+    if (DoHex && needs_hex(out, len)) {
+        /* Back to front: each byte's digits land at or after it */
+        for (int i = len - 1; i >= 0; i--) {
+            unsigned char c = out[i];
+            out[5 + 2 * i] = hexdigits[c >> 4];
+            out[6 + 2 * i] = hexdigits[c & 0x0F];
+        }
+        memcpy(out, "$HEX[", 5);
+        out[5 + 2 * len] = ']';
+        len = 2 * len + 6;
+    }
+    out[len] = '\n';
+    output_commit(job, len + 1);
+}
+
+/* op is a MODE_* value; tgt and strategy are -1 when absent */
+static void emit_result(struct JOB *job,
+    const unsigned char *input, int input_len,
+    const unsigned char *output, int output_len,
+    int op, int enc, int tgt, int strategy,
+    int had_errors, int is_first_for_line, int is_json_array)
+{
+    int opi = op_index(op), kind = op == MODE_DECODE ? 0 : 1;
+
+    if (output && output == (unsigned char *)job->outbuf + job->outlen) {
+        direct_commit(job, (unsigned char *)output, output_len);
+        return;
+    }
+
+    if (OutFormat == FMT_ARROW) {
+        const char *strategy_name = strategy < 0 ? NULL : kind == 0 ?
+            charconv_decode_strategy_names[strategy] : charconv_encode_strategy_names[strategy];
+        arrow_row(job, input, input_len, output, output_len, op_names[opi],
+            encodings[enc].enc.name, tgt >= 0 ? encodings[tgt].enc.name : NULL,
+            strategy_name, had_errors);
+        return;
+    }
+
+    /* Covers every format: labels, input up to 3x, output up to 6x */
+    if (output)
+        cur_begin(job, 64 + LabelMax + 3 * input_len + 6 * output_len);
+
+    switch (OutFormat) {
+    case FMT_LINES:
+        if (DoVerbose) {
+            if (is_first_for_line && !is_json_array) {
+                cur_bytes(job, "[input: ", 8);
+                cur_data(job, input, input_len);
+                cur_bytes(job, "]\n", 2);
+            }
+            cur_label(job, &EncLabel[enc].op[LBL_VERBOSE][opi]);
+            if (tgt >= 0) cur_label(job, &EncLabel[tgt].target[LBL_VERBOSE]);
+            if (had_errors && strategy >= 0)
+                cur_label(job, &StratLabel[kind][LBL_VERBOSE][strategy]);
+            cur_bytes(job, ": ", 2);
+        }
+        cur_output(job, output, output_len, OUT_DATA);
+        cur_bytes(job, "\n", 1);
+        break;
+
+    case FMT_JSON:
+        cur_label(job, &EncLabel[enc].op[LBL_JSON][opi]);
+        if (tgt >= 0) cur_label(job, &EncLabel[tgt].target[LBL_JSON]);
+        if (strategy >= 0) cur_label(job, &StratLabel[kind][LBL_JSON][strategy]);
+        cur_bytes(job, ",\"output\":", 10);
+        cur_output(job, output, output_len, OUT_JSON);
+        cur_bytes(job, "}", 1);
+        break;
+
+    case FMT_TSV:
+        cur_bytes(job, input, input_len);
+        cur_hex(job, "\t\"", 2, input, input_len, '"');
+        cur_bytes(job, "\t", 1);
+        cur_label(job, &EncLabel[enc].op[LBL_TSV][opi]);
+        cur_label(job, tgt >= 0 ? &EncLabel[tgt].target[LBL_TSV] : &NoneLabel[LBL_TSV]);
+        cur_label(job, strategy >= 0 ? &StratLabel[kind][LBL_TSV][strategy] : &NoneLabel[LBL_TSV]);
+        cur_output(job, output, output_len, OUT_RAW);
+        cur_bytes(job, "\t", 1);
+        cur_output(job, output, output_len, OUT_HEX);
+        cur_bytes(job, "\n", 1);
+        break;
+
+    case FMT_BINARY: {
+        unsigned char hdr[BIN_RECHDR];
+        put_le64(hdr, job->recno);
+        hdr[8] = opi;
+        put_le16(hdr + 9, enc);
+        put_le16(hdr + 11, tgt >= 0 ? tgt : BIN_NONE16);
+        hdr[13] = strategy >= 0 ? strategy : BIN_NONE8;
+        hdr[14] = had_errors ? BIN_FLAG_ERRORS : 0;
+        put_le32(hdr + 15, output_len);
+        cur_bytes(job, hdr, BIN_RECHDR);
+        cur_output(job, output, output_len, OUT_RAW);
+        break;
+    }
+
+    case FMT_ARROW:
+        break;
+    }
+    cur_end(job);
+}
+
+/* ===== Process a long record through the transform pipeline ===== */
+/* Same decisions as process_line, on results converted in pieces */
+static void process_long_line(struct JOB *job, const unsigned char *input, int input_len,
+    int whole)
+{
+    int is_utf8 = charconv_is_valid_utf8(input, input_len);
+    int first_result = 1;
+    int result_count = 0;
+    struct LongConv lc;
+
+    memset(&lc, 0, sizeof(lc));
+    lc.input = input;
+    lc.input_len = input_len;
+    lc.whole = whole;
+    job->lconv = &lc;
+    dedup_reset(job);
+
+    if (OutFormat == FMT_JSON) {
+        emit_str(job, "{\"input\":");
+        emit_json_str(job, input, input_len);
+        emit_str(job, ",\"input_hex\":");
+        emit_hex_str(job, input, input_len);
+        emit_str(job, ",\"results\":[");
+    }
+
+    if (OpMode & MODE_DECODE) {
+        lc.op = MODE_DECODE;
+        for (int e = 0; e < Num_encodings; e++) {
+            if (!encodings[e].available) continue;
+            lc.src = &encodings[e].enc;
+            if (whole) whole_split(lc.src, MODE_DECODE);
+
+            for (int s = 0; s < DS_COUNT; s++) {
+                lc.strategy = s;
+                if (long_convert(job, &lc, OUT_SCAN) < 0) continue;
 
-                    if (out_len < 0) continue;
+                if (s == DS_STRICT && !lc.had_errors) {
+                    if (lc.identity) break;
+                    if (!dedup_insert(job, lc.hash)) break;
+                    if (OutFormat == FMT_JSON && result_count > 0)
+                        output_append(job, ",", 1);
+                    emit_result(job, input, input_len, NULL, lc.out_len,
+                        MODE_DECODE, e, -1, -1,
+                        0, first_result, OutFormat == FMT_JSON);
+                    first_result = 0;
+                    result_count++;
+                    break;
+                }
 
-                    if (out_len == input_len && memcmp(scratch, input, out_len) == 0
-                        && s == ES_STRICT)
-                        continue;
+                if (DoNoErrors && lc.had_errors) continue;
+                if (!dedup_insert(job, lc.hash)) continue;
+                if (OutFormat == FMT_JSON && result_count > 0)
+                    output_append(job, ",", 1);
+                emit_result(job, input, input_len, NULL, lc.out_len,
+                    MODE_DECODE, e, -1, s,
+                    lc.had_errors, first_result, OutFormat == FMT_JSON);
+                first_result = 0;
+                result_count++;
+            }
+        }
+    }
 
-                    if (DoNoErrors && (had_dec_errors || had_enc_errors)) continue;
+    if ((OpMode & MODE_ENCODE) && is_utf8) {
+        lc.op = MODE_ENCODE;
+        for (int e = 0; e < Num_encodings; e++) {
+            if (!encodings[e].available) continue;
+            lc.src = &encodings[e].enc;
+            if (whole) whole_split(lc.src, MODE_ENCODE);
 
-                    uint64_t hash = fnv1a(scratch, out_len);
-                    if (!dedup_insert(job, hash)) continue;
+            for (int s = 0; s < ES_COUNT; s++) {
+                lc.strategy = s;
+                if (long_convert(job, &lc, OUT_SCAN) < 0) continue;
 
-                    const char *strat_name = (s == ES_STRICT) ? NULL :
-                        charconv_encode_strategy_names[s];
+                if (s == ES_STRICT && !lc.had_errors) {
+                    if (lc.identity) break;
+                    if (!dedup_insert(job, lc.hash)) break;
                     if (OutFormat == FMT_JSON && result_count > 0)
                         output_append(job, ",", 1);
+                    emit_result(job, input, input_len, NULL, lc.out_len,
+                        MODE_ENCODE, e, -1, -1,
+                        0, first_result, OutFormat == FMT_JSON);
+                    first_result = 0;
+                    result_count++;
+                    break;
+                }
+
+                if (DoNoErrors && lc.had_errors) continue;
+                if (!dedup_insert(job, lc.hash)) continue;
+                if (OutFormat == FMT_JSON && result_count > 0)
+                    output_append(job, ",", 1);
+                emit_result(job, input, input_len, NULL, lc.out_len,
+                    MODE_ENCODE, e, -1, s,
+                    lc.had_errors, first_result, OutFormat == FMT_JSON);
+                first_result = 0;
+                result_count++;
+            }
+        }
+    }
+
+    /* Transcode pieces would each end the target's shift state */
+    if ((OpMode & MODE_TRANSCODE) && !whole) {
+        lc.op = MODE_TRANSCODE;
+        for (int src = 0; src < Num_encodings; src++) {
+            if (!encodings[src].available) continue;
+            lc.src = &encodings[src].enc;
 
-                    emit_result(job, input, input_len, scratch, out_len,
-                        "transcode", encodings[src].enc.name,
-                        encodings[tgt].enc.name,
-                        strat_name, had_dec_errors || had_enc_errors,
+            for (int tgt = 0; tgt < Num_encodings; tgt++) {
+                if (tgt == src) continue;
+                if (!encodings[tgt].available) continue;
+                lc.tgt = &encodings[tgt].enc;
+
+                for (int s = 0; s < ES_COUNT; s++) {
+                    lc.strategy = s;
+                    if (long_convert(job, &lc, OUT_SCAN) < 0) continue;
+
+                    if (lc.identity && s == ES_STRICT) continue;
+                    if (DoNoErrors && (lc.dec_errors || lc.had_errors)) continue;
+                    if (!dedup_insert(job, lc.hash)) continue;
+
+                    if (OutFormat == FMT_JSON && result_count > 0)
+                        output_append(job, ",", 1);
+                    emit_result(job, input, input_len, NULL, lc.out_len,
+                        MODE_TRANSCODE, src, tgt, (s == ES_STRICT) ? -1 : s,
+                        lc.dec_errors || lc.had_errors,
                         first_result, OutFormat == FMT_JSON);
                     first_result = 0;
                     result_count++;
 
-                    if (s == ES_STRICT && !had_enc_errors) break;
+                    if (s == ES_STRICT && !lc.had_errors) break;
+                }
+            }
+        }
+    }
+
+    if (OutFormat == FMT_JSON) {
+        output_append(job, "]}\n", 3);
+    }
+    job->lconv = NULL;
+}
+
+/* ===== Transcode one source ===== */
+/* What every source's transcode needs to know about the line */
+struct TranscodeLine {
+    const unsigned char *input;
+    int input_len, is_ascii, direct;
+    uint64_t ascii_set[2], line_set[4];
+};
+
+/* One source's results, kept for split_merge */
+struct SplitSrc {
+    int done;                   /* results complete (atomic) */
+    int count, cap;
+    struct {
+        uint64_t hash;
+        short tgt;
+        signed char strategy;
+        char had_errors;
+        int off, len;
+    } *r;
+    unsigned char *buf;
+    int used, size;
+};
+
+static void split_record(struct SplitSrc *ss, uint64_t hash, int tgt, int strategy,
+    int had_errors, const unsigned char *out, int len)
+{
+    if (ss->count == ss->cap) {
+        ss->cap = ss->cap ? 2 * ss->cap : 256;
+        ss->r = realloc(ss->r, ss->cap * sizeof(ss->r[0]));
+        if (!ss->r) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(1);
+        }
+    }
+    if (ss->used + len > ss->size) {
+        int size = ss->size ? 2 * ss->size : 65536;
+        while (size < ss->used + len) size *= 2;
+        ss->buf = realloc(ss->buf, size);
+        if (!ss->buf) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(1);
+        }
+        ss->size = size;
+    }
+    memcpy(ss->buf + ss->used, out, len);
+    ss->r[ss->count].hash = hash;
+    ss->r[ss->count].tgt = tgt;
+    ss->r[ss->count].strategy = strategy;
+    ss->r[ss->count].had_errors = had_errors;
+    ss->r[ss->count].off = ss->used;
+    ss->r[ss->count].len = len;
+    ss->count++;
+    ss->used += len;
+}
+
+/*
+ * Decode the line as src, then encode it into every other encoding under
+ * each strategy. With sink NULL each new result is written out; otherwise
+ * it goes to sink, new meaning new to job's own dedup table.
+ */
+static void transcode_source(struct JOB *job, const struct TranscodeLine *tl, int src,
+    unsigned char *mid, struct SplitSrc *sink, int *first_result, int *result_count)
+{
+    const unsigned char *input = tl->input;
+    int input_len = tl->input_len, scratch_size = job->scratch_size;
+    int direct = sink ? 0 : tl->direct, outsize;
+    const uint64_t *line_set = tl->line_set;
+
+    /* Decode input as source encoding with FFFD replacement */
+    int had_dec_errors = 0, mid_len;
+    int mid_ascii = tl->is_ascii && ascii_identity(ascii_id(src)->dec, tl->ascii_set);
+    if (mid_ascii) {
+        memcpy(mid, input, input_len);
+        mid_len = input_len;
+    } else {
+        mid_len = charconv_decode(&encodings[src].enc, input, input_len,
+            mid, scratch_size, DS_REPLACEMENT_FFFD, &had_dec_errors);
+        if (mid_len < 0) return;
+    }
+    /* Strategies grow the decoded text, which can be longer than the input */
+    direct = direct && direct_output(job, mid_len);
+
+    /* Re-encode decoded text into each target encoding */
+    for (int tgt = 0; tgt < Num_encodings; tgt++) {
+        if (tgt == src) continue;
+        if (!encodings[tgt].available) continue;
+
+        /* Strict would give the input back, which is dropped */
+        int first_s = mid_ascii && ascii_identity(ascii_id(tgt)->enc, tl->ascii_set);
+
+        /* Both single-byte: straight through the pair's byte map */
+        const struct SbPair *pair = NULL;
+        int clean = 0;
+        if (SbPairs && SbIndex[src] >= 0 && SbIndex[tgt] >= 0) {
+            pair = sb_pair(src, tgt);
+            clean = !((line_set[0] & pair->bad[0]) | (line_set[1] & pair->bad[1]) |
+                (line_set[2] & pair->bad[2]) | (line_set[3] & pair->bad[3]));
+        }
+
+        for (int s = first_s; s < ES_COUNT; s++) {
+            unsigned char *out = result_buf(job, direct, mid_len, &outsize);
+            int had_enc_errors = 0, out_len;
+            if (pair) {
+                out_len = sb_pair_convert(job, pair, encodings[src].enc.to_unicode,
+                    input, input_len, clean, out, outsize, s, &had_enc_errors);
+            } else {
+                out_len = charconv_encode(&encodings[tgt].enc, mid, mid_len,
+                    out, outsize, s, &had_enc_errors);
+            }
+
+            if (out_len < 0) continue;
+
+            if (out_len == input_len && memcmp(out, input, out_len) == 0
+                && s == ES_STRICT)
+                continue;
+
+            if (DoNoErrors && (had_dec_errors || had_enc_errors)) continue;
+
+            uint64_t hash = fnv1a(out, out_len);
+            if (!dedup_insert(job, hash)) continue;
+
+            if (sink) {
+                split_record(sink, hash, tgt, (s == ES_STRICT) ? -1 : s,
+                    had_dec_errors || had_enc_errors, out, out_len);
+            } else {
+                if (OutFormat == FMT_JSON && *result_count > 0)
+                    output_append(job, ",", 1);
+
+                emit_result(job, input, input_len, out, out_len,
+                    MODE_TRANSCODE, src, tgt, (s == ES_STRICT) ? -1 : s,
+                    had_dec_errors || had_enc_errors,
+                    *first_result, OutFormat == FMT_JSON);
+                *first_result = 0;
+                (*result_count)++;
+            }
+
+            if (s == ES_STRICT && !had_enc_errors) break;
+        }
+    }
+}
+
+/* ===== Split transcode ===== */
+/*
+ * Transcoding one line is a conversion per (source, target, strategy),
+ * over a million for a short line with every encoding. When a line is
+ * that expensive and jobs are free, each free job is queued as a helper
+ * (every free job has an idle worker behind it): this thread and the
+ * helpers take sources in turn, each keeping the results new to its own
+ * dedup table, and this thread merges finished sources in order through
+ * the line's table. A result dropped by a helper was seen earlier in that
+ * order, so the merge drops it too and the output is the same as one
+ * pass. The one control-flow difference is harmless: after a strict
+ * result without errors the helper stops even if the line's table
+ * already had it, where one pass tries the other strategies, and with
+ * nothing to replace those give the same bytes.
+ *
+ * Helpers use their own job's buffers, and this thread's part and the
+ * per-source results live in the job's Split, so nothing is allocated
+ * per line once they have grown. Measured on one core, a split costs
+ * about 5 us of queueing and handoff per line, plus up to 60% more work
+ * per result kept (each is copied, then deduplicated twice). A cost unit
+ * of (input bytes + 16) x source/target pairs converts in 0.1-0.4 us, so
+ * SPLIT_MINCOST is at least 0.5 ms of work, where a second thread gains
+ * well over the fixed cost and a wakeup.
+ */
+#define SPLIT_MINCOST 5000
+#define SPLIT_MAXLINE 65536     /* longest line split (results are held) */
+
+struct Split {
+    const struct TranscodeLine *tl;
+    int next;                   /* next source to take (atomic) */
+    lock *busy;                 /* helpers still taking sources */
+    struct JOB self;            /* this thread's part: scratch, mid, dedup */
+    struct SplitSrc src[MAXENC];
+};
+
+static void queue_helper(struct JOB *job);
+
+/* Transcode scratch for the decoded line, allocated on first use */
+static unsigned char *job_mid(struct JOB *job) {
+    if (!job->mid) {
+        job->mid = malloc(SCRATCH_SIZE);
+        if (!job->mid) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(1);
+        }
+    }
+    return job->mid;
+}
+
+/* A free job, or NULL without waiting if all are busy */
+static struct JOB *try_free_job(void) {
+    struct JOB *job = NULL;
+
+    possess(FreeWaiting);
+    if (peek_lock(FreeWaiting) == 0) {
+        release(FreeWaiting);
+        return NULL;
+    }
+    job = FreeHead;
+    FreeHead = job->next;
+    if (FreeHead == NULL) FreeTail = &FreeHead;
+    twist(FreeWaiting, BY, -1);
+    job->next = NULL;
+    return job;
+}
+
+static struct Split *new_split(void) {
+    struct Split *sp = calloc(1, sizeof(struct Split));
+
+    if (!sp || !(sp->busy = new_lock(0)) ||
+        !(sp->self.scratch = malloc(SCRATCH_SIZE)) ||
+        !(sp->self.dedup_hashes = calloc(DEDUP_CAPACITY, sizeof(uint64_t)))) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    sp->self.scratch_size = SCRATCH_SIZE;
+    sp->self.dedup_capacity = DEDUP_CAPACITY;
+    return sp;
+}
+
+static void free_split(struct Split *sp) {
+    if (!sp) return;
+    for (int i = 0; i < (int)MAXENC; i++) {
+        free(sp->src[i].r);
+        free(sp->src[i].buf);
+    }
+    free(sp->self.scratch);
+    free(sp->self.dedup_hashes);
+    free(sp->self.errtext);
+    free(sp->self.mid);
+    free_lock(sp->busy);
+    free(sp);
+}
+
+/* Take sources until none are left; returns the last one taken, or -1 */
+static int split_take(struct JOB *job, struct Split *sp) {
+    int src = __atomic_fetch_add(&sp->next, 1, __ATOMIC_RELAXED);
+
+    if (src >= Num_encodings) return -1;
+    if (encodings[src].available)
+        transcode_source(job, sp->tl, src, job_mid(job), &sp->src[src], NULL, NULL);
+    __atomic_store_n(&sp->src[src].done, 1, __ATOMIC_RELEASE);
+    return src;
+}
+
+/* JOB_SPLIT: help until the line's sources are all taken */
+static void split_help(struct JOB *job) {
+    struct Split *sp = job->help;
+
+    dedup_reset(job);
+    while (split_take(job, sp) >= 0)
+        ;
+    possess(sp->busy);
+    twist(sp->busy, BY, -1);
+}
+
+static void split_merge(struct JOB *job, const struct TranscodeLine *tl, int src,
+    struct SplitSrc *ss, int *first_result, int *result_count)
+{
+    for (int i = 0; i < ss->count; i++) {
+        if (!dedup_insert(job, ss->r[i].hash)) continue;
+        if (OutFormat == FMT_JSON && *result_count > 0)
+            output_append(job, ",", 1);
+        emit_result(job, tl->input, tl->input_len, ss->buf + ss->r[i].off, ss->r[i].len,
+            MODE_TRANSCODE, src, ss->r[i].tgt, ss->r[i].strategy, ss->r[i].had_errors,
+            *first_result, OutFormat == FMT_JSON);
+        *first_result = 0;
+        (*result_count)++;
+    }
+}
+
+/* Transcode the line with whatever jobs are free; 0 if none were */
+static int transcode_split(struct JOB *job, const struct TranscodeLine *tl,
+    int *first_result, int *result_count)
+{
+    struct JOB *helper = try_free_job();
+    int merged = 0, helpers = 0;
+
+    if (!helper) return 0;
+    if (!job->split) job->split = new_split();
+    struct Split *sp = job->split;
+    sp->tl = tl;
+    sp->next = 0;
+    for (int i = 0; i < Num_encodings; i++) {
+        sp->src[i].done = 0;
+        sp->src[i].count = 0;
+        sp->src[i].used = 0;
+    }
+    dedup_reset(&sp->self);
+
+    while (helper) {
+        helper->func = JOB_SPLIT;
+        helper->help = sp;
+        possess(sp->busy);
+        twist(sp->busy, BY, +1);
+        queue_helper(helper);
+        helper = ++helpers < Num_encodings - 1 ? try_free_job() : NULL;
+    }
+
+    /* Convert here too, merging whatever is finished in order between sources */
+    while (split_take(&sp->self, sp) >= 0) {
+        while (merged < Num_encodings &&
+            __atomic_load_n(&sp->src[merged].done, __ATOMIC_ACQUIRE)) {
+            split_merge(job, tl, merged, &sp->src[merged], first_result, result_count);
+            merged++;
+        }
+    }
+    possess(sp->busy);
+    wait_for(sp->busy, TO_BE, 0);
+    release(sp->busy);
+    for (; merged < Num_encodings; merged++)
+        split_merge(job, tl, merged, &sp->src[merged], first_result, result_count);
+    return 1;
+}
+
+/* ===== Process one line through the transform pipeline ===== */
+static void process_line(struct JOB *job, const unsigned char *input, int input_len) {
+    int is_utf8, is_ascii, direct, outsize;
+    uint64_t ascii_set[2];
+    int first_result = 1;
+    int result_count = 0;
+
+    if (input_len >= MAXLINE) {
+        process_long_line(job, input, input_len, 0);
+        return;
+    }
+    is_ascii = ascii_bytes(input, input_len, ascii_set);
+    is_utf8 = is_ascii || charconv_is_valid_utf8(input, input_len);
+    direct = direct_output(job, input_len);
+    dedup_reset(job);
+
+    /* JSON: emit header for this input line */
+    if (OutFormat == FMT_JSON) {
+        emit_str(job, "{\"input\":");
+        emit_json_str(job, input, input_len);
+        emit_str(job, ",\"input_hex\":");
+        emit_hex_str(job, input, input_len);
+        emit_str(job, ",\"results\":[");
+    }
+
+    /* DECODE mode */
+    if (OpMode & MODE_DECODE) {
+        decode_groups(job, input, input_len);
+        decode_lanes(job, input, input_len, is_ascii, ascii_set);
+        for (int e = 0; e < Num_encodings; e++) {
+            if (!encodings[e].available) continue;
+            /* Decodes to itself: strict would succeed and be dropped */
+            if (is_ascii && ascii_identity(ascii_id(e)->dec, ascii_set)) continue;
+
+            /* Same text as an earlier encoding: all duplicates, or a replay */
+            if (job->rep[e] != e) {
+                if (!DoUnique)
+                    fan_replay(job, input, input_len, MODE_DECODE, job->rep[e], e,
+                        &first_result, &result_count);
+                continue;
+            }
+            int record = !DoUnique && job->shared[e];
+            job->fan.num[e] = 0;
+
+            /* Try with each strategy */
+            for (int s = 0; s < DS_COUNT; s++) {
+                unsigned char *out = result_buf(job, direct, input_len, &outsize);
+                int had_errors = 0;
+                int out_len = decode_result(job, e, input, input_len,
+                    out, outsize, s, &had_errors);
+
+                if (out_len < 0) continue;
+
+                /* If strict succeeded without errors, skip remaining strategies */
+                if (s == DS_STRICT && !had_errors) {
+                    /* Also skip identity results (output == input) */
+                    if (out_len == input_len && memcmp(out, input, out_len) == 0)
+                        break;
+
+                    /* Dedup */
+                    uint64_t hash = fnv1a(out, out_len);
+                    if (!dedup_insert(job, hash)) break;
+
+                    if (OutFormat == FMT_JSON && result_count > 0)
+                        output_append(job, ",", 1);
+                    if (record) fan_record(job, e, -1, out, out_len, had_errors);
+                    emit_result(job, input, input_len, out, out_len,
+                        MODE_DECODE, e, -1, -1,
+                        had_errors, first_result, OutFormat == FMT_JSON);
+                    first_result = 0;
+                    result_count++;
+                    break;
+                }
+
+                /* Filter errors if requested */
+                if (DoNoErrors && had_errors) continue;
+
+                /* Dedup */
+                uint64_t hash = fnv1a(out, out_len);
+                if (!dedup_insert(job, hash)) continue;
+
+                /* Output */
+                if (OutFormat == FMT_JSON && result_count > 0)
+                    output_append(job, ",", 1);
+
+                if (record) fan_record(job, e, s, out, out_len, had_errors);
+                emit_result(job, input, input_len, out, out_len,
+                    MODE_DECODE, e, -1, s,
+                    had_errors, first_result, OutFormat == FMT_JSON);
+                first_result = 0;
+                result_count++;
+            }
+        }
+    }
+
+    /* ENCODE mode */
+    if ((OpMode & MODE_ENCODE) && is_utf8) {
+        encode_groups(job, input, input_len);
+        encode_lanes(job, input, input_len, is_ascii, ascii_set);
+        for (int e = 0; e < Num_encodings; e++) {
+            if (!encodings[e].available) continue;
+            if (is_ascii && ascii_identity(ascii_id(e)->enc, ascii_set)) continue;
+
+            if (job->rep[e] != e) {
+                if (!DoUnique)
+                    fan_replay(job, input, input_len, MODE_ENCODE, job->rep[e], e,
+                        &first_result, &result_count);
+                continue;
+            }
+            int record = !DoUnique && job->shared[e];
+            job->fan.num[e] = 0;
+
+            for (int s = 0; s < ES_COUNT; s++) {
+                unsigned char *out = result_buf(job, direct, input_len, &outsize);
+                int had_errors = 0;
+                int out_len = encode_result(job, e, input, input_len,
+                    out, outsize, s, &had_errors);
+
+                if (out_len < 0) continue;
+
+                /* If strict succeeded without errors, skip remaining strategies */
+                if (s == ES_STRICT && !had_errors) {
+                    if (out_len == input_len && memcmp(out, input, out_len) == 0)
+                        break;
+
+                    uint64_t hash = fnv1a(out, out_len);
+                    if (!dedup_insert(job, hash)) break;
+
+                    if (OutFormat == FMT_JSON && result_count > 0)
+                        output_append(job, ",", 1);
+                    if (record) fan_record(job, e, -1, out, out_len, had_errors);
+                    emit_result(job, input, input_len, out, out_len,
+                        MODE_ENCODE, e, -1, -1,
+                        had_errors, first_result, OutFormat == FMT_JSON);
+                    first_result = 0;
+                    result_count++;
+                    break;
                 }
+
+                if (DoNoErrors && had_errors) continue;
+
+                uint64_t hash = fnv1a(out, out_len);
+                if (!dedup_insert(job, hash)) continue;
+
+                if (OutFormat == FMT_JSON && result_count > 0)
+                    output_append(job, ",", 1);
+
+                if (record) fan_record(job, e, s, out, out_len, had_errors);
+                emit_result(job, input, input_len, out, out_len,
+                    MODE_ENCODE, e, -1, s,
+                    had_errors, first_result, OutFormat == FMT_JSON);
+                first_result = 0;
+                result_count++;
             }
         }
-        free(mid);
     }
-end_transcode:
+
+    /* TRANSCODE mode */
+    if (OpMode & MODE_TRANSCODE) {
+        struct TranscodeLine tl;
+        int navail = 0;
+
+        tl.input = input;
+        tl.input_len = input_len;
+        tl.is_ascii = is_ascii;
+        tl.direct = direct;
+        memcpy(tl.ascii_set, ascii_set, sizeof(tl.ascii_set));
+        memset(tl.line_set, 0, sizeof(tl.line_set));
+        for (int i = 0; i < input_len; i++)
+            tl.line_set[input[i] >> 6] |= 1ULL << (input[i] & 63);
+
+        for (int e = 0; e < Num_encodings; e++)
+            navail += encodings[e].available;
+        if (!(Maxt > 1 && input_len <= SPLIT_MAXLINE &&
+              (int64_t)(input_len + 16) * navail * (navail - 1) >= SPLIT_MINCOST &&
+              transcode_split(job, &tl, &first_result, &result_count))) {
+            for (int src = 0; src < Num_encodings; src++)
+                if (encodings[src].available)
+                    transcode_source(job, &tl, src, job_mid(job), NULL,
+                        &first_result, &result_count);
+        }
+    }
 
     /* Close JSON array for this line */
     if (OutFormat == FMT_JSON) {
@@ -547,6 +2823,8 @@ end_transcode:
     }
 }
 
+static void whole_piece(struct JOB *job);
+
 /* ===== Worker thread function ===== */
 static void procjob(void *dummy) {
     struct JOB *job;
@@ -570,22 +2848,27 @@ static void procjob(void *dummy) {
         twist(WorkWaiting, BY, -1);
         job->next = NULL;
 
-        if (job->func == JOB_PROCESS) {
+        if (job->func == JOB_PROCESS || job->func == JOB_RECORDS) {
             for (int i = 0; i < job->numline; i++) {
                 unsigned char *line = (unsigned char *)&job->readbuf[job->readindex[i].offset];
                 int len = job->readindex[i].len;
+                job->recno = job->startline + i;
                 process_line(job, line, len);
             }
             flush_output(job);
-        }
-
-        /* Release read buffer */
-        if (job->readbuf == Readbuf) {
-            possess(ReadBuf0);
-            twist(ReadBuf0, BY, -1);
-        } else {
-            possess(ReadBuf1);
-            twist(ReadBuf1, BY, -1);
+
+            end_turn(job);
+
+            /* Release read buffer; JOB_RECORDS buffers belong to the caller */
+            if (job->func == JOB_PROCESS) {
+                lock *rb = job->readbuf == Readbuf ? ReadBuf0 : ReadBuf1;
+                possess(rb);
+                twist(rb, BY, -1);
+            }
+        } else if (job->func == JOB_WHOLE) {
+            whole_piece(job);
+        } else if (job->func == JOB_SPLIT) {
+            split_help(job);
         }
 
         /* Return job to free list */
@@ -596,6 +2879,68 @@ static void procjob(void *dummy) {
     }
 }
 
+/* ===== Streaming input ===== */
+static int64_t now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/*
+ * Read whatever is available on fi without waiting for a full chunk.
+ * Blocks until the first byte arrives, then keeps reading until
+ * StreamDelay ms have passed, StreamLines lines are buffered, or the
+ * buffer is full. Sets Stream_eof at end of input.
+ */
+static int stream_read(FILE *fi, char *buf, int size) {
+    struct pollfd pfd;
+    int64_t deadline = 0;
+    int got = 0, lines = 0;
+
+    pfd.fd = fileno(fi);
+    pfd.events = POLLIN;
+    while (got < size) {
+        int timeout = -1;
+        if (got > 0) {
+            timeout = (int)(deadline - now_ms());
+            if (timeout <= 0) break;
+        }
+        int r = poll(&pfd, 1, timeout);
+        if (r < 0) {
+            if (errno == EINTR) continue;
+            Stream_error = errno;
+            Stream_eof = 1;
+            break;
+        }
+        if (r == 0) break;
+        ssize_t n = read(pfd.fd, buf + got, size - got);
+        if (n < 0) {
+            if (errno == EINTR || errno == EAGAIN) continue;
+            Stream_error = errno;
+            Stream_eof = 1;
+            break;
+        }
+        if (n == 0) {
+            Stream_eof = 1;
+            break;
+        }
+        if (got == 0) deadline = now_ms() + StreamDelay;
+        for (char *p = buf + got; (p = memchr(p, '\n', buf + got + n - p)) != NULL; p++)
+            lines++;
+        got += n;
+        if (lines >= StreamLines) break;
+    }
+    return got;
+}
+
+static inline int input_eof(FILE *fi) {
+    return DoStream ? Stream_eof : feof(fi);
+}
+
+static inline int input_error(FILE *fi) {
+    return DoStream ? Stream_error != 0 : ferror(fi);
+}
+
 /* ===== cacheline: block I/O with double buffering ===== */
 static unsigned int cacheline(FILE *fi, char **mybuf, struct LineInfo **myindex) {
     char *curpos, *readbuf, *f;
@@ -604,6 +2949,8 @@ static unsigned int cacheline(FILE *fi, char **mybuf, struct LineInfo **myindex)
     int cacheindex;
     static char *Lastleft;
     static int Lastcnt;
+    static int Skiprecord;
+    static int64_t Skipbytes;
     int curcnt, curindex, doneline;
 
     cacheindex = Cacheindex;
@@ -632,27 +2979,85 @@ static unsigned int cacheline(FILE *fi, char **mybuf, struct LineInfo **myindex)
         Lastcnt = 0;
         Lastleft = NULL;
     }
-    curcnt += fread(curpos, 1, (MAXCHUNK / 2) - curcnt - 1, fi);
+    if (DoStream)
+        curcnt += stream_read(fi, curpos, (MAXCHUNK / 2) - curcnt - 1);
+    else
+        curcnt += fread(curpos, 1, (MAXCHUNK / 2) - curcnt - 1, fi);
     curpos = readbuf;
     curindex = 0;
 
+    if (InFormat == REC_LENGTH) {
+        /* Discard the rest of a record too long for the read buffer */
+        if (Skipbytes) {
+            curindex = Skipbytes < curcnt ? (int)Skipbytes : curcnt;
+            Skipbytes -= curindex;
+        }
+        while (curindex < curcnt) {
+            const unsigned char *p = (const unsigned char *)&curpos[curindex];
+            int64_t reclen = -1;
+            if (curcnt - curindex >= 4)
+                reclen = p[0] | (p[1] << 8) | (p[2] << 16) | ((int64_t)p[3] << 24);
+            if (reclen >= MAXRECORD) {
+                /* Record can never fit the read buffer: drop it */
+                int64_t n = curcnt - curindex;
+                Skipbytes = 4 + reclen;
+                if (n > Skipbytes) n = Skipbytes;
+                curindex += (int)n;
+                Skipbytes -= n;
+                continue;
+            }
+            if (reclen < 0 || curindex + 4 + reclen > curcnt) {
+                if (input_eof(fi)) {
+                    fprintf(stderr, "Truncated length-prefixed record at end of input\n");
+                    break;
+                }
+                Lastleft = &curpos[curindex];
+                Lastcnt = curcnt - curindex;
+                break;
+            }
+            readindex[Linecount].offset = curindex + 4;
+            readindex[Linecount].len = (unsigned int)reclen;
+            curindex += 4 + (int)reclen;
+            if (++Linecount >= RINDEXSIZE) {
+                if (curindex < curcnt) {
+                    Lastleft = &curpos[curindex];
+                    Lastcnt = curcnt - curindex;
+                }
+                break;
+            }
+        }
+        Cacheindex ^= 1;
+        return Linecount;
+    }
+
+    /* Discard the rest of a record too long for the read buffer */
+    if (Skiprecord) {
+        f = findeol(curpos, curcnt);
+        if (f) {
+            curindex = f - curpos + 1;
+            Skiprecord = 0;
+        } else {
+            curindex = curcnt;
+        }
+    }
+
     while (curindex < curcnt) {
         readindex[Linecount].offset = curindex;
         len = 0;
         doneline = 0;
-        f = findeol(&curpos[curindex], curcnt - curindex - 1);
+        /* Streaming can't wait for the next read to confirm a trailing newline */
+        f = findeol(&curpos[curindex], curcnt - curindex - (DoStream ? 0 : 1));
         if (f) {
             doneline = 1;
             rlen = len = f - &curpos[curindex];
-            if (len > 0 && f[-1] == '\r') {
+            if (InFormat == REC_LINES && len > 0 && f[-1] == '\r') {
                 f[-1] = '\n';
                 rlen--;
             }
-            if (rlen > MAXLINE) rlen = MAXLINE;
             readindex[Linecount].len = rlen;
 
             /* $HEX[] decode if enabled */
-            if (DoHex && rlen >= 6 &&
+            if (DoHex && InFormat == REC_LINES && rlen >= 6 &&
                 curpos[curindex] == '$' && curpos[curindex+1] == 'H' &&
                 curpos[curindex+2] == 'E' && curpos[curindex+3] == 'X' &&
                 curpos[curindex+4] == '[') {
@@ -675,17 +3080,20 @@ static unsigned int cacheline(FILE *fi, char **mybuf, struct LineInfo **myindex)
 
             curindex += len + 1;
         } else {
-            if (feof(fi)) {
+            if (input_eof(fi)) {
                 curpos[curcnt] = '\n';
                 rlen = len = (curcnt - curindex);
-                if (len > 1) rlen--;
-                if (rlen > 0 && curpos[curindex + rlen - 1] == '\n') rlen--;
-                if (rlen > 0 && curpos[curindex + rlen - 1] == '\r') rlen--;
-                if (rlen > MAXLINE) rlen = MAXLINE;
+                if (InFormat == REC_LINES) {
+                    if (rlen > 0 && curpos[curindex + rlen - 1] == '\n') rlen--;
+                    if (rlen > 0 && curpos[curindex + rlen - 1] == '\r') rlen--;
+                } else if (InFormat == REC_NUL) {
+                    /* A terminator on the last record is not part of it */
+                    if (rlen > 0 && curpos[curindex + rlen - 1] == '\0') rlen--;
+                }
                 readindex[Linecount].len = rlen;
 
                 /* $HEX[] decode for last line */
-                if (DoHex && rlen >= 6 &&
+                if (DoHex && InFormat == REC_LINES && rlen >= 6 &&
                     curpos[curindex] == '$' && curpos[curindex+1] == 'H' &&
                     curpos[curindex+2] == 'E' && curpos[curindex+3] == 'X' &&
                     curpos[curindex+4] == '[') {
@@ -705,17 +3113,18 @@ static unsigned int cacheline(FILE *fi, char **mybuf, struct LineInfo **myindex)
                     readindex[Linecount].len = dst - curindex;
                 }
 
-                if (rlen > 0 && rlen < MAXLINE) { Linecount++; }
+                if (rlen > 0) { Linecount++; }
                 break;
             }
             Lastleft = &curpos[curindex];
             Lastcnt = curcnt - curindex;
-            if (Lastcnt >= MAXLINE) {
+            if (Lastcnt >= MAXRECORD) {
+                /* Record fills the whole read buffer: drop it */
                 Lastcnt = 0;
+                Skiprecord = 1;
             }
             break;
         }
-        if (len >= MAXLINE) continue;
         if (doneline) {
             if (++Linecount >= RINDEXSIZE) {
                 if (curindex < curcnt) {
@@ -731,6 +3140,16 @@ static unsigned int cacheline(FILE *fi, char **mybuf, struct LineInfo **myindex)
 }
 
 /* ===== Validate encodings at startup ===== */
+/* Whether encoding i is named, by name or alias, in names[0..n) */
+static int encoding_matches(int i, char **names, int n) {
+    for (int j = 0; j < n; j++) {
+        if (strcasecmp(names[j], encodings[i].enc.name) == 0) return 1;
+        for (int k = 0; encodings[i].aliases[k]; k++)
+            if (strcasecmp(names[j], encodings[i].aliases[k]) == 0) return 1;
+    }
+    return 0;
+}
+
 static void validate_encodings(void) {
     Num_encodings = 0;
     for (int i = 0; encodings[i].enc.name != NULL; i++) {
@@ -738,36 +3157,10 @@ static void validate_encodings(void) {
         encodings[i].available = 0;
 
         /* Check include/exclude filters */
-        if (NumInclude > 0) {
-            int found = 0;
-            for (int j = 0; j < NumInclude; j++) {
-                if (strcasecmp(IncludeEncodings[j], encodings[i].enc.name) == 0) {
-                    found = 1; break;
-                }
-                for (int k = 0; encodings[i].aliases[k]; k++) {
-                    if (strcasecmp(IncludeEncodings[j], encodings[i].aliases[k]) == 0) {
-                        found = 1; break;
-                    }
-                }
-                if (found) break;
-            }
-            if (!found) continue;
-        }
-        if (NumExclude > 0) {
-            int excluded = 0;
-            for (int j = 0; j < NumExclude; j++) {
-                if (strcasecmp(ExcludeEncodings[j], encodings[i].enc.name) == 0) {
-                    excluded = 1; break;
-                }
-                for (int k = 0; encodings[i].aliases[k]; k++) {
-                    if (strcasecmp(ExcludeEncodings[j], encodings[i].aliases[k]) == 0) {
-                        excluded = 1; break;
-                    }
-                }
-                if (excluded) break;
-            }
-            if (excluded) continue;
-        }
+        if (NumInclude > 0 && !encoding_matches(i, IncludeEncodings, NumInclude))
+            continue;
+        if (NumExclude > 0 && encoding_matches(i, ExcludeEncodings, NumExclude))
+            continue;
 
         /* All encodings are available (no iconv dependency) */
         encodings[i].available = 1;
@@ -780,35 +3173,149 @@ static void validate_encodings(void) {
         VERSION, avail, Num_encodings, Maxt);
 }
 
+/* ===== Job queue ===== */
+/* Get a free job, waiting for one to be returned if all are busy */
+static struct JOB *get_free_job(void) {
+    possess(FreeWaiting);
+    wait_for(FreeWaiting, NOT_TO_BE, 0);
+    struct JOB *job = FreeHead;
+    FreeHead = job->next;
+    if (FreeHead == NULL) FreeTail = &FreeHead;
+    twist(FreeWaiting, BY, -1);
+    job->next = NULL;
+    return job;
+}
+
+/*
+ * Jobs are queued from the main thread and, as split helpers, from
+ * workers; a thread is launched per job until there are Maxt, so there
+ * are always as many threads as jobs out.
+ */
+static void queue_job(struct JOB *job) {
+    possess(WorkWaiting);
+    if (Workthread < Maxt) {
+        launch(procjob, NULL);
+        Workthread++;
+    }
+    *WorkTail = job;
+    WorkTail = &(job->next);
+    twist(WorkWaiting, BY, +1);
+}
+
+/* Queue a split helper ahead of other work: its line is waiting on it */
+static void queue_helper(struct JOB *job) {
+    possess(WorkWaiting);
+    if (Workthread < Maxt) {
+        launch(procjob, NULL);
+        Workthread++;
+    }
+    job->next = WorkHead;
+    WorkHead = job;
+    if (WorkTail == &WorkHead) WorkTail = &(job->next);
+    twist(WorkWaiting, BY, +1);
+}
+
+/* Allocate the Maxt jobs and their per-thread buffers; threads start on demand */
+static void init_jobs(void) {
+    Jobs = calloc(Maxt, sizeof(struct JOB));
+    FreeWaiting = new_lock(Maxt);
+    WorkWaiting = new_lock(0);
+    Out_turn = new_lock(1);
+    if (!Jobs || !FreeWaiting || !WorkWaiting || !Out_turn) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+
+    /* Initialize job queue */
+    WorkTail = &WorkHead;
+    FreeTail = &FreeHead;
+    Workthread = 0;
+
+    for (int x = 0; x < Maxt; x++) {
+        *FreeTail = &Jobs[x];
+        FreeTail = &(Jobs[x].next);
+        Jobs[x].out = stdout;
+        Jobs[x].outbuf = malloc(OUTBUFSIZE);
+        Jobs[x].outlen = 0;
+        Jobs[x].outsize = OUTBUFSIZE;
+        Jobs[x].dedup_hashes = calloc(DEDUP_CAPACITY, sizeof(uint64_t));
+        Jobs[x].dedup_capacity = DEDUP_CAPACITY;
+        Jobs[x].scratch = malloc(SCRATCH_SIZE);
+        Jobs[x].scratch_size = SCRATCH_SIZE;
+        if (!Jobs[x].outbuf || !Jobs[x].dedup_hashes || !Jobs[x].scratch) {
+            fprintf(stderr, "Memory allocation failed for job %d\n", x);
+            exit(1);
+        }
+    }
+}
+
+static void free_jobs(void) {
+    for (int x = 0; x < Maxt; x++) {
+        free(Jobs[x].outbuf);
+        free(Jobs[x].dedup_hashes);
+        free(Jobs[x].scratch);
+        free(Jobs[x].fan.buf);
+        free(Jobs[x].errtext);
+        free(Jobs[x].lanes);
+        free(Jobs[x].cps);
+        free(Jobs[x].mid);
+        free_split(Jobs[x].split);
+        arrow_free(&Jobs[x]);
+    }
+    free(Jobs);
+    free_lock(FreeWaiting);
+    free_lock(WorkWaiting);
+    free_lock(Out_turn);
+}
+
+/* Wait for all jobs to complete */
+static void wait_jobs(void) {
+    possess(FreeWaiting);
+    wait_for(FreeWaiting, TO_BE, Maxt);
+    release(FreeWaiting);
+}
+
+static void stop_workers(void) {
+    /* Send done signal */
+    struct JOB done_job;
+    memset(&done_job, 0, sizeof(done_job));
+    done_job.func = JOB_DONE;
+    done_job.next = NULL;
+    possess(WorkWaiting);
+    *WorkTail = &done_job;
+    WorkTail = &(done_job.next);
+    twist(WorkWaiting, BY, +1);
+
+    join_all();
+}
+
 /* ===== Process a file ===== */
 static void process_file(FILE *fi) {
     char *readbuf;
     struct LineInfo *readindex;
     unsigned int numline;
+    int64_t recno = 0;
 
-    /* TSV header */
-    if (OutFormat == FMT_TSV) {
-        possess(Output_lock);
-        fprintf(stdout, "input\tinput_hex\toperation\tencoding\ttarget\tstrategy\toutput\toutput_hex\n");
-        release(Output_lock);
-    }
+    /* TSV/binary header */
+    possess(Output_lock);
+    write_output_header(stdout);
+    release(Output_lock);
 
-    while ((numline = cacheline(fi, &readbuf, &readindex)) > 0) {
-        /* Get a free job */
-        possess(FreeWaiting);
-        wait_for(FreeWaiting, NOT_TO_BE, 0);
-        struct JOB *job = FreeHead;
-        FreeHead = job->next;
-        if (FreeHead == NULL) FreeTail = &FreeHead;
-        twist(FreeWaiting, BY, -1);
-        job->next = NULL;
+    /* A read error leaves feof unset: stop on it rather than retry forever */
+    while ((numline = cacheline(fi, &readbuf, &readindex)) > 0 ||
+           (!input_eof(fi) && !input_error(fi))) {
+        /* Only part of a line arrived (streaming) or a record was dropped */
+        if (numline == 0) continue;
+
+        struct JOB *job = get_free_job();
 
         /* Set up job */
         job->func = JOB_PROCESS;
         job->readbuf = readbuf;
         job->readindex = readindex;
         job->numline = numline;
-        job->startline = 0;
+        job->startline = recno;
+        recno += numline;
 
         /* Track which buffer this is from */
         if (Cacheindex == 1) {
@@ -820,42 +3327,453 @@ static void process_file(FILE *fi) {
             twist(ReadBuf1, BY, +1);
         }
 
-        /* Launch thread if needed */
-        if (Workthread < Maxt) {
-            launch(procjob, NULL);
-            Workthread++;
+        queue_job(job);
+    }
+
+    wait_jobs();
+    stop_workers();
+    write_output_trailer(stdout);
+    if (input_error(fi)) {
+        fflush(stdout);
+        fprintf(stderr, "Error reading input\n");
+        exit(1);
+    }
+}
+
+/* ===== Whole-file mode ===== */
+/*
+ * --whole-file treats the entire input as one record. For each encoding
+ * the input is cut into pieces at points where decoding (or encoding)
+ * can restart without context, the pieces are converted in parallel on
+ * the thread pool, and the per-piece results are combined in order.
+ */
+#define WHOLE_PIECE (MAXLINE/2)     /* target piece size; pieces never exceed MAXLINE */
+#define WHOLE_HASH_MUL 0x100000001b3ULL
+
+struct WholePiece {
+    int64_t offset;
+    int len;
+    struct charconv_state st;       /* converter state at offset */
+    /* Filled in by an OUT_SCAN pass */
+    int64_t out_len;
+    uint64_t hash;
+    int nh, err, fail;
+};
+
+static struct {
+    const unsigned char *data;
+    int64_t len;
+    struct WholePiece *pieces;
+    int npieces, maxpieces;
+    const struct CharEncoding *enc;
+    int op, strategy, nh;
+    enum OutForm form;
+    uint64_t input_hash;
+    char *split_scratch;
+} Whole;
+static lock *Whole_turn;
+
+/*
+ * Positional hash: h = h * M + byte + 1. Unlike FNV-1a it can be
+ * combined across pieces (h(AB) = h(A) * M^|B| + h(B)), so pieces
+ * hash in parallel and the result does not depend on where the cuts
+ * fell. Used for dedup and for the output == input check.
+ */
+static inline uint64_t whole_hash(uint64_t h, const unsigned char *data, int len) {
+    for (int i = 0; i < len; i++)
+        h = h * WHOLE_HASH_MUL + data[i] + 1;
+    return h;
+}
+
+static uint64_t whole_hash_pow(int64_t n) {
+    uint64_t r = 1, b = WHOLE_HASH_MUL;
+    while (n > 0) {
+        if (n & 1) r *= b;
+        b *= b;
+        n >>= 1;
+    }
+    return r;
+}
+
+/* UTF-16 code unit at p in the byte order of the piece state */
+static inline unsigned whole_unit16(const unsigned char *d, int64_t p, int be) {
+    return be ? ((unsigned)d[p] << 8) | d[p+1] : d[p] | ((unsigned)d[p+1] << 8);
+}
+
+/*
+ * Can conversion restart at p with a fresh state (BOM byte order aside)?
+ * base is where code units start (after a BOM).
+ */
+static int whole_safe(const struct CharEncoding *enc, int op, int64_t p,
+    int64_t base, int be)
+{
+    const unsigned char *d = Whole.data;
+    unsigned char c = d[p], prev = d[p-1];
+
+    if (op == MODE_ENCODE) {
+        switch (enc->type) {
+        case ENC_TYPE_UTF7:
+            /* Direct character: any base64 run was closed before it */
+            return prev >= 0x20 && prev <= 0x7E && prev != '+';
+        case ENC_TYPE_ISO2022JP:
+            return prev < 0x80;     /* back in ASCII mode */
+        default:
+            return (c & 0xC0) != 0x80;
+        }
+    }
+
+    switch (enc->type) {
+    case ENC_TYPE_SINGLE_BYTE:
+        return 1;
+    case ENC_TYPE_UTF8:
+        return c < 0x80 || c >= 0xC0;
+    case ENC_TYPE_CESU8:
+        return c < 0x80 || (c >= 0xC0 && c != 0xED);
+    case ENC_TYPE_UTF16:
+    case ENC_TYPE_UTF16BE:
+    case ENC_TYPE_UTF16LE: {
+        if ((p - base) & 1 || p + 1 >= Whole.len) return 0;
+        unsigned hi = whole_unit16(d, p - 2, be), lo = whole_unit16(d, p, be);
+        return !(hi >= 0xD800 && hi <= 0xDBFF && lo >= 0xDC00 && lo <= 0xDFFF);
+    }
+    case ENC_TYPE_UTF32:
+    case ENC_TYPE_UTF32BE:
+    case ENC_TYPE_UTF32LE:
+        return ((p - base) & 3) == 0;
+    case ENC_TYPE_UTF7:
+        /* Not base64 and not '+': ends any base64 section */
+        return prev >= 0x80 || !((prev >= 'A' && prev <= 'Z') ||
+            (prev >= 'a' && prev <= 'z') || (prev >= '0' && prev <= '9') ||
+            prev == '+' || prev == '/');
+    case ENC_TYPE_ISO2022JP:
+        /* Designation escape: resets the charset */
+        return c == 0x1B && p + 2 < Whole.len &&
+            ((d[p+1] == '(' && (d[p+2] == 'B' || d[p+2] == 'J')) ||
+             (d[p+1] == '$' && (d[p+2] == '@' || d[p+2] == 'B')));
+    default:
+        /* CJK: bytes below 0x30 are never lead or trail bytes */
+        return prev < 0x30;
+    }
+}
+
+/* Cut the input into pieces for one encoding and direction */
+static void whole_split(const struct CharEncoding *enc, int op) {
+    const unsigned char *d = Whole.data;
+    struct charconv_state st;
+    int64_t base = 0, s = 0;
+    int be = 1;
+
+    charconv_state_init(&st);
+    /* Byte order from the BOM applies to every later piece */
+    if (op == MODE_DECODE && enc->type == ENC_TYPE_UTF16 && Whole.len >= 2) {
+        if (d[0] == 0xFF && d[1] == 0xFE) { be = 0; base = 2; }
+        else if (d[0] == 0xFE && d[1] == 0xFF) base = 2;
+    } else if (op == MODE_DECODE && enc->type == ENC_TYPE_UTF32 && Whole.len >= 4) {
+        if (d[0] == 0xFF && d[1] == 0xFE && d[2] == 0 && d[3] == 0) { be = 0; base = 4; }
+        else if (d[0] == 0 && d[1] == 0 && d[2] == 0xFE && d[3] == 0xFF) base = 4;
+    } else if (enc->type == ENC_TYPE_UTF16LE || enc->type == ENC_TYPE_UTF32LE) {
+        be = 0;
+    }
+
+    Whole.npieces = 0;
+    while (s < Whole.len) {
+        struct WholePiece *wp;
+        int64_t p = -1, lim;
+
+        if (Whole.npieces == Whole.maxpieces) {
+            Whole.maxpieces = Whole.maxpieces ? Whole.maxpieces * 2 : 1024;
+            Whole.pieces = realloc(Whole.pieces, Whole.maxpieces * sizeof(struct WholePiece));
+            if (!Whole.pieces) {
+                fprintf(stderr, "Memory allocation failed\n");
+                exit(1);
+            }
+        }
+        wp = &Whole.pieces[Whole.npieces++];
+        wp->offset = s;
+        wp->st = st;
+
+        if (Whole.len - s <= WHOLE_PIECE) {
+            wp->len = Whole.len - s;
+            break;
         }
+        /* Nearest safe point at or before the target, else after it */
+        lim = s + WHOLE_PIECE;
+        for (int64_t q = lim; q > s + base + 4 && p < 0; q--)
+            if (whole_safe(enc, op, q, base, be)) p = q;
+        if (Whole.len - s <= MAXLINE) lim = Whole.len;
+        else lim = s + MAXLINE;
+        for (int64_t q = s + WHOLE_PIECE + 1; q < lim && p < 0; q++)
+            if (whole_safe(enc, op, q, base, be)) p = q;
 
-        /* Queue job */
-        possess(WorkWaiting);
-        *WorkTail = job;
-        WorkTail = &(job->next);
-        twist(WorkWaiting, BY, +1);
+        if (p < 0 && lim == Whole.len) {
+            wp->len = Whole.len - s;
+            break;
+        }
+        if (p >= 0) {
+            /* Fresh state, keeping what the BOM decided */
+            charconv_state_init(&st);
+            st.started = 1;
+            st.big_endian = be;
+        } else {
+            /* No restart point: run the converter up to the limit to
+             * find where it stops and the state it stops in */
+            int err = 0, n = (int)(lim - s);
+            st.final = 0;
+            if (op == MODE_DECODE)
+                charconv_decode_chunk(enc, &st, d + s, n, (unsigned char *)Whole.split_scratch,
+                    SCRATCH_SIZE, DS_REPLACEMENT_FFFD, &err);
+            else
+                charconv_encode_chunk(enc, &st, d + s, n, (unsigned char *)Whole.split_scratch,
+                    SCRATCH_SIZE, ES_REPLACEMENT_QUESTION, &err);
+            p = lim - st.carrylen;
+            st.carrylen = 0;
+        }
+        wp->len = (int)(p - s);
+        s = p;
+    }
+}
+
+/* Worker: convert one piece, then record or write its output */
+static void whole_piece(struct JOB *job) {
+    struct WholePiece *wp = &Whole.pieces[job->piece];
+    struct charconv_state st = wp->st;
+    unsigned char *out = (unsigned char *)job->scratch;
+    int err = 0, n;
+
+    st.final = 1;
+    if (Whole.op == MODE_DECODE)
+        n = charconv_decode_chunk(Whole.enc, &st, Whole.data + wp->offset, wp->len,
+            out, job->scratch_size, Whole.strategy, &err);
+    else
+        n = charconv_encode_chunk(Whole.enc, &st, Whole.data + wp->offset, wp->len,
+            out, job->scratch_size, Whole.strategy, &err);
+
+    if (Whole.form == OUT_SCAN) {
+        wp->fail = n < 0;
+        if (n < 0) return;
+        wp->out_len = n;
+        wp->hash = whole_hash(0, out, n);
+        wp->nh = needs_hex(out, n);
+        wp->err = err;
+        return;
+    }
+
+    /* Write in piece order */
+    possess(Whole_turn);
+    wait_for(Whole_turn, TO_BE, job->piece);
+    release(Whole_turn);
+    if (n > 0) {
+        switch (Whole.form) {
+        case OUT_DATA:
+            if (DoHex && Whole.nh) emit_hex_chars(job, out, n);
+            else output_append(job, (const char *)out, n);
+            break;
+        case OUT_JSON:
+            emit_json_chars(job, out, n);
+            break;
+        case OUT_RAW:
+            output_append(job, (const char *)out, n);
+            break;
+        case OUT_HEX:
+            emit_hex_chars(job, out, n);
+            break;
+        case OUT_SCAN:
+            break;
+        }
+        flush_output(job);
+    }
+    possess(Whole_turn);
+    twist(Whole_turn, BY, +1);
+}
+
+/* Run one pass over all pieces on the thread pool */
+static void whole_pass(enum OutForm form) {
+    Whole.form = form;
+    possess(Whole_turn);
+    twist(Whole_turn, TO, 0);
+    for (int k = 0; k < Whole.npieces; k++) {
+        struct JOB *job = get_free_job();
+        job->func = JOB_WHOLE;
+        job->piece = k;
+        queue_job(job);
+    }
+    wait_jobs();
+}
+
+/* Convert the whole input for lc's encoding/strategy and fill in lc */
+static int whole_scan(struct LongConv *lc) {
+    uint64_t h = 0;
+    int64_t out_len = 0;
+
+    Whole.enc = lc->src;
+    Whole.op = lc->op;
+    Whole.strategy = lc->strategy;
+    whole_pass(OUT_SCAN);
+
+    lc->nh = lc->had_errors = 0;
+    for (int k = 0; k < Whole.npieces; k++) {
+        struct WholePiece *wp = &Whole.pieces[k];
+        if (wp->fail) return -1;
+        h = h * whole_hash_pow(wp->out_len) + wp->hash;
+        out_len += wp->out_len;
+        lc->nh |= wp->nh;
+        lc->had_errors |= wp->err;
+    }
+    /* Result lengths are int downstream, and binary records store 32 bits */
+    if (out_len > INT32_MAX) {
+        fprintf(stderr, "--whole-file: skipping a %s result over 2 GB\n", lc->src->name);
+        return -1;
+    }
+    /* Hash match stands in for a byte compare of up to 2 GB */
+    lc->identity = out_len == Whole.len && h == Whole.input_hash;
+    lc->out_len = (int)out_len;
+    lc->hash = h ^ (uint64_t)out_len * 0x9E3779B97F4A7C15ULL;
+    if (lc->hash == 0) lc->hash = 1;
+    return 0;
+}
+
+/* emit_long for whole-file results: the pieces write themselves */
+static void whole_emit(struct JOB *job, enum OutForm form) {
+    Whole.nh = job->lconv->nh;
+    flush_output(job);
+    whole_pass(form);
+}
+
+/* Read all of fi into memory */
+static void whole_load(FILE *fi) {
+    size_t size = 0, cap = MAXCHUNK, n;
+    unsigned char *buf = malloc(cap);
+
+    while (buf && (n = fread(buf + size, 1, cap - size, fi)) > 0) {
+        size += n;
+        if (size > INT32_MAX) {
+            fprintf(stderr, "--whole-file: input larger than 2 GB\n");
+            exit(1);
+        }
+        if (size == cap) {
+            cap *= 2;
+            buf = realloc(buf, cap);
+        }
+    }
+    if (ferror(fi)) {
+        fprintf(stderr, "Error reading input\n");
+        exit(1);
+    }
+    if (!buf) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    Whole.data = buf;
+    Whole.len = size;
+}
+
+static void process_whole_file(FILE *fi) {
+    struct JOB job;
+
+    if (OutFormat == FMT_ARROW) {
+        fprintf(stderr, "--whole-file: -F arrow is not supported\n");
+        exit(1);
+    }
+    whole_load(fi);
+    if (OpMode & MODE_TRANSCODE) {
+        fprintf(stderr, "--whole-file: transcode not supported, skipping it\n");
+        if (!(OpMode & (MODE_DECODE | MODE_ENCODE))) exit(1);
+    }
+    if (Whole.len == 0) return;
+
+    /* Runs on the main thread; pieces go to the workers */
+    memset(&job, 0, sizeof(job));
+    job.out = stdout;
+    job.outbuf = malloc(OUTBUFSIZE);
+    job.outsize = OUTBUFSIZE;
+    job.dedup_hashes = calloc(DEDUP_CAPACITY, sizeof(uint64_t));
+    job.dedup_capacity = DEDUP_CAPACITY;
+    Whole.split_scratch = malloc(SCRATCH_SIZE);
+    Whole_turn = new_lock(0);
+    if (!job.outbuf || !job.dedup_hashes || !Whole.split_scratch || !Whole_turn) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    Whole.input_hash = whole_hash(0, Whole.data, (int)Whole.len);
+
+    write_output_header(stdout);
+    process_long_line(&job, Whole.data, (int)Whole.len, 1);
+    flush_output(&job);
+    stop_workers();
+
+    free(job.outbuf);
+    free(job.dedup_hashes);
+    free(Whole.split_scratch);
+    free(Whole.pieces);
+    free((void *)Whole.data);
+    free_lock(Whole_turn);
+}
+
+/* ===== Process command-line string arguments ===== */
+/*
+ * Several arguments go through the worker pool as -f input does: copied
+ * into one buffer and cut into ranges, a job each. Each job takes a turn
+ * and writes only after the jobs before it, so the output is in argument
+ * order, as single-threaded.
+ */
+#define ARGS_PER_THREAD 4   /* ranges per thread, to even out slow arguments */
+
+static void process_strings_pool(int argc, char **argv) {
+    struct LineInfo *index = malloc(argc * sizeof(struct LineInfo));
+    size_t total = 0;
+    char *buf;
+
+    for (int i = 0; i < argc; i++)
+        total += strlen(argv[i]);
+    buf = malloc(total + 1);
+    if (!index || !buf) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
     }
+    total = 0;
+    for (int i = 0; i < argc; i++) {
+        int len = strlen(argv[i]);
+        memcpy(buf + total, argv[i], len);
+        index[i].offset = total;
+        index[i].len = len;
+        total += len;
+    }
+    init_jobs();
 
-    /* Wait for all jobs to complete */
-    possess(FreeWaiting);
-    wait_for(FreeWaiting, TO_BE, Maxt);
-    release(FreeWaiting);
+    /* TSV/binary header */
+    write_output_header(stdout);
 
-    /* Send done signal */
-    struct JOB done_job;
-    memset(&done_job, 0, sizeof(done_job));
-    done_job.func = JOB_DONE;
-    done_job.next = NULL;
-    possess(WorkWaiting);
-    *WorkTail = &done_job;
-    WorkTail = &(done_job.next);
-    twist(WorkWaiting, BY, +1);
+    int per = (argc + ARGS_PER_THREAD * Maxt - 1) / (ARGS_PER_THREAD * Maxt);
+    for (int start = 0, turn = 1; start < argc; start += per, turn++) {
+        struct JOB *job = get_free_job();
+        job->func = JOB_RECORDS;
+        job->turn = turn;
+        job->readbuf = buf;
+        job->readindex = index + start;
+        job->numline = argc - start < per ? argc - start : per;
+        job->startline = start;
+        queue_job(job);
+    }
+    wait_jobs();
+    stop_workers();
+    write_output_trailer(stdout);
 
-    join_all();
+    free_jobs();
+    free(index);
+    free(buf);
 }
 
-/* ===== Process command-line string arguments ===== */
 static void process_strings(int argc, char **argv) {
-    /* For string arguments, process them single-threaded for simplicity */
+    /* A transcode line is split over the pool's free jobs */
+    if (Maxt > 1 && (argc > 1 || (OpMode & MODE_TRANSCODE))) {
+        process_strings_pool(argc, argv);
+        return;
+    }
+
+    /* One argument (or -j1): convert it here */
     struct JOB job;
     memset(&job, 0, sizeof(job));
+    job.out = stdout;
     job.outbuf = malloc(OUTBUFSIZE);
     job.outlen = 0;
     job.outsize = OUTBUFSIZE;
@@ -868,23 +3786,216 @@ static void process_strings(int argc, char **argv) {
         exit(1);
     }
 
-    /* TSV header */
-    if (OutFormat == FMT_TSV) {
-        fprintf(stdout, "input\tinput_hex\toperation\tencoding\ttarget\tstrategy\toutput\toutput_hex\n");
-    }
+    /* TSV/binary header */
+    write_output_header(stdout);
 
     for (int i = 0; i < argc; i++) {
+        job.recno = i;
         process_line(&job, (unsigned char *)argv[i], strlen(argv[i]));
     }
 
     /* Flush remaining output */
-    if (job.outlen > 0) {
-        fwrite(job.outbuf, 1, job.outlen, stdout);
-    }
+    flush_output(&job);
+    write_output_trailer(stdout);
 
     free(job.outbuf);
     free(job.dedup_hashes);
     free(job.scratch);
+    free(job.mid);
+    free(job.fan.buf);
+    free(job.errtext);
+    free(job.lanes);
+    free(job.cps);
+    arrow_free(&job);
+}
+
+/* ===== Render binary output ===== */
+struct NameTable {
+    int count;
+    char **names;
+};
+
+static void render_truncated(void) {
+    fprintf(stderr, "--render: truncated input\n");
+    exit(1);
+}
+
+static void read_name_table(FILE *fi, struct NameTable *t) {
+    unsigned char n[2], len;
+
+    if (fread(n, 1, 2, fi) != 2) render_truncated();
+    t->count = get_le16(n);
+    t->names = calloc(t->count, sizeof(char *));
+    if (!t->names) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    for (int i = 0; i < t->count; i++) {
+        if (fread(&len, 1, 1, fi) != 1) render_truncated();
+        t->names[i] = malloc(len + 1);
+        if (!t->names[i]) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(1);
+        }
+        if (fread(t->names[i], 1, len, fi) != len) render_truncated();
+        t->names[i][len] = 0;
+    }
+}
+
+static void free_name_table(struct NameTable *t) {
+    for (int i = 0; i < t->count; i++)
+        free(t->names[i]);
+    free(t->names);
+}
+
+static const char *table_name(const struct NameTable *t, unsigned id) {
+    return id < (unsigned)t->count ? t->names[id] : "?";
+}
+
+/* Print a -F binary stream as lines, json or tsv */
+static void render_binary(const char *path) {
+    struct NameTable ops, encs, dstrat, estrat;
+    unsigned char hdr[BIN_RECHDR], *data = NULL;
+    uint32_t datasize = 0;
+    uint64_t lastindex = UINT64_MAX;
+    char magic[8], tmp[48];     /* numbers only: names are up to 255 bytes each */
+    struct JOB job;
+    FILE *fi = stdin;
+
+    if (OutFormat == FMT_BINARY || OutFormat == FMT_ARROW) {
+        fprintf(stderr, "--render: choose a text format with -F\n");
+        exit(1);
+    }
+    if (strcmp(path, "-") != 0) {
+        fi = fopen(path, "rb");
+        if (!fi) {
+            fprintf(stderr, "Can't open: %s\n", path);
+            exit(1);
+        }
+    }
+    if (fread(magic, 1, 8, fi) != 8 || memcmp(magic, BIN_MAGIC, 8) != 0) {
+        fprintf(stderr, "--render: %s is not encforce binary output\n", path);
+        exit(1);
+    }
+    read_name_table(fi, &ops);
+    read_name_table(fi, &encs);
+    read_name_table(fi, &dstrat);
+    read_name_table(fi, &estrat);
+
+    memset(&job, 0, sizeof(job));
+    job.out = stdout;
+    job.outbuf = malloc(OUTBUFSIZE);
+    job.outsize = OUTBUFSIZE;
+    if (!job.outbuf) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+
+    if (OutFormat == FMT_TSV)
+        emit_str(&job, "index\toperation\tencoding\ttarget\tstrategy\thad_errors\toutput\toutput_hex\n");
+
+    size_t got;
+    while ((got = fread(hdr, 1, BIN_RECHDR, fi)) == BIN_RECHDR) {
+        uint64_t index = get_le64(hdr);
+        const char *operation = table_name(&ops, hdr[8]);
+        const char *enc_name = table_name(&encs, get_le16(hdr + 9));
+        unsigned tgt = get_le16(hdr + 11);
+        const char *target_enc = tgt == BIN_NONE16 ? NULL : table_name(&encs, tgt);
+        const char *strategy_name = hdr[13] == BIN_NONE8 ? NULL :
+            table_name(hdr[8] == 0 ? &dstrat : &estrat, hdr[13]);
+        int had_errors = hdr[14] & BIN_FLAG_ERRORS;
+        uint32_t len = get_le32(hdr + 15);
+
+        if (len > datasize) {
+            free(data);
+            datasize = len;
+            data = malloc(datasize);
+            if (!data) {
+                fprintf(stderr, "Memory allocation failed\n");
+                exit(1);
+            }
+        }
+        if (fread(data, 1, len, fi) != len) render_truncated();
+
+        switch (OutFormat) {
+        case FMT_LINES:
+            if (DoVerbose) {
+                if (index != lastindex) {
+                    sprintf(tmp, "[input #%llu]\n", (unsigned long long)index);
+                    emit_str(&job, tmp);
+                }
+                emit_str(&job, "  ");
+                emit_str(&job, operation);
+                emit_str(&job, " ");
+                emit_str(&job, enc_name);
+                if (target_enc) {
+                    emit_str(&job, " -> ");
+                    emit_str(&job, target_enc);
+                }
+                if (had_errors && strategy_name) {
+                    emit_str(&job, " (");
+                    emit_str(&job, strategy_name);
+                    emit_str(&job, ")");
+                }
+                emit_str(&job, ": ");
+            }
+            emit_data(&job, data, len);
+            output_append(&job, "\n", 1);
+            break;
+
+        case FMT_JSON:
+            sprintf(tmp, "{\"index\":%llu,\"op\":", (unsigned long long)index);
+            emit_str(&job, tmp);
+            emit_json_str(&job, (const unsigned char *)operation, strlen(operation));
+            emit_str(&job, ",\"enc\":");
+            emit_json_str(&job, (const unsigned char *)enc_name, strlen(enc_name));
+            if (target_enc) {
+                emit_str(&job, ",\"target\":");
+                emit_json_str(&job, (const unsigned char *)target_enc, strlen(target_enc));
+            }
+            if (strategy_name) {
+                emit_str(&job, ",\"strategy\":");
+                emit_json_str(&job, (const unsigned char *)strategy_name, strlen(strategy_name));
+            }
+            emit_str(&job, had_errors ? ",\"had_errors\":true" : ",\"had_errors\":false");
+            emit_str(&job, ",\"output\":");
+            emit_json_str(&job, data, len);
+            emit_str(&job, "}\n");
+            break;
+
+        case FMT_TSV:
+            sprintf(tmp, "%llu\t", (unsigned long long)index);
+            emit_str(&job, tmp);
+            emit_str(&job, operation);
+            emit_str(&job, "\t");
+            emit_str(&job, enc_name);
+            emit_str(&job, "\t");
+            emit_str(&job, target_enc ? target_enc : "");
+            emit_str(&job, "\t");
+            emit_str(&job, strategy_name ? strategy_name : "");
+            emit_str(&job, had_errors ? "\t1\t" : "\t0\t");
+            output_append(&job, (const char *)data, len);
+            output_append(&job, "\t", 1);
+            emit_hex_str(&job, data, len);
+            output_append(&job, "\n", 1);
+            break;
+
+        case FMT_BINARY:
+        case FMT_ARROW:
+            break;
+        }
+        lastindex = index;
+    }
+    if (got != 0) render_truncated();
+    flush_output(&job);
+
+    if (fi != stdin) fclose(fi);
+    free(data);
+    free(job.outbuf);
+    free_name_table(&ops);
+    free_name_table(&encs);
+    free_name_table(&dstrat);
+    free_name_table(&estrat);
 }
 
 /* ===== Usage ===== */
@@ -900,20 +4011,33 @@ static void usage(void) {
         "\n"
         "Options:\n"
         "  -f, --file FILE        Read inputs from file (one per line)\n"
+        "  -0, --null             Input records are NUL-terminated, not lines;\n"
+        "                         no CR stripping or $HEX[] decoding\n"
+        "      --length-prefixed  Input records are a 4-byte little-endian length\n"
+        "                         followed by that many bytes\n"
         "  -m, --mode MODE        Operation mode: decode|encode|both|transcode|all\n"
         "                         (default: both)\n"
         "  -e, --encoding ENC     Only use these encodings (repeatable)\n"
         "  -x, --exclude ENC      Exclude these encodings (repeatable)\n"
         "  -j, --jobs N           Worker threads (default: CPU count)\n"
-        "  -F, --format FMT       Output format: lines|json|tsv (default: lines)\n"
+        "  -F, --format FMT       Output format: lines|json|tsv|binary|arrow\n"
+        "                         (default: lines)\n"
+        "      --render FILE      Print -F binary output as lines|json|tsv and exit\n"
         "      --depth N          Max transcode chain depth (default: 1)\n"
         "      --raw              Disable $HEX[] input parsing and output encoding\n"
         "      --unique           Deduplicate output (default: on)\n"
         "      --no-unique        Disable deduplication\n"
         "      --no-errors        Hide results with errors\n"
+        "      --stream           Low-latency mode for slow producers: dispatch\n"
+        "                         input as it arrives and flush per batch\n"
+        "      --stream-delay MS  Max wait for more input in --stream (default: 10)\n"
+        "      --stream-lines N   Dispatch after N lines in --stream (default: 1000)\n"
+        "      --whole-file       Treat the whole input as one record (up to 2 GB),\n"
+        "                         converted in parallel pieces; no transcode\n"
         "  -l, --list-encodings   List all supported encodings and exit\n"
         "  -v, --verbose          Show input headers, encoding names, strategies\n"
         "  -s, --suggest          Show mojibake suggestions\n"
+        "      --serve SOCK       Answer requests on a Unix socket (see README)\n"
         "  -h, --help             Show help\n"
         "  -V, --version          Show version\n"
         "\n"
@@ -924,47 +4048,524 @@ static void usage(void) {
     );
 }
 
+/* ===== Option values ===== */
+/* Set OpMode from a -m argument; 0 if unknown */
+static int parse_mode(const char *arg) {
+    if (strcmp(arg, "decode") == 0) OpMode = MODE_DECODE;
+    else if (strcmp(arg, "encode") == 0) OpMode = MODE_ENCODE;
+    else if (strcmp(arg, "both") == 0) OpMode = MODE_BOTH;
+    else if (strcmp(arg, "transcode") == 0) OpMode = MODE_TRANSCODE;
+    else if (strcmp(arg, "all") == 0) OpMode = MODE_ALL;
+    else return 0;
+    return 1;
+}
+
+/* Set OutFormat from a -F argument; 0 if unknown */
+static int parse_format(const char *arg) {
+    if (strcmp(arg, "lines") == 0) OutFormat = FMT_LINES;
+    else if (strcmp(arg, "json") == 0) OutFormat = FMT_JSON;
+    else if (strcmp(arg, "tsv") == 0) OutFormat = FMT_TSV;
+    else if (strcmp(arg, "binary") == 0) OutFormat = FMT_BINARY;
+    else if (strcmp(arg, "arrow") == 0) OutFormat = FMT_ARROW;
+    else return 0;
+    return 1;
+}
+
+/* ===== Serve ===== */
+/*
+ * --serve SOCK keeps one process warm on a Unix socket: tables, the
+ * per-thread jobs and the worker threads are set up once, so a request
+ * costs a connect instead of a process start. A request is one
+ * connection carrying length-prefixed records (as with -P), the first
+ * holding options and the rest inputs; the client then shuts down its
+ * write side. The reply is the output the command line would write, and
+ * the server closes the connection after it. Requests that are complete
+ * at the same time and have the same options share one dispatch round,
+ * their records spread over the pool. Sockets are non-blocking: each
+ * piece of a reply is sent as its turn comes, and what the socket does
+ * not take is queued and sent from the poll loop, so a client that is
+ * slow to read holds up nobody else. A client is dropped once more than
+ * SERVE_MAXQUEUED bytes wait for it, or its reply makes no progress for
+ * SERVE_STALL seconds.
+ */
+#define SERVE_MAXCLIENTS 256
+#define SERVE_MAXREQUEST (MAXCHUNK / 2)
+#define SERVE_MAXOPTS 64
+#define SERVE_JOBLINES 256      /* most records per job */
+#define SERVE_STALL 30
+#define SERVE_MAXQUEUED (64 << 20)
+
+struct ServeClient {
+    int fd;
+    int done;                   /* whole request received */
+    unsigned char *buf;
+    size_t len, size;
+    const unsigned char *opts;  /* first record */
+    int optlen;
+    struct LineInfo *index;     /* the input records, offsets into buf */
+    int nrec;
+    int answered;               /* reply written; the rest is queued */
+    int failed;                 /* reply dropped: the client is closed after the round */
+    int toolarge;               /* ... because too much of it was queued */
+    char *queued;               /* reply bytes the socket has not taken */
+    size_t sent, qlen, qsize;   /* queued[sent..qlen) are waiting */
+    time_t progress;            /* last time some of the reply went out */
+};
+
+/* Server-wide settings from the command line; each request starts from them */
+static struct {
+    enum Mode mode;
+    enum OutputFormat format;
+    int hex, verbose, unique, noerrors;
+    char available[MAXENC];
+} Serve;
+
+/* Split a complete request into its records; 0 if they don't add up */
+static int serve_records(struct ServeClient *c) {
+    size_t pos = 0;
+    int n = -1, cap = 0;
+
+    while (pos < c->len) {
+        const unsigned char *p = c->buf + pos;
+        uint32_t reclen;
+        if (c->len - pos < 4) return 0;
+        reclen = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+        if (reclen > c->len - pos - 4) return 0;
+        if (n < 0) {
+            c->opts = p + 4;
+            c->optlen = reclen;
+        } else {
+            if (n == cap) {
+                cap = cap ? 2 * cap : 64;
+                c->index = realloc(c->index, cap * sizeof(struct LineInfo));
+                if (!c->index) {
+                    fprintf(stderr, "Memory allocation failed\n");
+                    exit(1);
+                }
+            }
+            c->index[n].offset = pos + 4;
+            c->index[n].len = reclen;
+        }
+        n++;
+        pos += 4 + reclen;
+    }
+    c->nrec = n;
+    return n >= 0;
+}
+
+/*
+ * Apply a request's options over the server's: -m, -F, -u, -U, -E, -r,
+ * -v, and -e/-x, which narrow the encodings the server was started with.
+ * Returns NULL, or what was wrong.
+ */
+static const char *serve_options(const unsigned char *opts, int len) {
+    char buf[1024], *tok[SERVE_MAXOPTS], *include[SERVE_MAXOPTS], *exclude[SERVE_MAXOPTS];
+    char *save = NULL;
+    int ntok = 0, ninc = 0, nexc = 0;
+
+    OpMode = Serve.mode;
+    OutFormat = Serve.format;
+    DoHex = Serve.hex;
+    DoVerbose = Serve.verbose;
+    DoUnique = Serve.unique;
+    DoNoErrors = Serve.noerrors;
+    for (int e = 0; e < Num_encodings; e++)
+        encodings[e].available = Serve.available[e];
+
+    if (len >= (int)sizeof(buf)) return "options too long";
+    memcpy(buf, opts, len);
+    buf[len] = 0;
+    for (char *t = strtok_r(buf, " \t\r\n", &save); t; t = strtok_r(NULL, " \t\r\n", &save)) {
+        if (ntok == SERVE_MAXOPTS) return "too many options";
+        tok[ntok++] = t;
+    }
+
+    for (int i = 0; i < ntok; i++) {
+        const char *o = tok[i];
+        if (!strcmp(o, "-u") || !strcmp(o, "--unique")) DoUnique = 1;
+        else if (!strcmp(o, "-U") || !strcmp(o, "--no-unique")) DoUnique = 0;
+        else if (!strcmp(o, "-E") || !strcmp(o, "--no-errors")) DoNoErrors = 1;
+        else if (!strcmp(o, "-r") || !strcmp(o, "--raw")) DoHex = 0;
+        else if (!strcmp(o, "-v") || !strcmp(o, "--verbose")) DoVerbose = 1;
+        else if (i + 1 == ntok) return "unknown option or missing argument";
+        else if (!strcmp(o, "-m") || !strcmp(o, "--mode")) {
+            if (!parse_mode(tok[++i])) return "unknown mode";
+        } else if (!strcmp(o, "-F") || !strcmp(o, "--format")) {
+            if (!parse_format(tok[++i])) return "unknown format";
+        } else if (!strcmp(o, "-e") || !strcmp(o, "--encoding")) {
+            include[ninc++] = tok[++i];
+        } else if (!strcmp(o, "-x") || !strcmp(o, "--exclude")) {
+            exclude[nexc++] = tok[++i];
+        } else {
+            return "unknown option or missing argument";
+        }
+    }
+
+    for (int e = 0; e < Num_encodings; e++) {
+        if (ninc > 0 && !encoding_matches(e, include, ninc))
+            encodings[e].available = 0;
+        if (nexc > 0 && encoding_matches(e, exclude, nexc))
+            encodings[e].available = 0;
+    }
+    return NULL;
+}
+
+static void serve_error(struct ServeClient *c, const char *what) {
+    dprintf(c->fd, "encforce: %s\n", what);
+    close(c->fd);
+    c->fd = -1;
+}
+
+/* A complete request still waiting for its round */
+static inline int serve_pending(const struct ServeClient *c) {
+    return c->fd >= 0 && c->done && !c->answered;
+}
+
+/* Write what the socket takes of data; how much, or -1 if the client is gone */
+static ssize_t serve_put(struct ServeClient *c, const char *data, size_t len) {
+    size_t off = 0;
+
+    while (off < len) {
+        ssize_t n = write(c->fd, data + off, len - off);
+        if (n > 0) {
+            off += n;
+            c->progress = time(NULL);
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        } else {
+            return -1;
+        }
+    }
+    return off;
+}
+
+/*
+ * The reply stream's write function, called in turn order as pieces are
+ * flushed: send directly while nothing is queued, queue the rest. A
+ * failed reply swallows what is left.
+ */
+static ssize_t serve_write(void *cookie, const char *data, size_t len) {
+    struct ServeClient *c = cookie;
+    ssize_t n = 0;
+
+    if (c->failed) return len;
+    if (c->sent == c->qlen) {
+        c->sent = c->qlen = 0;
+        if ((n = serve_put(c, data, len)) < 0) {
+            c->failed = 1;
+            return len;
+        }
+    }
+    if ((size_t)n == len) return len;
+    if (c->qlen - c->sent + (len - n) > SERVE_MAXQUEUED) {
+        c->failed = c->toolarge = 1;
+        return len;
+    }
+    if (c->qlen + (len - n) > c->qsize) {
+        memmove(c->queued, c->queued + c->sent, c->qlen - c->sent);
+        c->qlen -= c->sent;
+        c->sent = 0;
+        while (c->qlen + (len - n) > c->qsize)
+            c->qsize = c->qsize ? 2 * c->qsize : 65536;
+        c->queued = realloc(c->queued, c->qsize);
+        if (!c->queued) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(1);
+        }
+    }
+    memcpy(c->queued + c->qlen, data + n, len - n);
+    c->qlen += len - n;
+    return len;
+}
+
+#ifdef __APPLE__
+static int serve_write_bsd(void *cookie, const char *data, int len) {
+    return (int)serve_write(cookie, data, len);
+}
+#endif
+
+/* An unbuffered stream that hands everything written to serve_write */
+static FILE *serve_stream(struct ServeClient *c) {
+    FILE *fo;
+#ifdef __APPLE__
+    fo = funopen(c, NULL, serve_write_bsd, NULL, NULL);
+#else
+    cookie_io_functions_t io = { NULL, serve_write, NULL, NULL };
+    fo = fopencookie(c, "w", io);
+#endif
+    if (fo) setvbuf(fo, NULL, _IONBF, 0);
+    return fo;
+}
+
+/* Send what the socket takes of the queue; close the client once it is all out */
+static void serve_send(struct ServeClient *c) {
+    ssize_t n = serve_put(c, c->queued + c->sent, c->qlen - c->sent);
+
+    if (n >= 0) c->sent += n;
+    if (n >= 0 && c->sent < c->qlen) return;
+    close(c->fd);
+    c->fd = -1;
+}
+
+/* Answer every complete request with the same options as the first one */
+static void serve_round(struct ServeClient *cl, int ncl) {
+    struct ServeClient *first = NULL;
+    FILE *fo[SERVE_MAXCLIENTS];
+    const char *err;
+    int turn = 1;
+
+    for (int i = 0; i < ncl && !first; i++)
+        if (serve_pending(&cl[i])) first = &cl[i];
+    if (!serve_records(first)) {
+        serve_error(first, "malformed request");
+        return;
+    }
+    if ((err = serve_options(first->opts, first->optlen)) != NULL) {
+        serve_error(first, err);
+        return;
+    }
+
+    for (int i = 0; i < ncl; i++) {
+        struct ServeClient *c = &cl[i];
+        fo[i] = NULL;
+        if (!serve_pending(c)) continue;
+        if (c != first) {
+            if (!serve_records(c)) {
+                serve_error(c, "malformed request");
+                continue;
+            }
+            if (c->optlen != first->optlen || memcmp(c->opts, first->opts, c->optlen) != 0)
+                continue;
+        }
+        fo[i] = serve_stream(c);
+        c->answered = 1;
+        if (!fo[i]) {
+            close(c->fd);
+            c->fd = -1;
+            continue;
+        }
+        write_output_header(fo[i]);
+
+        /* Pieces of a request write in turn, keeping its records in order */
+        int per = (c->nrec + Maxt - 1) / Maxt;
+        if (per > SERVE_JOBLINES) per = SERVE_JOBLINES;
+        for (int start = 0; start < c->nrec; start += per) {
+            struct JOB *job = get_free_job();
+            job->func = JOB_RECORDS;
+            job->turn = turn++;
+            job->out = fo[i];
+            job->readbuf = (char *)c->buf;
+            job->readindex = c->index + start;
+            job->numline = c->nrec - start < per ? c->nrec - start : per;
+            job->startline = start;
+            queue_job(job);
+        }
+    }
+    wait_jobs();
+    possess(Out_turn);
+    twist(Out_turn, TO, 1);
+
+    for (int i = 0; i < ncl; i++) {
+        if (!fo[i]) continue;
+        write_output_trailer(fo[i]);
+        fclose(fo[i]);
+        cl[i].progress = time(NULL);
+        if (cl[i].toolarge) {
+            /* the rest of the reply gives way to the error, sent as read */
+            static const char msg[] = "\nencforce: reply too large\n";
+            cl[i].sent = cl[i].qlen = 0;
+            cl[i].failed = 0;
+            serve_write(&cl[i], msg, sizeof(msg) - 1);
+        }
+        if (cl[i].failed) {
+            close(cl[i].fd);
+            cl[i].fd = -1;
+        }
+    }
+}
+
+static void serve(const char *path) {
+    struct sockaddr_un sa;
+    struct stat st;
+    struct ServeClient cl[SERVE_MAXCLIENTS];
+    struct pollfd pfd[SERVE_MAXCLIENTS + 1];
+    int lfd, ncl = 0;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(sa.sun_path)) {
+        fprintf(stderr, "--serve: socket path too long: %s\n", path);
+        exit(1);
+    }
+    strcpy(sa.sun_path, path);
+    /* Replace a socket left by an earlier server, never any other file */
+    if (lstat(path, &st) == 0) {
+        if (!S_ISSOCK(st.st_mode)) {
+            fprintf(stderr, "--serve: %s exists and is not a socket\n", path);
+            exit(1);
+        }
+        unlink(path);
+    }
+    lfd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (lfd < 0 || bind(lfd, (struct sockaddr *)&sa, sizeof(sa)) != 0 ||
+        listen(lfd, SOMAXCONN) != 0) {
+        perror(path);
+        exit(1);
+    }
+    /* A client that hangs up early must not take the server with it */
+    signal(SIGPIPE, SIG_IGN);
+
+    Serve.mode = OpMode;
+    Serve.format = OutFormat;
+    Serve.hex = DoHex;
+    Serve.verbose = DoVerbose;
+    Serve.unique = DoUnique;
+    Serve.noerrors = DoNoErrors;
+    for (int e = 0; e < Num_encodings; e++)
+        Serve.available[e] = encodings[e].available;
+
+    while (1) {
+        int np = 0, ndone = 0, sending = 0;
+
+        pfd[np].fd = ncl < SERVE_MAXCLIENTS ? lfd : -1;
+        pfd[np++].events = POLLIN;
+        for (int i = 0; i < ncl; i++) {
+            pfd[np].fd = cl[i].done && !cl[i].answered ? -1 : cl[i].fd;
+            pfd[np++].events = cl[i].answered ? POLLOUT : POLLIN;
+            sending |= cl[i].answered;
+        }
+        /* Wake up now and then to drop stalled readers */
+        if (poll(pfd, np, sending ? 1000 : -1) < 0) {
+            if (errno == EINTR) continue;
+            perror("poll");
+            exit(1);
+        }
+
+        time_t now = time(NULL);
+        for (int i = 0; i < ncl; i++) {
+            struct ServeClient *c = &cl[i];
+            if (c->answered) {
+                if (pfd[i + 1].revents & (POLLOUT | POLLHUP | POLLERR)) {
+                    serve_send(c);
+                } else if (now - c->progress > SERVE_STALL) {
+                    close(c->fd);
+                    c->fd = -1;
+                }
+                continue;
+            }
+            if (!(pfd[i + 1].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+            if (c->len == c->size) {
+                if (c->size >= SERVE_MAXREQUEST) {
+                    serve_error(c, "request too large");
+                    continue;
+                }
+                c->size = c->size ? 2 * c->size : 65536;
+                c->buf = realloc(c->buf, c->size);
+                if (!c->buf) {
+                    fprintf(stderr, "Memory allocation failed\n");
+                    exit(1);
+                }
+            }
+            ssize_t n = read(c->fd, c->buf + c->len, c->size - c->len);
+            if (n > 0) c->len += n;
+            else if (n == 0) c->done = 1;
+            else if (errno != EINTR && errno != EAGAIN) {
+                close(c->fd);
+                c->fd = -1;
+            }
+        }
+        if (pfd[0].revents & POLLIN) {
+            int fd = accept(lfd, NULL, NULL);
+            if (fd >= 0 && fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) != 0) {
+                close(fd);
+                fd = -1;
+            }
+            if (fd >= 0) {
+                memset(&cl[ncl], 0, sizeof(cl[ncl]));
+                cl[ncl++].fd = fd;
+            }
+        }
+
+        for (int i = 0; i < ncl; i++)
+            ndone += serve_pending(&cl[i]);
+        while (ndone > 0) {
+            serve_round(cl, ncl);
+            ndone = 0;
+            for (int i = 0; i < ncl; i++)
+                ndone += serve_pending(&cl[i]);
+        }
+
+        /* Drop the clients whose reply went out or that went away */
+        int k = 0;
+        for (int i = 0; i < ncl; i++) {
+            if (cl[i].fd >= 0) {
+                cl[k++] = cl[i];
+                continue;
+            }
+            free(cl[i].buf);
+            free(cl[i].index);
+            free(cl[i].queued);
+        }
+        ncl = k;
+    }
+}
+
 /* ===== Main ===== */
 int main(int argc, char **argv) {
     char *input_file = NULL;
+    char *render_file = NULL;
+    char *serve_path = NULL;
+    enum { OPT_SERVE = 256 };
 
     static struct option long_options[] = {
         {"file", required_argument, 0, 'f'},
+        {"null", no_argument, 0, '0'},
+        {"length-prefixed", no_argument, 0, 'P'},
         {"mode", required_argument, 0, 'm'},
         {"encoding", required_argument, 0, 'e'},
         {"exclude", required_argument, 0, 'x'},
         {"jobs", required_argument, 0, 'j'},
         {"format", required_argument, 0, 'F'},
+        {"render", required_argument, 0, 'R'},
         {"depth", required_argument, 0, 'd'},
         {"raw", no_argument, 0, 'r'},
         {"unique", no_argument, 0, 'u'},
         {"no-unique", no_argument, 0, 'U'},
         {"no-errors", no_argument, 0, 'E'},
+        {"stream", no_argument, 0, 'S'},
+        {"stream-delay", required_argument, 0, 'D'},
+        {"stream-lines", required_argument, 0, 'L'},
+        {"whole-file", no_argument, 0, 'W'},
         {"list-encodings", no_argument, 0, 'l'},
         {"verbose", no_argument, 0, 'v'},
         {"suggest", no_argument, 0, 's'},
         {"help", no_argument, 0, 'h'},
         {"version", no_argument, 0, 'V'},
+        {"serve", required_argument, 0, OPT_SERVE},
         {0, 0, 0, 0}
     };
 
+    simd_init();
     Maxt = get_nprocs();
     if (Maxt < 1) Maxt = 1;
     if (Maxt > 64) Maxt = 64;
 
     int opt;
-    while ((opt = getopt_long(argc, argv, "f:m:e:x:j:F:d:ruUElvshV", long_options, NULL)) != -1) {
+    while ((opt = getopt_long(argc, argv, "f:0Pm:e:x:j:F:R:d:ruUESD:L:WlvshV", long_options, NULL)) != -1) {
         switch (opt) {
         case 'f':
             input_file = optarg;
             break;
+        case '0':
+            InFormat = REC_NUL;
+            break;
+        case 'P':
+            InFormat = REC_LENGTH;
+            break;
         case 'm':
-            if (strcmp(optarg, "decode") == 0) OpMode = MODE_DECODE;
-            else if (strcmp(optarg, "encode") == 0) OpMode = MODE_ENCODE;
-            else if (strcmp(optarg, "both") == 0) OpMode = MODE_BOTH;
-            else if (strcmp(optarg, "transcode") == 0) OpMode = MODE_TRANSCODE;
-            else if (strcmp(optarg, "all") == 0) OpMode = MODE_ALL;
-            else {
+            if (!parse_mode(optarg)) {
                 fprintf(stderr, "Unknown mode: %s\n", optarg);
                 exit(1);
             }
@@ -983,14 +4584,14 @@ int main(int argc, char **argv) {
             if (Maxt > 256) Maxt = 256;
             break;
         case 'F':
-            if (strcmp(optarg, "lines") == 0) OutFormat = FMT_LINES;
-            else if (strcmp(optarg, "json") == 0) OutFormat = FMT_JSON;
-            else if (strcmp(optarg, "tsv") == 0) OutFormat = FMT_TSV;
-            else {
+            if (!parse_format(optarg)) {
                 fprintf(stderr, "Unknown format: %s\n", optarg);
                 exit(1);
             }
             break;
+        case 'R':
+            render_file = optarg;
+            break;
         case 'd':
             MaxDepth = atoi(optarg);
             if (MaxDepth < 1) MaxDepth = 1;
@@ -1007,6 +4608,20 @@ int main(int argc, char **argv) {
         case 'E':
             DoNoErrors = 1;
             break;
+        case 'S':
+            DoStream = 1;
+            break;
+        case 'D':
+            StreamDelay = atoi(optarg);
+            if (StreamDelay < 0) StreamDelay = 0;
+            break;
+        case 'L':
+            StreamLines = atoi(optarg);
+            if (StreamLines < 1) StreamLines = 1;
+            break;
+        case 'W':
+            DoWholeFile = 1;
+            break;
         case 'l': {
             int i, k;
             printf("%-30s  %s\n", "Encoding", "Aliases");
@@ -1033,30 +4648,56 @@ int main(int argc, char **argv) {
         case 'V':
             fprintf(stderr, "encforce %s\n", VERSION);
             exit(0);
+        case OPT_SERVE:
+            serve_path = optarg;
+            break;
         default:
             usage();
             exit(1);
         }
     }
 
+    /* Output lock is used by every path, including string arguments */
+    Output_lock = new_lock(0);
+    if (!Output_lock) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+
+    if (render_file) {
+        render_binary(render_file);
+        fflush(stdout);
+        return 0;
+    }
+
     /* Validate encodings */
     validate_encodings();
+    /* Plain lines output shows no labels; --serve requests pick their own */
+    if (OutFormat != FMT_LINES || DoVerbose || serve_path) build_labels();
 
-    /* Build reverse maps for single-byte encode */
-    {
-        struct CharEncoding *enc_array = &encodings[0].enc;
-        /* We need to pass the array with proper stride.
-         * Since CharEncoding is embedded in Encoding, we iterate manually. */
-        for (int i = 0; i < Num_encodings; i++) {
-            if (encodings[i].enc.type == ENC_TYPE_SINGLE_BYTE &&
-                encodings[i].enc.to_unicode != NULL &&
-                encodings[i].available) {
-                /* charconv_init_reverse_maps expects a contiguous CharEncoding array,
-                 * but our array has stride sizeof(struct Encoding). Call individually. */
-                charconv_init_reverse_maps(&encodings[i].enc, 1);
-            }
+    /* Single-byte reverse maps are generated const data (sb_tables.c) */
+    build_decode_groups();
+    LineTables = serve_path || input_file || optind >= argc;
+    for (int i = optind, high = 0; i < argc && !LineTables; i++) {
+        for (const unsigned char *p = (const unsigned char *)argv[i]; *p; p++)
+            high += *p >= 0x80;
+        LineTables = high >= LINE_TABLES_MIN;
+    }
+    /* --serve requests pick their own mode */
+    if (((OpMode & MODE_DECODE) || serve_path) && LineTables) build_decode_lanes();
+    if (((OpMode & MODE_ENCODE) || serve_path) && LineTables) {
+        build_encode_groups();
+        build_encode_lanes();
+    }
+    if ((OpMode & MODE_TRANSCODE) || serve_path) build_transcode_maps();
+
+    if (serve_path) {
+        if (optind < argc || input_file) {
+            fprintf(stderr, "--serve: inputs come from requests, not arguments\n");
+            exit(1);
         }
-        (void)enc_array;
+        init_jobs();
+        serve(serve_path);
     }
 
     /* If we have remaining argv arguments and no -f, process them as strings */
@@ -1083,57 +4724,26 @@ int main(int argc, char **argv) {
     /* Allocate buffers */
     Readbuf = malloc(MAXCHUNK + 16);
     Readindex = malloc(MAXLINEPERCHUNK * 2 * sizeof(struct LineInfo) + 16);
-    Jobs = calloc(Maxt, sizeof(struct JOB));
-
-    FreeWaiting = new_lock(Maxt);
-    WorkWaiting = new_lock(0);
     ReadBuf0 = new_lock(0);
     ReadBuf1 = new_lock(0);
-    Output_lock = new_lock(0);
 
-    if (!Readbuf || !Readindex || !Jobs || !FreeWaiting || !WorkWaiting ||
-        !ReadBuf0 || !ReadBuf1 || !Output_lock) {
+    if (!Readbuf || !Readindex || !ReadBuf0 || !ReadBuf1) {
         fprintf(stderr, "Memory allocation failed\n");
         exit(1);
     }
+    init_jobs();
 
-    /* Initialize job queue */
-    WorkTail = &WorkHead;
-    FreeTail = &FreeHead;
-    Workthread = 0;
-
-    int x;
-    for (x = 0; x < Maxt; x++) {
-        *FreeTail = &Jobs[x];
-        FreeTail = &(Jobs[x].next);
-        Jobs[x].outbuf = malloc(OUTBUFSIZE);
-        Jobs[x].outlen = 0;
-        Jobs[x].outsize = OUTBUFSIZE;
-        Jobs[x].dedup_hashes = calloc(DEDUP_CAPACITY, sizeof(uint64_t));
-        Jobs[x].dedup_capacity = DEDUP_CAPACITY;
-        Jobs[x].scratch = malloc(SCRATCH_SIZE);
-        Jobs[x].scratch_size = SCRATCH_SIZE;
-        if (!Jobs[x].outbuf || !Jobs[x].dedup_hashes || !Jobs[x].scratch) {
-            fprintf(stderr, "Memory allocation failed for job %d\n", x);
-            exit(1);
-        }
-    }
-
-    process_file(fi);
+    if (DoWholeFile)
+        process_whole_file(fi);
+    else
+        process_file(fi);
 
     if (fi != stdin) fclose(fi);
 
     /* Cleanup */
-    for (x = 0; x < Maxt; x++) {
-        free(Jobs[x].outbuf);
-        free(Jobs[x].dedup_hashes);
-        free(Jobs[x].scratch);
-    }
-    free(Jobs);
+    free_jobs();
     free(Readbuf);
     free(Readindex);
-    free_lock(FreeWaiting);
-    free_lock(WorkWaiting);
     free_lock(ReadBuf0);
     free_lock(ReadBuf1);
     free_lock(Output_lock);
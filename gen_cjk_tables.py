@@ -1,6 +1,6 @@
 #!/usr/bin/env python3
 """
-Generate cjk_data.h from WHATWG encoding standard index files.
+Generate cjk_data.h and cjk_data.c from WHATWG encoding standard index files.
 
 Downloads and parses:
   - index-jis0208.txt
@@ -10,8 +10,8 @@ Downloads and parses:
   - index-gb18030-ranges.txt
   - index-big5.txt
 
-Produces cjk_data.h with decode arrays, sorted encode arrays,
-and gb18030 range table.
+Produces cjk_data.c with decode arrays, sorted encode arrays, the
+gb18030 range table and its direct index, and cjk_data.h declaring them.
 """
 
 import os
@@ -33,8 +33,15 @@ RANGES_FILE = ("index-gb18030-ranges.txt", "gb18030_ranges")
 
 SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
 OUTPUT_FILE = os.path.join(SCRIPT_DIR, "cjk_data.h")
+OUTPUT_SOURCE = os.path.join(SCRIPT_DIR, "cjk_data.c")
 CACHE_DIR = os.path.join(SCRIPT_DIR, ".index_cache")
 
+# First uint16 decode value that escapes to a _decode_supp[] entry
+CJK_DECODE_SUPP = 0xD800
+
+# gb18030 four-byte index block size (64 keys)
+GB18030_BLOCK_SHIFT = 6
+
 
 def download(filename):
     """Download a file from WHATWG, caching locally."""
@@ -98,6 +105,64 @@ def parse_ranges(text):
     return entries
 
 
+def define(w, d, decl, comment=None):
+    """Declare an array in the header (w) and open its definition in the source (d)."""
+    if comment:
+        w(comment)
+        d(comment)
+    w("extern const {};".format(decl))
+    d("const {} = {{".format(decl))
+
+
+def emit_gb18030_index(w, d, ranges_entries, key, name, what):
+    """Emit a direct index for the piecewise-linear map gb18030_ranges defines.
+
+    key 0 maps pointer -> codepoint, key 1 maps codepoint -> pointer.  Each
+    x maps through the last range whose key is <= x.  The index covers keys
+    below the second-to-last range start; past that the map is linear.
+    """
+    starts = sorted((r[key], r[1 - key]) for r in ranges_entries)
+    limit = starts[-2][0]
+
+    def value(x):
+        lo, hi = 0, len(starts) - 1
+        while lo < hi:
+            mid = (lo + hi + 1) // 2
+            if starts[mid][0] <= x:
+                lo = mid
+            else:
+                hi = mid - 1
+        k, v = starts[lo]
+        return v + (x - k) if k <= x else 0
+
+    size = 1 << GB18030_BLOCK_SHIFT
+    nblocks = (limit + size - 1) // size
+    blocks = []
+    detail = []
+    for b in range(nblocks):
+        vals = [value(x) if x < limit else 0 for x in range(b * size, (b + 1) * size)]
+        if all(vals[i] == vals[0] + i for i in range(size)):
+            blocks.append("0x{:04X}".format(vals[0]))
+        else:
+            blocks.append("GB18030_MIXED | {}".format(len(detail) // size))
+            detail.extend(vals)
+
+    comment = "/* gb18030 {}: {} blocks, {} mixed */".format(what, nblocks, len(detail) // size)
+    w(comment)
+    d(comment)
+    w("#define GB18030_{}_LIMIT {}".format(name.upper(), limit))
+    define(w, d, "uint32_t gb18030_{}_block[{}]".format(name, nblocks))
+    for i in range(0, nblocks, 4):
+        d("    " + " ".join(v + "," for v in blocks[i:i + 4]))
+    d("};")
+    define(w, d, "uint16_t gb18030_{}_detail[{}]".format(name, len(detail)))
+    for i in range(0, len(detail), 8):
+        d("    " + ", ".join("0x{:04X}".format(v) for v in detail[i:i + 8]) + ",")
+    d("};")
+    d("")
+    w("")
+
+
 def main():
     print("gen_cjk_tables.py: Generating CJK encoding tables")
     print()
@@ -119,9 +184,11 @@ def main():
     print("  {} range entries".format(len(ranges_entries)))
     print()
 
-    # Generate output
+    # Generate output: declarations in cjk_data.h, one definition in cjk_data.c
     lines = []
     w = lines.append
+    src_lines = []
+    d = src_lines.append
 
     w("/* cjk_data.h - Auto-generated by gen_cjk_tables.py */")
     w("/* Do not edit manually. */")
@@ -141,6 +208,19 @@ def main():
     w("    uint32_t codepoint;")
     w("};")
     w("")
+    w("/*")
+    w(" * Decode arrays are uint16_t.  Surrogates never decode, so an entry in")
+    w(" * 0xD800-0xDFFF is CJK_DECODE_SUPP plus an index into NAME_decode_supp[],")
+    w(" * which holds the supplementary-plane code points.")
+    w(" */")
+    w("#define CJK_DECODE_SUPP 0x{:04X}".format(CJK_DECODE_SUPP))
+    w("")
+
+    d("/* cjk_data.c - Auto-generated by gen_cjk_tables.py */")
+    d("/* Do not edit manually. */")
+    d("")
+    d('#include "cjk_data.h"')
+    d("")
 
     stats = {}
 
@@ -153,24 +233,47 @@ def main():
         for p, c in entries:
             decode_map[p] = c
 
-        w("/* {}: {} mappings, max pointer {} */".format(name, len(entries), max_pointer))
-        w("static const uint32_t {}_decode[{}] = {{".format(name, decode_size))
+        # Supplementary code points escape through surrogate values
+        supp = []
+        supp_index = {}
+        for p in sorted(decode_map):
+            c = decode_map[p]
+            if 0xD800 <= c <= 0xDFFF:
+                sys.exit("{}: surrogate U+{:04X} at pointer {}".format(name, c, p))
+            if c > 0xFFFF and c not in supp_index:
+                supp_index[c] = len(supp)
+                supp.append(c)
+        if len(supp) > 0x800:
+            sys.exit("{}: {} supplementary code points do not fit".format(name, len(supp)))
+
+        define(w, d, "uint16_t {}_decode[{}]".format(name, decode_size),
+               "/* {}: {} mappings, max pointer {} */".format(name, len(entries), max_pointer))
 
         # Write in rows of 8
         row = []
         for i in range(decode_size):
             val = decode_map.get(i, 0)
-            if val:
+            if val > 0xFFFF:
+                row.append("0x{:04X}".format(CJK_DECODE_SUPP + supp_index[val]))
+            elif val:
                 row.append("0x{:04X}".format(val))
             else:
                 row.append("0")
             if len(row) == 8:
-                w("    " + ", ".join(row) + ",")
+                d("    " + ", ".join(row) + ",")
                 row = []
         if row:
-            w("    " + ", ".join(row) + ",")
-        w("};")
-        w("")
+            d("    " + ", ".join(row) + ",")
+        d("};")
+        d("")
+
+        if supp:
+            define(w, d, "uint32_t {}_decode_supp[{}]".format(name, len(supp)),
+                   "/* {}: {} supplementary-plane code points */".format(name, len(supp)))
+            for i in range(0, len(supp), 8):
+                d("    " + ", ".join("0x{:04X}".format(c) for c in supp[i:i + 8]) + ",")
+            d("};")
+            d("")
 
         # -- Encode array (sorted by codepoint) --
         # For duplicate codepoints, keep the first (lowest pointer) per WHATWG spec
@@ -180,10 +283,11 @@ def main():
                 encode_map[c] = p
         encode_list = sorted(encode_map.items())  # sorted by codepoint
 
-        w("static const struct cjk_encode_entry {}_encode[{}] = {{".format(name, len(encode_list)))
+        define(w, d, "struct cjk_encode_entry {}_encode[{}]".format(name, len(encode_list)))
         for cp, ptr in encode_list:
-            w("    {{0x{:04X}, {}}},".format(cp, ptr))
-        w("};")
+            d("    {{0x{:04X}, {}}},".format(cp, ptr))
+        d("};")
+        d("")
         w("")
 
         stats[name] = {
@@ -193,12 +297,26 @@ def main():
         }
 
     # -- GB18030 ranges --
-    w("/* gb18030_ranges: {} range entries */".format(len(ranges_entries)))
-    w("static const struct gb18030_range gb18030_ranges[{}] = {{".format(len(ranges_entries)))
+    define(w, d, "struct gb18030_range gb18030_ranges[{}]".format(len(ranges_entries)),
+           "/* gb18030_ranges: {} range entries */".format(len(ranges_entries)))
     for ptr, cp in ranges_entries:
-        w("    {{{}, 0x{:04X}}},".format(ptr, cp))
-    w("};")
+        d("    {{{}, 0x{:04X}}},".format(ptr, cp))
+    d("};")
+    d("")
+    w("")
+
+    # -- GB18030 four-byte direct index --
+    w("/*")
+    w(" * gb18030 four-byte direct index.  Below X_LIMIT, block x >> 6 holds the")
+    w(" * mapped value of its first key (the block is linear), or GB18030_MIXED")
+    w(" * plus a 64-entry row number in X_detail.  At and above X_LIMIT the last")
+    w(" * two gb18030_ranges entries apply directly.")
+    w(" */")
+    w("#define GB18030_BLOCK_SHIFT {}".format(GB18030_BLOCK_SHIFT))
+    w("#define GB18030_MIXED 0x80000000u")
     w("")
+    emit_gb18030_index(w, d, ranges_entries, 0, "ptr", "pointer -> codepoint")
+    emit_gb18030_index(w, d, ranges_entries, 1, "cp", "codepoint -> pointer")
 
     # Convenience size macros
     w("/* Array size constants */")
@@ -215,11 +333,14 @@ def main():
     output = "\n".join(lines)
     with open(OUTPUT_FILE, "w", encoding="utf-8") as f:
         f.write(output)
+    source = "\n".join(src_lines)
+    with open(OUTPUT_SOURCE, "w", encoding="utf-8") as f:
+        f.write(source)
 
-    total_lines = len(lines)
-    file_size = len(output.encode("utf-8"))
+    total_lines = len(lines) + len(src_lines)
+    file_size = len(output.encode("utf-8")) + len(source.encode("utf-8"))
 
-    print("Written: {}".format(OUTPUT_FILE))
+    print("Written: {}, {}".format(OUTPUT_FILE, OUTPUT_SOURCE))
     print("Total lines: {}".format(total_lines))
     print("File size: {:,} bytes ({:.1f} MB)".format(file_size, file_size / 1024 / 1024))
     print()
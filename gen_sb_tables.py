@@ -1,8 +1,8 @@
 #!/usr/bin/env python3
-"""Convert Rust single-byte encoding tables to C static const uint32_t arrays.
+"""Convert Rust single-byte encoding tables to C static const uint16_t arrays.
 
-Reads all .rs files in the Rust tables directory and produces sb_tables.h
-with C arrays suitable for charconv.
+Reads all .rs files in the Rust tables directory and produces sb_tables.c
+with the C arrays suitable for charconv, and sb_tables.h declaring them.
 """
 
 import re
@@ -11,6 +11,7 @@ import sys
 
 RUST_TABLES_DIR = "/Users/dlr/src/mdfind/encforce/src/encodings/tables"
 OUTPUT_FILE = "/Users/dlr/src/mdfind/cenc/sb_tables.h"
+OUTPUT_SOURCE = "/Users/dlr/src/mdfind/cenc/sb_tables.c"
 
 def extract_tables(filepath):
     """Extract all table definitions from a Rust source file."""
@@ -91,8 +92,11 @@ def extract_tables(filepath):
 
 def format_c_table(name, values):
     """Format a single table as a C static const array."""
+    # Every single-byte table is BMP-only; uint16 halves the decode working set
+    if max(values) > 0xFFFF:
+        sys.exit(f"{name}: supplementary code point needs a wider table")
     lines = []
-    lines.append(f"static const uint32_t {name}[256] = {{")
+    lines.append(f"const uint16_t {name}[256] = {{")
     for row in range(16):
         vals = []
         for col in range(16):
@@ -123,25 +127,71 @@ def main():
             print(f"WARNING: {filepath} not found", file=sys.stderr)
 
     print(f"\nTotal: {len(all_tables)} tables", file=sys.stderr)
+    write_tables(all_tables)
+
+def reverse_name(name):
+    """ascii_to_unicode -> ascii_from_unicode"""
+    return name[:-len("_to_unicode")] + "_from_unicode"
+
+def reverse_entries(values):
+    """The encoder's reverse map: (codepoint, byte) sorted by codepoint.
+
+    Unmapped bytes are left out; when several bytes decode to the same
+    codepoint the highest byte wins (matches Rust HashMap "last wins").
+    """
+    rev = {}
+    for b, v in enumerate(values):
+        if v != 0xFFFD and v != 0xFFFF:
+            rev[v] = b
+    return sorted(rev.items())
+
+def format_c_reverse(name, values):
+    """Format a table's reverse map as a C const sb_reverse_entry array."""
+    entries = reverse_entries(values)
+    lines = [f"const struct sb_reverse_entry {reverse_name(name)}[{len(entries)}] = {{"]
+    for i in range(0, len(entries), 8):
+        row = [f"{{0x{cp:04X}, 0x{b:02X}}}" for cp, b in entries[i:i + 8]]
+        lines.append(f"    {', '.join(row)},")
+    lines.append("};")
+    return '\n'.join(lines)
+
+def write_banner(f, filename, count):
+    f.write(f"/* {filename} — Single-byte encoding tables (auto-generated from Rust source)\n")
+    f.write(f" * {count} tables, 256 entries each\n")
+    f.write(" * Values are Unicode codepoints (BMP only). 0xFFFD = unmapped byte.\n")
+    f.write(" * NAME_from_unicode is the sorted reverse map charconv encodes through.\n")
+    f.write(" * Generated by gen_sb_tables.py\n")
+    f.write(" */\n\n")
 
-    # Generate the C header
+def write_tables(all_tables):
+    """Write the declarations (sb_tables.h) and the one definition (sb_tables.c)."""
     with open(OUTPUT_FILE, 'w') as f:
-        f.write("/* sb_tables.h — Single-byte encoding tables (auto-generated from Rust source)\n")
-        f.write(f" * {len(all_tables)} tables, 256 entries each\n")
-        f.write(" * Values are Unicode codepoints. 0xFFFD = unmapped byte.\n")
-        f.write(" * Generated by gen_sb_tables.py\n")
-        f.write(" */\n\n")
+        write_banner(f, "sb_tables.h", len(all_tables))
         f.write("#ifndef SB_TABLES_H\n")
         f.write("#define SB_TABLES_H\n\n")
-        f.write("#include <stdint.h>\n\n")
+        f.write("#include <stdint.h>\n")
+        f.write('#include "charconv.h"\n\n')
+
+        for name, values in all_tables:
+            rname = reverse_name(name)
+            f.write(f"extern const uint16_t {name}[256];\n")
+            f.write(f"#define {rname.upper()}_SIZE {len(reverse_entries(values))}\n")
+            f.write(f"extern const struct sb_reverse_entry {rname}[{rname.upper()}_SIZE];\n")
+
+        f.write("\n#endif /* SB_TABLES_H */\n")
+
+    with open(OUTPUT_SOURCE, 'w') as f:
+        write_banner(f, "sb_tables.c", len(all_tables))
+        f.write('#include "sb_tables.h"\n\n')
 
         for name, values in all_tables:
             f.write(format_c_table(name, values))
             f.write("\n\n")
-
-        f.write("#endif /* SB_TABLES_H */\n")
+            f.write(format_c_reverse(name, values))
+            f.write("\n\n")
 
     print(f"Wrote {OUTPUT_FILE}", file=sys.stderr)
+    print(f"Wrote {OUTPUT_SOURCE}", file=sys.stderr)
 
 if __name__ == '__main__':
     main()
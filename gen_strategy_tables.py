@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+"""
+Generate strategy_tables.h from the hand-written strategy data in charconv.c.
+
+Reads:
+  - charconv_html_entities[]   (ES_HTML_NAMED)
+  - charconv_translit_table[]  (ES_TRANSLITERATION)
+
+and extends the transliteration data with every code point whose Unicode
+compatibility decomposition (NFKD), minus combining marks, spells out in
+ASCII or in hand-table entries.  Hand-written entries always win.
+
+Produces strategy_tables.h with direct-index lookup tables: a page map
+from cp >> 8 to a 256-entry block of offsets into a string pool, where
+each pool string is prefixed by its length.  Offset 0 means no entry.
+"""
+
+import os
+import re
+import sys
+import unicodedata
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+SOURCE_FILE = os.path.join(SCRIPT_DIR, "charconv.c")
+OUTPUT_FILE = os.path.join(SCRIPT_DIR, "strategy_tables.h")
+
+# Longest derived transliteration kept (hand entries are not limited)
+MAX_DERIVED = 8
+
+
+def array_body(source, name):
+    """Return the initializer text of a const array in charconv.c."""
+    m = re.search(r'\b' + re.escape(name) + r'\[\]\s*=\s*\{(.*?)\n\};', source, re.DOTALL)
+    if not m:
+        sys.exit("{}: {} not found".format(SOURCE_FILE, name))
+    return re.sub(r'/\*.*?\*/', '', m.group(1), flags=re.DOTALL)
+
+
+def c_unescape(text):
+    return re.sub(r'\\(.)', r'\1', text)
+
+
+def parse_html_entities(source):
+    """Return {codepoint: name}, first entry for a code point wins."""
+    entities = {}
+    body = array_body(source, "charconv_html_entities")
+    for m in re.finditer(r'\{"([^"]+)",\s*0x([0-9A-Fa-f]+)\}', body):
+        entities.setdefault(int(m.group(2), 16), m.group(1))
+    return entities
+
+
+def parse_translit(source):
+    """Return {codepoint: ascii}, first entry for a code point wins."""
+    table = {}
+    body = array_body(source, "charconv_translit_table")
+    for m in re.finditer(r'\{0x([0-9A-Fa-f]+),\s*"((?:[^"\\]|\\.)*)"\}', body):
+        table.setdefault(int(m.group(1), 16), c_unescape(m.group(2)))
+    return table
+
+
+def derive_translit(hand):
+    """Transliterations derived from NFKD for code points the hand table lacks."""
+    derived = {}
+    for cp in range(0x80, 0x110000):
+        if cp in hand:
+            continue
+        ch = chr(cp)
+        cat = unicodedata.category(ch)
+        if cat in ("Cc", "Cs", "Co", "Cn") or cat.startswith("M"):
+            continue
+        decomp = unicodedata.normalize("NFKD", ch)
+        # U+0338 turns = into != and < into not-less-than; stripping it lies
+        if decomp == ch or "\u0338" in decomp:
+            continue
+        parts = []
+        for c in decomp:
+            if unicodedata.category(c).startswith("M"):
+                continue
+            if 0x20 <= ord(c) < 0x7F:
+                parts.append(c)
+            elif ord(c) in hand:
+                parts.append(hand[ord(c)])
+            else:
+                parts = None
+                break
+        if not parts:
+            continue
+        text = "".join(parts)
+        # Spacing accents (e.g. U+00A8) decompose to a bare space
+        if not text.strip() and cat != "Zs":
+            continue
+        if len(text) > MAX_DERIVED:
+            continue
+        derived[cp] = text
+    return derived
+
+
+def c_string(text):
+    out = []
+    for c in text:
+        if c in '"\\?':
+            out.append("\\" + c)
+        else:
+            out.append(c)
+    return "".join(out)
+
+
+def emit_map(w, prefix, mapping, what):
+    """Emit <prefix>_page[], <prefix>_index[][256] and <prefix>_pool[]."""
+    offsets = {}
+    pool = [""]   # offset 0 is the "no entry" sentinel
+    pos = 1
+    for cp in sorted(mapping):
+        text = mapping[cp]
+        if len(text) > 255:
+            sys.exit("{} entry U+{:04X} too long".format(what, cp))
+        offsets[cp] = pos
+        pool.append((cp, text))
+        pos += 1 + len(text)
+    if pos > 0xFFFF:
+        sys.exit("{} pool exceeds 64K".format(what))
+
+    pages = max(offsets) // 256 + 1
+    blocks = [[0] * 256]
+    page_map = [0] * pages
+    for cp, off in offsets.items():
+        page = cp >> 8
+        if not page_map[page]:
+            page_map[page] = len(blocks)
+            blocks.append([0] * 256)
+        blocks[page_map[page]][cp & 0xFF] = off
+    if len(blocks) > 256:
+        sys.exit("{} needs more than 256 blocks".format(what))
+
+    upper = prefix.upper()
+    w("/* {}: {} entries in {} blocks, pool {} bytes */".format(
+        what, len(offsets), len(blocks) - 1, pos))
+    w("#define {}_LIMIT 0x{:X}".format(upper, pages * 256))
+    w("")
+    w("static const uint8_t {}_page[{}] = {{".format(prefix, pages))
+    for i in range(0, pages, 16):
+        w("    " + " ".join("{},".format(b) for b in page_map[i:i + 16]))
+    w("};")
+    w("")
+    w("static const uint16_t {}_index[{}][256] = {{".format(prefix, len(blocks)))
+    for block in blocks:
+        w("    {")
+        for i in range(0, 256, 8):
+            w("        " + " ".join("{},".format(v) for v in block[i:i + 8]))
+        w("    },")
+    w("};")
+    w("")
+    w("static const char {}_pool[{}] =".format(prefix, pos))
+    w('    "\\000"')
+    for cp, text in pool[1:]:
+        w('    "\\{:03o}{}"  /* U+{:04X} */'.format(len(text), c_string(text), cp))
+    w("    ;")
+    w("")
+    return len(offsets), pos
+
+
+def main():
+    with open(SOURCE_FILE, "r", encoding="utf-8") as f:
+        source = f.read()
+
+    entities = parse_html_entities(source)
+    hand = parse_translit(source)
+    derived = derive_translit(hand)
+    translit = dict(derived)
+    translit.update(hand)
+
+    lines = []
+    w = lines.append
+
+    w("/* strategy_tables.h - Auto-generated by gen_strategy_tables.py */")
+    w("/* Do not edit manually. */")
+    w("/* Unicode data version {} */".format(unicodedata.unidata_version))
+    w("")
+    w("#ifndef STRATEGY_TABLES_H")
+    w("#define STRATEGY_TABLES_H")
+    w("")
+    w("#include <stdint.h>")
+    w("")
+    w("/*")
+    w(" * Lookup: off = X_index[X_page[cp >> 8]][cp & 0xFF] for cp < X_LIMIT;")
+    w(" * off != 0 points at a length byte in X_pool followed by the text.")
+    w(" */")
+    w("")
+    emit_map(w, "html_named", entities, "html_named")
+    emit_map(w, "translit", translit, "translit")
+    w("#endif /* STRATEGY_TABLES_H */")
+    w("")
+
+    output = "\n".join(lines)
+    with open(OUTPUT_FILE, "w", encoding="utf-8") as f:
+        f.write(output)
+
+    print("Written: {}".format(OUTPUT_FILE))
+    print("  html_named: {} entities".format(len(entities)))
+    print("  translit:   {} hand + {} derived".format(len(hand), len(derived)))
+
+
+if __name__ == "__main__":
+    main()
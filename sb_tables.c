@@ -0,0 +1,4682 @@
+/* sb_tables.c — Single-byte encoding tables (auto-generated from Rust source)
+ * 89 tables, 256 entries each
+ * Values are Unicode codepoints (BMP only). 0xFFFD = unmapped byte.
+ * NAME_from_unicode is the sorted reverse map charconv encodes through.
+ * Generated by gen_sb_tables.py
+ */
+
+#include "sb_tables.h"
+
+const uint16_t ascii_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x80 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x90 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xA0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xB0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xC0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xD0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xE0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry ascii_from_unicode[128] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+};
+
+const uint16_t iso_8859_1_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, /* 0xB0 */
+    0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, /* 0xC0 */
+    0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF, /* 0xD0 */
+    0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, /* 0xE0 */
+    0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_1_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x00A1, 0xA1}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A4, 0xA4}, {0x00A5, 0xA5}, {0x00A6, 0xA6}, {0x00A7, 0xA7},
+    {0x00A8, 0xA8}, {0x00A9, 0xA9}, {0x00AA, 0xAA}, {0x00AB, 0xAB}, {0x00AC, 0xAC}, {0x00AD, 0xAD}, {0x00AE, 0xAE}, {0x00AF, 0xAF},
+    {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B2, 0xB2}, {0x00B3, 0xB3}, {0x00B4, 0xB4}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7},
+    {0x00B8, 0xB8}, {0x00B9, 0xB9}, {0x00BA, 0xBA}, {0x00BB, 0xBB}, {0x00BC, 0xBC}, {0x00BD, 0xBD}, {0x00BE, 0xBE}, {0x00BF, 0xBF},
+    {0x00C0, 0xC0}, {0x00C1, 0xC1}, {0x00C2, 0xC2}, {0x00C3, 0xC3}, {0x00C4, 0xC4}, {0x00C5, 0xC5}, {0x00C6, 0xC6}, {0x00C7, 0xC7},
+    {0x00C8, 0xC8}, {0x00C9, 0xC9}, {0x00CA, 0xCA}, {0x00CB, 0xCB}, {0x00CC, 0xCC}, {0x00CD, 0xCD}, {0x00CE, 0xCE}, {0x00CF, 0xCF},
+    {0x00D0, 0xD0}, {0x00D1, 0xD1}, {0x00D2, 0xD2}, {0x00D3, 0xD3}, {0x00D4, 0xD4}, {0x00D5, 0xD5}, {0x00D6, 0xD6}, {0x00D7, 0xD7},
+    {0x00D8, 0xD8}, {0x00D9, 0xD9}, {0x00DA, 0xDA}, {0x00DB, 0xDB}, {0x00DC, 0xDC}, {0x00DD, 0xDD}, {0x00DE, 0xDE}, {0x00DF, 0xDF},
+    {0x00E0, 0xE0}, {0x00E1, 0xE1}, {0x00E2, 0xE2}, {0x00E3, 0xE3}, {0x00E4, 0xE4}, {0x00E5, 0xE5}, {0x00E6, 0xE6}, {0x00E7, 0xE7},
+    {0x00E8, 0xE8}, {0x00E9, 0xE9}, {0x00EA, 0xEA}, {0x00EB, 0xEB}, {0x00EC, 0xEC}, {0x00ED, 0xED}, {0x00EE, 0xEE}, {0x00EF, 0xEF},
+    {0x00F0, 0xF0}, {0x00F1, 0xF1}, {0x00F2, 0xF2}, {0x00F3, 0xF3}, {0x00F4, 0xF4}, {0x00F5, 0xF5}, {0x00F6, 0xF6}, {0x00F7, 0xF7},
+    {0x00F8, 0xF8}, {0x00F9, 0xF9}, {0x00FA, 0xFA}, {0x00FB, 0xFB}, {0x00FC, 0xFC}, {0x00FD, 0xFD}, {0x00FE, 0xFE}, {0x00FF, 0xFF},
+};
+
+const uint16_t iso_8859_2_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0x0104, 0x02D8, 0x0141, 0x00A4, 0x013D, 0x015A, 0x00A7, 0x00A8, 0x0160, 0x015E, 0x0164, 0x0179, 0x00AD, 0x017D, 0x017B, /* 0xA0 */
+    0x00B0, 0x0105, 0x02DB, 0x0142, 0x00B4, 0x013E, 0x015B, 0x02C7, 0x00B8, 0x0161, 0x015F, 0x0165, 0x017A, 0x02DD, 0x017E, 0x017C, /* 0xB0 */
+    0x0154, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x0139, 0x0106, 0x00C7, 0x010C, 0x00C9, 0x0118, 0x00CB, 0x011A, 0x00CD, 0x00CE, 0x010E, /* 0xC0 */
+    0x0110, 0x0143, 0x0147, 0x00D3, 0x00D4, 0x0150, 0x00D6, 0x00D7, 0x0158, 0x016E, 0x00DA, 0x0170, 0x00DC, 0x00DD, 0x0162, 0x00DF, /* 0xD0 */
+    0x0155, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x013A, 0x0107, 0x00E7, 0x010D, 0x00E9, 0x0119, 0x00EB, 0x011B, 0x00ED, 0x00EE, 0x010F, /* 0xE0 */
+    0x0111, 0x0144, 0x0148, 0x00F3, 0x00F4, 0x0151, 0x00F6, 0x00F7, 0x0159, 0x016F, 0x00FA, 0x0171, 0x00FC, 0x00FD, 0x0163, 0x02D9, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_2_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x00A4, 0xA4}, {0x00A7, 0xA7}, {0x00A8, 0xA8}, {0x00AD, 0xAD}, {0x00B0, 0xB0}, {0x00B4, 0xB4}, {0x00B8, 0xB8},
+    {0x00C1, 0xC1}, {0x00C2, 0xC2}, {0x00C4, 0xC4}, {0x00C7, 0xC7}, {0x00C9, 0xC9}, {0x00CB, 0xCB}, {0x00CD, 0xCD}, {0x00CE, 0xCE},
+    {0x00D3, 0xD3}, {0x00D4, 0xD4}, {0x00D6, 0xD6}, {0x00D7, 0xD7}, {0x00DA, 0xDA}, {0x00DC, 0xDC}, {0x00DD, 0xDD}, {0x00DF, 0xDF},
+    {0x00E1, 0xE1}, {0x00E2, 0xE2}, {0x00E4, 0xE4}, {0x00E7, 0xE7}, {0x00E9, 0xE9}, {0x00EB, 0xEB}, {0x00ED, 0xED}, {0x00EE, 0xEE},
+    {0x00F3, 0xF3}, {0x00F4, 0xF4}, {0x00F6, 0xF6}, {0x00F7, 0xF7}, {0x00FA, 0xFA}, {0x00FC, 0xFC}, {0x00FD, 0xFD}, {0x0102, 0xC3},
+    {0x0103, 0xE3}, {0x0104, 0xA1}, {0x0105, 0xB1}, {0x0106, 0xC6}, {0x0107, 0xE6}, {0x010C, 0xC8}, {0x010D, 0xE8}, {0x010E, 0xCF},
+    {0x010F, 0xEF}, {0x0110, 0xD0}, {0x0111, 0xF0}, {0x0118, 0xCA}, {0x0119, 0xEA}, {0x011A, 0xCC}, {0x011B, 0xEC}, {0x0139, 0xC5},
+    {0x013A, 0xE5}, {0x013D, 0xA5}, {0x013E, 0xB5}, {0x0141, 0xA3}, {0x0142, 0xB3}, {0x0143, 0xD1}, {0x0144, 0xF1}, {0x0147, 0xD2},
+    {0x0148, 0xF2}, {0x0150, 0xD5}, {0x0151, 0xF5}, {0x0154, 0xC0}, {0x0155, 0xE0}, {0x0158, 0xD8}, {0x0159, 0xF8}, {0x015A, 0xA6},
+    {0x015B, 0xB6}, {0x015E, 0xAA}, {0x015F, 0xBA}, {0x0160, 0xA9}, {0x0161, 0xB9}, {0x0162, 0xDE}, {0x0163, 0xFE}, {0x0164, 0xAB},
+    {0x0165, 0xBB}, {0x016E, 0xD9}, {0x016F, 0xF9}, {0x0170, 0xDB}, {0x0171, 0xFB}, {0x0179, 0xAC}, {0x017A, 0xBC}, {0x017B, 0xAF},
+    {0x017C, 0xBF}, {0x017D, 0xAE}, {0x017E, 0xBE}, {0x02C7, 0xB7}, {0x02D8, 0xA2}, {0x02D9, 0xFF}, {0x02DB, 0xB2}, {0x02DD, 0xBD},
+};
+
+const uint16_t iso_8859_3_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0x0126, 0x02D8, 0x00A3, 0x00A4, 0xFFFD, 0x0124, 0x00A7, 0x00A8, 0x0130, 0x015E, 0x011E, 0x0134, 0x00AD, 0xFFFD, 0x017B, /* 0xA0 */
+    0x00B0, 0x0127, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x0125, 0x00B7, 0x00B8, 0x0131, 0x015F, 0x011F, 0x0135, 0x00BD, 0xFFFD, 0x017C, /* 0xB0 */
+    0x00C0, 0x00C1, 0x00C2, 0xFFFD, 0x00C4, 0x010A, 0x0108, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, /* 0xC0 */
+    0xFFFD, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x0120, 0x00D6, 0x00D7, 0x011C, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x016C, 0x015C, 0x00DF, /* 0xD0 */
+    0x00E0, 0x00E1, 0x00E2, 0xFFFD, 0x00E4, 0x010B, 0x0109, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, /* 0xE0 */
+    0xFFFD, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x0121, 0x00F6, 0x00F7, 0x011D, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x016D, 0x015D, 0x02D9, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_3_from_unicode[249] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x00A3, 0xA3}, {0x00A4, 0xA4}, {0x00A7, 0xA7}, {0x00A8, 0xA8}, {0x00AD, 0xAD}, {0x00B0, 0xB0}, {0x00B2, 0xB2},
+    {0x00B3, 0xB3}, {0x00B4, 0xB4}, {0x00B5, 0xB5}, {0x00B7, 0xB7}, {0x00B8, 0xB8}, {0x00BD, 0xBD}, {0x00C0, 0xC0}, {0x00C1, 0xC1},
+    {0x00C2, 0xC2}, {0x00C4, 0xC4}, {0x00C7, 0xC7}, {0x00C8, 0xC8}, {0x00C9, 0xC9}, {0x00CA, 0xCA}, {0x00CB, 0xCB}, {0x00CC, 0xCC},
+    {0x00CD, 0xCD}, {0x00CE, 0xCE}, {0x00CF, 0xCF}, {0x00D1, 0xD1}, {0x00D2, 0xD2}, {0x00D3, 0xD3}, {0x00D4, 0xD4}, {0x00D6, 0xD6},
+    {0x00D7, 0xD7}, {0x00D9, 0xD9}, {0x00DA, 0xDA}, {0x00DB, 0xDB}, {0x00DC, 0xDC}, {0x00DF, 0xDF}, {0x00E0, 0xE0}, {0x00E1, 0xE1},
+    {0x00E2, 0xE2}, {0x00E4, 0xE4}, {0x00E7, 0xE7}, {0x00E8, 0xE8}, {0x00E9, 0xE9}, {0x00EA, 0xEA}, {0x00EB, 0xEB}, {0x00EC, 0xEC},
+    {0x00ED, 0xED}, {0x00EE, 0xEE}, {0x00EF, 0xEF}, {0x00F1, 0xF1}, {0x00F2, 0xF2}, {0x00F3, 0xF3}, {0x00F4, 0xF4}, {0x00F6, 0xF6},
+    {0x00F7, 0xF7}, {0x00F9, 0xF9}, {0x00FA, 0xFA}, {0x00FB, 0xFB}, {0x00FC, 0xFC}, {0x0108, 0xC6}, {0x0109, 0xE6}, {0x010A, 0xC5},
+    {0x010B, 0xE5}, {0x011C, 0xD8}, {0x011D, 0xF8}, {0x011E, 0xAB}, {0x011F, 0xBB}, {0x0120, 0xD5}, {0x0121, 0xF5}, {0x0124, 0xA6},
+    {0x0125, 0xB6}, {0x0126, 0xA1}, {0x0127, 0xB1}, {0x0130, 0xA9}, {0x0131, 0xB9}, {0x0134, 0xAC}, {0x0135, 0xBC}, {0x015C, 0xDE},
+    {0x015D, 0xFE}, {0x015E, 0xAA}, {0x015F, 0xBA}, {0x016C, 0xDD}, {0x016D, 0xFD}, {0x017B, 0xAF}, {0x017C, 0xBF}, {0x02D8, 0xA2},
+    {0x02D9, 0xFF},
+};
+
+const uint16_t iso_8859_4_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0x0104, 0x0138, 0x0156, 0x00A4, 0x0128, 0x013B, 0x00A7, 0x00A8, 0x0160, 0x0112, 0x0122, 0x0166, 0x00AD, 0x017D, 0x00AF, /* 0xA0 */
+    0x00B0, 0x0105, 0x02DB, 0x0157, 0x00B4, 0x0129, 0x013C, 0x02C7, 0x00B8, 0x0161, 0x0113, 0x0123, 0x0167, 0x014A, 0x017E, 0x014B, /* 0xB0 */
+    0x0100, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x012E, 0x010C, 0x00C9, 0x0118, 0x00CB, 0x0116, 0x00CD, 0x00CE, 0x012A, /* 0xC0 */
+    0x0110, 0x0145, 0x014C, 0x0136, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x0172, 0x00DA, 0x00DB, 0x00DC, 0x0168, 0x016A, 0x00DF, /* 0xD0 */
+    0x0101, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x012F, 0x010D, 0x00E9, 0x0119, 0x00EB, 0x0117, 0x00ED, 0x00EE, 0x012B, /* 0xE0 */
+    0x0111, 0x0146, 0x014D, 0x0137, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x0173, 0x00FA, 0x00FB, 0x00FC, 0x0169, 0x016B, 0x02D9, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_4_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x00A4, 0xA4}, {0x00A7, 0xA7}, {0x00A8, 0xA8}, {0x00AD, 0xAD}, {0x00AF, 0xAF}, {0x00B0, 0xB0}, {0x00B4, 0xB4},
+    {0x00B8, 0xB8}, {0x00C1, 0xC1}, {0x00C2, 0xC2}, {0x00C3, 0xC3}, {0x00C4, 0xC4}, {0x00C5, 0xC5}, {0x00C6, 0xC6}, {0x00C9, 0xC9},
+    {0x00CB, 0xCB}, {0x00CD, 0xCD}, {0x00CE, 0xCE}, {0x00D4, 0xD4}, {0x00D5, 0xD5}, {0x00D6, 0xD6}, {0x00D7, 0xD7}, {0x00D8, 0xD8},
+    {0x00DA, 0xDA}, {0x00DB, 0xDB}, {0x00DC, 0xDC}, {0x00DF, 0xDF}, {0x00E1, 0xE1}, {0x00E2, 0xE2}, {0x00E3, 0xE3}, {0x00E4, 0xE4},
+    {0x00E5, 0xE5}, {0x00E6, 0xE6}, {0x00E9, 0xE9}, {0x00EB, 0xEB}, {0x00ED, 0xED}, {0x00EE, 0xEE}, {0x00F4, 0xF4}, {0x00F5, 0xF5},
+    {0x00F6, 0xF6}, {0x00F7, 0xF7}, {0x00F8, 0xF8}, {0x00FA, 0xFA}, {0x00FB, 0xFB}, {0x00FC, 0xFC}, {0x0100, 0xC0}, {0x0101, 0xE0},
+    {0x0104, 0xA1}, {0x0105, 0xB1}, {0x010C, 0xC8}, {0x010D, 0xE8}, {0x0110, 0xD0}, {0x0111, 0xF0}, {0x0112, 0xAA}, {0x0113, 0xBA},
+    {0x0116, 0xCC}, {0x0117, 0xEC}, {0x0118, 0xCA}, {0x0119, 0xEA}, {0x0122, 0xAB}, {0x0123, 0xBB}, {0x0128, 0xA5}, {0x0129, 0xB5},
+    {0x012A, 0xCF}, {0x012B, 0xEF}, {0x012E, 0xC7}, {0x012F, 0xE7}, {0x0136, 0xD3}, {0x0137, 0xF3}, {0x0138, 0xA2}, {0x013B, 0xA6},
+    {0x013C, 0xB6}, {0x0145, 0xD1}, {0x0146, 0xF1}, {0x014A, 0xBD}, {0x014B, 0xBF}, {0x014C, 0xD2}, {0x014D, 0xF2}, {0x0156, 0xA3},
+    {0x0157, 0xB3}, {0x0160, 0xA9}, {0x0161, 0xB9}, {0x0166, 0xAC}, {0x0167, 0xBC}, {0x0168, 0xDD}, {0x0169, 0xFD}, {0x016A, 0xDE},
+    {0x016B, 0xFE}, {0x0172, 0xD9}, {0x0173, 0xF9}, {0x017D, 0xAE}, {0x017E, 0xBE}, {0x02C7, 0xB7}, {0x02D9, 0xFF}, {0x02DB, 0xB2},
+};
+
+const uint16_t iso_8859_5_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040A, 0x040B, 0x040C, 0x00AD, 0x040E, 0x040F, /* 0xA0 */
+    0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F, /* 0xB0 */
+    0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F, /* 0xC0 */
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, /* 0xD0 */
+    0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F, /* 0xE0 */
+    0x2116, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457, 0x0458, 0x0459, 0x045A, 0x045B, 0x045C, 0x00A7, 0x045E, 0x045F, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_5_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x00A7, 0xFD}, {0x00AD, 0xAD}, {0x0401, 0xA1}, {0x0402, 0xA2}, {0x0403, 0xA3}, {0x0404, 0xA4}, {0x0405, 0xA5},
+    {0x0406, 0xA6}, {0x0407, 0xA7}, {0x0408, 0xA8}, {0x0409, 0xA9}, {0x040A, 0xAA}, {0x040B, 0xAB}, {0x040C, 0xAC}, {0x040E, 0xAE},
+    {0x040F, 0xAF}, {0x0410, 0xB0}, {0x0411, 0xB1}, {0x0412, 0xB2}, {0x0413, 0xB3}, {0x0414, 0xB4}, {0x0415, 0xB5}, {0x0416, 0xB6},
+    {0x0417, 0xB7}, {0x0418, 0xB8}, {0x0419, 0xB9}, {0x041A, 0xBA}, {0x041B, 0xBB}, {0x041C, 0xBC}, {0x041D, 0xBD}, {0x041E, 0xBE},
+    {0x041F, 0xBF}, {0x0420, 0xC0}, {0x0421, 0xC1}, {0x0422, 0xC2}, {0x0423, 0xC3}, {0x0424, 0xC4}, {0x0425, 0xC5}, {0x0426, 0xC6},
+    {0x0427, 0xC7}, {0x0428, 0xC8}, {0x0429, 0xC9}, {0x042A, 0xCA}, {0x042B, 0xCB}, {0x042C, 0xCC}, {0x042D, 0xCD}, {0x042E, 0xCE},
+    {0x042F, 0xCF}, {0x0430, 0xD0}, {0x0431, 0xD1}, {0x0432, 0xD2}, {0x0433, 0xD3}, {0x0434, 0xD4}, {0x0435, 0xD5}, {0x0436, 0xD6},
+    {0x0437, 0xD7}, {0x0438, 0xD8}, {0x0439, 0xD9}, {0x043A, 0xDA}, {0x043B, 0xDB}, {0x043C, 0xDC}, {0x043D, 0xDD}, {0x043E, 0xDE},
+    {0x043F, 0xDF}, {0x0440, 0xE0}, {0x0441, 0xE1}, {0x0442, 0xE2}, {0x0443, 0xE3}, {0x0444, 0xE4}, {0x0445, 0xE5}, {0x0446, 0xE6},
+    {0x0447, 0xE7}, {0x0448, 0xE8}, {0x0449, 0xE9}, {0x044A, 0xEA}, {0x044B, 0xEB}, {0x044C, 0xEC}, {0x044D, 0xED}, {0x044E, 0xEE},
+    {0x044F, 0xEF}, {0x0451, 0xF1}, {0x0452, 0xF2}, {0x0453, 0xF3}, {0x0454, 0xF4}, {0x0455, 0xF5}, {0x0456, 0xF6}, {0x0457, 0xF7},
+    {0x0458, 0xF8}, {0x0459, 0xF9}, {0x045A, 0xFA}, {0x045B, 0xFB}, {0x045C, 0xFC}, {0x045E, 0xFE}, {0x045F, 0xFF}, {0x2116, 0xF0},
+};
+
+const uint16_t iso_8859_6_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0xFFFD, 0xFFFD, 0xFFFD, 0x00A4, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x060C, 0x00AD, 0xFFFD, 0xFFFD, /* 0xA0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x061B, 0xFFFD, 0xFFFD, 0xFFFD, 0x061F, /* 0xB0 */
+    0xFFFD, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627, 0x0628, 0x0629, 0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F, /* 0xC0 */
+    0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x0637, 0x0638, 0x0639, 0x063A, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xD0 */
+    0x0640, 0x0641, 0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647, 0x0648, 0x0649, 0x064A, 0x064B, 0x064C, 0x064D, 0x064E, 0x064F, /* 0xE0 */
+    0x0650, 0x0651, 0x0652, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_6_from_unicode[211] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x00A4, 0xA4}, {0x00AD, 0xAD}, {0x060C, 0xAC}, {0x061B, 0xBB}, {0x061F, 0xBF}, {0x0621, 0xC1}, {0x0622, 0xC2},
+    {0x0623, 0xC3}, {0x0624, 0xC4}, {0x0625, 0xC5}, {0x0626, 0xC6}, {0x0627, 0xC7}, {0x0628, 0xC8}, {0x0629, 0xC9}, {0x062A, 0xCA},
+    {0x062B, 0xCB}, {0x062C, 0xCC}, {0x062D, 0xCD}, {0x062E, 0xCE}, {0x062F, 0xCF}, {0x0630, 0xD0}, {0x0631, 0xD1}, {0x0632, 0xD2},
+    {0x0633, 0xD3}, {0x0634, 0xD4}, {0x0635, 0xD5}, {0x0636, 0xD6}, {0x0637, 0xD7}, {0x0638, 0xD8}, {0x0639, 0xD9}, {0x063A, 0xDA},
+    {0x0640, 0xE0}, {0x0641, 0xE1}, {0x0642, 0xE2}, {0x0643, 0xE3}, {0x0644, 0xE4}, {0x0645, 0xE5}, {0x0646, 0xE6}, {0x0647, 0xE7},
+    {0x0648, 0xE8}, {0x0649, 0xE9}, {0x064A, 0xEA}, {0x064B, 0xEB}, {0x064C, 0xEC}, {0x064D, 0xED}, {0x064E, 0xEE}, {0x064F, 0xEF},
+    {0x0650, 0xF0}, {0x0651, 0xF1}, {0x0652, 0xF2},
+};
+
+const uint16_t iso_8859_7_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0x2018, 0x2019, 0x00A3, 0x20AC, 0x20AF, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x037A, 0x00AB, 0x00AC, 0x00AD, 0xFFFD, 0x2015, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x0384, 0x0385, 0x0386, 0x00B7, 0x0388, 0x0389, 0x038A, 0x00BB, 0x038C, 0x00BD, 0x038E, 0x038F, /* 0xB0 */
+    0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, /* 0xC0 */
+    0x03A0, 0x03A1, 0xFFFD, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF, /* 0xD0 */
+    0x03B0, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, /* 0xE0 */
+    0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_7_from_unicode[253] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x00A3, 0xA3}, {0x00A6, 0xA6}, {0x00A7, 0xA7}, {0x00A8, 0xA8}, {0x00A9, 0xA9}, {0x00AB, 0xAB}, {0x00AC, 0xAC},
+    {0x00AD, 0xAD}, {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B2, 0xB2}, {0x00B3, 0xB3}, {0x00B7, 0xB7}, {0x00BB, 0xBB}, {0x00BD, 0xBD},
+    {0x037A, 0xAA}, {0x0384, 0xB4}, {0x0385, 0xB5}, {0x0386, 0xB6}, {0x0388, 0xB8}, {0x0389, 0xB9}, {0x038A, 0xBA}, {0x038C, 0xBC},
+    {0x038E, 0xBE}, {0x038F, 0xBF}, {0x0390, 0xC0}, {0x0391, 0xC1}, {0x0392, 0xC2}, {0x0393, 0xC3}, {0x0394, 0xC4}, {0x0395, 0xC5},
+    {0x0396, 0xC6}, {0x0397, 0xC7}, {0x0398, 0xC8}, {0x0399, 0xC9}, {0x039A, 0xCA}, {0x039B, 0xCB}, {0x039C, 0xCC}, {0x039D, 0xCD},
+    {0x039E, 0xCE}, {0x039F, 0xCF}, {0x03A0, 0xD0}, {0x03A1, 0xD1}, {0x03A3, 0xD3}, {0x03A4, 0xD4}, {0x03A5, 0xD5}, {0x03A6, 0xD6},
+    {0x03A7, 0xD7}, {0x03A8, 0xD8}, {0x03A9, 0xD9}, {0x03AA, 0xDA}, {0x03AB, 0xDB}, {0x03AC, 0xDC}, {0x03AD, 0xDD}, {0x03AE, 0xDE},
+    {0x03AF, 0xDF}, {0x03B0, 0xE0}, {0x03B1, 0xE1}, {0x03B2, 0xE2}, {0x03B3, 0xE3}, {0x03B4, 0xE4}, {0x03B5, 0xE5}, {0x03B6, 0xE6},
+    {0x03B7, 0xE7}, {0x03B8, 0xE8}, {0x03B9, 0xE9}, {0x03BA, 0xEA}, {0x03BB, 0xEB}, {0x03BC, 0xEC}, {0x03BD, 0xED}, {0x03BE, 0xEE},
+    {0x03BF, 0xEF}, {0x03C0, 0xF0}, {0x03C1, 0xF1}, {0x03C2, 0xF2}, {0x03C3, 0xF3}, {0x03C4, 0xF4}, {0x03C5, 0xF5}, {0x03C6, 0xF6},
+    {0x03C7, 0xF7}, {0x03C8, 0xF8}, {0x03C9, 0xF9}, {0x03CA, 0xFA}, {0x03CB, 0xFB}, {0x03CC, 0xFC}, {0x03CD, 0xFD}, {0x03CE, 0xFE},
+    {0x2015, 0xAF}, {0x2018, 0xA1}, {0x2019, 0xA2}, {0x20AC, 0xA4}, {0x20AF, 0xA5},
+};
+
+const uint16_t iso_8859_8_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0xFFFD, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00D7, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00F7, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0xFFFD, /* 0xB0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xC0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x2017, /* 0xD0 */
+    0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF, /* 0xE0 */
+    0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0xFFFD, 0xFFFD, 0x200E, 0x200F, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_8_from_unicode[220] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A4, 0xA4}, {0x00A5, 0xA5}, {0x00A6, 0xA6}, {0x00A7, 0xA7}, {0x00A8, 0xA8},
+    {0x00A9, 0xA9}, {0x00AB, 0xAB}, {0x00AC, 0xAC}, {0x00AD, 0xAD}, {0x00AE, 0xAE}, {0x00AF, 0xAF}, {0x00B0, 0xB0}, {0x00B1, 0xB1},
+    {0x00B2, 0xB2}, {0x00B3, 0xB3}, {0x00B4, 0xB4}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7}, {0x00B8, 0xB8}, {0x00B9, 0xB9},
+    {0x00BB, 0xBB}, {0x00BC, 0xBC}, {0x00BD, 0xBD}, {0x00BE, 0xBE}, {0x00D7, 0xAA}, {0x00F7, 0xBA}, {0x05D0, 0xE0}, {0x05D1, 0xE1},
+    {0x05D2, 0xE2}, {0x05D3, 0xE3}, {0x05D4, 0xE4}, {0x05D5, 0xE5}, {0x05D6, 0xE6}, {0x05D7, 0xE7}, {0x05D8, 0xE8}, {0x05D9, 0xE9},
+    {0x05DA, 0xEA}, {0x05DB, 0xEB}, {0x05DC, 0xEC}, {0x05DD, 0xED}, {0x05DE, 0xEE}, {0x05DF, 0xEF}, {0x05E0, 0xF0}, {0x05E1, 0xF1},
+    {0x05E2, 0xF2}, {0x05E3, 0xF3}, {0x05E4, 0xF4}, {0x05E5, 0xF5}, {0x05E6, 0xF6}, {0x05E7, 0xF7}, {0x05E8, 0xF8}, {0x05E9, 0xF9},
+    {0x05EA, 0xFA}, {0x200E, 0xFD}, {0x200F, 0xFE}, {0x2017, 0xDF},
+};
+
+const uint16_t iso_8859_9_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, /* 0xB0 */
+    0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, /* 0xC0 */
+    0x011E, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x0130, 0x015E, 0x00DF, /* 0xD0 */
+    0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, /* 0xE0 */
+    0x011F, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x0131, 0x015F, 0x00FF, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_9_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x00A1, 0xA1}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A4, 0xA4}, {0x00A5, 0xA5}, {0x00A6, 0xA6}, {0x00A7, 0xA7},
+    {0x00A8, 0xA8}, {0x00A9, 0xA9}, {0x00AA, 0xAA}, {0x00AB, 0xAB}, {0x00AC, 0xAC}, {0x00AD, 0xAD}, {0x00AE, 0xAE}, {0x00AF, 0xAF},
+    {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B2, 0xB2}, {0x00B3, 0xB3}, {0x00B4, 0xB4}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7},
+    {0x00B8, 0xB8}, {0x00B9, 0xB9}, {0x00BA, 0xBA}, {0x00BB, 0xBB}, {0x00BC, 0xBC}, {0x00BD, 0xBD}, {0x00BE, 0xBE}, {0x00BF, 0xBF},
+    {0x00C0, 0xC0}, {0x00C1, 0xC1}, {0x00C2, 0xC2}, {0x00C3, 0xC3}, {0x00C4, 0xC4}, {0x00C5, 0xC5}, {0x00C6, 0xC6}, {0x00C7, 0xC7},
+    {0x00C8, 0xC8}, {0x00C9, 0xC9}, {0x00CA, 0xCA}, {0x00CB, 0xCB}, {0x00CC, 0xCC}, {0x00CD, 0xCD}, {0x00CE, 0xCE}, {0x00CF, 0xCF},
+    {0x00D1, 0xD1}, {0x00D2, 0xD2}, {0x00D3, 0xD3}, {0x00D4, 0xD4}, {0x00D5, 0xD5}, {0x00D6, 0xD6}, {0x00D7, 0xD7}, {0x00D8, 0xD8},
+    {0x00D9, 0xD9}, {0x00DA, 0xDA}, {0x00DB, 0xDB}, {0x00DC, 0xDC}, {0x00DF, 0xDF}, {0x00E0, 0xE0}, {0x00E1, 0xE1}, {0x00E2, 0xE2},
+    {0x00E3, 0xE3}, {0x00E4, 0xE4}, {0x00E5, 0xE5}, {0x00E6, 0xE6}, {0x00E7, 0xE7}, {0x00E8, 0xE8}, {0x00E9, 0xE9}, {0x00EA, 0xEA},
+    {0x00EB, 0xEB}, {0x00EC, 0xEC}, {0x00ED, 0xED}, {0x00EE, 0xEE}, {0x00EF, 0xEF}, {0x00F1, 0xF1}, {0x00F2, 0xF2}, {0x00F3, 0xF3},
+    {0x00F4, 0xF4}, {0x00F5, 0xF5}, {0x00F6, 0xF6}, {0x00F7, 0xF7}, {0x00F8, 0xF8}, {0x00F9, 0xF9}, {0x00FA, 0xFA}, {0x00FB, 0xFB},
+    {0x00FC, 0xFC}, {0x00FF, 0xFF}, {0x011E, 0xD0}, {0x011F, 0xF0}, {0x0130, 0xDD}, {0x0131, 0xFD}, {0x015E, 0xDE}, {0x015F, 0xFE},
+};
+
+const uint16_t iso_8859_10_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0x0104, 0x0112, 0x0122, 0x012A, 0x0128, 0x0136, 0x00A7, 0x013B, 0x0110, 0x0160, 0x0166, 0x017D, 0x00AD, 0x016A, 0x014A, /* 0xA0 */
+    0x00B0, 0x0105, 0x0113, 0x0123, 0x012B, 0x0129, 0x0137, 0x00B7, 0x013C, 0x0111, 0x0161, 0x0167, 0x017E, 0x2015, 0x016B, 0x014B, /* 0xB0 */
+    0x0100, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x012E, 0x010C, 0x00C9, 0x0118, 0x00CB, 0x0116, 0x00CD, 0x00CE, 0x00CF, /* 0xC0 */
+    0x00D0, 0x0145, 0x014C, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x0168, 0x00D8, 0x0172, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF, /* 0xD0 */
+    0x0101, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x012F, 0x010D, 0x00E9, 0x0119, 0x00EB, 0x0117, 0x00ED, 0x00EE, 0x00EF, /* 0xE0 */
+    0x00F0, 0x0146, 0x014D, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x0169, 0x00F8, 0x0173, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x0138, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_10_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x00A7, 0xA7}, {0x00AD, 0xAD}, {0x00B0, 0xB0}, {0x00B7, 0xB7}, {0x00C1, 0xC1}, {0x00C2, 0xC2}, {0x00C3, 0xC3},
+    {0x00C4, 0xC4}, {0x00C5, 0xC5}, {0x00C6, 0xC6}, {0x00C9, 0xC9}, {0x00CB, 0xCB}, {0x00CD, 0xCD}, {0x00CE, 0xCE}, {0x00CF, 0xCF},
+    {0x00D0, 0xD0}, {0x00D3, 0xD3}, {0x00D4, 0xD4}, {0x00D5, 0xD5}, {0x00D6, 0xD6}, {0x00D8, 0xD8}, {0x00DA, 0xDA}, {0x00DB, 0xDB},
+    {0x00DC, 0xDC}, {0x00DD, 0xDD}, {0x00DE, 0xDE}, {0x00DF, 0xDF}, {0x00E1, 0xE1}, {0x00E2, 0xE2}, {0x00E3, 0xE3}, {0x00E4, 0xE4},
+    {0x00E5, 0xE5}, {0x00E6, 0xE6}, {0x00E9, 0xE9}, {0x00EB, 0xEB}, {0x00ED, 0xED}, {0x00EE, 0xEE}, {0x00EF, 0xEF}, {0x00F0, 0xF0},
+    {0x00F3, 0xF3}, {0x00F4, 0xF4}, {0x00F5, 0xF5}, {0x00F6, 0xF6}, {0x00F8, 0xF8}, {0x00FA, 0xFA}, {0x00FB, 0xFB}, {0x00FC, 0xFC},
+    {0x00FD, 0xFD}, {0x00FE, 0xFE}, {0x0100, 0xC0}, {0x0101, 0xE0}, {0x0104, 0xA1}, {0x0105, 0xB1}, {0x010C, 0xC8}, {0x010D, 0xE8},
+    {0x0110, 0xA9}, {0x0111, 0xB9}, {0x0112, 0xA2}, {0x0113, 0xB2}, {0x0116, 0xCC}, {0x0117, 0xEC}, {0x0118, 0xCA}, {0x0119, 0xEA},
+    {0x0122, 0xA3}, {0x0123, 0xB3}, {0x0128, 0xA5}, {0x0129, 0xB5}, {0x012A, 0xA4}, {0x012B, 0xB4}, {0x012E, 0xC7}, {0x012F, 0xE7},
+    {0x0136, 0xA6}, {0x0137, 0xB6}, {0x0138, 0xFF}, {0x013B, 0xA8}, {0x013C, 0xB8}, {0x0145, 0xD1}, {0x0146, 0xF1}, {0x014A, 0xAF},
+    {0x014B, 0xBF}, {0x014C, 0xD2}, {0x014D, 0xF2}, {0x0160, 0xAA}, {0x0161, 0xBA}, {0x0166, 0xAB}, {0x0167, 0xBB}, {0x0168, 0xD7},
+    {0x0169, 0xF7}, {0x016A, 0xAE}, {0x016B, 0xBE}, {0x0172, 0xD9}, {0x0173, 0xF9}, {0x017D, 0xAC}, {0x017E, 0xBC}, {0x2015, 0xBD},
+};
+
+const uint16_t iso_8859_11_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0x0E01, 0x0E02, 0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07, 0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F, /* 0xA0 */
+    0x0E10, 0x0E11, 0x0E12, 0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0E17, 0x0E18, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F, /* 0xB0 */
+    0x0E20, 0x0E21, 0x0E22, 0x0E23, 0x0E24, 0x0E25, 0x0E26, 0x0E27, 0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D, 0x0E2E, 0x0E2F, /* 0xC0 */
+    0x0E30, 0x0E31, 0x0E32, 0x0E33, 0x0E34, 0x0E35, 0x0E36, 0x0E37, 0x0E38, 0x0E39, 0x0E3A, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x0E3F, /* 0xD0 */
+    0x0E40, 0x0E41, 0x0E42, 0x0E43, 0x0E44, 0x0E45, 0x0E46, 0x0E47, 0x0E48, 0x0E49, 0x0E4A, 0x0E4B, 0x0E4C, 0x0E4D, 0x0E4E, 0x0E4F, /* 0xE0 */
+    0x0E50, 0x0E51, 0x0E52, 0x0E53, 0x0E54, 0x0E55, 0x0E56, 0x0E57, 0x0E58, 0x0E59, 0x0E5A, 0x0E5B, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_11_from_unicode[248] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x0E01, 0xA1}, {0x0E02, 0xA2}, {0x0E03, 0xA3}, {0x0E04, 0xA4}, {0x0E05, 0xA5}, {0x0E06, 0xA6}, {0x0E07, 0xA7},
+    {0x0E08, 0xA8}, {0x0E09, 0xA9}, {0x0E0A, 0xAA}, {0x0E0B, 0xAB}, {0x0E0C, 0xAC}, {0x0E0D, 0xAD}, {0x0E0E, 0xAE}, {0x0E0F, 0xAF},
+    {0x0E10, 0xB0}, {0x0E11, 0xB1}, {0x0E12, 0xB2}, {0x0E13, 0xB3}, {0x0E14, 0xB4}, {0x0E15, 0xB5}, {0x0E16, 0xB6}, {0x0E17, 0xB7},
+    {0x0E18, 0xB8}, {0x0E19, 0xB9}, {0x0E1A, 0xBA}, {0x0E1B, 0xBB}, {0x0E1C, 0xBC}, {0x0E1D, 0xBD}, {0x0E1E, 0xBE}, {0x0E1F, 0xBF},
+    {0x0E20, 0xC0}, {0x0E21, 0xC1}, {0x0E22, 0xC2}, {0x0E23, 0xC3}, {0x0E24, 0xC4}, {0x0E25, 0xC5}, {0x0E26, 0xC6}, {0x0E27, 0xC7},
+    {0x0E28, 0xC8}, {0x0E29, 0xC9}, {0x0E2A, 0xCA}, {0x0E2B, 0xCB}, {0x0E2C, 0xCC}, {0x0E2D, 0xCD}, {0x0E2E, 0xCE}, {0x0E2F, 0xCF},
+    {0x0E30, 0xD0}, {0x0E31, 0xD1}, {0x0E32, 0xD2}, {0x0E33, 0xD3}, {0x0E34, 0xD4}, {0x0E35, 0xD5}, {0x0E36, 0xD6}, {0x0E37, 0xD7},
+    {0x0E38, 0xD8}, {0x0E39, 0xD9}, {0x0E3A, 0xDA}, {0x0E3F, 0xDF}, {0x0E40, 0xE0}, {0x0E41, 0xE1}, {0x0E42, 0xE2}, {0x0E43, 0xE3},
+    {0x0E44, 0xE4}, {0x0E45, 0xE5}, {0x0E46, 0xE6}, {0x0E47, 0xE7}, {0x0E48, 0xE8}, {0x0E49, 0xE9}, {0x0E4A, 0xEA}, {0x0E4B, 0xEB},
+    {0x0E4C, 0xEC}, {0x0E4D, 0xED}, {0x0E4E, 0xEE}, {0x0E4F, 0xEF}, {0x0E50, 0xF0}, {0x0E51, 0xF1}, {0x0E52, 0xF2}, {0x0E53, 0xF3},
+    {0x0E54, 0xF4}, {0x0E55, 0xF5}, {0x0E56, 0xF6}, {0x0E57, 0xF7}, {0x0E58, 0xF8}, {0x0E59, 0xF9}, {0x0E5A, 0xFA}, {0x0E5B, 0xFB},
+};
+
+const uint16_t iso_8859_13_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0x201D, 0x00A2, 0x00A3, 0x00A4, 0x201E, 0x00A6, 0x00A7, 0x00D8, 0x00A9, 0x0156, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00C6, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x201C, 0x00B5, 0x00B6, 0x00B7, 0x00F8, 0x00B9, 0x0157, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00E6, /* 0xB0 */
+    0x0104, 0x012E, 0x0100, 0x0106, 0x00C4, 0x00C5, 0x0118, 0x0112, 0x010C, 0x00C9, 0x0179, 0x0116, 0x0122, 0x0136, 0x012A, 0x013B, /* 0xC0 */
+    0x0160, 0x0143, 0x0145, 0x00D3, 0x014C, 0x00D5, 0x00D6, 0x00D7, 0x0172, 0x0141, 0x015A, 0x016A, 0x00DC, 0x017B, 0x017D, 0x00DF, /* 0xD0 */
+    0x0105, 0x012F, 0x0101, 0x0107, 0x00E4, 0x00E5, 0x0119, 0x0113, 0x010D, 0x00E9, 0x017A, 0x0117, 0x0123, 0x0137, 0x012B, 0x013C, /* 0xE0 */
+    0x0161, 0x0144, 0x0146, 0x00F3, 0x014D, 0x00F5, 0x00F6, 0x00F7, 0x0173, 0x0142, 0x015B, 0x016B, 0x00FC, 0x017C, 0x017E, 0x2019, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_13_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A4, 0xA4}, {0x00A6, 0xA6}, {0x00A7, 0xA7}, {0x00A9, 0xA9}, {0x00AB, 0xAB},
+    {0x00AC, 0xAC}, {0x00AD, 0xAD}, {0x00AE, 0xAE}, {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B2, 0xB2}, {0x00B3, 0xB3}, {0x00B5, 0xB5},
+    {0x00B6, 0xB6}, {0x00B7, 0xB7}, {0x00B9, 0xB9}, {0x00BB, 0xBB}, {0x00BC, 0xBC}, {0x00BD, 0xBD}, {0x00BE, 0xBE}, {0x00C4, 0xC4},
+    {0x00C5, 0xC5}, {0x00C6, 0xAF}, {0x00C9, 0xC9}, {0x00D3, 0xD3}, {0x00D5, 0xD5}, {0x00D6, 0xD6}, {0x00D7, 0xD7}, {0x00D8, 0xA8},
+    {0x00DC, 0xDC}, {0x00DF, 0xDF}, {0x00E4, 0xE4}, {0x00E5, 0xE5}, {0x00E6, 0xBF}, {0x00E9, 0xE9}, {0x00F3, 0xF3}, {0x00F5, 0xF5},
+    {0x00F6, 0xF6}, {0x00F7, 0xF7}, {0x00F8, 0xB8}, {0x00FC, 0xFC}, {0x0100, 0xC2}, {0x0101, 0xE2}, {0x0104, 0xC0}, {0x0105, 0xE0},
+    {0x0106, 0xC3}, {0x0107, 0xE3}, {0x010C, 0xC8}, {0x010D, 0xE8}, {0x0112, 0xC7}, {0x0113, 0xE7}, {0x0116, 0xCB}, {0x0117, 0xEB},
+    {0x0118, 0xC6}, {0x0119, 0xE6}, {0x0122, 0xCC}, {0x0123, 0xEC}, {0x012A, 0xCE}, {0x012B, 0xEE}, {0x012E, 0xC1}, {0x012F, 0xE1},
+    {0x0136, 0xCD}, {0x0137, 0xED}, {0x013B, 0xCF}, {0x013C, 0xEF}, {0x0141, 0xD9}, {0x0142, 0xF9}, {0x0143, 0xD1}, {0x0144, 0xF1},
+    {0x0145, 0xD2}, {0x0146, 0xF2}, {0x014C, 0xD4}, {0x014D, 0xF4}, {0x0156, 0xAA}, {0x0157, 0xBA}, {0x015A, 0xDA}, {0x015B, 0xFA},
+    {0x0160, 0xD0}, {0x0161, 0xF0}, {0x016A, 0xDB}, {0x016B, 0xFB}, {0x0172, 0xD8}, {0x0173, 0xF8}, {0x0179, 0xCA}, {0x017A, 0xEA},
+    {0x017B, 0xDD}, {0x017C, 0xFD}, {0x017D, 0xDE}, {0x017E, 0xFE}, {0x2019, 0xFF}, {0x201C, 0xB4}, {0x201D, 0xA1}, {0x201E, 0xA5},
+};
+
+const uint16_t iso_8859_14_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0x1E02, 0x1E03, 0x00A3, 0x010A, 0x010B, 0x1E0A, 0x00A7, 0x1E80, 0x00A9, 0x1E82, 0x1E0B, 0x1EF2, 0x00AD, 0x00AE, 0x0178, /* 0xA0 */
+    0x1E1E, 0x1E1F, 0x0120, 0x0121, 0x1E40, 0x1E41, 0x00B6, 0x1E56, 0x1E81, 0x1E57, 0x1E83, 0x1E60, 0x1EF3, 0x1E84, 0x1E85, 0x1E61, /* 0xB0 */
+    0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, /* 0xC0 */
+    0x0174, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x1E6A, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x0176, 0x00DF, /* 0xD0 */
+    0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, /* 0xE0 */
+    0x0175, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x1E6B, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x0177, 0x00FF, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_14_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x00A3, 0xA3}, {0x00A7, 0xA7}, {0x00A9, 0xA9}, {0x00AD, 0xAD}, {0x00AE, 0xAE}, {0x00B6, 0xB6}, {0x00C0, 0xC0},
+    {0x00C1, 0xC1}, {0x00C2, 0xC2}, {0x00C3, 0xC3}, {0x00C4, 0xC4}, {0x00C5, 0xC5}, {0x00C6, 0xC6}, {0x00C7, 0xC7}, {0x00C8, 0xC8},
+    {0x00C9, 0xC9}, {0x00CA, 0xCA}, {0x00CB, 0xCB}, {0x00CC, 0xCC}, {0x00CD, 0xCD}, {0x00CE, 0xCE}, {0x00CF, 0xCF}, {0x00D1, 0xD1},
+    {0x00D2, 0xD2}, {0x00D3, 0xD3}, {0x00D4, 0xD4}, {0x00D5, 0xD5}, {0x00D6, 0xD6}, {0x00D8, 0xD8}, {0x00D9, 0xD9}, {0x00DA, 0xDA},
+    {0x00DB, 0xDB}, {0x00DC, 0xDC}, {0x00DD, 0xDD}, {0x00DF, 0xDF}, {0x00E0, 0xE0}, {0x00E1, 0xE1}, {0x00E2, 0xE2}, {0x00E3, 0xE3},
+    {0x00E4, 0xE4}, {0x00E5, 0xE5}, {0x00E6, 0xE6}, {0x00E7, 0xE7}, {0x00E8, 0xE8}, {0x00E9, 0xE9}, {0x00EA, 0xEA}, {0x00EB, 0xEB},
+    {0x00EC, 0xEC}, {0x00ED, 0xED}, {0x00EE, 0xEE}, {0x00EF, 0xEF}, {0x00F1, 0xF1}, {0x00F2, 0xF2}, {0x00F3, 0xF3}, {0x00F4, 0xF4},
+    {0x00F5, 0xF5}, {0x00F6, 0xF6}, {0x00F8, 0xF8}, {0x00F9, 0xF9}, {0x00FA, 0xFA}, {0x00FB, 0xFB}, {0x00FC, 0xFC}, {0x00FD, 0xFD},
+    {0x00FF, 0xFF}, {0x010A, 0xA4}, {0x010B, 0xA5}, {0x0120, 0xB2}, {0x0121, 0xB3}, {0x0174, 0xD0}, {0x0175, 0xF0}, {0x0176, 0xDE},
+    {0x0177, 0xFE}, {0x0178, 0xAF}, {0x1E02, 0xA1}, {0x1E03, 0xA2}, {0x1E0A, 0xA6}, {0x1E0B, 0xAB}, {0x1E1E, 0xB0}, {0x1E1F, 0xB1},
+    {0x1E40, 0xB4}, {0x1E41, 0xB5}, {0x1E56, 0xB7}, {0x1E57, 0xB9}, {0x1E60, 0xBB}, {0x1E61, 0xBF}, {0x1E6A, 0xD7}, {0x1E6B, 0xF7},
+    {0x1E80, 0xA8}, {0x1E81, 0xB8}, {0x1E82, 0xAA}, {0x1E83, 0xBA}, {0x1E84, 0xBD}, {0x1E85, 0xBE}, {0x1EF2, 0xAC}, {0x1EF3, 0xBC},
+};
+
+const uint16_t iso_8859_15_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x20AC, 0x00A5, 0x0160, 0x00A7, 0x0161, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x017D, 0x00B5, 0x00B6, 0x00B7, 0x017E, 0x00B9, 0x00BA, 0x00BB, 0x0152, 0x0153, 0x0178, 0x00BF, /* 0xB0 */
+    0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, /* 0xC0 */
+    0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF, /* 0xD0 */
+    0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, /* 0xE0 */
+    0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_15_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x00A1, 0xA1}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A5, 0xA5}, {0x00A7, 0xA7}, {0x00A9, 0xA9}, {0x00AA, 0xAA},
+    {0x00AB, 0xAB}, {0x00AC, 0xAC}, {0x00AD, 0xAD}, {0x00AE, 0xAE}, {0x00AF, 0xAF}, {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B2, 0xB2},
+    {0x00B3, 0xB3}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7}, {0x00B9, 0xB9}, {0x00BA, 0xBA}, {0x00BB, 0xBB}, {0x00BF, 0xBF},
+    {0x00C0, 0xC0}, {0x00C1, 0xC1}, {0x00C2, 0xC2}, {0x00C3, 0xC3}, {0x00C4, 0xC4}, {0x00C5, 0xC5}, {0x00C6, 0xC6}, {0x00C7, 0xC7},
+    {0x00C8, 0xC8}, {0x00C9, 0xC9}, {0x00CA, 0xCA}, {0x00CB, 0xCB}, {0x00CC, 0xCC}, {0x00CD, 0xCD}, {0x00CE, 0xCE}, {0x00CF, 0xCF},
+    {0x00D0, 0xD0}, {0x00D1, 0xD1}, {0x00D2, 0xD2}, {0x00D3, 0xD3}, {0x00D4, 0xD4}, {0x00D5, 0xD5}, {0x00D6, 0xD6}, {0x00D7, 0xD7},
+    {0x00D8, 0xD8}, {0x00D9, 0xD9}, {0x00DA, 0xDA}, {0x00DB, 0xDB}, {0x00DC, 0xDC}, {0x00DD, 0xDD}, {0x00DE, 0xDE}, {0x00DF, 0xDF},
+    {0x00E0, 0xE0}, {0x00E1, 0xE1}, {0x00E2, 0xE2}, {0x00E3, 0xE3}, {0x00E4, 0xE4}, {0x00E5, 0xE5}, {0x00E6, 0xE6}, {0x00E7, 0xE7},
+    {0x00E8, 0xE8}, {0x00E9, 0xE9}, {0x00EA, 0xEA}, {0x00EB, 0xEB}, {0x00EC, 0xEC}, {0x00ED, 0xED}, {0x00EE, 0xEE}, {0x00EF, 0xEF},
+    {0x00F0, 0xF0}, {0x00F1, 0xF1}, {0x00F2, 0xF2}, {0x00F3, 0xF3}, {0x00F4, 0xF4}, {0x00F5, 0xF5}, {0x00F6, 0xF6}, {0x00F7, 0xF7},
+    {0x00F8, 0xF8}, {0x00F9, 0xF9}, {0x00FA, 0xFA}, {0x00FB, 0xFB}, {0x00FC, 0xFC}, {0x00FD, 0xFD}, {0x00FE, 0xFE}, {0x00FF, 0xFF},
+    {0x0152, 0xBC}, {0x0153, 0xBD}, {0x0160, 0xA6}, {0x0161, 0xA8}, {0x0178, 0xBE}, {0x017D, 0xB4}, {0x017E, 0xB8}, {0x20AC, 0xA4},
+};
+
+const uint16_t iso_8859_16_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, /* 0x80 */
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, /* 0x90 */
+    0x00A0, 0x0104, 0x0105, 0x0141, 0x20AC, 0x201E, 0x0160, 0x00A7, 0x0161, 0x00A9, 0x0218, 0x00AB, 0x0179, 0x00AD, 0x017A, 0x017B, /* 0xA0 */
+    0x00B0, 0x00B1, 0x010C, 0x0142, 0x017D, 0x201D, 0x00B6, 0x00B7, 0x017E, 0x010D, 0x0219, 0x00BB, 0x0152, 0x0153, 0x0178, 0x017C, /* 0xB0 */
+    0x00C0, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x0106, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, /* 0xC0 */
+    0x0110, 0x0143, 0x00D2, 0x00D3, 0x00D4, 0x0150, 0x00D6, 0x015A, 0x0170, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x0118, 0x021A, 0x00DF, /* 0xD0 */
+    0x00E0, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x0107, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, /* 0xE0 */
+    0x0111, 0x0144, 0x00F2, 0x00F3, 0x00F4, 0x0151, 0x00F6, 0x015B, 0x0171, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x0119, 0x021B, 0x00FF, /* 0xF0 */
+};
+
+const struct sb_reverse_entry iso_8859_16_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83}, {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+    {0x0088, 0x88}, {0x0089, 0x89}, {0x008A, 0x8A}, {0x008B, 0x8B}, {0x008C, 0x8C}, {0x008D, 0x8D}, {0x008E, 0x8E}, {0x008F, 0x8F},
+    {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93}, {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+    {0x0098, 0x98}, {0x0099, 0x99}, {0x009A, 0x9A}, {0x009B, 0x9B}, {0x009C, 0x9C}, {0x009D, 0x9D}, {0x009E, 0x9E}, {0x009F, 0x9F},
+    {0x00A0, 0xA0}, {0x00A7, 0xA7}, {0x00A9, 0xA9}, {0x00AB, 0xAB}, {0x00AD, 0xAD}, {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B6, 0xB6},
+    {0x00B7, 0xB7}, {0x00BB, 0xBB}, {0x00C0, 0xC0}, {0x00C1, 0xC1}, {0x00C2, 0xC2}, {0x00C4, 0xC4}, {0x00C6, 0xC6}, {0x00C7, 0xC7},
+    {0x00C8, 0xC8}, {0x00C9, 0xC9}, {0x00CA, 0xCA}, {0x00CB, 0xCB}, {0x00CC, 0xCC}, {0x00CD, 0xCD}, {0x00CE, 0xCE}, {0x00CF, 0xCF},
+    {0x00D2, 0xD2}, {0x00D3, 0xD3}, {0x00D4, 0xD4}, {0x00D6, 0xD6}, {0x00D9, 0xD9}, {0x00DA, 0xDA}, {0x00DB, 0xDB}, {0x00DC, 0xDC},
+    {0x00DF, 0xDF}, {0x00E0, 0xE0}, {0x00E1, 0xE1}, {0x00E2, 0xE2}, {0x00E4, 0xE4}, {0x00E6, 0xE6}, {0x00E7, 0xE7}, {0x00E8, 0xE8},
+    {0x00E9, 0xE9}, {0x00EA, 0xEA}, {0x00EB, 0xEB}, {0x00EC, 0xEC}, {0x00ED, 0xED}, {0x00EE, 0xEE}, {0x00EF, 0xEF}, {0x00F2, 0xF2},
+    {0x00F3, 0xF3}, {0x00F4, 0xF4}, {0x00F6, 0xF6}, {0x00F9, 0xF9}, {0x00FA, 0xFA}, {0x00FB, 0xFB}, {0x00FC, 0xFC}, {0x00FF, 0xFF},
+    {0x0102, 0xC3}, {0x0103, 0xE3}, {0x0104, 0xA1}, {0x0105, 0xA2}, {0x0106, 0xC5}, {0x0107, 0xE5}, {0x010C, 0xB2}, {0x010D, 0xB9},
+    {0x0110, 0xD0}, {0x0111, 0xF0}, {0x0118, 0xDD}, {0x0119, 0xFD}, {0x0141, 0xA3}, {0x0142, 0xB3}, {0x0143, 0xD1}, {0x0144, 0xF1},
+    {0x0150, 0xD5}, {0x0151, 0xF5}, {0x0152, 0xBC}, {0x0153, 0xBD}, {0x015A, 0xD7}, {0x015B, 0xF7}, {0x0160, 0xA6}, {0x0161, 0xA8},
+    {0x0170, 0xD8}, {0x0171, 0xF8}, {0x0178, 0xBE}, {0x0179, 0xAC}, {0x017A, 0xAE}, {0x017B, 0xAF}, {0x017C, 0xBF}, {0x017D, 0xB4},
+    {0x017E, 0xB8}, {0x0218, 0xAA}, {0x0219, 0xBA}, {0x021A, 0xDE}, {0x021B, 0xFE}, {0x201D, 0xB5}, {0x201E, 0xA5}, {0x20AC, 0xA4},
+};
+
+const uint16_t windows_1252_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0xFFFD, 0x017D, 0xFFFD, /* 0x80 */
+    0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0xFFFD, 0x017E, 0x0178, /* 0x90 */
+    0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, /* 0xB0 */
+    0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, /* 0xC0 */
+    0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF, /* 0xD0 */
+    0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, /* 0xE0 */
+    0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, /* 0xF0 */
+};
+
+const struct sb_reverse_entry windows_1252_from_unicode[251] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xA0}, {0x00A1, 0xA1}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A4, 0xA4}, {0x00A5, 0xA5}, {0x00A6, 0xA6}, {0x00A7, 0xA7},
+    {0x00A8, 0xA8}, {0x00A9, 0xA9}, {0x00AA, 0xAA}, {0x00AB, 0xAB}, {0x00AC, 0xAC}, {0x00AD, 0xAD}, {0x00AE, 0xAE}, {0x00AF, 0xAF},
+    {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B2, 0xB2}, {0x00B3, 0xB3}, {0x00B4, 0xB4}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7},
+    {0x00B8, 0xB8}, {0x00B9, 0xB9}, {0x00BA, 0xBA}, {0x00BB, 0xBB}, {0x00BC, 0xBC}, {0x00BD, 0xBD}, {0x00BE, 0xBE}, {0x00BF, 0xBF},
+    {0x00C0, 0xC0}, {0x00C1, 0xC1}, {0x00C2, 0xC2}, {0x00C3, 0xC3}, {0x00C4, 0xC4}, {0x00C5, 0xC5}, {0x00C6, 0xC6}, {0x00C7, 0xC7},
+    {0x00C8, 0xC8}, {0x00C9, 0xC9}, {0x00CA, 0xCA}, {0x00CB, 0xCB}, {0x00CC, 0xCC}, {0x00CD, 0xCD}, {0x00CE, 0xCE}, {0x00CF, 0xCF},
+    {0x00D0, 0xD0}, {0x00D1, 0xD1}, {0x00D2, 0xD2}, {0x00D3, 0xD3}, {0x00D4, 0xD4}, {0x00D5, 0xD5}, {0x00D6, 0xD6}, {0x00D7, 0xD7},
+    {0x00D8, 0xD8}, {0x00D9, 0xD9}, {0x00DA, 0xDA}, {0x00DB, 0xDB}, {0x00DC, 0xDC}, {0x00DD, 0xDD}, {0x00DE, 0xDE}, {0x00DF, 0xDF},
+    {0x00E0, 0xE0}, {0x00E1, 0xE1}, {0x00E2, 0xE2}, {0x00E3, 0xE3}, {0x00E4, 0xE4}, {0x00E5, 0xE5}, {0x00E6, 0xE6}, {0x00E7, 0xE7},
+    {0x00E8, 0xE8}, {0x00E9, 0xE9}, {0x00EA, 0xEA}, {0x00EB, 0xEB}, {0x00EC, 0xEC}, {0x00ED, 0xED}, {0x00EE, 0xEE}, {0x00EF, 0xEF},
+    {0x00F0, 0xF0}, {0x00F1, 0xF1}, {0x00F2, 0xF2}, {0x00F3, 0xF3}, {0x00F4, 0xF4}, {0x00F5, 0xF5}, {0x00F6, 0xF6}, {0x00F7, 0xF7},
+    {0x00F8, 0xF8}, {0x00F9, 0xF9}, {0x00FA, 0xFA}, {0x00FB, 0xFB}, {0x00FC, 0xFC}, {0x00FD, 0xFD}, {0x00FE, 0xFE}, {0x00FF, 0xFF},
+    {0x0152, 0x8C}, {0x0153, 0x9C}, {0x0160, 0x8A}, {0x0161, 0x9A}, {0x0178, 0x9F}, {0x017D, 0x8E}, {0x017E, 0x9E}, {0x0192, 0x83},
+    {0x02C6, 0x88}, {0x02DC, 0x98}, {0x2013, 0x96}, {0x2014, 0x97}, {0x2018, 0x91}, {0x2019, 0x92}, {0x201A, 0x82}, {0x201C, 0x93},
+    {0x201D, 0x94}, {0x201E, 0x84}, {0x2020, 0x86}, {0x2021, 0x87}, {0x2022, 0x95}, {0x2026, 0x85}, {0x2030, 0x89}, {0x2039, 0x8B},
+    {0x203A, 0x9B}, {0x20AC, 0x80}, {0x2122, 0x99},
+};
+
+const uint16_t windows_1250_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x20AC, 0xFFFD, 0x201A, 0xFFFD, 0x201E, 0x2026, 0x2020, 0x2021, 0xFFFD, 0x2030, 0x0160, 0x2039, 0x015A, 0x0164, 0x017D, 0x0179, /* 0x80 */
+    0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0xFFFD, 0x2122, 0x0161, 0x203A, 0x015B, 0x0165, 0x017E, 0x017A, /* 0x90 */
+    0x00A0, 0x02C7, 0x02D8, 0x0141, 0x00A4, 0x0104, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x015E, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x017B, /* 0xA0 */
+    0x00B0, 0x00B1, 0x02DB, 0x0142, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x0105, 0x015F, 0x00BB, 0x013D, 0x02DD, 0x013E, 0x017C, /* 0xB0 */
+    0x0154, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x0139, 0x0106, 0x00C7, 0x010C, 0x00C9, 0x0118, 0x00CB, 0x011A, 0x00CD, 0x00CE, 0x010E, /* 0xC0 */
+    0x0110, 0x0143, 0x0147, 0x00D3, 0x00D4, 0x0150, 0x00D6, 0x00D7, 0x0158, 0x016E, 0x00DA, 0x0170, 0x00DC, 0x00DD, 0x0162, 0x00DF, /* 0xD0 */
+    0x0155, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x013A, 0x0107, 0x00E7, 0x010D, 0x00E9, 0x0119, 0x00EB, 0x011B, 0x00ED, 0x00EE, 0x010F, /* 0xE0 */
+    0x0111, 0x0144, 0x0148, 0x00F3, 0x00F4, 0x0151, 0x00F6, 0x00F7, 0x0159, 0x016F, 0x00FA, 0x0171, 0x00FC, 0x00FD, 0x0163, 0x02D9, /* 0xF0 */
+};
+
+const struct sb_reverse_entry windows_1250_from_unicode[251] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xA0}, {0x00A4, 0xA4}, {0x00A6, 0xA6}, {0x00A7, 0xA7}, {0x00A8, 0xA8}, {0x00A9, 0xA9}, {0x00AB, 0xAB}, {0x00AC, 0xAC},
+    {0x00AD, 0xAD}, {0x00AE, 0xAE}, {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B4, 0xB4}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7},
+    {0x00B8, 0xB8}, {0x00BB, 0xBB}, {0x00C1, 0xC1}, {0x00C2, 0xC2}, {0x00C4, 0xC4}, {0x00C7, 0xC7}, {0x00C9, 0xC9}, {0x00CB, 0xCB},
+    {0x00CD, 0xCD}, {0x00CE, 0xCE}, {0x00D3, 0xD3}, {0x00D4, 0xD4}, {0x00D6, 0xD6}, {0x00D7, 0xD7}, {0x00DA, 0xDA}, {0x00DC, 0xDC},
+    {0x00DD, 0xDD}, {0x00DF, 0xDF}, {0x00E1, 0xE1}, {0x00E2, 0xE2}, {0x00E4, 0xE4}, {0x00E7, 0xE7}, {0x00E9, 0xE9}, {0x00EB, 0xEB},
+    {0x00ED, 0xED}, {0x00EE, 0xEE}, {0x00F3, 0xF3}, {0x00F4, 0xF4}, {0x00F6, 0xF6}, {0x00F7, 0xF7}, {0x00FA, 0xFA}, {0x00FC, 0xFC},
+    {0x00FD, 0xFD}, {0x0102, 0xC3}, {0x0103, 0xE3}, {0x0104, 0xA5}, {0x0105, 0xB9}, {0x0106, 0xC6}, {0x0107, 0xE6}, {0x010C, 0xC8},
+    {0x010D, 0xE8}, {0x010E, 0xCF}, {0x010F, 0xEF}, {0x0110, 0xD0}, {0x0111, 0xF0}, {0x0118, 0xCA}, {0x0119, 0xEA}, {0x011A, 0xCC},
+    {0x011B, 0xEC}, {0x0139, 0xC5}, {0x013A, 0xE5}, {0x013D, 0xBC}, {0x013E, 0xBE}, {0x0141, 0xA3}, {0x0142, 0xB3}, {0x0143, 0xD1},
+    {0x0144, 0xF1}, {0x0147, 0xD2}, {0x0148, 0xF2}, {0x0150, 0xD5}, {0x0151, 0xF5}, {0x0154, 0xC0}, {0x0155, 0xE0}, {0x0158, 0xD8},
+    {0x0159, 0xF8}, {0x015A, 0x8C}, {0x015B, 0x9C}, {0x015E, 0xAA}, {0x015F, 0xBA}, {0x0160, 0x8A}, {0x0161, 0x9A}, {0x0162, 0xDE},
+    {0x0163, 0xFE}, {0x0164, 0x8D}, {0x0165, 0x9D}, {0x016E, 0xD9}, {0x016F, 0xF9}, {0x0170, 0xDB}, {0x0171, 0xFB}, {0x0179, 0x8F},
+    {0x017A, 0x9F}, {0x017B, 0xAF}, {0x017C, 0xBF}, {0x017D, 0x8E}, {0x017E, 0x9E}, {0x02C7, 0xA1}, {0x02D8, 0xA2}, {0x02D9, 0xFF},
+    {0x02DB, 0xB2}, {0x02DD, 0xBD}, {0x2013, 0x96}, {0x2014, 0x97}, {0x2018, 0x91}, {0x2019, 0x92}, {0x201A, 0x82}, {0x201C, 0x93},
+    {0x201D, 0x94}, {0x201E, 0x84}, {0x2020, 0x86}, {0x2021, 0x87}, {0x2022, 0x95}, {0x2026, 0x85}, {0x2030, 0x89}, {0x2039, 0x8B},
+    {0x203A, 0x9B}, {0x20AC, 0x80}, {0x2122, 0x99},
+};
+
+const uint16_t windows_1251_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0402, 0x0403, 0x201A, 0x0453, 0x201E, 0x2026, 0x2020, 0x2021, 0x20AC, 0x2030, 0x0409, 0x2039, 0x040A, 0x040C, 0x040B, 0x040F, /* 0x80 */
+    0x0452, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0xFFFD, 0x2122, 0x0459, 0x203A, 0x045A, 0x045C, 0x045B, 0x045F, /* 0x90 */
+    0x00A0, 0x040E, 0x045E, 0x0408, 0x00A4, 0x0490, 0x00A6, 0x00A7, 0x0401, 0x00A9, 0x0404, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x0407, /* 0xA0 */
+    0x00B0, 0x00B1, 0x0406, 0x0456, 0x0491, 0x00B5, 0x00B6, 0x00B7, 0x0451, 0x2116, 0x0454, 0x00BB, 0x0458, 0x0405, 0x0455, 0x0457, /* 0xB0 */
+    0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F, /* 0xC0 */
+    0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F, /* 0xD0 */
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, /* 0xE0 */
+    0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F, /* 0xF0 */
+};
+
+const struct sb_reverse_entry windows_1251_from_unicode[255] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xA0}, {0x00A4, 0xA4}, {0x00A6, 0xA6}, {0x00A7, 0xA7}, {0x00A9, 0xA9}, {0x00AB, 0xAB}, {0x00AC, 0xAC}, {0x00AD, 0xAD},
+    {0x00AE, 0xAE}, {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7}, {0x00BB, 0xBB}, {0x0401, 0xA8},
+    {0x0402, 0x80}, {0x0403, 0x81}, {0x0404, 0xAA}, {0x0405, 0xBD}, {0x0406, 0xB2}, {0x0407, 0xAF}, {0x0408, 0xA3}, {0x0409, 0x8A},
+    {0x040A, 0x8C}, {0x040B, 0x8E}, {0x040C, 0x8D}, {0x040E, 0xA1}, {0x040F, 0x8F}, {0x0410, 0xC0}, {0x0411, 0xC1}, {0x0412, 0xC2},
+    {0x0413, 0xC3}, {0x0414, 0xC4}, {0x0415, 0xC5}, {0x0416, 0xC6}, {0x0417, 0xC7}, {0x0418, 0xC8}, {0x0419, 0xC9}, {0x041A, 0xCA},
+    {0x041B, 0xCB}, {0x041C, 0xCC}, {0x041D, 0xCD}, {0x041E, 0xCE}, {0x041F, 0xCF}, {0x0420, 0xD0}, {0x0421, 0xD1}, {0x0422, 0xD2},
+    {0x0423, 0xD3}, {0x0424, 0xD4}, {0x0425, 0xD5}, {0x0426, 0xD6}, {0x0427, 0xD7}, {0x0428, 0xD8}, {0x0429, 0xD9}, {0x042A, 0xDA},
+    {0x042B, 0xDB}, {0x042C, 0xDC}, {0x042D, 0xDD}, {0x042E, 0xDE}, {0x042F, 0xDF}, {0x0430, 0xE0}, {0x0431, 0xE1}, {0x0432, 0xE2},
+    {0x0433, 0xE3}, {0x0434, 0xE4}, {0x0435, 0xE5}, {0x0436, 0xE6}, {0x0437, 0xE7}, {0x0438, 0xE8}, {0x0439, 0xE9}, {0x043A, 0xEA},
+    {0x043B, 0xEB}, {0x043C, 0xEC}, {0x043D, 0xED}, {0x043E, 0xEE}, {0x043F, 0xEF}, {0x0440, 0xF0}, {0x0441, 0xF1}, {0x0442, 0xF2},
+    {0x0443, 0xF3}, {0x0444, 0xF4}, {0x0445, 0xF5}, {0x0446, 0xF6}, {0x0447, 0xF7}, {0x0448, 0xF8}, {0x0449, 0xF9}, {0x044A, 0xFA},
+    {0x044B, 0xFB}, {0x044C, 0xFC}, {0x044D, 0xFD}, {0x044E, 0xFE}, {0x044F, 0xFF}, {0x0451, 0xB8}, {0x0452, 0x90}, {0x0453, 0x83},
+    {0x0454, 0xBA}, {0x0455, 0xBE}, {0x0456, 0xB3}, {0x0457, 0xBF}, {0x0458, 0xBC}, {0x0459, 0x9A}, {0x045A, 0x9C}, {0x045B, 0x9E},
+    {0x045C, 0x9D}, {0x045E, 0xA2}, {0x045F, 0x9F}, {0x0490, 0xA5}, {0x0491, 0xB4}, {0x2013, 0x96}, {0x2014, 0x97}, {0x2018, 0x91},
+    {0x2019, 0x92}, {0x201A, 0x82}, {0x201C, 0x93}, {0x201D, 0x94}, {0x201E, 0x84}, {0x2020, 0x86}, {0x2021, 0x87}, {0x2022, 0x95},
+    {0x2026, 0x85}, {0x2030, 0x89}, {0x2039, 0x8B}, {0x203A, 0x9B}, {0x20AC, 0x88}, {0x2116, 0xB9}, {0x2122, 0x99},
+};
+
+const uint16_t windows_1253_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0xFFFD, 0x2030, 0xFFFD, 0x2039, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x80 */
+    0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0xFFFD, 0x2122, 0xFFFD, 0x203A, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x90 */
+    0x00A0, 0x0385, 0x0386, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0xFFFD, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x2015, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x0384, 0x00B5, 0x00B6, 0x00B7, 0x0388, 0x0389, 0x038A, 0x00BB, 0x038C, 0x00BD, 0x038E, 0x038F, /* 0xB0 */
+    0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, /* 0xC0 */
+    0x03A0, 0x03A1, 0xFFFD, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF, /* 0xD0 */
+    0x03B0, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, /* 0xE0 */
+    0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry windows_1253_from_unicode[239] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xA0}, {0x00A3, 0xA3}, {0x00A4, 0xA4}, {0x00A5, 0xA5}, {0x00A6, 0xA6}, {0x00A7, 0xA7}, {0x00A8, 0xA8}, {0x00A9, 0xA9},
+    {0x00AB, 0xAB}, {0x00AC, 0xAC}, {0x00AD, 0xAD}, {0x00AE, 0xAE}, {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B2, 0xB2}, {0x00B3, 0xB3},
+    {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7}, {0x00BB, 0xBB}, {0x00BD, 0xBD}, {0x0192, 0x83}, {0x0384, 0xB4}, {0x0385, 0xA1},
+    {0x0386, 0xA2}, {0x0388, 0xB8}, {0x0389, 0xB9}, {0x038A, 0xBA}, {0x038C, 0xBC}, {0x038E, 0xBE}, {0x038F, 0xBF}, {0x0390, 0xC0},
+    {0x0391, 0xC1}, {0x0392, 0xC2}, {0x0393, 0xC3}, {0x0394, 0xC4}, {0x0395, 0xC5}, {0x0396, 0xC6}, {0x0397, 0xC7}, {0x0398, 0xC8},
+    {0x0399, 0xC9}, {0x039A, 0xCA}, {0x039B, 0xCB}, {0x039C, 0xCC}, {0x039D, 0xCD}, {0x039E, 0xCE}, {0x039F, 0xCF}, {0x03A0, 0xD0},
+    {0x03A1, 0xD1}, {0x03A3, 0xD3}, {0x03A4, 0xD4}, {0x03A5, 0xD5}, {0x03A6, 0xD6}, {0x03A7, 0xD7}, {0x03A8, 0xD8}, {0x03A9, 0xD9},
+    {0x03AA, 0xDA}, {0x03AB, 0xDB}, {0x03AC, 0xDC}, {0x03AD, 0xDD}, {0x03AE, 0xDE}, {0x03AF, 0xDF}, {0x03B0, 0xE0}, {0x03B1, 0xE1},
+    {0x03B2, 0xE2}, {0x03B3, 0xE3}, {0x03B4, 0xE4}, {0x03B5, 0xE5}, {0x03B6, 0xE6}, {0x03B7, 0xE7}, {0x03B8, 0xE8}, {0x03B9, 0xE9},
+    {0x03BA, 0xEA}, {0x03BB, 0xEB}, {0x03BC, 0xEC}, {0x03BD, 0xED}, {0x03BE, 0xEE}, {0x03BF, 0xEF}, {0x03C0, 0xF0}, {0x03C1, 0xF1},
+    {0x03C2, 0xF2}, {0x03C3, 0xF3}, {0x03C4, 0xF4}, {0x03C5, 0xF5}, {0x03C6, 0xF6}, {0x03C7, 0xF7}, {0x03C8, 0xF8}, {0x03C9, 0xF9},
+    {0x03CA, 0xFA}, {0x03CB, 0xFB}, {0x03CC, 0xFC}, {0x03CD, 0xFD}, {0x03CE, 0xFE}, {0x2013, 0x96}, {0x2014, 0x97}, {0x2015, 0xAF},
+    {0x2018, 0x91}, {0x2019, 0x92}, {0x201A, 0x82}, {0x201C, 0x93}, {0x201D, 0x94}, {0x201E, 0x84}, {0x2020, 0x86}, {0x2021, 0x87},
+    {0x2022, 0x95}, {0x2026, 0x85}, {0x2030, 0x89}, {0x2039, 0x8B}, {0x203A, 0x9B}, {0x20AC, 0x80}, {0x2122, 0x99},
+};
+
+const uint16_t windows_1254_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x80 */
+    0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0xFFFD, 0xFFFD, 0x0178, /* 0x90 */
+    0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, /* 0xB0 */
+    0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, /* 0xC0 */
+    0x011E, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x0130, 0x015E, 0x00DF, /* 0xD0 */
+    0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, /* 0xE0 */
+    0x011F, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x0131, 0x015F, 0x00FF, /* 0xF0 */
+};
+
+const struct sb_reverse_entry windows_1254_from_unicode[249] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xA0}, {0x00A1, 0xA1}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A4, 0xA4}, {0x00A5, 0xA5}, {0x00A6, 0xA6}, {0x00A7, 0xA7},
+    {0x00A8, 0xA8}, {0x00A9, 0xA9}, {0x00AA, 0xAA}, {0x00AB, 0xAB}, {0x00AC, 0xAC}, {0x00AD, 0xAD}, {0x00AE, 0xAE}, {0x00AF, 0xAF},
+    {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B2, 0xB2}, {0x00B3, 0xB3}, {0x00B4, 0xB4}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7},
+    {0x00B8, 0xB8}, {0x00B9, 0xB9}, {0x00BA, 0xBA}, {0x00BB, 0xBB}, {0x00BC, 0xBC}, {0x00BD, 0xBD}, {0x00BE, 0xBE}, {0x00BF, 0xBF},
+    {0x00C0, 0xC0}, {0x00C1, 0xC1}, {0x00C2, 0xC2}, {0x00C3, 0xC3}, {0x00C4, 0xC4}, {0x00C5, 0xC5}, {0x00C6, 0xC6}, {0x00C7, 0xC7},
+    {0x00C8, 0xC8}, {0x00C9, 0xC9}, {0x00CA, 0xCA}, {0x00CB, 0xCB}, {0x00CC, 0xCC}, {0x00CD, 0xCD}, {0x00CE, 0xCE}, {0x00CF, 0xCF},
+    {0x00D1, 0xD1}, {0x00D2, 0xD2}, {0x00D3, 0xD3}, {0x00D4, 0xD4}, {0x00D5, 0xD5}, {0x00D6, 0xD6}, {0x00D7, 0xD7}, {0x00D8, 0xD8},
+    {0x00D9, 0xD9}, {0x00DA, 0xDA}, {0x00DB, 0xDB}, {0x00DC, 0xDC}, {0x00DF, 0xDF}, {0x00E0, 0xE0}, {0x00E1, 0xE1}, {0x00E2, 0xE2},
+    {0x00E3, 0xE3}, {0x00E4, 0xE4}, {0x00E5, 0xE5}, {0x00E6, 0xE6}, {0x00E7, 0xE7}, {0x00E8, 0xE8}, {0x00E9, 0xE9}, {0x00EA, 0xEA},
+    {0x00EB, 0xEB}, {0x00EC, 0xEC}, {0x00ED, 0xED}, {0x00EE, 0xEE}, {0x00EF, 0xEF}, {0x00F1, 0xF1}, {0x00F2, 0xF2}, {0x00F3, 0xF3},
+    {0x00F4, 0xF4}, {0x00F5, 0xF5}, {0x00F6, 0xF6}, {0x00F7, 0xF7}, {0x00F8, 0xF8}, {0x00F9, 0xF9}, {0x00FA, 0xFA}, {0x00FB, 0xFB},
+    {0x00FC, 0xFC}, {0x00FF, 0xFF}, {0x011E, 0xD0}, {0x011F, 0xF0}, {0x0130, 0xDD}, {0x0131, 0xFD}, {0x0152, 0x8C}, {0x0153, 0x9C},
+    {0x015E, 0xDE}, {0x015F, 0xFE}, {0x0160, 0x8A}, {0x0161, 0x9A}, {0x0178, 0x9F}, {0x0192, 0x83}, {0x02C6, 0x88}, {0x02DC, 0x98},
+    {0x2013, 0x96}, {0x2014, 0x97}, {0x2018, 0x91}, {0x2019, 0x92}, {0x201A, 0x82}, {0x201C, 0x93}, {0x201D, 0x94}, {0x201E, 0x84},
+    {0x2020, 0x86}, {0x2021, 0x87}, {0x2022, 0x95}, {0x2026, 0x85}, {0x2030, 0x89}, {0x2039, 0x8B}, {0x203A, 0x9B}, {0x20AC, 0x80},
+    {0x2122, 0x99},
+};
+
+const uint16_t windows_1255_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0xFFFD, 0x2039, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x80 */
+    0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0xFFFD, 0x203A, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x90 */
+    0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x20AA, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00D7, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00F7, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, /* 0xB0 */
+    0x05B0, 0x05B1, 0x05B2, 0x05B3, 0x05B4, 0x05B5, 0x05B6, 0x05B7, 0x05B8, 0x05B9, 0x05BA, 0x05BB, 0x05BC, 0x05BD, 0x05BE, 0x05BF, /* 0xC0 */
+    0x05C0, 0x05C1, 0x05C2, 0x05C3, 0x05F0, 0x05F1, 0x05F2, 0x05F3, 0x05F4, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xD0 */
+    0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF, /* 0xE0 */
+    0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0xFFFD, 0xFFFD, 0x200E, 0x200F, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry windows_1255_from_unicode[234] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xA0}, {0x00A1, 0xA1}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A5, 0xA5}, {0x00A6, 0xA6}, {0x00A7, 0xA7}, {0x00A8, 0xA8},
+    {0x00A9, 0xA9}, {0x00AB, 0xAB}, {0x00AC, 0xAC}, {0x00AD, 0xAD}, {0x00AE, 0xAE}, {0x00AF, 0xAF}, {0x00B0, 0xB0}, {0x00B1, 0xB1},
+    {0x00B2, 0xB2}, {0x00B3, 0xB3}, {0x00B4, 0xB4}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7}, {0x00B8, 0xB8}, {0x00B9, 0xB9},
+    {0x00BB, 0xBB}, {0x00BC, 0xBC}, {0x00BD, 0xBD}, {0x00BE, 0xBE}, {0x00BF, 0xBF}, {0x00D7, 0xAA}, {0x00F7, 0xBA}, {0x0192, 0x83},
+    {0x02C6, 0x88}, {0x02DC, 0x98}, {0x05B0, 0xC0}, {0x05B1, 0xC1}, {0x05B2, 0xC2}, {0x05B3, 0xC3}, {0x05B4, 0xC4}, {0x05B5, 0xC5},
+    {0x05B6, 0xC6}, {0x05B7, 0xC7}, {0x05B8, 0xC8}, {0x05B9, 0xC9}, {0x05BA, 0xCA}, {0x05BB, 0xCB}, {0x05BC, 0xCC}, {0x05BD, 0xCD},
+    {0x05BE, 0xCE}, {0x05BF, 0xCF}, {0x05C0, 0xD0}, {0x05C1, 0xD1}, {0x05C2, 0xD2}, {0x05C3, 0xD3}, {0x05D0, 0xE0}, {0x05D1, 0xE1},
+    {0x05D2, 0xE2}, {0x05D3, 0xE3}, {0x05D4, 0xE4}, {0x05D5, 0xE5}, {0x05D6, 0xE6}, {0x05D7, 0xE7}, {0x05D8, 0xE8}, {0x05D9, 0xE9},
+    {0x05DA, 0xEA}, {0x05DB, 0xEB}, {0x05DC, 0xEC}, {0x05DD, 0xED}, {0x05DE, 0xEE}, {0x05DF, 0xEF}, {0x05E0, 0xF0}, {0x05E1, 0xF1},
+    {0x05E2, 0xF2}, {0x05E3, 0xF3}, {0x05E4, 0xF4}, {0x05E5, 0xF5}, {0x05E6, 0xF6}, {0x05E7, 0xF7}, {0x05E8, 0xF8}, {0x05E9, 0xF9},
+    {0x05EA, 0xFA}, {0x05F0, 0xD4}, {0x05F1, 0xD5}, {0x05F2, 0xD6}, {0x05F3, 0xD7}, {0x05F4, 0xD8}, {0x200E, 0xFD}, {0x200F, 0xFE},
+    {0x2013, 0x96}, {0x2014, 0x97}, {0x2018, 0x91}, {0x2019, 0x92}, {0x201A, 0x82}, {0x201C, 0x93}, {0x201D, 0x94}, {0x201E, 0x84},
+    {0x2020, 0x86}, {0x2021, 0x87}, {0x2022, 0x95}, {0x2026, 0x85}, {0x2030, 0x89}, {0x2039, 0x8B}, {0x203A, 0x9B}, {0x20AA, 0xA4},
+    {0x20AC, 0x80}, {0x2122, 0x99},
+};
+
+const uint16_t windows_1256_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x20AC, 0x067E, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0679, 0x2039, 0x0152, 0x0686, 0x0698, 0x0688, /* 0x80 */
+    0x06AF, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x06A9, 0x2122, 0x0691, 0x203A, 0x0153, 0x200C, 0x200D, 0x06BA, /* 0x90 */
+    0x00A0, 0x060C, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x06BE, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x061B, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x061F, /* 0xB0 */
+    0x06C1, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627, 0x0628, 0x0629, 0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F, /* 0xC0 */
+    0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x00D7, 0x0637, 0x0638, 0x0639, 0x063A, 0x0640, 0x0641, 0x0642, 0x0643, /* 0xD0 */
+    0x00E0, 0x0644, 0x00E2, 0x0645, 0x0646, 0x0647, 0x0648, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x0649, 0x064A, 0x00EE, 0x00EF, /* 0xE0 */
+    0x064B, 0x064C, 0x064D, 0x064E, 0x00F4, 0x064F, 0x0650, 0x00F7, 0x0651, 0x00F9, 0x0652, 0x00FB, 0x00FC, 0x200E, 0x200F, 0x06D2, /* 0xF0 */
+};
+
+const struct sb_reverse_entry windows_1256_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xA0}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A4, 0xA4}, {0x00A5, 0xA5}, {0x00A6, 0xA6}, {0x00A7, 0xA7}, {0x00A8, 0xA8},
+    {0x00A9, 0xA9}, {0x00AB, 0xAB}, {0x00AC, 0xAC}, {0x00AD, 0xAD}, {0x00AE, 0xAE}, {0x00AF, 0xAF}, {0x00B0, 0xB0}, {0x00B1, 0xB1},
+    {0x00B2, 0xB2}, {0x00B3, 0xB3}, {0x00B4, 0xB4}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7}, {0x00B8, 0xB8}, {0x00B9, 0xB9},
+    {0x00BB, 0xBB}, {0x00BC, 0xBC}, {0x00BD, 0xBD}, {0x00BE, 0xBE}, {0x00D7, 0xD7}, {0x00E0, 0xE0}, {0x00E2, 0xE2}, {0x00E7, 0xE7},
+    {0x00E8, 0xE8}, {0x00E9, 0xE9}, {0x00EA, 0xEA}, {0x00EB, 0xEB}, {0x00EE, 0xEE}, {0x00EF, 0xEF}, {0x00F4, 0xF4}, {0x00F7, 0xF7},
+    {0x00F9, 0xF9}, {0x00FB, 0xFB}, {0x00FC, 0xFC}, {0x0152, 0x8C}, {0x0153, 0x9C}, {0x0192, 0x83}, {0x02C6, 0x88}, {0x060C, 0xA1},
+    {0x061B, 0xBA}, {0x061F, 0xBF}, {0x0621, 0xC1}, {0x0622, 0xC2}, {0x0623, 0xC3}, {0x0624, 0xC4}, {0x0625, 0xC5}, {0x0626, 0xC6},
+    {0x0627, 0xC7}, {0x0628, 0xC8}, {0x0629, 0xC9}, {0x062A, 0xCA}, {0x062B, 0xCB}, {0x062C, 0xCC}, {0x062D, 0xCD}, {0x062E, 0xCE},
+    {0x062F, 0xCF}, {0x0630, 0xD0}, {0x0631, 0xD1}, {0x0632, 0xD2}, {0x0633, 0xD3}, {0x0634, 0xD4}, {0x0635, 0xD5}, {0x0636, 0xD6},
+    {0x0637, 0xD8}, {0x0638, 0xD9}, {0x0639, 0xDA}, {0x063A, 0xDB}, {0x0640, 0xDC}, {0x0641, 0xDD}, {0x0642, 0xDE}, {0x0643, 0xDF},
+    {0x0644, 0xE1}, {0x0645, 0xE3}, {0x0646, 0xE4}, {0x0647, 0xE5}, {0x0648, 0xE6}, {0x0649, 0xEC}, {0x064A, 0xED}, {0x064B, 0xF0},
+    {0x064C, 0xF1}, {0x064D, 0xF2}, {0x064E, 0xF3}, {0x064F, 0xF5}, {0x0650, 0xF6}, {0x0651, 0xF8}, {0x0652, 0xFA}, {0x0679, 0x8A},
+    {0x067E, 0x81}, {0x0686, 0x8D}, {0x0688, 0x8F}, {0x0691, 0x9A}, {0x0698, 0x8E}, {0x06A9, 0x98}, {0x06AF, 0x90}, {0x06BA, 0x9F},
+    {0x06BE, 0xAA}, {0x06C1, 0xC0}, {0x06D2, 0xFF}, {0x200C, 0x9D}, {0x200D, 0x9E}, {0x200E, 0xFD}, {0x200F, 0xFE}, {0x2013, 0x96},
+    {0x2014, 0x97}, {0x2018, 0x91}, {0x2019, 0x92}, {0x201A, 0x82}, {0x201C, 0x93}, {0x201D, 0x94}, {0x201E, 0x84}, {0x2020, 0x86},
+    {0x2021, 0x87}, {0x2022, 0x95}, {0x2026, 0x85}, {0x2030, 0x89}, {0x2039, 0x8B}, {0x203A, 0x9B}, {0x20AC, 0x80}, {0x2122, 0x99},
+};
+
+const uint16_t windows_1257_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x20AC, 0xFFFD, 0x201A, 0xFFFD, 0x201E, 0x2026, 0x2020, 0x2021, 0xFFFD, 0x2030, 0xFFFD, 0x2039, 0xFFFD, 0x00A8, 0x02C7, 0x00B8, /* 0x80 */
+    0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0xFFFD, 0x2122, 0xFFFD, 0x203A, 0xFFFD, 0x00AF, 0x02DB, 0xFFFD, /* 0x90 */
+    0x00A0, 0xFFFD, 0x00A2, 0x00A3, 0x00A4, 0xFFFD, 0x00A6, 0x00A7, 0x00D8, 0x00A9, 0x0156, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00C6, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00F8, 0x00B9, 0x0157, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00E6, /* 0xB0 */
+    0x0104, 0x012E, 0x0100, 0x0106, 0x00C4, 0x00C5, 0x0118, 0x0112, 0x010C, 0x00C9, 0x0179, 0x0116, 0x0122, 0x0136, 0x012A, 0x013B, /* 0xC0 */
+    0x0160, 0x0143, 0x0145, 0x00D3, 0x014C, 0x00D5, 0x00D6, 0x00D7, 0x0172, 0x0141, 0x015A, 0x016A, 0x00DC, 0x017B, 0x017D, 0x00DF, /* 0xD0 */
+    0x0105, 0x012F, 0x0101, 0x0107, 0x00E4, 0x00E5, 0x0119, 0x0113, 0x010D, 0x00E9, 0x017A, 0x0117, 0x0123, 0x0137, 0x012B, 0x013C, /* 0xE0 */
+    0x0161, 0x0144, 0x0146, 0x00F3, 0x014D, 0x00F5, 0x00F6, 0x00F7, 0x0173, 0x0142, 0x015B, 0x016B, 0x00FC, 0x017C, 0x017E, 0x02D9, /* 0xF0 */
+};
+
+const struct sb_reverse_entry windows_1257_from_unicode[244] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xA0}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A4, 0xA4}, {0x00A6, 0xA6}, {0x00A7, 0xA7}, {0x00A8, 0x8D}, {0x00A9, 0xA9},
+    {0x00AB, 0xAB}, {0x00AC, 0xAC}, {0x00AD, 0xAD}, {0x00AE, 0xAE}, {0x00AF, 0x9D}, {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B2, 0xB2},
+    {0x00B3, 0xB3}, {0x00B4, 0xB4}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7}, {0x00B8, 0x8F}, {0x00B9, 0xB9}, {0x00BB, 0xBB},
+    {0x00BC, 0xBC}, {0x00BD, 0xBD}, {0x00BE, 0xBE}, {0x00C4, 0xC4}, {0x00C5, 0xC5}, {0x00C6, 0xAF}, {0x00C9, 0xC9}, {0x00D3, 0xD3},
+    {0x00D5, 0xD5}, {0x00D6, 0xD6}, {0x00D7, 0xD7}, {0x00D8, 0xA8}, {0x00DC, 0xDC}, {0x00DF, 0xDF}, {0x00E4, 0xE4}, {0x00E5, 0xE5},
+    {0x00E6, 0xBF}, {0x00E9, 0xE9}, {0x00F3, 0xF3}, {0x00F5, 0xF5}, {0x00F6, 0xF6}, {0x00F7, 0xF7}, {0x00F8, 0xB8}, {0x00FC, 0xFC},
+    {0x0100, 0xC2}, {0x0101, 0xE2}, {0x0104, 0xC0}, {0x0105, 0xE0}, {0x0106, 0xC3}, {0x0107, 0xE3}, {0x010C, 0xC8}, {0x010D, 0xE8},
+    {0x0112, 0xC7}, {0x0113, 0xE7}, {0x0116, 0xCB}, {0x0117, 0xEB}, {0x0118, 0xC6}, {0x0119, 0xE6}, {0x0122, 0xCC}, {0x0123, 0xEC},
+    {0x012A, 0xCE}, {0x012B, 0xEE}, {0x012E, 0xC1}, {0x012F, 0xE1}, {0x0136, 0xCD}, {0x0137, 0xED}, {0x013B, 0xCF}, {0x013C, 0xEF},
+    {0x0141, 0xD9}, {0x0142, 0xF9}, {0x0143, 0xD1}, {0x0144, 0xF1}, {0x0145, 0xD2}, {0x0146, 0xF2}, {0x014C, 0xD4}, {0x014D, 0xF4},
+    {0x0156, 0xAA}, {0x0157, 0xBA}, {0x015A, 0xDA}, {0x015B, 0xFA}, {0x0160, 0xD0}, {0x0161, 0xF0}, {0x016A, 0xDB}, {0x016B, 0xFB},
+    {0x0172, 0xD8}, {0x0173, 0xF8}, {0x0179, 0xCA}, {0x017A, 0xEA}, {0x017B, 0xDD}, {0x017C, 0xFD}, {0x017D, 0xDE}, {0x017E, 0xFE},
+    {0x02C7, 0x8E}, {0x02D9, 0xFF}, {0x02DB, 0x9E}, {0x2013, 0x96}, {0x2014, 0x97}, {0x2018, 0x91}, {0x2019, 0x92}, {0x201A, 0x82},
+    {0x201C, 0x93}, {0x201D, 0x94}, {0x201E, 0x84}, {0x2020, 0x86}, {0x2021, 0x87}, {0x2022, 0x95}, {0x2026, 0x85}, {0x2030, 0x89},
+    {0x2039, 0x8B}, {0x203A, 0x9B}, {0x20AC, 0x80}, {0x2122, 0x99},
+};
+
+const uint16_t windows_1258_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0xFFFD, 0x2039, 0x0152, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x80 */
+    0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0xFFFD, 0x203A, 0x0153, 0xFFFD, 0xFFFD, 0x0178, /* 0x90 */
+    0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, /* 0xB0 */
+    0x00C0, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x0300, 0x00CD, 0x00CE, 0x00CF, /* 0xC0 */
+    0x0110, 0x00D1, 0x0309, 0x00D3, 0x00D4, 0x01A0, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x01AF, 0x0303, 0x00DF, /* 0xD0 */
+    0x00E0, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x0301, 0x00ED, 0x00EE, 0x00EF, /* 0xE0 */
+    0x0111, 0x00F1, 0x0323, 0x00F3, 0x00F4, 0x01A1, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x01B0, 0x20AB, 0x00FF, /* 0xF0 */
+};
+
+const struct sb_reverse_entry windows_1258_from_unicode[247] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xA0}, {0x00A1, 0xA1}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A4, 0xA4}, {0x00A5, 0xA5}, {0x00A6, 0xA6}, {0x00A7, 0xA7},
+    {0x00A8, 0xA8}, {0x00A9, 0xA9}, {0x00AA, 0xAA}, {0x00AB, 0xAB}, {0x00AC, 0xAC}, {0x00AD, 0xAD}, {0x00AE, 0xAE}, {0x00AF, 0xAF},
+    {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B2, 0xB2}, {0x00B3, 0xB3}, {0x00B4, 0xB4}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7},
+    {0x00B8, 0xB8}, {0x00B9, 0xB9}, {0x00BA, 0xBA}, {0x00BB, 0xBB}, {0x00BC, 0xBC}, {0x00BD, 0xBD}, {0x00BE, 0xBE}, {0x00BF, 0xBF},
+    {0x00C0, 0xC0}, {0x00C1, 0xC1}, {0x00C2, 0xC2}, {0x00C4, 0xC4}, {0x00C5, 0xC5}, {0x00C6, 0xC6}, {0x00C7, 0xC7}, {0x00C8, 0xC8},
+    {0x00C9, 0xC9}, {0x00CA, 0xCA}, {0x00CB, 0xCB}, {0x00CD, 0xCD}, {0x00CE, 0xCE}, {0x00CF, 0xCF}, {0x00D1, 0xD1}, {0x00D3, 0xD3},
+    {0x00D4, 0xD4}, {0x00D6, 0xD6}, {0x00D7, 0xD7}, {0x00D8, 0xD8}, {0x00D9, 0xD9}, {0x00DA, 0xDA}, {0x00DB, 0xDB}, {0x00DC, 0xDC},
+    {0x00DF, 0xDF}, {0x00E0, 0xE0}, {0x00E1, 0xE1}, {0x00E2, 0xE2}, {0x00E4, 0xE4}, {0x00E5, 0xE5}, {0x00E6, 0xE6}, {0x00E7, 0xE7},
+    {0x00E8, 0xE8}, {0x00E9, 0xE9}, {0x00EA, 0xEA}, {0x00EB, 0xEB}, {0x00ED, 0xED}, {0x00EE, 0xEE}, {0x00EF, 0xEF}, {0x00F1, 0xF1},
+    {0x00F3, 0xF3}, {0x00F4, 0xF4}, {0x00F6, 0xF6}, {0x00F7, 0xF7}, {0x00F8, 0xF8}, {0x00F9, 0xF9}, {0x00FA, 0xFA}, {0x00FB, 0xFB},
+    {0x00FC, 0xFC}, {0x00FF, 0xFF}, {0x0102, 0xC3}, {0x0103, 0xE3}, {0x0110, 0xD0}, {0x0111, 0xF0}, {0x0152, 0x8C}, {0x0153, 0x9C},
+    {0x0178, 0x9F}, {0x0192, 0x83}, {0x01A0, 0xD5}, {0x01A1, 0xF5}, {0x01AF, 0xDD}, {0x01B0, 0xFD}, {0x02C6, 0x88}, {0x02DC, 0x98},
+    {0x0300, 0xCC}, {0x0301, 0xEC}, {0x0303, 0xDE}, {0x0309, 0xD2}, {0x0323, 0xF2}, {0x2013, 0x96}, {0x2014, 0x97}, {0x2018, 0x91},
+    {0x2019, 0x92}, {0x201A, 0x82}, {0x201C, 0x93}, {0x201D, 0x94}, {0x201E, 0x84}, {0x2020, 0x86}, {0x2021, 0x87}, {0x2022, 0x95},
+    {0x2026, 0x85}, {0x2030, 0x89}, {0x2039, 0x8B}, {0x203A, 0x9B}, {0x20AB, 0xFE}, {0x20AC, 0x80}, {0x2122, 0x99},
+};
+
+const uint16_t cp437_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5, /* 0x80 */
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x00FF, 0x00D6, 0x00DC, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229, /* 0xE0 */
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp437_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A2, 0x9B}, {0x00A3, 0x9C}, {0x00A5, 0x9D}, {0x00AA, 0xA6}, {0x00AB, 0xAE}, {0x00AC, 0xAA},
+    {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B5, 0xE6}, {0x00B7, 0xFA}, {0x00BA, 0xA7}, {0x00BB, 0xAF}, {0x00BC, 0xAC},
+    {0x00BD, 0xAB}, {0x00BF, 0xA8}, {0x00C4, 0x8E}, {0x00C5, 0x8F}, {0x00C6, 0x92}, {0x00C7, 0x80}, {0x00C9, 0x90}, {0x00D1, 0xA5},
+    {0x00D6, 0x99}, {0x00DC, 0x9A}, {0x00DF, 0xE1}, {0x00E0, 0x85}, {0x00E1, 0xA0}, {0x00E2, 0x83}, {0x00E4, 0x84}, {0x00E5, 0x86},
+    {0x00E6, 0x91}, {0x00E7, 0x87}, {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88}, {0x00EB, 0x89}, {0x00EC, 0x8D}, {0x00ED, 0xA1},
+    {0x00EE, 0x8C}, {0x00EF, 0x8B}, {0x00F1, 0xA4}, {0x00F2, 0x95}, {0x00F3, 0xA2}, {0x00F4, 0x93}, {0x00F6, 0x94}, {0x00F7, 0xF6},
+    {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FB, 0x96}, {0x00FC, 0x81}, {0x00FF, 0x98}, {0x0192, 0x9F}, {0x0393, 0xE2}, {0x0398, 0xE9},
+    {0x03A3, 0xE4}, {0x03A6, 0xE8}, {0x03A9, 0xEA}, {0x03B1, 0xE0}, {0x03B4, 0xEB}, {0x03B5, 0xEE}, {0x03C0, 0xE3}, {0x03C3, 0xE5},
+    {0x03C4, 0xE7}, {0x03C6, 0xED}, {0x207F, 0xFC}, {0x20A7, 0x9E}, {0x2219, 0xF9}, {0x221A, 0xFB}, {0x221E, 0xEC}, {0x2229, 0xEF},
+    {0x2248, 0xF7}, {0x2261, 0xF0}, {0x2264, 0xF3}, {0x2265, 0xF2}, {0x2310, 0xA9}, {0x2320, 0xF4}, {0x2321, 0xF5}, {0x2500, 0xC4},
+    {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2},
+    {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8},
+    {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4}, {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC},
+    {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC}, {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2},
+    {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0}, {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF},
+    {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD}, {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+const uint16_t cp437_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5, /* 0x80 */
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x00FF, 0x00D6, 0x00DC, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229, /* 0xE0 */
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp437_doc_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E},
+    {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66},
+    {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E},
+    {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76},
+    {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A2, 0x9B}, {0x00A3, 0x9C}, {0x00A5, 0x9D}, {0x00A7, 0x15}, {0x00AA, 0xA6}, {0x00AB, 0xAE},
+    {0x00AC, 0xAA}, {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B5, 0xE6}, {0x00B6, 0x14}, {0x00B7, 0xFA}, {0x00BA, 0xA7},
+    {0x00BB, 0xAF}, {0x00BC, 0xAC}, {0x00BD, 0xAB}, {0x00BF, 0xA8}, {0x00C4, 0x8E}, {0x00C5, 0x8F}, {0x00C6, 0x92}, {0x00C7, 0x80},
+    {0x00C9, 0x90}, {0x00D1, 0xA5}, {0x00D6, 0x99}, {0x00DC, 0x9A}, {0x00DF, 0xE1}, {0x00E0, 0x85}, {0x00E1, 0xA0}, {0x00E2, 0x83},
+    {0x00E4, 0x84}, {0x00E5, 0x86}, {0x00E6, 0x91}, {0x00E7, 0x87}, {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88}, {0x00EB, 0x89},
+    {0x00EC, 0x8D}, {0x00ED, 0xA1}, {0x00EE, 0x8C}, {0x00EF, 0x8B}, {0x00F1, 0xA4}, {0x00F2, 0x95}, {0x00F3, 0xA2}, {0x00F4, 0x93},
+    {0x00F6, 0x94}, {0x00F7, 0xF6}, {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FB, 0x96}, {0x00FC, 0x81}, {0x00FF, 0x98}, {0x0192, 0x9F},
+    {0x0393, 0xE2}, {0x0398, 0xE9}, {0x03A3, 0xE4}, {0x03A6, 0xE8}, {0x03A9, 0xEA}, {0x03B1, 0xE0}, {0x03B4, 0xEB}, {0x03B5, 0xEE},
+    {0x03C0, 0xE3}, {0x03C3, 0xE5}, {0x03C4, 0xE7}, {0x03C6, 0xED}, {0x2022, 0x07}, {0x203C, 0x13}, {0x207F, 0xFC}, {0x20A7, 0x9E},
+    {0x2190, 0x1B}, {0x2191, 0x18}, {0x2192, 0x1A}, {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17}, {0x2219, 0xF9},
+    {0x221A, 0xFB}, {0x221E, 0xEC}, {0x221F, 0x1C}, {0x2229, 0xEF}, {0x2248, 0xF7}, {0x2261, 0xF0}, {0x2264, 0xF3}, {0x2265, 0xF2},
+    {0x2302, 0x7F}, {0x2310, 0xA9}, {0x2320, 0xF4}, {0x2321, 0xF5}, {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF},
+    {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD},
+    {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8}, {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4},
+    {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC}, {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC},
+    {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2}, {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0},
+    {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD},
+    {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE}, {0x25AC, 0x16}, {0x25B2, 0x1E}, {0x25BA, 0x10},
+    {0x25BC, 0x1F}, {0x25C4, 0x11}, {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A}, {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F},
+    {0x2640, 0x0C}, {0x2642, 0x0B}, {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04}, {0x266A, 0x0D}, {0x266B, 0x0E},
+};
+
+const uint16_t cp850_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5, /* 0x80 */
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x00FF, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x00D7, 0x0192, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x00AE, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x00C0, 0x00A9, 0x2563, 0x2551, 0x2557, 0x255D, 0x00A2, 0x00A5, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x00E3, 0x00C3, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4, /* 0xC0 */
+    0x00F0, 0x00D0, 0x00CA, 0x00CB, 0x00C8, 0x0131, 0x00CD, 0x00CE, 0x00CF, 0x2518, 0x250C, 0x2588, 0x2584, 0x00A6, 0x00CC, 0x2580, /* 0xD0 */
+    0x00D3, 0x00DF, 0x00D4, 0x00D2, 0x00F5, 0x00D5, 0x00B5, 0x00FE, 0x00DE, 0x00DA, 0x00DB, 0x00D9, 0x00FD, 0x00DD, 0x00AF, 0x00B4, /* 0xE0 */
+    0x00AD, 0x00B1, 0x2017, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp850_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A2, 0xBD}, {0x00A3, 0x9C}, {0x00A4, 0xCF}, {0x00A5, 0xBE}, {0x00A6, 0xDD}, {0x00A7, 0xF5},
+    {0x00A8, 0xF9}, {0x00A9, 0xB8}, {0x00AA, 0xA6}, {0x00AB, 0xAE}, {0x00AC, 0xAA}, {0x00AD, 0xF0}, {0x00AE, 0xA9}, {0x00AF, 0xEE},
+    {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B3, 0xFC}, {0x00B4, 0xEF}, {0x00B5, 0xE6}, {0x00B6, 0xF4}, {0x00B7, 0xFA},
+    {0x00B8, 0xF7}, {0x00B9, 0xFB}, {0x00BA, 0xA7}, {0x00BB, 0xAF}, {0x00BC, 0xAC}, {0x00BD, 0xAB}, {0x00BE, 0xF3}, {0x00BF, 0xA8},
+    {0x00C0, 0xB7}, {0x00C1, 0xB5}, {0x00C2, 0xB6}, {0x00C3, 0xC7}, {0x00C4, 0x8E}, {0x00C5, 0x8F}, {0x00C6, 0x92}, {0x00C7, 0x80},
+    {0x00C8, 0xD4}, {0x00C9, 0x90}, {0x00CA, 0xD2}, {0x00CB, 0xD3}, {0x00CC, 0xDE}, {0x00CD, 0xD6}, {0x00CE, 0xD7}, {0x00CF, 0xD8},
+    {0x00D0, 0xD1}, {0x00D1, 0xA5}, {0x00D2, 0xE3}, {0x00D3, 0xE0}, {0x00D4, 0xE2}, {0x00D5, 0xE5}, {0x00D6, 0x99}, {0x00D7, 0x9E},
+    {0x00D8, 0x9D}, {0x00D9, 0xEB}, {0x00DA, 0xE9}, {0x00DB, 0xEA}, {0x00DC, 0x9A}, {0x00DD, 0xED}, {0x00DE, 0xE8}, {0x00DF, 0xE1},
+    {0x00E0, 0x85}, {0x00E1, 0xA0}, {0x00E2, 0x83}, {0x00E3, 0xC6}, {0x00E4, 0x84}, {0x00E5, 0x86}, {0x00E6, 0x91}, {0x00E7, 0x87},
+    {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88}, {0x00EB, 0x89}, {0x00EC, 0x8D}, {0x00ED, 0xA1}, {0x00EE, 0x8C}, {0x00EF, 0x8B},
+    {0x00F0, 0xD0}, {0x00F1, 0xA4}, {0x00F2, 0x95}, {0x00F3, 0xA2}, {0x00F4, 0x93}, {0x00F5, 0xE4}, {0x00F6, 0x94}, {0x00F7, 0xF6},
+    {0x00F8, 0x9B}, {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FB, 0x96}, {0x00FC, 0x81}, {0x00FD, 0xEC}, {0x00FE, 0xE7}, {0x00FF, 0x98},
+    {0x0131, 0xD5}, {0x0192, 0x9F}, {0x2017, 0xF2}, {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0},
+    {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA},
+    {0x2554, 0xC9}, {0x2557, 0xBB}, {0x255A, 0xC8}, {0x255D, 0xBC}, {0x2560, 0xCC}, {0x2563, 0xB9}, {0x2566, 0xCB}, {0x2569, 0xCA},
+    {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+const uint16_t cp852_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x016F, 0x0107, 0x00E7, 0x0142, 0x00EB, 0x0150, 0x0151, 0x00EE, 0x0179, 0x00C4, 0x0106, /* 0x80 */
+    0x00C9, 0x0139, 0x013A, 0x00F4, 0x00F6, 0x013D, 0x013E, 0x015A, 0x015B, 0x00D6, 0x00DC, 0x0164, 0x0165, 0x0141, 0x00D7, 0x010D, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x0104, 0x0105, 0x017D, 0x017E, 0x0118, 0x0119, 0x00AC, 0x017A, 0x010C, 0x015F, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x011A, 0x015E, 0x2563, 0x2551, 0x2557, 0x255D, 0x017B, 0x017C, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x0102, 0x0103, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4, /* 0xC0 */
+    0x0111, 0x0110, 0x010E, 0x00CB, 0x010F, 0x0147, 0x00CD, 0x00CE, 0x011B, 0x2518, 0x250C, 0x2588, 0x2584, 0x0162, 0x016E, 0x2580, /* 0xD0 */
+    0x00D3, 0x00DF, 0x00D4, 0x0143, 0x0144, 0x0148, 0x0160, 0x0161, 0x0154, 0x00DA, 0x0155, 0x0170, 0x00FD, 0x00DD, 0x0163, 0x00B4, /* 0xE0 */
+    0x00AD, 0x02DD, 0x02DB, 0x02C7, 0x02D8, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x02D9, 0x0171, 0x0158, 0x0159, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp852_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xFF}, {0x00A4, 0xCF}, {0x00A7, 0xF5}, {0x00A8, 0xF9}, {0x00AB, 0xAE}, {0x00AC, 0xAA}, {0x00AD, 0xF0}, {0x00B0, 0xF8},
+    {0x00B4, 0xEF}, {0x00B8, 0xF7}, {0x00BB, 0xAF}, {0x00C1, 0xB5}, {0x00C2, 0xB6}, {0x00C4, 0x8E}, {0x00C7, 0x80}, {0x00C9, 0x90},
+    {0x00CB, 0xD3}, {0x00CD, 0xD6}, {0x00CE, 0xD7}, {0x00D3, 0xE0}, {0x00D4, 0xE2}, {0x00D6, 0x99}, {0x00D7, 0x9E}, {0x00DA, 0xE9},
+    {0x00DC, 0x9A}, {0x00DD, 0xED}, {0x00DF, 0xE1}, {0x00E1, 0xA0}, {0x00E2, 0x83}, {0x00E4, 0x84}, {0x00E7, 0x87}, {0x00E9, 0x82},
+    {0x00EB, 0x89}, {0x00ED, 0xA1}, {0x00EE, 0x8C}, {0x00F3, 0xA2}, {0x00F4, 0x93}, {0x00F6, 0x94}, {0x00F7, 0xF6}, {0x00FA, 0xA3},
+    {0x00FC, 0x81}, {0x00FD, 0xEC}, {0x0102, 0xC6}, {0x0103, 0xC7}, {0x0104, 0xA4}, {0x0105, 0xA5}, {0x0106, 0x8F}, {0x0107, 0x86},
+    {0x010C, 0xAC}, {0x010D, 0x9F}, {0x010E, 0xD2}, {0x010F, 0xD4}, {0x0110, 0xD1}, {0x0111, 0xD0}, {0x0118, 0xA8}, {0x0119, 0xA9},
+    {0x011A, 0xB7}, {0x011B, 0xD8}, {0x0139, 0x91}, {0x013A, 0x92}, {0x013D, 0x95}, {0x013E, 0x96}, {0x0141, 0x9D}, {0x0142, 0x88},
+    {0x0143, 0xE3}, {0x0144, 0xE4}, {0x0147, 0xD5}, {0x0148, 0xE5}, {0x0150, 0x8A}, {0x0151, 0x8B}, {0x0154, 0xE8}, {0x0155, 0xEA},
+    {0x0158, 0xFC}, {0x0159, 0xFD}, {0x015A, 0x97}, {0x015B, 0x98}, {0x015E, 0xB8}, {0x015F, 0xAD}, {0x0160, 0xE6}, {0x0161, 0xE7},
+    {0x0162, 0xDD}, {0x0163, 0xEE}, {0x0164, 0x9B}, {0x0165, 0x9C}, {0x016E, 0xDE}, {0x016F, 0x85}, {0x0170, 0xEB}, {0x0171, 0xFB},
+    {0x0179, 0x8D}, {0x017A, 0xAB}, {0x017B, 0xBD}, {0x017C, 0xBE}, {0x017D, 0xA6}, {0x017E, 0xA7}, {0x02C7, 0xF3}, {0x02D8, 0xF4},
+    {0x02D9, 0xFA}, {0x02DB, 0xF2}, {0x02DD, 0xF1}, {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0},
+    {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA},
+    {0x2554, 0xC9}, {0x2557, 0xBB}, {0x255A, 0xC8}, {0x255D, 0xBC}, {0x2560, 0xCC}, {0x2563, 0xB9}, {0x2566, 0xCB}, {0x2569, 0xCA},
+    {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+const uint16_t cp866_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F, /* 0x80 */
+    0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F, /* 0x90 */
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F, /* 0xE0 */
+    0x0401, 0x0451, 0x0404, 0x0454, 0x0407, 0x0457, 0x040E, 0x045E, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x2116, 0x00A4, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp866_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xFF}, {0x00A4, 0xFD}, {0x00B0, 0xF8}, {0x00B7, 0xFA}, {0x0401, 0xF0}, {0x0404, 0xF2}, {0x0407, 0xF4}, {0x040E, 0xF6},
+    {0x0410, 0x80}, {0x0411, 0x81}, {0x0412, 0x82}, {0x0413, 0x83}, {0x0414, 0x84}, {0x0415, 0x85}, {0x0416, 0x86}, {0x0417, 0x87},
+    {0x0418, 0x88}, {0x0419, 0x89}, {0x041A, 0x8A}, {0x041B, 0x8B}, {0x041C, 0x8C}, {0x041D, 0x8D}, {0x041E, 0x8E}, {0x041F, 0x8F},
+    {0x0420, 0x90}, {0x0421, 0x91}, {0x0422, 0x92}, {0x0423, 0x93}, {0x0424, 0x94}, {0x0425, 0x95}, {0x0426, 0x96}, {0x0427, 0x97},
+    {0x0428, 0x98}, {0x0429, 0x99}, {0x042A, 0x9A}, {0x042B, 0x9B}, {0x042C, 0x9C}, {0x042D, 0x9D}, {0x042E, 0x9E}, {0x042F, 0x9F},
+    {0x0430, 0xA0}, {0x0431, 0xA1}, {0x0432, 0xA2}, {0x0433, 0xA3}, {0x0434, 0xA4}, {0x0435, 0xA5}, {0x0436, 0xA6}, {0x0437, 0xA7},
+    {0x0438, 0xA8}, {0x0439, 0xA9}, {0x043A, 0xAA}, {0x043B, 0xAB}, {0x043C, 0xAC}, {0x043D, 0xAD}, {0x043E, 0xAE}, {0x043F, 0xAF},
+    {0x0440, 0xE0}, {0x0441, 0xE1}, {0x0442, 0xE2}, {0x0443, 0xE3}, {0x0444, 0xE4}, {0x0445, 0xE5}, {0x0446, 0xE6}, {0x0447, 0xE7},
+    {0x0448, 0xE8}, {0x0449, 0xE9}, {0x044A, 0xEA}, {0x044B, 0xEB}, {0x044C, 0xEC}, {0x044D, 0xED}, {0x044E, 0xEE}, {0x044F, 0xEF},
+    {0x0451, 0xF1}, {0x0454, 0xF3}, {0x0457, 0xF5}, {0x045E, 0xF7}, {0x2116, 0xFC}, {0x2219, 0xF9}, {0x221A, 0xFB}, {0x2500, 0xC4},
+    {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2},
+    {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8},
+    {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4}, {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC},
+    {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC}, {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2},
+    {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0}, {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF},
+    {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD}, {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+const uint16_t cp737_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, /* 0x80 */
+    0x03A1, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, /* 0x90 */
+    0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3, 0x03C2, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x03C9, 0x03AC, 0x03AD, 0x03AE, 0x03CA, 0x03AF, 0x03CC, 0x03CD, 0x03CB, 0x03CE, 0x0386, 0x0388, 0x0389, 0x038A, 0x038C, 0x038E, /* 0xE0 */
+    0x038F, 0x00B1, 0x2265, 0x2264, 0x03AA, 0x03AB, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp737_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xFF}, {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B7, 0xFA}, {0x00F7, 0xF6}, {0x0386, 0xEA}, {0x0388, 0xEB},
+    {0x0389, 0xEC}, {0x038A, 0xED}, {0x038C, 0xEE}, {0x038E, 0xEF}, {0x038F, 0xF0}, {0x0391, 0x80}, {0x0392, 0x81}, {0x0393, 0x82},
+    {0x0394, 0x83}, {0x0395, 0x84}, {0x0396, 0x85}, {0x0397, 0x86}, {0x0398, 0x87}, {0x0399, 0x88}, {0x039A, 0x89}, {0x039B, 0x8A},
+    {0x039C, 0x8B}, {0x039D, 0x8C}, {0x039E, 0x8D}, {0x039F, 0x8E}, {0x03A0, 0x8F}, {0x03A1, 0x90}, {0x03A3, 0x91}, {0x03A4, 0x92},
+    {0x03A5, 0x93}, {0x03A6, 0x94}, {0x03A7, 0x95}, {0x03A8, 0x96}, {0x03A9, 0x97}, {0x03AA, 0xF4}, {0x03AB, 0xF5}, {0x03AC, 0xE1},
+    {0x03AD, 0xE2}, {0x03AE, 0xE3}, {0x03AF, 0xE5}, {0x03B1, 0x98}, {0x03B2, 0x99}, {0x03B3, 0x9A}, {0x03B4, 0x9B}, {0x03B5, 0x9C},
+    {0x03B6, 0x9D}, {0x03B7, 0x9E}, {0x03B8, 0x9F}, {0x03B9, 0xA0}, {0x03BA, 0xA1}, {0x03BB, 0xA2}, {0x03BC, 0xA3}, {0x03BD, 0xA4},
+    {0x03BE, 0xA5}, {0x03BF, 0xA6}, {0x03C0, 0xA7}, {0x03C1, 0xA8}, {0x03C2, 0xAA}, {0x03C3, 0xA9}, {0x03C4, 0xAB}, {0x03C5, 0xAC},
+    {0x03C6, 0xAD}, {0x03C7, 0xAE}, {0x03C8, 0xAF}, {0x03C9, 0xE0}, {0x03CA, 0xE4}, {0x03CB, 0xE8}, {0x03CC, 0xE6}, {0x03CD, 0xE7},
+    {0x03CE, 0xE9}, {0x207F, 0xFC}, {0x2219, 0xF9}, {0x221A, 0xFB}, {0x2248, 0xF7}, {0x2264, 0xF3}, {0x2265, 0xF2}, {0x2500, 0xC4},
+    {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2},
+    {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8},
+    {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4}, {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC},
+    {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC}, {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2},
+    {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0}, {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF},
+    {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD}, {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+const uint16_t cp855_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0452, 0x0402, 0x0453, 0x0403, 0x0451, 0x0401, 0x0454, 0x0404, 0x0455, 0x0405, 0x0456, 0x0406, 0x0457, 0x0407, 0x0458, 0x0408, /* 0x80 */
+    0x0459, 0x0409, 0x045A, 0x040A, 0x045B, 0x040B, 0x045C, 0x040C, 0x045E, 0x040E, 0x045F, 0x040F, 0x044E, 0x042E, 0x044A, 0x042A, /* 0x90 */
+    0x0430, 0x0410, 0x0431, 0x0411, 0x0446, 0x0426, 0x0434, 0x0414, 0x0435, 0x0415, 0x0444, 0x0424, 0x0433, 0x0413, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x0445, 0x0425, 0x0438, 0x0418, 0x2563, 0x2551, 0x2557, 0x255D, 0x0439, 0x0419, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x043A, 0x041A, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4, /* 0xC0 */
+    0x043B, 0x041B, 0x043C, 0x041C, 0x043D, 0x041D, 0x043E, 0x041E, 0x043F, 0x2518, 0x250C, 0x2588, 0x2584, 0x041F, 0x044F, 0x2580, /* 0xD0 */
+    0x042F, 0x0440, 0x0420, 0x0441, 0x0421, 0x0442, 0x0422, 0x0443, 0x0423, 0x0436, 0x0416, 0x0432, 0x0412, 0x044C, 0x042C, 0x2116, /* 0xE0 */
+    0x00AD, 0x044B, 0x042B, 0x0437, 0x0417, 0x0448, 0x0428, 0x044D, 0x042D, 0x0449, 0x0429, 0x0447, 0x0427, 0x00A7, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp855_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xFF}, {0x00A4, 0xCF}, {0x00A7, 0xFD}, {0x00AB, 0xAE}, {0x00AD, 0xF0}, {0x00BB, 0xAF}, {0x0401, 0x85}, {0x0402, 0x81},
+    {0x0403, 0x83}, {0x0404, 0x87}, {0x0405, 0x89}, {0x0406, 0x8B}, {0x0407, 0x8D}, {0x0408, 0x8F}, {0x0409, 0x91}, {0x040A, 0x93},
+    {0x040B, 0x95}, {0x040C, 0x97}, {0x040E, 0x99}, {0x040F, 0x9B}, {0x0410, 0xA1}, {0x0411, 0xA3}, {0x0412, 0xEC}, {0x0413, 0xAD},
+    {0x0414, 0xA7}, {0x0415, 0xA9}, {0x0416, 0xEA}, {0x0417, 0xF4}, {0x0418, 0xB8}, {0x0419, 0xBE}, {0x041A, 0xC7}, {0x041B, 0xD1},
+    {0x041C, 0xD3}, {0x041D, 0xD5}, {0x041E, 0xD7}, {0x041F, 0xDD}, {0x0420, 0xE2}, {0x0421, 0xE4}, {0x0422, 0xE6}, {0x0423, 0xE8},
+    {0x0424, 0xAB}, {0x0425, 0xB6}, {0x0426, 0xA5}, {0x0427, 0xFC}, {0x0428, 0xF6}, {0x0429, 0xFA}, {0x042A, 0x9F}, {0x042B, 0xF2},
+    {0x042C, 0xEE}, {0x042D, 0xF8}, {0x042E, 0x9D}, {0x042F, 0xE0}, {0x0430, 0xA0}, {0x0431, 0xA2}, {0x0432, 0xEB}, {0x0433, 0xAC},
+    {0x0434, 0xA6}, {0x0435, 0xA8}, {0x0436, 0xE9}, {0x0437, 0xF3}, {0x0438, 0xB7}, {0x0439, 0xBD}, {0x043A, 0xC6}, {0x043B, 0xD0},
+    {0x043C, 0xD2}, {0x043D, 0xD4}, {0x043E, 0xD6}, {0x043F, 0xD8}, {0x0440, 0xE1}, {0x0441, 0xE3}, {0x0442, 0xE5}, {0x0443, 0xE7},
+    {0x0444, 0xAA}, {0x0445, 0xB5}, {0x0446, 0xA4}, {0x0447, 0xFB}, {0x0448, 0xF5}, {0x0449, 0xF9}, {0x044A, 0x9E}, {0x044B, 0xF1},
+    {0x044C, 0xED}, {0x044D, 0xF7}, {0x044E, 0x9C}, {0x044F, 0xDE}, {0x0451, 0x84}, {0x0452, 0x80}, {0x0453, 0x82}, {0x0454, 0x86},
+    {0x0455, 0x88}, {0x0456, 0x8A}, {0x0457, 0x8C}, {0x0458, 0x8E}, {0x0459, 0x90}, {0x045A, 0x92}, {0x045B, 0x94}, {0x045C, 0x96},
+    {0x045E, 0x98}, {0x045F, 0x9A}, {0x2116, 0xEF}, {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0},
+    {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA},
+    {0x2554, 0xC9}, {0x2557, 0xBB}, {0x255A, 0xC8}, {0x255D, 0xBC}, {0x2560, 0xCC}, {0x2563, 0xB9}, {0x2566, 0xCB}, {0x2569, 0xCA},
+    {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+const uint16_t cp857_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x0131, 0x00C4, 0x00C5, /* 0x80 */
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x0130, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x015E, 0x015F, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x011E, 0x011F, 0x00BF, 0x00AE, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x00C0, 0x00A9, 0x2563, 0x2551, 0x2557, 0x255D, 0x00A2, 0x00A5, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x00E3, 0x00C3, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4, /* 0xC0 */
+    0x00BA, 0x00AA, 0x00CA, 0x00CB, 0x00C8, 0xFFFD, 0x00CD, 0x00CE, 0x00CF, 0x2518, 0x250C, 0x2588, 0x2584, 0x00A6, 0x00CC, 0x2580, /* 0xD0 */
+    0x00D3, 0x00DF, 0x00D4, 0x00D2, 0x00F5, 0x00D5, 0x00B5, 0xFFFD, 0x00D7, 0x00DA, 0x00DB, 0x00D9, 0x00EC, 0x00FF, 0x00AF, 0x00B4, /* 0xE0 */
+    0x00AD, 0x00B1, 0xFFFD, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp857_from_unicode[253] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A2, 0xBD}, {0x00A3, 0x9C}, {0x00A4, 0xCF}, {0x00A5, 0xBE}, {0x00A6, 0xDD}, {0x00A7, 0xF5},
+    {0x00A8, 0xF9}, {0x00A9, 0xB8}, {0x00AA, 0xD1}, {0x00AB, 0xAE}, {0x00AC, 0xAA}, {0x00AD, 0xF0}, {0x00AE, 0xA9}, {0x00AF, 0xEE},
+    {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B3, 0xFC}, {0x00B4, 0xEF}, {0x00B5, 0xE6}, {0x00B6, 0xF4}, {0x00B7, 0xFA},
+    {0x00B8, 0xF7}, {0x00B9, 0xFB}, {0x00BA, 0xD0}, {0x00BB, 0xAF}, {0x00BC, 0xAC}, {0x00BD, 0xAB}, {0x00BE, 0xF3}, {0x00BF, 0xA8},
+    {0x00C0, 0xB7}, {0x00C1, 0xB5}, {0x00C2, 0xB6}, {0x00C3, 0xC7}, {0x00C4, 0x8E}, {0x00C5, 0x8F}, {0x00C6, 0x92}, {0x00C7, 0x80},
+    {0x00C8, 0xD4}, {0x00C9, 0x90}, {0x00CA, 0xD2}, {0x00CB, 0xD3}, {0x00CC, 0xDE}, {0x00CD, 0xD6}, {0x00CE, 0xD7}, {0x00CF, 0xD8},
+    {0x00D1, 0xA5}, {0x00D2, 0xE3}, {0x00D3, 0xE0}, {0x00D4, 0xE2}, {0x00D5, 0xE5}, {0x00D6, 0x99}, {0x00D7, 0xE8}, {0x00D8, 0x9D},
+    {0x00D9, 0xEB}, {0x00DA, 0xE9}, {0x00DB, 0xEA}, {0x00DC, 0x9A}, {0x00DF, 0xE1}, {0x00E0, 0x85}, {0x00E1, 0xA0}, {0x00E2, 0x83},
+    {0x00E3, 0xC6}, {0x00E4, 0x84}, {0x00E5, 0x86}, {0x00E6, 0x91}, {0x00E7, 0x87}, {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88},
+    {0x00EB, 0x89}, {0x00EC, 0xEC}, {0x00ED, 0xA1}, {0x00EE, 0x8C}, {0x00EF, 0x8B}, {0x00F1, 0xA4}, {0x00F2, 0x95}, {0x00F3, 0xA2},
+    {0x00F4, 0x93}, {0x00F5, 0xE4}, {0x00F6, 0x94}, {0x00F7, 0xF6}, {0x00F8, 0x9B}, {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FB, 0x96},
+    {0x00FC, 0x81}, {0x00FF, 0xED}, {0x011E, 0xA6}, {0x011F, 0xA7}, {0x0130, 0x98}, {0x0131, 0x8D}, {0x015E, 0x9E}, {0x015F, 0x9F},
+    {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4},
+    {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2554, 0xC9}, {0x2557, 0xBB}, {0x255A, 0xC8},
+    {0x255D, 0xBC}, {0x2560, 0xCC}, {0x2563, 0xB9}, {0x2566, 0xCB}, {0x2569, 0xCA}, {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC},
+    {0x2588, 0xDB}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+const uint16_t cp865_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5, /* 0x80 */
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x00FF, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x20A7, 0x0192, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00A4, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229, /* 0xE0 */
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp865_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A3, 0x9C}, {0x00A4, 0xAF}, {0x00AA, 0xA6}, {0x00AB, 0xAE}, {0x00AC, 0xAA}, {0x00B0, 0xF8},
+    {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B5, 0xE6}, {0x00B7, 0xFA}, {0x00BA, 0xA7}, {0x00BC, 0xAC}, {0x00BD, 0xAB}, {0x00BF, 0xA8},
+    {0x00C4, 0x8E}, {0x00C5, 0x8F}, {0x00C6, 0x92}, {0x00C7, 0x80}, {0x00C9, 0x90}, {0x00D1, 0xA5}, {0x00D6, 0x99}, {0x00D8, 0x9D},
+    {0x00DC, 0x9A}, {0x00DF, 0xE1}, {0x00E0, 0x85}, {0x00E1, 0xA0}, {0x00E2, 0x83}, {0x00E4, 0x84}, {0x00E5, 0x86}, {0x00E6, 0x91},
+    {0x00E7, 0x87}, {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88}, {0x00EB, 0x89}, {0x00EC, 0x8D}, {0x00ED, 0xA1}, {0x00EE, 0x8C},
+    {0x00EF, 0x8B}, {0x00F1, 0xA4}, {0x00F2, 0x95}, {0x00F3, 0xA2}, {0x00F4, 0x93}, {0x00F6, 0x94}, {0x00F7, 0xF6}, {0x00F8, 0x9B},
+    {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FB, 0x96}, {0x00FC, 0x81}, {0x00FF, 0x98}, {0x0192, 0x9F}, {0x0393, 0xE2}, {0x0398, 0xE9},
+    {0x03A3, 0xE4}, {0x03A6, 0xE8}, {0x03A9, 0xEA}, {0x03B1, 0xE0}, {0x03B4, 0xEB}, {0x03B5, 0xEE}, {0x03C0, 0xE3}, {0x03C3, 0xE5},
+    {0x03C4, 0xE7}, {0x03C6, 0xED}, {0x207F, 0xFC}, {0x20A7, 0x9E}, {0x2219, 0xF9}, {0x221A, 0xFB}, {0x221E, 0xEC}, {0x2229, 0xEF},
+    {0x2248, 0xF7}, {0x2261, 0xF0}, {0x2264, 0xF3}, {0x2265, 0xF2}, {0x2310, 0xA9}, {0x2320, 0xF4}, {0x2321, 0xF5}, {0x2500, 0xC4},
+    {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2},
+    {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8},
+    {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4}, {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC},
+    {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC}, {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2},
+    {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0}, {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF},
+    {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD}, {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+const uint16_t cp858_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5, /* 0x80 */
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x00FF, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x00D7, 0x0192, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x00AE, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x00C0, 0x00A9, 0x2563, 0x2551, 0x2557, 0x255D, 0x00A2, 0x00A5, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x00E3, 0x00C3, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4, /* 0xC0 */
+    0x00F0, 0x00D0, 0x00CA, 0x00CB, 0x00C8, 0x20AC, 0x00CD, 0x00CE, 0x00CF, 0x2518, 0x250C, 0x2588, 0x2584, 0x00A6, 0x00CC, 0x2580, /* 0xD0 */
+    0x00D3, 0x00DF, 0x00D4, 0x00D2, 0x00F5, 0x00D5, 0x00B5, 0x00FE, 0x00DE, 0x00DA, 0x00DB, 0x00D9, 0x00FD, 0x00DD, 0x00AF, 0x00B4, /* 0xE0 */
+    0x00AD, 0x00B1, 0x2017, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp858_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A2, 0xBD}, {0x00A3, 0x9C}, {0x00A4, 0xCF}, {0x00A5, 0xBE}, {0x00A6, 0xDD}, {0x00A7, 0xF5},
+    {0x00A8, 0xF9}, {0x00A9, 0xB8}, {0x00AA, 0xA6}, {0x00AB, 0xAE}, {0x00AC, 0xAA}, {0x00AD, 0xF0}, {0x00AE, 0xA9}, {0x00AF, 0xEE},
+    {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B3, 0xFC}, {0x00B4, 0xEF}, {0x00B5, 0xE6}, {0x00B6, 0xF4}, {0x00B7, 0xFA},
+    {0x00B8, 0xF7}, {0x00B9, 0xFB}, {0x00BA, 0xA7}, {0x00BB, 0xAF}, {0x00BC, 0xAC}, {0x00BD, 0xAB}, {0x00BE, 0xF3}, {0x00BF, 0xA8},
+    {0x00C0, 0xB7}, {0x00C1, 0xB5}, {0x00C2, 0xB6}, {0x00C3, 0xC7}, {0x00C4, 0x8E}, {0x00C5, 0x8F}, {0x00C6, 0x92}, {0x00C7, 0x80},
+    {0x00C8, 0xD4}, {0x00C9, 0x90}, {0x00CA, 0xD2}, {0x00CB, 0xD3}, {0x00CC, 0xDE}, {0x00CD, 0xD6}, {0x00CE, 0xD7}, {0x00CF, 0xD8},
+    {0x00D0, 0xD1}, {0x00D1, 0xA5}, {0x00D2, 0xE3}, {0x00D3, 0xE0}, {0x00D4, 0xE2}, {0x00D5, 0xE5}, {0x00D6, 0x99}, {0x00D7, 0x9E},
+    {0x00D8, 0x9D}, {0x00D9, 0xEB}, {0x00DA, 0xE9}, {0x00DB, 0xEA}, {0x00DC, 0x9A}, {0x00DD, 0xED}, {0x00DE, 0xE8}, {0x00DF, 0xE1},
+    {0x00E0, 0x85}, {0x00E1, 0xA0}, {0x00E2, 0x83}, {0x00E3, 0xC6}, {0x00E4, 0x84}, {0x00E5, 0x86}, {0x00E6, 0x91}, {0x00E7, 0x87},
+    {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88}, {0x00EB, 0x89}, {0x00EC, 0x8D}, {0x00ED, 0xA1}, {0x00EE, 0x8C}, {0x00EF, 0x8B},
+    {0x00F0, 0xD0}, {0x00F1, 0xA4}, {0x00F2, 0x95}, {0x00F3, 0xA2}, {0x00F4, 0x93}, {0x00F5, 0xE4}, {0x00F6, 0x94}, {0x00F7, 0xF6},
+    {0x00F8, 0x9B}, {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FB, 0x96}, {0x00FC, 0x81}, {0x00FD, 0xEC}, {0x00FE, 0xE7}, {0x00FF, 0x98},
+    {0x0192, 0x9F}, {0x2017, 0xF2}, {0x20AC, 0xD5}, {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0},
+    {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA},
+    {0x2554, 0xC9}, {0x2557, 0xBB}, {0x255A, 0xC8}, {0x255D, 0xBC}, {0x2560, 0xCC}, {0x2563, 0xB9}, {0x2566, 0xCB}, {0x2569, 0xCA},
+    {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+const uint16_t cp860_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E3, 0x00E0, 0x00C1, 0x00E7, 0x00EA, 0x00CA, 0x00E8, 0x00CD, 0x00D4, 0x00EC, 0x00C3, 0x00C2, /* 0x80 */
+    0x00C9, 0x00C0, 0x00C8, 0x00F4, 0x00F5, 0x00F2, 0x00DA, 0x00F9, 0x00CC, 0x00D5, 0x00DC, 0x00A2, 0x00A3, 0x00D9, 0x20A7, 0x00D3, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x00D2, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229, /* 0xE0 */
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp860_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A2, 0x9B}, {0x00A3, 0x9C}, {0x00AA, 0xA6}, {0x00AB, 0xAE}, {0x00AC, 0xAA}, {0x00B0, 0xF8},
+    {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B5, 0xE6}, {0x00B7, 0xFA}, {0x00BA, 0xA7}, {0x00BB, 0xAF}, {0x00BC, 0xAC}, {0x00BD, 0xAB},
+    {0x00BF, 0xA8}, {0x00C0, 0x91}, {0x00C1, 0x86}, {0x00C2, 0x8F}, {0x00C3, 0x8E}, {0x00C7, 0x80}, {0x00C8, 0x92}, {0x00C9, 0x90},
+    {0x00CA, 0x89}, {0x00CC, 0x98}, {0x00CD, 0x8B}, {0x00D1, 0xA5}, {0x00D2, 0xA9}, {0x00D3, 0x9F}, {0x00D4, 0x8C}, {0x00D5, 0x99},
+    {0x00D9, 0x9D}, {0x00DA, 0x96}, {0x00DC, 0x9A}, {0x00DF, 0xE1}, {0x00E0, 0x85}, {0x00E1, 0xA0}, {0x00E2, 0x83}, {0x00E3, 0x84},
+    {0x00E7, 0x87}, {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88}, {0x00EC, 0x8D}, {0x00ED, 0xA1}, {0x00F1, 0xA4}, {0x00F2, 0x95},
+    {0x00F3, 0xA2}, {0x00F4, 0x93}, {0x00F5, 0x94}, {0x00F7, 0xF6}, {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FC, 0x81}, {0x0393, 0xE2},
+    {0x0398, 0xE9}, {0x03A3, 0xE4}, {0x03A6, 0xE8}, {0x03A9, 0xEA}, {0x03B1, 0xE0}, {0x03B4, 0xEB}, {0x03B5, 0xEE}, {0x03C0, 0xE3},
+    {0x03C3, 0xE5}, {0x03C4, 0xE7}, {0x03C6, 0xED}, {0x207F, 0xFC}, {0x20A7, 0x9E}, {0x2219, 0xF9}, {0x221A, 0xFB}, {0x221E, 0xEC},
+    {0x2229, 0xEF}, {0x2248, 0xF7}, {0x2261, 0xF0}, {0x2264, 0xF3}, {0x2265, 0xF2}, {0x2320, 0xF4}, {0x2321, 0xF5}, {0x2500, 0xC4},
+    {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2},
+    {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8},
+    {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4}, {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC},
+    {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC}, {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2},
+    {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0}, {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF},
+    {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD}, {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+const uint16_t cp861_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00D0, 0x00F0, 0x00DE, 0x00C4, 0x00C5, /* 0x80 */
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00FE, 0x00FB, 0x00DD, 0x00FD, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x20A7, 0x0192, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00C1, 0x00CD, 0x00D3, 0x00DA, 0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229, /* 0xE0 */
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp861_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A3, 0x9C}, {0x00AB, 0xAE}, {0x00AC, 0xAA}, {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD},
+    {0x00B5, 0xE6}, {0x00B7, 0xFA}, {0x00BB, 0xAF}, {0x00BC, 0xAC}, {0x00BD, 0xAB}, {0x00BF, 0xA8}, {0x00C1, 0xA4}, {0x00C4, 0x8E},
+    {0x00C5, 0x8F}, {0x00C6, 0x92}, {0x00C7, 0x80}, {0x00C9, 0x90}, {0x00CD, 0xA5}, {0x00D0, 0x8B}, {0x00D3, 0xA6}, {0x00D6, 0x99},
+    {0x00D8, 0x9D}, {0x00DA, 0xA7}, {0x00DC, 0x9A}, {0x00DD, 0x97}, {0x00DE, 0x8D}, {0x00DF, 0xE1}, {0x00E0, 0x85}, {0x00E1, 0xA0},
+    {0x00E2, 0x83}, {0x00E4, 0x84}, {0x00E5, 0x86}, {0x00E6, 0x91}, {0x00E7, 0x87}, {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88},
+    {0x00EB, 0x89}, {0x00ED, 0xA1}, {0x00F0, 0x8C}, {0x00F3, 0xA2}, {0x00F4, 0x93}, {0x00F6, 0x94}, {0x00F7, 0xF6}, {0x00F8, 0x9B},
+    {0x00FA, 0xA3}, {0x00FB, 0x96}, {0x00FC, 0x81}, {0x00FD, 0x98}, {0x00FE, 0x95}, {0x0192, 0x9F}, {0x0393, 0xE2}, {0x0398, 0xE9},
+    {0x03A3, 0xE4}, {0x03A6, 0xE8}, {0x03A9, 0xEA}, {0x03B1, 0xE0}, {0x03B4, 0xEB}, {0x03B5, 0xEE}, {0x03C0, 0xE3}, {0x03C3, 0xE5},
+    {0x03C4, 0xE7}, {0x03C6, 0xED}, {0x207F, 0xFC}, {0x20A7, 0x9E}, {0x2219, 0xF9}, {0x221A, 0xFB}, {0x221E, 0xEC}, {0x2229, 0xEF},
+    {0x2248, 0xF7}, {0x2261, 0xF0}, {0x2264, 0xF3}, {0x2265, 0xF2}, {0x2310, 0xA9}, {0x2320, 0xF4}, {0x2321, 0xF5}, {0x2500, 0xC4},
+    {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2},
+    {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8},
+    {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4}, {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC},
+    {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC}, {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2},
+    {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0}, {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF},
+    {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD}, {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+const uint16_t cp862_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF, /* 0x80 */
+    0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229, /* 0xE0 */
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp862_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A2, 0x9B}, {0x00A3, 0x9C}, {0x00A5, 0x9D}, {0x00AA, 0xA6}, {0x00AB, 0xAE}, {0x00AC, 0xAA},
+    {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B5, 0xE6}, {0x00B7, 0xFA}, {0x00BA, 0xA7}, {0x00BB, 0xAF}, {0x00BC, 0xAC},
+    {0x00BD, 0xAB}, {0x00BF, 0xA8}, {0x00D1, 0xA5}, {0x00DF, 0xE1}, {0x00E1, 0xA0}, {0x00ED, 0xA1}, {0x00F1, 0xA4}, {0x00F3, 0xA2},
+    {0x00F7, 0xF6}, {0x00FA, 0xA3}, {0x0192, 0x9F}, {0x0393, 0xE2}, {0x0398, 0xE9}, {0x03A3, 0xE4}, {0x03A6, 0xE8}, {0x03A9, 0xEA},
+    {0x03B1, 0xE0}, {0x03B4, 0xEB}, {0x03B5, 0xEE}, {0x03C0, 0xE3}, {0x03C3, 0xE5}, {0x03C4, 0xE7}, {0x03C6, 0xED}, {0x05D0, 0x80},
+    {0x05D1, 0x81}, {0x05D2, 0x82}, {0x05D3, 0x83}, {0x05D4, 0x84}, {0x05D5, 0x85}, {0x05D6, 0x86}, {0x05D7, 0x87}, {0x05D8, 0x88},
+    {0x05D9, 0x89}, {0x05DA, 0x8A}, {0x05DB, 0x8B}, {0x05DC, 0x8C}, {0x05DD, 0x8D}, {0x05DE, 0x8E}, {0x05DF, 0x8F}, {0x05E0, 0x90},
+    {0x05E1, 0x91}, {0x05E2, 0x92}, {0x05E3, 0x93}, {0x05E4, 0x94}, {0x05E5, 0x95}, {0x05E6, 0x96}, {0x05E7, 0x97}, {0x05E8, 0x98},
+    {0x05E9, 0x99}, {0x05EA, 0x9A}, {0x207F, 0xFC}, {0x20A7, 0x9E}, {0x2219, 0xF9}, {0x221A, 0xFB}, {0x221E, 0xEC}, {0x2229, 0xEF},
+    {0x2248, 0xF7}, {0x2261, 0xF0}, {0x2264, 0xF3}, {0x2265, 0xF2}, {0x2310, 0xA9}, {0x2320, 0xF4}, {0x2321, 0xF5}, {0x2500, 0xC4},
+    {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2},
+    {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8},
+    {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4}, {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC},
+    {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC}, {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2},
+    {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0}, {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF},
+    {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD}, {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+const uint16_t cp863_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00C2, 0x00E0, 0x00B6, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x2017, 0x00C0, 0x00A7, /* 0x80 */
+    0x00C9, 0x00C8, 0x00CA, 0x00F4, 0x00CB, 0x00CF, 0x00FB, 0x00F9, 0x00A4, 0x00D4, 0x00DC, 0x00A2, 0x00A3, 0x00D9, 0x00DB, 0x0192, /* 0x90 */
+    0x00A6, 0x00B4, 0x00F3, 0x00FA, 0x00A8, 0x00B8, 0x00B3, 0x00AF, 0x00CE, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00BE, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229, /* 0xE0 */
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp863_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xFF}, {0x00A2, 0x9B}, {0x00A3, 0x9C}, {0x00A4, 0x98}, {0x00A6, 0xA0}, {0x00A7, 0x8F}, {0x00A8, 0xA4}, {0x00AB, 0xAE},
+    {0x00AC, 0xAA}, {0x00AF, 0xA7}, {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B3, 0xA6}, {0x00B4, 0xA1}, {0x00B5, 0xE6},
+    {0x00B6, 0x86}, {0x00B7, 0xFA}, {0x00B8, 0xA5}, {0x00BB, 0xAF}, {0x00BC, 0xAC}, {0x00BD, 0xAB}, {0x00BE, 0xAD}, {0x00C0, 0x8E},
+    {0x00C2, 0x84}, {0x00C7, 0x80}, {0x00C8, 0x91}, {0x00C9, 0x90}, {0x00CA, 0x92}, {0x00CB, 0x94}, {0x00CE, 0xA8}, {0x00CF, 0x95},
+    {0x00D4, 0x99}, {0x00D9, 0x9D}, {0x00DB, 0x9E}, {0x00DC, 0x9A}, {0x00DF, 0xE1}, {0x00E0, 0x85}, {0x00E2, 0x83}, {0x00E7, 0x87},
+    {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88}, {0x00EB, 0x89}, {0x00EE, 0x8C}, {0x00EF, 0x8B}, {0x00F3, 0xA2}, {0x00F4, 0x93},
+    {0x00F7, 0xF6}, {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FB, 0x96}, {0x00FC, 0x81}, {0x0192, 0x9F}, {0x0393, 0xE2}, {0x0398, 0xE9},
+    {0x03A3, 0xE4}, {0x03A6, 0xE8}, {0x03A9, 0xEA}, {0x03B1, 0xE0}, {0x03B4, 0xEB}, {0x03B5, 0xEE}, {0x03C0, 0xE3}, {0x03C3, 0xE5},
+    {0x03C4, 0xE7}, {0x03C6, 0xED}, {0x2017, 0x8D}, {0x207F, 0xFC}, {0x2219, 0xF9}, {0x221A, 0xFB}, {0x221E, 0xEC}, {0x2229, 0xEF},
+    {0x2248, 0xF7}, {0x2261, 0xF0}, {0x2264, 0xF3}, {0x2265, 0xF2}, {0x2310, 0xA9}, {0x2320, 0xF4}, {0x2321, 0xF5}, {0x2500, 0xC4},
+    {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2},
+    {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8},
+    {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4}, {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC},
+    {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC}, {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2},
+    {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0}, {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF},
+    {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD}, {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+const uint16_t cp864_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x066A, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00B0, 0x00B7, 0x2219, 0x221A, 0x2592, 0x2500, 0x2502, 0x253C, 0x2524, 0x252C, 0x251C, 0x2534, 0x2510, 0x250C, 0x2514, 0x2518, /* 0x80 */
+    0x03B2, 0x221E, 0x03C6, 0x00B1, 0x00BD, 0x00BC, 0x2248, 0x00AB, 0x00BB, 0xFEF7, 0xFEF8, 0xFFFD, 0xFFFD, 0xFEFB, 0xFEFC, 0xFFFD, /* 0x90 */
+    0x00A0, 0x00AD, 0xFE82, 0x00A3, 0x00A4, 0xFE84, 0xFFFD, 0xFFFD, 0xFE8E, 0xFE8F, 0xFE95, 0xFE99, 0x060C, 0xFE9D, 0xFEA1, 0xFEA5, /* 0xA0 */
+    0x0660, 0x0661, 0x0662, 0x0663, 0x0664, 0x0665, 0x0666, 0x0667, 0x0668, 0x0669, 0xFED1, 0x061B, 0xFEB1, 0xFEB5, 0xFEB9, 0x061F, /* 0xB0 */
+    0x00A2, 0xFE80, 0xFE81, 0xFE83, 0xFE85, 0xFECA, 0xFE8B, 0xFE8D, 0xFE91, 0xFE93, 0xFE97, 0xFE9B, 0xFE9F, 0xFEA3, 0xFEA7, 0xFEA9, /* 0xC0 */
+    0xFEAB, 0xFEAD, 0xFEAF, 0xFEB3, 0xFEB7, 0xFEBB, 0xFEBF, 0xFEC1, 0xFEC5, 0xFECB, 0xFECF, 0x00A6, 0x00AC, 0x00F7, 0x00D7, 0xFEC9, /* 0xD0 */
+    0x0640, 0xFED3, 0xFED7, 0xFEDB, 0xFEDF, 0xFEE3, 0xFEE7, 0xFEEB, 0xFEED, 0xFEEF, 0xFEF3, 0xFEBD, 0xFECC, 0xFECE, 0xFECD, 0xFEE1, /* 0xE0 */
+    0xFE7D, 0x0651, 0xFEE5, 0xFEE9, 0xFEEC, 0xFEF0, 0xFEF2, 0xFED0, 0xFED5, 0xFEF5, 0xFEF6, 0xFEDD, 0xFED9, 0xFEF1, 0x25A0, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp864_from_unicode[250] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0026, 0x26}, {0x0027, 0x27}, {0x0028, 0x28},
+    {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F}, {0x0030, 0x30},
+    {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37}, {0x0038, 0x38},
+    {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F}, {0x0040, 0x40},
+    {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47}, {0x0048, 0x48},
+    {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F}, {0x0050, 0x50},
+    {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57}, {0x0058, 0x58},
+    {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F}, {0x0060, 0x60},
+    {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67}, {0x0068, 0x68},
+    {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F}, {0x0070, 0x70},
+    {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77}, {0x0078, 0x78},
+    {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F}, {0x00A0, 0xA0},
+    {0x00A2, 0xC0}, {0x00A3, 0xA3}, {0x00A4, 0xA4}, {0x00A6, 0xDB}, {0x00AB, 0x97}, {0x00AC, 0xDC}, {0x00AD, 0xA1}, {0x00B0, 0x80},
+    {0x00B1, 0x93}, {0x00B7, 0x81}, {0x00BB, 0x98}, {0x00BC, 0x95}, {0x00BD, 0x94}, {0x00D7, 0xDE}, {0x00F7, 0xDD}, {0x03B2, 0x90},
+    {0x03C6, 0x92}, {0x060C, 0xAC}, {0x061B, 0xBB}, {0x061F, 0xBF}, {0x0640, 0xE0}, {0x0651, 0xF1}, {0x0660, 0xB0}, {0x0661, 0xB1},
+    {0x0662, 0xB2}, {0x0663, 0xB3}, {0x0664, 0xB4}, {0x0665, 0xB5}, {0x0666, 0xB6}, {0x0667, 0xB7}, {0x0668, 0xB8}, {0x0669, 0xB9},
+    {0x066A, 0x25}, {0x2219, 0x82}, {0x221A, 0x83}, {0x221E, 0x91}, {0x2248, 0x96}, {0x2500, 0x85}, {0x2502, 0x86}, {0x250C, 0x8D},
+    {0x2510, 0x8C}, {0x2514, 0x8E}, {0x2518, 0x8F}, {0x251C, 0x8A}, {0x2524, 0x88}, {0x252C, 0x89}, {0x2534, 0x8B}, {0x253C, 0x87},
+    {0x2592, 0x84}, {0x25A0, 0xFE}, {0xFE7D, 0xF0}, {0xFE80, 0xC1}, {0xFE81, 0xC2}, {0xFE82, 0xA2}, {0xFE83, 0xC3}, {0xFE84, 0xA5},
+    {0xFE85, 0xC4}, {0xFE8B, 0xC6}, {0xFE8D, 0xC7}, {0xFE8E, 0xA8}, {0xFE8F, 0xA9}, {0xFE91, 0xC8}, {0xFE93, 0xC9}, {0xFE95, 0xAA},
+    {0xFE97, 0xCA}, {0xFE99, 0xAB}, {0xFE9B, 0xCB}, {0xFE9D, 0xAD}, {0xFE9F, 0xCC}, {0xFEA1, 0xAE}, {0xFEA3, 0xCD}, {0xFEA5, 0xAF},
+    {0xFEA7, 0xCE}, {0xFEA9, 0xCF}, {0xFEAB, 0xD0}, {0xFEAD, 0xD1}, {0xFEAF, 0xD2}, {0xFEB1, 0xBC}, {0xFEB3, 0xD3}, {0xFEB5, 0xBD},
+    {0xFEB7, 0xD4}, {0xFEB9, 0xBE}, {0xFEBB, 0xD5}, {0xFEBD, 0xEB}, {0xFEBF, 0xD6}, {0xFEC1, 0xD7}, {0xFEC5, 0xD8}, {0xFEC9, 0xDF},
+    {0xFECA, 0xC5}, {0xFECB, 0xD9}, {0xFECC, 0xEC}, {0xFECD, 0xEE}, {0xFECE, 0xED}, {0xFECF, 0xDA}, {0xFED0, 0xF7}, {0xFED1, 0xBA},
+    {0xFED3, 0xE1}, {0xFED5, 0xF8}, {0xFED7, 0xE2}, {0xFED9, 0xFC}, {0xFEDB, 0xE3}, {0xFEDD, 0xFB}, {0xFEDF, 0xE4}, {0xFEE1, 0xEF},
+    {0xFEE3, 0xE5}, {0xFEE5, 0xF2}, {0xFEE7, 0xE6}, {0xFEE9, 0xF3}, {0xFEEB, 0xE7}, {0xFEEC, 0xF4}, {0xFEED, 0xE8}, {0xFEEF, 0xE9},
+    {0xFEF0, 0xF5}, {0xFEF1, 0xFD}, {0xFEF2, 0xF6}, {0xFEF3, 0xEA}, {0xFEF5, 0xF9}, {0xFEF6, 0xFA}, {0xFEF7, 0x99}, {0xFEF8, 0x9A},
+    {0xFEFB, 0x9D}, {0xFEFC, 0x9E},
+};
+
+const uint16_t cp869_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x0386, 0xFFFD, 0x00B7, 0x00AC, 0x00A6, 0x2018, 0x2019, 0x0388, 0x2015, 0x0389, /* 0x80 */
+    0x038A, 0x03AA, 0x038C, 0xFFFD, 0xFFFD, 0x038E, 0x03AB, 0x00A9, 0x038F, 0x00B2, 0x00B3, 0x03AC, 0x00A3, 0x03AD, 0x03AE, 0x03AF, /* 0x90 */
+    0x03CA, 0x0390, 0x03CC, 0x03CD, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x00BD, 0x0398, 0x0399, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x039A, 0x039B, 0x039C, 0x039D, 0x2563, 0x2551, 0x2557, 0x255D, 0x039E, 0x039F, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x03A0, 0x03A1, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x03A3, /* 0xC0 */
+    0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x2518, 0x250C, 0x2588, 0x2584, 0x03B4, 0x03B5, 0x2580, /* 0xD0 */
+    0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3, 0x03C2, 0x03C4, 0x0384, /* 0xE0 */
+    0x00AD, 0x00B1, 0x03C5, 0x03C6, 0x03C7, 0x00A7, 0x03C8, 0x0385, 0x00B0, 0x00A8, 0x03C9, 0x03CB, 0x03B0, 0x03CE, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp869_from_unicode[247] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xFF}, {0x00A3, 0x9C}, {0x00A6, 0x8A}, {0x00A7, 0xF5}, {0x00A8, 0xF9}, {0x00A9, 0x97}, {0x00AB, 0xAE}, {0x00AC, 0x89},
+    {0x00AD, 0xF0}, {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0x99}, {0x00B3, 0x9A}, {0x00B7, 0x88}, {0x00BB, 0xAF}, {0x00BD, 0xAB},
+    {0x0384, 0xEF}, {0x0385, 0xF7}, {0x0386, 0x86}, {0x0388, 0x8D}, {0x0389, 0x8F}, {0x038A, 0x90}, {0x038C, 0x92}, {0x038E, 0x95},
+    {0x038F, 0x98}, {0x0390, 0xA1}, {0x0391, 0xA4}, {0x0392, 0xA5}, {0x0393, 0xA6}, {0x0394, 0xA7}, {0x0395, 0xA8}, {0x0396, 0xA9},
+    {0x0397, 0xAA}, {0x0398, 0xAC}, {0x0399, 0xAD}, {0x039A, 0xB5}, {0x039B, 0xB6}, {0x039C, 0xB7}, {0x039D, 0xB8}, {0x039E, 0xBD},
+    {0x039F, 0xBE}, {0x03A0, 0xC6}, {0x03A1, 0xC7}, {0x03A3, 0xCF}, {0x03A4, 0xD0}, {0x03A5, 0xD1}, {0x03A6, 0xD2}, {0x03A7, 0xD3},
+    {0x03A8, 0xD4}, {0x03A9, 0xD5}, {0x03AA, 0x91}, {0x03AB, 0x96}, {0x03AC, 0x9B}, {0x03AD, 0x9D}, {0x03AE, 0x9E}, {0x03AF, 0x9F},
+    {0x03B0, 0xFC}, {0x03B1, 0xD6}, {0x03B2, 0xD7}, {0x03B3, 0xD8}, {0x03B4, 0xDD}, {0x03B5, 0xDE}, {0x03B6, 0xE0}, {0x03B7, 0xE1},
+    {0x03B8, 0xE2}, {0x03B9, 0xE3}, {0x03BA, 0xE4}, {0x03BB, 0xE5}, {0x03BC, 0xE6}, {0x03BD, 0xE7}, {0x03BE, 0xE8}, {0x03BF, 0xE9},
+    {0x03C0, 0xEA}, {0x03C1, 0xEB}, {0x03C2, 0xED}, {0x03C3, 0xEC}, {0x03C4, 0xEE}, {0x03C5, 0xF2}, {0x03C6, 0xF3}, {0x03C7, 0xF4},
+    {0x03C8, 0xF6}, {0x03C9, 0xFA}, {0x03CA, 0xA0}, {0x03CB, 0xFB}, {0x03CC, 0xA2}, {0x03CD, 0xA3}, {0x03CE, 0xFD}, {0x2015, 0x8E},
+    {0x2018, 0x8B}, {0x2019, 0x8C}, {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9},
+    {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2554, 0xC9},
+    {0x2557, 0xBB}, {0x255A, 0xC8}, {0x255D, 0xBC}, {0x2560, 0xCC}, {0x2563, 0xB9}, {0x2566, 0xCB}, {0x2569, 0xCA}, {0x256C, 0xCE},
+    {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+const uint16_t cp850_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5, /* 0x80 */
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x00FF, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x00D7, 0x0192, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x00AE, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x00C0, 0x00A9, 0x2563, 0x2551, 0x2557, 0x255D, 0x00A2, 0x00A5, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x00E3, 0x00C3, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4, /* 0xC0 */
+    0x00F0, 0x00D0, 0x00CA, 0x00CB, 0x00C8, 0x0131, 0x00CD, 0x00CE, 0x00CF, 0x2518, 0x250C, 0x2588, 0x2584, 0x00A6, 0x00CC, 0x2580, /* 0xD0 */
+    0x00D3, 0x00DF, 0x00D4, 0x00D2, 0x00F5, 0x00D5, 0x00B5, 0x00FE, 0x00DE, 0x00DA, 0x00DB, 0x00D9, 0x00FD, 0x00DD, 0x00AF, 0x00B4, /* 0xE0 */
+    0x00AD, 0x00B1, 0x2017, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp850_doc_from_unicode[254] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E},
+    {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66},
+    {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E},
+    {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76},
+    {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A2, 0xBD}, {0x00A3, 0x9C}, {0x00A4, 0xCF}, {0x00A5, 0xBE}, {0x00A6, 0xDD}, {0x00A7, 0xF5},
+    {0x00A8, 0xF9}, {0x00A9, 0xB8}, {0x00AA, 0xA6}, {0x00AB, 0xAE}, {0x00AC, 0xAA}, {0x00AD, 0xF0}, {0x00AE, 0xA9}, {0x00AF, 0xEE},
+    {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B3, 0xFC}, {0x00B4, 0xEF}, {0x00B5, 0xE6}, {0x00B6, 0xF4}, {0x00B7, 0xFA},
+    {0x00B8, 0xF7}, {0x00B9, 0xFB}, {0x00BA, 0xA7}, {0x00BB, 0xAF}, {0x00BC, 0xAC}, {0x00BD, 0xAB}, {0x00BE, 0xF3}, {0x00BF, 0xA8},
+    {0x00C0, 0xB7}, {0x00C1, 0xB5}, {0x00C2, 0xB6}, {0x00C3, 0xC7}, {0x00C4, 0x8E}, {0x00C5, 0x8F}, {0x00C6, 0x92}, {0x00C7, 0x80},
+    {0x00C8, 0xD4}, {0x00C9, 0x90}, {0x00CA, 0xD2}, {0x00CB, 0xD3}, {0x00CC, 0xDE}, {0x00CD, 0xD6}, {0x00CE, 0xD7}, {0x00CF, 0xD8},
+    {0x00D0, 0xD1}, {0x00D1, 0xA5}, {0x00D2, 0xE3}, {0x00D3, 0xE0}, {0x00D4, 0xE2}, {0x00D5, 0xE5}, {0x00D6, 0x99}, {0x00D7, 0x9E},
+    {0x00D8, 0x9D}, {0x00D9, 0xEB}, {0x00DA, 0xE9}, {0x00DB, 0xEA}, {0x00DC, 0x9A}, {0x00DD, 0xED}, {0x00DE, 0xE8}, {0x00DF, 0xE1},
+    {0x00E0, 0x85}, {0x00E1, 0xA0}, {0x00E2, 0x83}, {0x00E3, 0xC6}, {0x00E4, 0x84}, {0x00E5, 0x86}, {0x00E6, 0x91}, {0x00E7, 0x87},
+    {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88}, {0x00EB, 0x89}, {0x00EC, 0x8D}, {0x00ED, 0xA1}, {0x00EE, 0x8C}, {0x00EF, 0x8B},
+    {0x00F0, 0xD0}, {0x00F1, 0xA4}, {0x00F2, 0x95}, {0x00F3, 0xA2}, {0x00F4, 0x93}, {0x00F5, 0xE4}, {0x00F6, 0x94}, {0x00F7, 0xF6},
+    {0x00F8, 0x9B}, {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FB, 0x96}, {0x00FC, 0x81}, {0x00FD, 0xEC}, {0x00FE, 0xE7}, {0x00FF, 0x98},
+    {0x0131, 0xD5}, {0x0192, 0x9F}, {0x2017, 0xF2}, {0x2022, 0x07}, {0x203C, 0x13}, {0x2190, 0x1B}, {0x2191, 0x18}, {0x2192, 0x1A},
+    {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17}, {0x221F, 0x1C}, {0x2302, 0x7F}, {0x2500, 0xC4}, {0x2502, 0xB3},
+    {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1},
+    {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2554, 0xC9}, {0x2557, 0xBB}, {0x255A, 0xC8}, {0x255D, 0xBC}, {0x2560, 0xCC},
+    {0x2563, 0xB9}, {0x2566, 0xCB}, {0x2569, 0xCA}, {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x2591, 0xB0},
+    {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE}, {0x25AC, 0x16}, {0x25B2, 0x1E}, {0x25BA, 0x10}, {0x25BC, 0x1F}, {0x25C4, 0x11},
+    {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A}, {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F}, {0x2640, 0x0C}, {0x2642, 0x0B},
+    {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04}, {0x266A, 0x0D}, {0x266B, 0x0E},
+};
+
+const uint16_t cp852_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x016F, 0x0107, 0x00E7, 0x0142, 0x00EB, 0x0150, 0x0151, 0x00EE, 0x0179, 0x00C4, 0x0106, /* 0x80 */
+    0x00C9, 0x0139, 0x013A, 0x00F4, 0x00F6, 0x013D, 0x013E, 0x015A, 0x015B, 0x00D6, 0x00DC, 0x0164, 0x0165, 0x0141, 0x00D7, 0x010D, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x0104, 0x0105, 0x017D, 0x017E, 0x0118, 0x0119, 0x00AC, 0x017A, 0x010C, 0x015F, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x011A, 0x015E, 0x2563, 0x2551, 0x2557, 0x255D, 0x017B, 0x017C, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x0102, 0x0103, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4, /* 0xC0 */
+    0x0111, 0x0110, 0x010E, 0x00CB, 0x010F, 0x0147, 0x00CD, 0x00CE, 0x011B, 0x2518, 0x250C, 0x2588, 0x2584, 0x0162, 0x016E, 0x2580, /* 0xD0 */
+    0x00D3, 0x00DF, 0x00D4, 0x0143, 0x0144, 0x0148, 0x0160, 0x0161, 0x0154, 0x00DA, 0x0155, 0x0170, 0x00FD, 0x00DD, 0x0163, 0x00B4, /* 0xE0 */
+    0x00AD, 0x02DD, 0x02DB, 0x02C7, 0x02D8, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x02D9, 0x0171, 0x0158, 0x0159, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp852_doc_from_unicode[255] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E},
+    {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66},
+    {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E},
+    {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76},
+    {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E},
+    {0x00A0, 0xFF}, {0x00A4, 0xCF}, {0x00A7, 0xF5}, {0x00A8, 0xF9}, {0x00AB, 0xAE}, {0x00AC, 0xAA}, {0x00AD, 0xF0}, {0x00B0, 0xF8},
+    {0x00B4, 0xEF}, {0x00B6, 0x14}, {0x00B8, 0xF7}, {0x00BB, 0xAF}, {0x00C1, 0xB5}, {0x00C2, 0xB6}, {0x00C4, 0x8E}, {0x00C7, 0x80},
+    {0x00C9, 0x90}, {0x00CB, 0xD3}, {0x00CD, 0xD6}, {0x00CE, 0xD7}, {0x00D3, 0xE0}, {0x00D4, 0xE2}, {0x00D6, 0x99}, {0x00D7, 0x9E},
+    {0x00DA, 0xE9}, {0x00DC, 0x9A}, {0x00DD, 0xED}, {0x00DF, 0xE1}, {0x00E1, 0xA0}, {0x00E2, 0x83}, {0x00E4, 0x84}, {0x00E7, 0x87},
+    {0x00E9, 0x82}, {0x00EB, 0x89}, {0x00ED, 0xA1}, {0x00EE, 0x8C}, {0x00F3, 0xA2}, {0x00F4, 0x93}, {0x00F6, 0x94}, {0x00F7, 0xF6},
+    {0x00FA, 0xA3}, {0x00FC, 0x81}, {0x00FD, 0xEC}, {0x0102, 0xC6}, {0x0103, 0xC7}, {0x0104, 0xA4}, {0x0105, 0xA5}, {0x0106, 0x8F},
+    {0x0107, 0x86}, {0x010C, 0xAC}, {0x010D, 0x9F}, {0x010E, 0xD2}, {0x010F, 0xD4}, {0x0110, 0xD1}, {0x0111, 0xD0}, {0x0118, 0xA8},
+    {0x0119, 0xA9}, {0x011A, 0xB7}, {0x011B, 0xD8}, {0x0139, 0x91}, {0x013A, 0x92}, {0x013D, 0x95}, {0x013E, 0x96}, {0x0141, 0x9D},
+    {0x0142, 0x88}, {0x0143, 0xE3}, {0x0144, 0xE4}, {0x0147, 0xD5}, {0x0148, 0xE5}, {0x0150, 0x8A}, {0x0151, 0x8B}, {0x0154, 0xE8},
+    {0x0155, 0xEA}, {0x0158, 0xFC}, {0x0159, 0xFD}, {0x015A, 0x97}, {0x015B, 0x98}, {0x015E, 0xB8}, {0x015F, 0xAD}, {0x0160, 0xE6},
+    {0x0161, 0xE7}, {0x0162, 0xDD}, {0x0163, 0xEE}, {0x0164, 0x9B}, {0x0165, 0x9C}, {0x016E, 0xDE}, {0x016F, 0x85}, {0x0170, 0xEB},
+    {0x0171, 0xFB}, {0x0179, 0x8D}, {0x017A, 0xAB}, {0x017B, 0xBD}, {0x017C, 0xBE}, {0x017D, 0xA6}, {0x017E, 0xA7}, {0x02C7, 0xF3},
+    {0x02D8, 0xF4}, {0x02D9, 0xFA}, {0x02DB, 0xF2}, {0x02DD, 0xF1}, {0x2022, 0x07}, {0x203C, 0x13}, {0x2190, 0x1B}, {0x2191, 0x18},
+    {0x2192, 0x1A}, {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17}, {0x221F, 0x1C}, {0x2302, 0x7F}, {0x2500, 0xC4},
+    {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2},
+    {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2554, 0xC9}, {0x2557, 0xBB}, {0x255A, 0xC8}, {0x255D, 0xBC},
+    {0x2560, 0xCC}, {0x2563, 0xB9}, {0x2566, 0xCB}, {0x2569, 0xCA}, {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB},
+    {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE}, {0x25AC, 0x16}, {0x25B2, 0x1E}, {0x25BA, 0x10}, {0x25BC, 0x1F},
+    {0x25C4, 0x11}, {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A}, {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F}, {0x2640, 0x0C},
+    {0x2642, 0x0B}, {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04}, {0x266A, 0x0D}, {0x266B, 0x0E},
+};
+
+const uint16_t cp737_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, /* 0x80 */
+    0x03A1, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, /* 0x90 */
+    0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3, 0x03C2, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x03C9, 0x03AC, 0x03AD, 0x03AE, 0x03CA, 0x03AF, 0x03CC, 0x03CD, 0x03CB, 0x03CE, 0x0386, 0x0388, 0x0389, 0x038A, 0x038C, 0x038E, /* 0xE0 */
+    0x038F, 0x00B1, 0x2265, 0x2264, 0x03AA, 0x03AB, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp737_doc_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E},
+    {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66},
+    {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E},
+    {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76},
+    {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E},
+    {0x00A0, 0xFF}, {0x00A7, 0x15}, {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B6, 0x14}, {0x00B7, 0xFA}, {0x00F7, 0xF6},
+    {0x0386, 0xEA}, {0x0388, 0xEB}, {0x0389, 0xEC}, {0x038A, 0xED}, {0x038C, 0xEE}, {0x038E, 0xEF}, {0x038F, 0xF0}, {0x0391, 0x80},
+    {0x0392, 0x81}, {0x0393, 0x82}, {0x0394, 0x83}, {0x0395, 0x84}, {0x0396, 0x85}, {0x0397, 0x86}, {0x0398, 0x87}, {0x0399, 0x88},
+    {0x039A, 0x89}, {0x039B, 0x8A}, {0x039C, 0x8B}, {0x039D, 0x8C}, {0x039E, 0x8D}, {0x039F, 0x8E}, {0x03A0, 0x8F}, {0x03A1, 0x90},
+    {0x03A3, 0x91}, {0x03A4, 0x92}, {0x03A5, 0x93}, {0x03A6, 0x94}, {0x03A7, 0x95}, {0x03A8, 0x96}, {0x03A9, 0x97}, {0x03AA, 0xF4},
+    {0x03AB, 0xF5}, {0x03AC, 0xE1}, {0x03AD, 0xE2}, {0x03AE, 0xE3}, {0x03AF, 0xE5}, {0x03B1, 0x98}, {0x03B2, 0x99}, {0x03B3, 0x9A},
+    {0x03B4, 0x9B}, {0x03B5, 0x9C}, {0x03B6, 0x9D}, {0x03B7, 0x9E}, {0x03B8, 0x9F}, {0x03B9, 0xA0}, {0x03BA, 0xA1}, {0x03BB, 0xA2},
+    {0x03BC, 0xA3}, {0x03BD, 0xA4}, {0x03BE, 0xA5}, {0x03BF, 0xA6}, {0x03C0, 0xA7}, {0x03C1, 0xA8}, {0x03C2, 0xAA}, {0x03C3, 0xA9},
+    {0x03C4, 0xAB}, {0x03C5, 0xAC}, {0x03C6, 0xAD}, {0x03C7, 0xAE}, {0x03C8, 0xAF}, {0x03C9, 0xE0}, {0x03CA, 0xE4}, {0x03CB, 0xE8},
+    {0x03CC, 0xE6}, {0x03CD, 0xE7}, {0x03CE, 0xE9}, {0x2022, 0x07}, {0x203C, 0x13}, {0x207F, 0xFC}, {0x2190, 0x1B}, {0x2191, 0x18},
+    {0x2192, 0x1A}, {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17}, {0x2219, 0xF9}, {0x221A, 0xFB}, {0x221F, 0x1C},
+    {0x2248, 0xF7}, {0x2264, 0xF3}, {0x2265, 0xF2}, {0x2302, 0x7F}, {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF},
+    {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD},
+    {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8}, {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4},
+    {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC}, {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC},
+    {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2}, {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0},
+    {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD},
+    {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE}, {0x25AC, 0x16}, {0x25B2, 0x1E}, {0x25BA, 0x10},
+    {0x25BC, 0x1F}, {0x25C4, 0x11}, {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A}, {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F},
+    {0x2640, 0x0C}, {0x2642, 0x0B}, {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04}, {0x266A, 0x0D}, {0x266B, 0x0E},
+};
+
+const uint16_t cp855_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0x0452, 0x0402, 0x0453, 0x0403, 0x0451, 0x0401, 0x0454, 0x0404, 0x0455, 0x0405, 0x0456, 0x0406, 0x0457, 0x0407, 0x0458, 0x0408, /* 0x80 */
+    0x0459, 0x0409, 0x045A, 0x040A, 0x045B, 0x040B, 0x045C, 0x040C, 0x045E, 0x040E, 0x045F, 0x040F, 0x044E, 0x042E, 0x044A, 0x042A, /* 0x90 */
+    0x0430, 0x0410, 0x0431, 0x0411, 0x0446, 0x0426, 0x0434, 0x0414, 0x0435, 0x0415, 0x0444, 0x0424, 0x0433, 0x0413, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x0445, 0x0425, 0x0438, 0x0418, 0x2563, 0x2551, 0x2557, 0x255D, 0x0439, 0x0419, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x043A, 0x041A, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4, /* 0xC0 */
+    0x043B, 0x041B, 0x043C, 0x041C, 0x043D, 0x041D, 0x043E, 0x041E, 0x043F, 0x2518, 0x250C, 0x2588, 0x2584, 0x041F, 0x044F, 0x2580, /* 0xD0 */
+    0x042F, 0x0440, 0x0420, 0x0441, 0x0421, 0x0442, 0x0422, 0x0443, 0x0423, 0x0436, 0x0416, 0x0432, 0x0412, 0x044C, 0x042C, 0x2116, /* 0xE0 */
+    0x00AD, 0x044B, 0x042B, 0x0437, 0x0417, 0x0448, 0x0428, 0x044D, 0x042D, 0x0449, 0x0429, 0x0447, 0x0427, 0x00A7, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp855_doc_from_unicode[255] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E},
+    {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66},
+    {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E},
+    {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76},
+    {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E},
+    {0x00A0, 0xFF}, {0x00A4, 0xCF}, {0x00A7, 0xFD}, {0x00AB, 0xAE}, {0x00AD, 0xF0}, {0x00B6, 0x14}, {0x00BB, 0xAF}, {0x0401, 0x85},
+    {0x0402, 0x81}, {0x0403, 0x83}, {0x0404, 0x87}, {0x0405, 0x89}, {0x0406, 0x8B}, {0x0407, 0x8D}, {0x0408, 0x8F}, {0x0409, 0x91},
+    {0x040A, 0x93}, {0x040B, 0x95}, {0x040C, 0x97}, {0x040E, 0x99}, {0x040F, 0x9B}, {0x0410, 0xA1}, {0x0411, 0xA3}, {0x0412, 0xEC},
+    {0x0413, 0xAD}, {0x0414, 0xA7}, {0x0415, 0xA9}, {0x0416, 0xEA}, {0x0417, 0xF4}, {0x0418, 0xB8}, {0x0419, 0xBE}, {0x041A, 0xC7},
+    {0x041B, 0xD1}, {0x041C, 0xD3}, {0x041D, 0xD5}, {0x041E, 0xD7}, {0x041F, 0xDD}, {0x0420, 0xE2}, {0x0421, 0xE4}, {0x0422, 0xE6},
+    {0x0423, 0xE8}, {0x0424, 0xAB}, {0x0425, 0xB6}, {0x0426, 0xA5}, {0x0427, 0xFC}, {0x0428, 0xF6}, {0x0429, 0xFA}, {0x042A, 0x9F},
+    {0x042B, 0xF2}, {0x042C, 0xEE}, {0x042D, 0xF8}, {0x042E, 0x9D}, {0x042F, 0xE0}, {0x0430, 0xA0}, {0x0431, 0xA2}, {0x0432, 0xEB},
+    {0x0433, 0xAC}, {0x0434, 0xA6}, {0x0435, 0xA8}, {0x0436, 0xE9}, {0x0437, 0xF3}, {0x0438, 0xB7}, {0x0439, 0xBD}, {0x043A, 0xC6},
+    {0x043B, 0xD0}, {0x043C, 0xD2}, {0x043D, 0xD4}, {0x043E, 0xD6}, {0x043F, 0xD8}, {0x0440, 0xE1}, {0x0441, 0xE3}, {0x0442, 0xE5},
+    {0x0443, 0xE7}, {0x0444, 0xAA}, {0x0445, 0xB5}, {0x0446, 0xA4}, {0x0447, 0xFB}, {0x0448, 0xF5}, {0x0449, 0xF9}, {0x044A, 0x9E},
+    {0x044B, 0xF1}, {0x044C, 0xED}, {0x044D, 0xF7}, {0x044E, 0x9C}, {0x044F, 0xDE}, {0x0451, 0x84}, {0x0452, 0x80}, {0x0453, 0x82},
+    {0x0454, 0x86}, {0x0455, 0x88}, {0x0456, 0x8A}, {0x0457, 0x8C}, {0x0458, 0x8E}, {0x0459, 0x90}, {0x045A, 0x92}, {0x045B, 0x94},
+    {0x045C, 0x96}, {0x045E, 0x98}, {0x045F, 0x9A}, {0x2022, 0x07}, {0x203C, 0x13}, {0x2116, 0xEF}, {0x2190, 0x1B}, {0x2191, 0x18},
+    {0x2192, 0x1A}, {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17}, {0x221F, 0x1C}, {0x2302, 0x7F}, {0x2500, 0xC4},
+    {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2},
+    {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2554, 0xC9}, {0x2557, 0xBB}, {0x255A, 0xC8}, {0x255D, 0xBC},
+    {0x2560, 0xCC}, {0x2563, 0xB9}, {0x2566, 0xCB}, {0x2569, 0xCA}, {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB},
+    {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE}, {0x25AC, 0x16}, {0x25B2, 0x1E}, {0x25BA, 0x10}, {0x25BC, 0x1F},
+    {0x25C4, 0x11}, {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A}, {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F}, {0x2640, 0x0C},
+    {0x2642, 0x0B}, {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04}, {0x266A, 0x0D}, {0x266B, 0x0E},
+};
+
+const uint16_t cp857_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x0131, 0x00C4, 0x00C5, /* 0x80 */
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x0130, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x015E, 0x015F, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x011E, 0x011F, 0x00BF, 0x00AE, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x00C0, 0x00A9, 0x2563, 0x2551, 0x2557, 0x255D, 0x00A2, 0x00A5, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x00E3, 0x00C3, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4, /* 0xC0 */
+    0x00BA, 0x00AA, 0x00CA, 0x00CB, 0x00C8, 0xFFFD, 0x00CD, 0x00CE, 0x00CF, 0x2518, 0x250C, 0x2588, 0x2584, 0x00A6, 0x00CC, 0x2580, /* 0xD0 */
+    0x00D3, 0x00DF, 0x00D4, 0x00D2, 0x00F5, 0x00D5, 0x00B5, 0xFFFD, 0x00D7, 0x00DA, 0x00DB, 0x00D9, 0x00EC, 0x00FF, 0x00AF, 0x00B4, /* 0xE0 */
+    0x00AD, 0x00B1, 0xFFFD, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp857_doc_from_unicode[251] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E},
+    {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66},
+    {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E},
+    {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76},
+    {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A2, 0xBD}, {0x00A3, 0x9C}, {0x00A4, 0xCF}, {0x00A5, 0xBE}, {0x00A6, 0xDD}, {0x00A7, 0xF5},
+    {0x00A8, 0xF9}, {0x00A9, 0xB8}, {0x00AA, 0xD1}, {0x00AB, 0xAE}, {0x00AC, 0xAA}, {0x00AD, 0xF0}, {0x00AE, 0xA9}, {0x00AF, 0xEE},
+    {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B3, 0xFC}, {0x00B4, 0xEF}, {0x00B5, 0xE6}, {0x00B6, 0xF4}, {0x00B7, 0xFA},
+    {0x00B8, 0xF7}, {0x00B9, 0xFB}, {0x00BA, 0xD0}, {0x00BB, 0xAF}, {0x00BC, 0xAC}, {0x00BD, 0xAB}, {0x00BE, 0xF3}, {0x00BF, 0xA8},
+    {0x00C0, 0xB7}, {0x00C1, 0xB5}, {0x00C2, 0xB6}, {0x00C3, 0xC7}, {0x00C4, 0x8E}, {0x00C5, 0x8F}, {0x00C6, 0x92}, {0x00C7, 0x80},
+    {0x00C8, 0xD4}, {0x00C9, 0x90}, {0x00CA, 0xD2}, {0x00CB, 0xD3}, {0x00CC, 0xDE}, {0x00CD, 0xD6}, {0x00CE, 0xD7}, {0x00CF, 0xD8},
+    {0x00D1, 0xA5}, {0x00D2, 0xE3}, {0x00D3, 0xE0}, {0x00D4, 0xE2}, {0x00D5, 0xE5}, {0x00D6, 0x99}, {0x00D7, 0xE8}, {0x00D8, 0x9D},
+    {0x00D9, 0xEB}, {0x00DA, 0xE9}, {0x00DB, 0xEA}, {0x00DC, 0x9A}, {0x00DF, 0xE1}, {0x00E0, 0x85}, {0x00E1, 0xA0}, {0x00E2, 0x83},
+    {0x00E3, 0xC6}, {0x00E4, 0x84}, {0x00E5, 0x86}, {0x00E6, 0x91}, {0x00E7, 0x87}, {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88},
+    {0x00EB, 0x89}, {0x00EC, 0xEC}, {0x00ED, 0xA1}, {0x00EE, 0x8C}, {0x00EF, 0x8B}, {0x00F1, 0xA4}, {0x00F2, 0x95}, {0x00F3, 0xA2},
+    {0x00F4, 0x93}, {0x00F5, 0xE4}, {0x00F6, 0x94}, {0x00F7, 0xF6}, {0x00F8, 0x9B}, {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FB, 0x96},
+    {0x00FC, 0x81}, {0x00FF, 0xED}, {0x011E, 0xA6}, {0x011F, 0xA7}, {0x0130, 0x98}, {0x0131, 0x8D}, {0x015E, 0x9E}, {0x015F, 0x9F},
+    {0x2022, 0x07}, {0x203C, 0x13}, {0x2190, 0x1B}, {0x2191, 0x18}, {0x2192, 0x1A}, {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12},
+    {0x21A8, 0x17}, {0x221F, 0x1C}, {0x2302, 0x7F}, {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0},
+    {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA},
+    {0x2554, 0xC9}, {0x2557, 0xBB}, {0x255A, 0xC8}, {0x255D, 0xBC}, {0x2560, 0xCC}, {0x2563, 0xB9}, {0x2566, 0xCB}, {0x2569, 0xCA},
+    {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+    {0x25AC, 0x16}, {0x25B2, 0x1E}, {0x25BA, 0x10}, {0x25BC, 0x1F}, {0x25C4, 0x11}, {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A},
+    {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F}, {0x2640, 0x0C}, {0x2642, 0x0B}, {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03},
+    {0x2666, 0x04}, {0x266A, 0x0D}, {0x266B, 0x0E},
+};
+
+const uint16_t cp866_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F, /* 0x80 */
+    0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F, /* 0x90 */
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F, /* 0xE0 */
+    0x0401, 0x0451, 0x0404, 0x0454, 0x0407, 0x0457, 0x040E, 0x045E, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x2116, 0x00A4, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp866_doc_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E},
+    {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66},
+    {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E},
+    {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76},
+    {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E},
+    {0x00A0, 0xFF}, {0x00A4, 0xFD}, {0x00A7, 0x15}, {0x00B0, 0xF8}, {0x00B6, 0x14}, {0x00B7, 0xFA}, {0x0401, 0xF0}, {0x0404, 0xF2},
+    {0x0407, 0xF4}, {0x040E, 0xF6}, {0x0410, 0x80}, {0x0411, 0x81}, {0x0412, 0x82}, {0x0413, 0x83}, {0x0414, 0x84}, {0x0415, 0x85},
+    {0x0416, 0x86}, {0x0417, 0x87}, {0x0418, 0x88}, {0x0419, 0x89}, {0x041A, 0x8A}, {0x041B, 0x8B}, {0x041C, 0x8C}, {0x041D, 0x8D},
+    {0x041E, 0x8E}, {0x041F, 0x8F}, {0x0420, 0x90}, {0x0421, 0x91}, {0x0422, 0x92}, {0x0423, 0x93}, {0x0424, 0x94}, {0x0425, 0x95},
+    {0x0426, 0x96}, {0x0427, 0x97}, {0x0428, 0x98}, {0x0429, 0x99}, {0x042A, 0x9A}, {0x042B, 0x9B}, {0x042C, 0x9C}, {0x042D, 0x9D},
+    {0x042E, 0x9E}, {0x042F, 0x9F}, {0x0430, 0xA0}, {0x0431, 0xA1}, {0x0432, 0xA2}, {0x0433, 0xA3}, {0x0434, 0xA4}, {0x0435, 0xA5},
+    {0x0436, 0xA6}, {0x0437, 0xA7}, {0x0438, 0xA8}, {0x0439, 0xA9}, {0x043A, 0xAA}, {0x043B, 0xAB}, {0x043C, 0xAC}, {0x043D, 0xAD},
+    {0x043E, 0xAE}, {0x043F, 0xAF}, {0x0440, 0xE0}, {0x0441, 0xE1}, {0x0442, 0xE2}, {0x0443, 0xE3}, {0x0444, 0xE4}, {0x0445, 0xE5},
+    {0x0446, 0xE6}, {0x0447, 0xE7}, {0x0448, 0xE8}, {0x0449, 0xE9}, {0x044A, 0xEA}, {0x044B, 0xEB}, {0x044C, 0xEC}, {0x044D, 0xED},
+    {0x044E, 0xEE}, {0x044F, 0xEF}, {0x0451, 0xF1}, {0x0454, 0xF3}, {0x0457, 0xF5}, {0x045E, 0xF7}, {0x2022, 0x07}, {0x203C, 0x13},
+    {0x2116, 0xFC}, {0x2190, 0x1B}, {0x2191, 0x18}, {0x2192, 0x1A}, {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17},
+    {0x2219, 0xF9}, {0x221A, 0xFB}, {0x221F, 0x1C}, {0x2302, 0x7F}, {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF},
+    {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD},
+    {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8}, {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4},
+    {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC}, {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC},
+    {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2}, {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0},
+    {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD},
+    {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE}, {0x25AC, 0x16}, {0x25B2, 0x1E}, {0x25BA, 0x10},
+    {0x25BC, 0x1F}, {0x25C4, 0x11}, {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A}, {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F},
+    {0x2640, 0x0C}, {0x2642, 0x0B}, {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04}, {0x266A, 0x0D}, {0x266B, 0x0E},
+};
+
+const uint16_t cp865_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5, /* 0x80 */
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x00FF, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x20A7, 0x0192, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00A4, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229, /* 0xE0 */
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp865_doc_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E},
+    {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66},
+    {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E},
+    {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76},
+    {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A3, 0x9C}, {0x00A4, 0xAF}, {0x00A7, 0x15}, {0x00AA, 0xA6}, {0x00AB, 0xAE}, {0x00AC, 0xAA},
+    {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B5, 0xE6}, {0x00B6, 0x14}, {0x00B7, 0xFA}, {0x00BA, 0xA7}, {0x00BC, 0xAC},
+    {0x00BD, 0xAB}, {0x00BF, 0xA8}, {0x00C4, 0x8E}, {0x00C5, 0x8F}, {0x00C6, 0x92}, {0x00C7, 0x80}, {0x00C9, 0x90}, {0x00D1, 0xA5},
+    {0x00D6, 0x99}, {0x00D8, 0x9D}, {0x00DC, 0x9A}, {0x00DF, 0xE1}, {0x00E0, 0x85}, {0x00E1, 0xA0}, {0x00E2, 0x83}, {0x00E4, 0x84},
+    {0x00E5, 0x86}, {0x00E6, 0x91}, {0x00E7, 0x87}, {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88}, {0x00EB, 0x89}, {0x00EC, 0x8D},
+    {0x00ED, 0xA1}, {0x00EE, 0x8C}, {0x00EF, 0x8B}, {0x00F1, 0xA4}, {0x00F2, 0x95}, {0x00F3, 0xA2}, {0x00F4, 0x93}, {0x00F6, 0x94},
+    {0x00F7, 0xF6}, {0x00F8, 0x9B}, {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FB, 0x96}, {0x00FC, 0x81}, {0x00FF, 0x98}, {0x0192, 0x9F},
+    {0x0393, 0xE2}, {0x0398, 0xE9}, {0x03A3, 0xE4}, {0x03A6, 0xE8}, {0x03A9, 0xEA}, {0x03B1, 0xE0}, {0x03B4, 0xEB}, {0x03B5, 0xEE},
+    {0x03C0, 0xE3}, {0x03C3, 0xE5}, {0x03C4, 0xE7}, {0x03C6, 0xED}, {0x2022, 0x07}, {0x203C, 0x13}, {0x207F, 0xFC}, {0x20A7, 0x9E},
+    {0x2190, 0x1B}, {0x2191, 0x18}, {0x2192, 0x1A}, {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17}, {0x2219, 0xF9},
+    {0x221A, 0xFB}, {0x221E, 0xEC}, {0x221F, 0x1C}, {0x2229, 0xEF}, {0x2248, 0xF7}, {0x2261, 0xF0}, {0x2264, 0xF3}, {0x2265, 0xF2},
+    {0x2302, 0x7F}, {0x2310, 0xA9}, {0x2320, 0xF4}, {0x2321, 0xF5}, {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF},
+    {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD},
+    {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8}, {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4},
+    {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC}, {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC},
+    {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2}, {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0},
+    {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD},
+    {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE}, {0x25AC, 0x16}, {0x25B2, 0x1E}, {0x25BA, 0x10},
+    {0x25BC, 0x1F}, {0x25C4, 0x11}, {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A}, {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F},
+    {0x2640, 0x0C}, {0x2642, 0x0B}, {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04}, {0x266A, 0x0D}, {0x266B, 0x0E},
+};
+
+const uint16_t cp858_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5, /* 0x80 */
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x00FF, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x00D7, 0x0192, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x00AE, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x00C0, 0x00A9, 0x2563, 0x2551, 0x2557, 0x255D, 0x00A2, 0x00A5, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x00E3, 0x00C3, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4, /* 0xC0 */
+    0x00F0, 0x00D0, 0x00CA, 0x00CB, 0x00C8, 0x20AC, 0x00CD, 0x00CE, 0x00CF, 0x2518, 0x250C, 0x2588, 0x2584, 0x00A6, 0x00CC, 0x2580, /* 0xD0 */
+    0x00D3, 0x00DF, 0x00D4, 0x00D2, 0x00F5, 0x00D5, 0x00B5, 0x00FE, 0x00DE, 0x00DA, 0x00DB, 0x00D9, 0x00FD, 0x00DD, 0x00AF, 0x00B4, /* 0xE0 */
+    0x00AD, 0x00B1, 0x2017, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp858_doc_from_unicode[254] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E},
+    {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66},
+    {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E},
+    {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76},
+    {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A2, 0xBD}, {0x00A3, 0x9C}, {0x00A4, 0xCF}, {0x00A5, 0xBE}, {0x00A6, 0xDD}, {0x00A7, 0xF5},
+    {0x00A8, 0xF9}, {0x00A9, 0xB8}, {0x00AA, 0xA6}, {0x00AB, 0xAE}, {0x00AC, 0xAA}, {0x00AD, 0xF0}, {0x00AE, 0xA9}, {0x00AF, 0xEE},
+    {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B3, 0xFC}, {0x00B4, 0xEF}, {0x00B5, 0xE6}, {0x00B6, 0xF4}, {0x00B7, 0xFA},
+    {0x00B8, 0xF7}, {0x00B9, 0xFB}, {0x00BA, 0xA7}, {0x00BB, 0xAF}, {0x00BC, 0xAC}, {0x00BD, 0xAB}, {0x00BE, 0xF3}, {0x00BF, 0xA8},
+    {0x00C0, 0xB7}, {0x00C1, 0xB5}, {0x00C2, 0xB6}, {0x00C3, 0xC7}, {0x00C4, 0x8E}, {0x00C5, 0x8F}, {0x00C6, 0x92}, {0x00C7, 0x80},
+    {0x00C8, 0xD4}, {0x00C9, 0x90}, {0x00CA, 0xD2}, {0x00CB, 0xD3}, {0x00CC, 0xDE}, {0x00CD, 0xD6}, {0x00CE, 0xD7}, {0x00CF, 0xD8},
+    {0x00D0, 0xD1}, {0x00D1, 0xA5}, {0x00D2, 0xE3}, {0x00D3, 0xE0}, {0x00D4, 0xE2}, {0x00D5, 0xE5}, {0x00D6, 0x99}, {0x00D7, 0x9E},
+    {0x00D8, 0x9D}, {0x00D9, 0xEB}, {0x00DA, 0xE9}, {0x00DB, 0xEA}, {0x00DC, 0x9A}, {0x00DD, 0xED}, {0x00DE, 0xE8}, {0x00DF, 0xE1},
+    {0x00E0, 0x85}, {0x00E1, 0xA0}, {0x00E2, 0x83}, {0x00E3, 0xC6}, {0x00E4, 0x84}, {0x00E5, 0x86}, {0x00E6, 0x91}, {0x00E7, 0x87},
+    {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88}, {0x00EB, 0x89}, {0x00EC, 0x8D}, {0x00ED, 0xA1}, {0x00EE, 0x8C}, {0x00EF, 0x8B},
+    {0x00F0, 0xD0}, {0x00F1, 0xA4}, {0x00F2, 0x95}, {0x00F3, 0xA2}, {0x00F4, 0x93}, {0x00F5, 0xE4}, {0x00F6, 0x94}, {0x00F7, 0xF6},
+    {0x00F8, 0x9B}, {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FB, 0x96}, {0x00FC, 0x81}, {0x00FD, 0xEC}, {0x00FE, 0xE7}, {0x00FF, 0x98},
+    {0x0192, 0x9F}, {0x2017, 0xF2}, {0x2022, 0x07}, {0x203C, 0x13}, {0x20AC, 0xD5}, {0x2190, 0x1B}, {0x2191, 0x18}, {0x2192, 0x1A},
+    {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17}, {0x221F, 0x1C}, {0x2302, 0x7F}, {0x2500, 0xC4}, {0x2502, 0xB3},
+    {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1},
+    {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2554, 0xC9}, {0x2557, 0xBB}, {0x255A, 0xC8}, {0x255D, 0xBC}, {0x2560, 0xCC},
+    {0x2563, 0xB9}, {0x2566, 0xCB}, {0x2569, 0xCA}, {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x2591, 0xB0},
+    {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE}, {0x25AC, 0x16}, {0x25B2, 0x1E}, {0x25BA, 0x10}, {0x25BC, 0x1F}, {0x25C4, 0x11},
+    {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A}, {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F}, {0x2640, 0x0C}, {0x2642, 0x0B},
+    {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04}, {0x266A, 0x0D}, {0x266B, 0x0E},
+};
+
+const uint16_t cp860_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E3, 0x00E0, 0x00C1, 0x00E7, 0x00EA, 0x00CA, 0x00E8, 0x00CD, 0x00D4, 0x00EC, 0x00C3, 0x00C2, /* 0x80 */
+    0x00C9, 0x00C0, 0x00C8, 0x00F4, 0x00F5, 0x00F2, 0x00DA, 0x00F9, 0x00CC, 0x00D5, 0x00DC, 0x00A2, 0x00A3, 0x00D9, 0x20A7, 0x00D3, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x00D2, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229, /* 0xE0 */
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp860_doc_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E},
+    {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66},
+    {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E},
+    {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76},
+    {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A2, 0x9B}, {0x00A3, 0x9C}, {0x00A7, 0x15}, {0x00AA, 0xA6}, {0x00AB, 0xAE}, {0x00AC, 0xAA},
+    {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B5, 0xE6}, {0x00B6, 0x14}, {0x00B7, 0xFA}, {0x00BA, 0xA7}, {0x00BB, 0xAF},
+    {0x00BC, 0xAC}, {0x00BD, 0xAB}, {0x00BF, 0xA8}, {0x00C0, 0x91}, {0x00C1, 0x86}, {0x00C2, 0x8F}, {0x00C3, 0x8E}, {0x00C7, 0x80},
+    {0x00C8, 0x92}, {0x00C9, 0x90}, {0x00CA, 0x89}, {0x00CC, 0x98}, {0x00CD, 0x8B}, {0x00D1, 0xA5}, {0x00D2, 0xA9}, {0x00D3, 0x9F},
+    {0x00D4, 0x8C}, {0x00D5, 0x99}, {0x00D9, 0x9D}, {0x00DA, 0x96}, {0x00DC, 0x9A}, {0x00DF, 0xE1}, {0x00E0, 0x85}, {0x00E1, 0xA0},
+    {0x00E2, 0x83}, {0x00E3, 0x84}, {0x00E7, 0x87}, {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88}, {0x00EC, 0x8D}, {0x00ED, 0xA1},
+    {0x00F1, 0xA4}, {0x00F2, 0x95}, {0x00F3, 0xA2}, {0x00F4, 0x93}, {0x00F5, 0x94}, {0x00F7, 0xF6}, {0x00F9, 0x97}, {0x00FA, 0xA3},
+    {0x00FC, 0x81}, {0x0393, 0xE2}, {0x0398, 0xE9}, {0x03A3, 0xE4}, {0x03A6, 0xE8}, {0x03A9, 0xEA}, {0x03B1, 0xE0}, {0x03B4, 0xEB},
+    {0x03B5, 0xEE}, {0x03C0, 0xE3}, {0x03C3, 0xE5}, {0x03C4, 0xE7}, {0x03C6, 0xED}, {0x2022, 0x07}, {0x203C, 0x13}, {0x207F, 0xFC},
+    {0x20A7, 0x9E}, {0x2190, 0x1B}, {0x2191, 0x18}, {0x2192, 0x1A}, {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17},
+    {0x2219, 0xF9}, {0x221A, 0xFB}, {0x221E, 0xEC}, {0x221F, 0x1C}, {0x2229, 0xEF}, {0x2248, 0xF7}, {0x2261, 0xF0}, {0x2264, 0xF3},
+    {0x2265, 0xF2}, {0x2302, 0x7F}, {0x2320, 0xF4}, {0x2321, 0xF5}, {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF},
+    {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD},
+    {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8}, {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4},
+    {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC}, {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC},
+    {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2}, {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0},
+    {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD},
+    {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE}, {0x25AC, 0x16}, {0x25B2, 0x1E}, {0x25BA, 0x10},
+    {0x25BC, 0x1F}, {0x25C4, 0x11}, {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A}, {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F},
+    {0x2640, 0x0C}, {0x2642, 0x0B}, {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04}, {0x266A, 0x0D}, {0x266B, 0x0E},
+};
+
+const uint16_t cp861_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00D0, 0x00F0, 0x00DE, 0x00C4, 0x00C5, /* 0x80 */
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00FE, 0x00FB, 0x00DD, 0x00FD, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x20A7, 0x0192, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00C1, 0x00CD, 0x00D3, 0x00DA, 0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229, /* 0xE0 */
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp861_doc_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E},
+    {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66},
+    {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E},
+    {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76},
+    {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A3, 0x9C}, {0x00A7, 0x15}, {0x00AB, 0xAE}, {0x00AC, 0xAA}, {0x00B0, 0xF8}, {0x00B1, 0xF1},
+    {0x00B2, 0xFD}, {0x00B5, 0xE6}, {0x00B6, 0x14}, {0x00B7, 0xFA}, {0x00BB, 0xAF}, {0x00BC, 0xAC}, {0x00BD, 0xAB}, {0x00BF, 0xA8},
+    {0x00C1, 0xA4}, {0x00C4, 0x8E}, {0x00C5, 0x8F}, {0x00C6, 0x92}, {0x00C7, 0x80}, {0x00C9, 0x90}, {0x00CD, 0xA5}, {0x00D0, 0x8B},
+    {0x00D3, 0xA6}, {0x00D6, 0x99}, {0x00D8, 0x9D}, {0x00DA, 0xA7}, {0x00DC, 0x9A}, {0x00DD, 0x97}, {0x00DE, 0x8D}, {0x00DF, 0xE1},
+    {0x00E0, 0x85}, {0x00E1, 0xA0}, {0x00E2, 0x83}, {0x00E4, 0x84}, {0x00E5, 0x86}, {0x00E6, 0x91}, {0x00E7, 0x87}, {0x00E8, 0x8A},
+    {0x00E9, 0x82}, {0x00EA, 0x88}, {0x00EB, 0x89}, {0x00ED, 0xA1}, {0x00F0, 0x8C}, {0x00F3, 0xA2}, {0x00F4, 0x93}, {0x00F6, 0x94},
+    {0x00F7, 0xF6}, {0x00F8, 0x9B}, {0x00FA, 0xA3}, {0x00FB, 0x96}, {0x00FC, 0x81}, {0x00FD, 0x98}, {0x00FE, 0x95}, {0x0192, 0x9F},
+    {0x0393, 0xE2}, {0x0398, 0xE9}, {0x03A3, 0xE4}, {0x03A6, 0xE8}, {0x03A9, 0xEA}, {0x03B1, 0xE0}, {0x03B4, 0xEB}, {0x03B5, 0xEE},
+    {0x03C0, 0xE3}, {0x03C3, 0xE5}, {0x03C4, 0xE7}, {0x03C6, 0xED}, {0x2022, 0x07}, {0x203C, 0x13}, {0x207F, 0xFC}, {0x20A7, 0x9E},
+    {0x2190, 0x1B}, {0x2191, 0x18}, {0x2192, 0x1A}, {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17}, {0x2219, 0xF9},
+    {0x221A, 0xFB}, {0x221E, 0xEC}, {0x221F, 0x1C}, {0x2229, 0xEF}, {0x2248, 0xF7}, {0x2261, 0xF0}, {0x2264, 0xF3}, {0x2265, 0xF2},
+    {0x2302, 0x7F}, {0x2310, 0xA9}, {0x2320, 0xF4}, {0x2321, 0xF5}, {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF},
+    {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD},
+    {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8}, {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4},
+    {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC}, {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC},
+    {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2}, {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0},
+    {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD},
+    {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE}, {0x25AC, 0x16}, {0x25B2, 0x1E}, {0x25BA, 0x10},
+    {0x25BC, 0x1F}, {0x25C4, 0x11}, {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A}, {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F},
+    {0x2640, 0x0C}, {0x2642, 0x0B}, {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04}, {0x266A, 0x0D}, {0x266B, 0x0E},
+};
+
+const uint16_t cp862_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF, /* 0x80 */
+    0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192, /* 0x90 */
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229, /* 0xE0 */
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp862_doc_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E},
+    {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66},
+    {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E},
+    {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76},
+    {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E},
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A2, 0x9B}, {0x00A3, 0x9C}, {0x00A5, 0x9D}, {0x00A7, 0x15}, {0x00AA, 0xA6}, {0x00AB, 0xAE},
+    {0x00AC, 0xAA}, {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B5, 0xE6}, {0x00B6, 0x14}, {0x00B7, 0xFA}, {0x00BA, 0xA7},
+    {0x00BB, 0xAF}, {0x00BC, 0xAC}, {0x00BD, 0xAB}, {0x00BF, 0xA8}, {0x00D1, 0xA5}, {0x00DF, 0xE1}, {0x00E1, 0xA0}, {0x00ED, 0xA1},
+    {0x00F1, 0xA4}, {0x00F3, 0xA2}, {0x00F7, 0xF6}, {0x00FA, 0xA3}, {0x0192, 0x9F}, {0x0393, 0xE2}, {0x0398, 0xE9}, {0x03A3, 0xE4},
+    {0x03A6, 0xE8}, {0x03A9, 0xEA}, {0x03B1, 0xE0}, {0x03B4, 0xEB}, {0x03B5, 0xEE}, {0x03C0, 0xE3}, {0x03C3, 0xE5}, {0x03C4, 0xE7},
+    {0x03C6, 0xED}, {0x05D0, 0x80}, {0x05D1, 0x81}, {0x05D2, 0x82}, {0x05D3, 0x83}, {0x05D4, 0x84}, {0x05D5, 0x85}, {0x05D6, 0x86},
+    {0x05D7, 0x87}, {0x05D8, 0x88}, {0x05D9, 0x89}, {0x05DA, 0x8A}, {0x05DB, 0x8B}, {0x05DC, 0x8C}, {0x05DD, 0x8D}, {0x05DE, 0x8E},
+    {0x05DF, 0x8F}, {0x05E0, 0x90}, {0x05E1, 0x91}, {0x05E2, 0x92}, {0x05E3, 0x93}, {0x05E4, 0x94}, {0x05E5, 0x95}, {0x05E6, 0x96},
+    {0x05E7, 0x97}, {0x05E8, 0x98}, {0x05E9, 0x99}, {0x05EA, 0x9A}, {0x2022, 0x07}, {0x203C, 0x13}, {0x207F, 0xFC}, {0x20A7, 0x9E},
+    {0x2190, 0x1B}, {0x2191, 0x18}, {0x2192, 0x1A}, {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17}, {0x2219, 0xF9},
+    {0x221A, 0xFB}, {0x221E, 0xEC}, {0x221F, 0x1C}, {0x2229, 0xEF}, {0x2248, 0xF7}, {0x2261, 0xF0}, {0x2264, 0xF3}, {0x2265, 0xF2},
+    {0x2302, 0x7F}, {0x2310, 0xA9}, {0x2320, 0xF4}, {0x2321, 0xF5}, {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF},
+    {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD},
+    {0x2551, 0xBA}, {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8}, {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4},
+    {0x2559, 0xD3}, {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC}, {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC},
+    {0x2561, 0xB5}, {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2}, {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0},
+    {0x2569, 0xCA}, {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD},
+    {0x2590, 0xDE}, {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE}, {0x25AC, 0x16}, {0x25B2, 0x1E}, {0x25BA, 0x10},
+    {0x25BC, 0x1F}, {0x25C4, 0x11}, {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A}, {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F},
+    {0x2640, 0x0C}, {0x2642, 0x0B}, {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04}, {0x266A, 0x0D}, {0x266B, 0x0E},
+};
+
+const uint16_t cp863_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00C2, 0x00E0, 0x00B6, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x2017, 0x00C0, 0x00A7, /* 0x80 */
+    0x00C9, 0x00C8, 0x00CA, 0x00F4, 0x00CB, 0x00CF, 0x00FB, 0x00F9, 0x00A4, 0x00D4, 0x00DC, 0x00A2, 0x00A3, 0x00D9, 0x00DB, 0x0192, /* 0x90 */
+    0x00A6, 0x00B4, 0x00F3, 0x00FA, 0x00A8, 0x00B8, 0x00B3, 0x00AF, 0x00CE, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00BE, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567, /* 0xC0 */
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580, /* 0xD0 */
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229, /* 0xE0 */
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp863_doc_from_unicode[254] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E},
+    {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66},
+    {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E},
+    {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76},
+    {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E},
+    {0x00A0, 0xFF}, {0x00A2, 0x9B}, {0x00A3, 0x9C}, {0x00A4, 0x98}, {0x00A6, 0xA0}, {0x00A7, 0x8F}, {0x00A8, 0xA4}, {0x00AB, 0xAE},
+    {0x00AC, 0xAA}, {0x00AF, 0xA7}, {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B3, 0xA6}, {0x00B4, 0xA1}, {0x00B5, 0xE6},
+    {0x00B6, 0x86}, {0x00B7, 0xFA}, {0x00B8, 0xA5}, {0x00BB, 0xAF}, {0x00BC, 0xAC}, {0x00BD, 0xAB}, {0x00BE, 0xAD}, {0x00C0, 0x8E},
+    {0x00C2, 0x84}, {0x00C7, 0x80}, {0x00C8, 0x91}, {0x00C9, 0x90}, {0x00CA, 0x92}, {0x00CB, 0x94}, {0x00CE, 0xA8}, {0x00CF, 0x95},
+    {0x00D4, 0x99}, {0x00D9, 0x9D}, {0x00DB, 0x9E}, {0x00DC, 0x9A}, {0x00DF, 0xE1}, {0x00E0, 0x85}, {0x00E2, 0x83}, {0x00E7, 0x87},
+    {0x00E8, 0x8A}, {0x00E9, 0x82}, {0x00EA, 0x88}, {0x00EB, 0x89}, {0x00EE, 0x8C}, {0x00EF, 0x8B}, {0x00F3, 0xA2}, {0x00F4, 0x93},
+    {0x00F7, 0xF6}, {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FB, 0x96}, {0x00FC, 0x81}, {0x0192, 0x9F}, {0x0393, 0xE2}, {0x0398, 0xE9},
+    {0x03A3, 0xE4}, {0x03A6, 0xE8}, {0x03A9, 0xEA}, {0x03B1, 0xE0}, {0x03B4, 0xEB}, {0x03B5, 0xEE}, {0x03C0, 0xE3}, {0x03C3, 0xE5},
+    {0x03C4, 0xE7}, {0x03C6, 0xED}, {0x2017, 0x8D}, {0x2022, 0x07}, {0x203C, 0x13}, {0x207F, 0xFC}, {0x2190, 0x1B}, {0x2191, 0x18},
+    {0x2192, 0x1A}, {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17}, {0x2219, 0xF9}, {0x221A, 0xFB}, {0x221E, 0xEC},
+    {0x221F, 0x1C}, {0x2229, 0xEF}, {0x2248, 0xF7}, {0x2261, 0xF0}, {0x2264, 0xF3}, {0x2265, 0xF2}, {0x2302, 0x7F}, {0x2310, 0xA9},
+    {0x2320, 0xF4}, {0x2321, 0xF5}, {0x2500, 0xC4}, {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9},
+    {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2552, 0xD5},
+    {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8}, {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4}, {0x2559, 0xD3}, {0x255A, 0xC8},
+    {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC}, {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC}, {0x2561, 0xB5}, {0x2562, 0xB6},
+    {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2}, {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0}, {0x2569, 0xCA}, {0x256A, 0xD8},
+    {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD}, {0x2590, 0xDE}, {0x2591, 0xB0},
+    {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE}, {0x25AC, 0x16}, {0x25B2, 0x1E}, {0x25BA, 0x10}, {0x25BC, 0x1F}, {0x25C4, 0x11},
+    {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A}, {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F}, {0x2640, 0x0C}, {0x2642, 0x0B},
+    {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04}, {0x266A, 0x0D}, {0x266B, 0x0E},
+};
+
+const uint16_t cp864_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x066A, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0x00B0, 0x00B7, 0x2219, 0x221A, 0x2592, 0x2500, 0x2502, 0x253C, 0x2524, 0x252C, 0x251C, 0x2534, 0x2510, 0x250C, 0x2514, 0x2518, /* 0x80 */
+    0x03B2, 0x221E, 0x03C6, 0x00B1, 0x00BD, 0x00BC, 0x2248, 0x00AB, 0x00BB, 0xFEF7, 0xFEF8, 0xFFFD, 0xFFFD, 0xFEFB, 0xFEFC, 0xFFFD, /* 0x90 */
+    0x00A0, 0x00AD, 0xFE82, 0x00A3, 0x00A4, 0xFE84, 0xFFFD, 0xFFFD, 0xFE8E, 0xFE8F, 0xFE95, 0xFE99, 0x060C, 0xFE9D, 0xFEA1, 0xFEA5, /* 0xA0 */
+    0x0660, 0x0661, 0x0662, 0x0663, 0x0664, 0x0665, 0x0666, 0x0667, 0x0668, 0x0669, 0xFED1, 0x061B, 0xFEB1, 0xFEB5, 0xFEB9, 0x061F, /* 0xB0 */
+    0x00A2, 0xFE80, 0xFE81, 0xFE83, 0xFE85, 0xFECA, 0xFE8B, 0xFE8D, 0xFE91, 0xFE93, 0xFE97, 0xFE9B, 0xFE9F, 0xFEA3, 0xFEA7, 0xFEA9, /* 0xC0 */
+    0xFEAB, 0xFEAD, 0xFEAF, 0xFEB3, 0xFEB7, 0xFEBB, 0xFEBF, 0xFEC1, 0xFEC5, 0xFECB, 0xFECF, 0x00A6, 0x00AC, 0x00F7, 0x00D7, 0xFEC9, /* 0xD0 */
+    0x0640, 0xFED3, 0xFED7, 0xFEDB, 0xFEDF, 0xFEE3, 0xFEE7, 0xFEEB, 0xFEED, 0xFEEF, 0xFEF3, 0xFEBD, 0xFECC, 0xFECE, 0xFECD, 0xFEE1, /* 0xE0 */
+    0xFE7D, 0x0651, 0xFEE5, 0xFEE9, 0xFEEC, 0xFEF0, 0xFEF2, 0xFED0, 0xFED5, 0xFEF5, 0xFEF6, 0xFEDD, 0xFED9, 0xFEF1, 0x25A0, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp864_doc_from_unicode[250] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x00A0, 0xA0},
+    {0x00A2, 0xC0}, {0x00A3, 0xA3}, {0x00A4, 0xA4}, {0x00A6, 0xDB}, {0x00A7, 0x15}, {0x00AB, 0x97}, {0x00AC, 0xDC}, {0x00AD, 0xA1},
+    {0x00B0, 0x80}, {0x00B1, 0x93}, {0x00B6, 0x14}, {0x00B7, 0x81}, {0x00BB, 0x98}, {0x00BC, 0x95}, {0x00BD, 0x94}, {0x00D7, 0xDE},
+    {0x00F7, 0xDD}, {0x03B2, 0x90}, {0x03C6, 0x92}, {0x060C, 0xAC}, {0x061B, 0xBB}, {0x061F, 0xBF}, {0x0640, 0xE0}, {0x0651, 0xF1},
+    {0x0660, 0xB0}, {0x0661, 0xB1}, {0x0662, 0xB2}, {0x0663, 0xB3}, {0x0664, 0xB4}, {0x0665, 0xB5}, {0x0666, 0xB6}, {0x0667, 0xB7},
+    {0x0668, 0xB8}, {0x0669, 0xB9}, {0x066A, 0x25}, {0x2022, 0x07}, {0x203C, 0x13}, {0x2190, 0x1B}, {0x2191, 0x18}, {0x2192, 0x1A},
+    {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17}, {0x2219, 0x82}, {0x221A, 0x83}, {0x221E, 0x91}, {0x221F, 0x1C},
+    {0x2248, 0x96}, {0x2302, 0x7F}, {0x2500, 0x85}, {0x2502, 0x86}, {0x250C, 0x8D}, {0x2510, 0x8C}, {0x2514, 0x8E}, {0x2518, 0x8F},
+    {0x251C, 0x8A}, {0x2524, 0x88}, {0x252C, 0x89}, {0x2534, 0x8B}, {0x253C, 0x87}, {0x2592, 0x84}, {0x25A0, 0xFE}, {0x25AC, 0x16},
+    {0x25B2, 0x1E}, {0x25BA, 0x10}, {0x25BC, 0x1F}, {0x25C4, 0x11}, {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A}, {0x263A, 0x01},
+    {0x263B, 0x02}, {0x263C, 0x0F}, {0x2640, 0x0C}, {0x2642, 0x0B}, {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04},
+    {0x266A, 0x0D}, {0x266B, 0x0E}, {0xFE7D, 0xF0}, {0xFE80, 0xC1}, {0xFE81, 0xC2}, {0xFE82, 0xA2}, {0xFE83, 0xC3}, {0xFE84, 0xA5},
+    {0xFE85, 0xC4}, {0xFE8B, 0xC6}, {0xFE8D, 0xC7}, {0xFE8E, 0xA8}, {0xFE8F, 0xA9}, {0xFE91, 0xC8}, {0xFE93, 0xC9}, {0xFE95, 0xAA},
+    {0xFE97, 0xCA}, {0xFE99, 0xAB}, {0xFE9B, 0xCB}, {0xFE9D, 0xAD}, {0xFE9F, 0xCC}, {0xFEA1, 0xAE}, {0xFEA3, 0xCD}, {0xFEA5, 0xAF},
+    {0xFEA7, 0xCE}, {0xFEA9, 0xCF}, {0xFEAB, 0xD0}, {0xFEAD, 0xD1}, {0xFEAF, 0xD2}, {0xFEB1, 0xBC}, {0xFEB3, 0xD3}, {0xFEB5, 0xBD},
+    {0xFEB7, 0xD4}, {0xFEB9, 0xBE}, {0xFEBB, 0xD5}, {0xFEBD, 0xEB}, {0xFEBF, 0xD6}, {0xFEC1, 0xD7}, {0xFEC5, 0xD8}, {0xFEC9, 0xDF},
+    {0xFECA, 0xC5}, {0xFECB, 0xD9}, {0xFECC, 0xEC}, {0xFECD, 0xEE}, {0xFECE, 0xED}, {0xFECF, 0xDA}, {0xFED0, 0xF7}, {0xFED1, 0xBA},
+    {0xFED3, 0xE1}, {0xFED5, 0xF8}, {0xFED7, 0xE2}, {0xFED9, 0xFC}, {0xFEDB, 0xE3}, {0xFEDD, 0xFB}, {0xFEDF, 0xE4}, {0xFEE1, 0xEF},
+    {0xFEE3, 0xE5}, {0xFEE5, 0xF2}, {0xFEE7, 0xE6}, {0xFEE9, 0xF3}, {0xFEEB, 0xE7}, {0xFEEC, 0xF4}, {0xFEED, 0xE8}, {0xFEEF, 0xE9},
+    {0xFEF0, 0xF5}, {0xFEF1, 0xFD}, {0xFEF2, 0xF6}, {0xFEF3, 0xEA}, {0xFEF5, 0xF9}, {0xFEF6, 0xFA}, {0xFEF7, 0x99}, {0xFEF8, 0x9A},
+    {0xFEFB, 0x9D}, {0xFEFC, 0x9E},
+};
+
+const uint16_t cp869_doc_to_unicode[256] = {
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C, /* 0x00 */
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302, /* 0x70 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x0386, 0xFFFD, 0x00B7, 0x00AC, 0x00A6, 0x2018, 0x2019, 0x0388, 0x2015, 0x0389, /* 0x80 */
+    0x038A, 0x03AA, 0x038C, 0xFFFD, 0xFFFD, 0x038E, 0x03AB, 0x00A9, 0x038F, 0x00B2, 0x00B3, 0x03AC, 0x00A3, 0x03AD, 0x03AE, 0x03AF, /* 0x90 */
+    0x03CA, 0x0390, 0x03CC, 0x03CD, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x00BD, 0x0398, 0x0399, 0x00AB, 0x00BB, /* 0xA0 */
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x039A, 0x039B, 0x039C, 0x039D, 0x2563, 0x2551, 0x2557, 0x255D, 0x039E, 0x039F, 0x2510, /* 0xB0 */
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x03A0, 0x03A1, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x03A3, /* 0xC0 */
+    0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x2518, 0x250C, 0x2588, 0x2584, 0x03B4, 0x03B5, 0x2580, /* 0xD0 */
+    0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3, 0x03C2, 0x03C4, 0x0384, /* 0xE0 */
+    0x00AD, 0x00B1, 0x03C5, 0x03C6, 0x03C7, 0x00A7, 0x03C8, 0x0385, 0x00B0, 0x00A8, 0x03C9, 0x03CB, 0x03B0, 0x03CE, 0x25A0, 0x00A0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp869_doc_from_unicode[246] = {
+    {0x0000, 0x00}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E},
+    {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66},
+    {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E},
+    {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76},
+    {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E},
+    {0x00A0, 0xFF}, {0x00A3, 0x9C}, {0x00A6, 0x8A}, {0x00A7, 0xF5}, {0x00A8, 0xF9}, {0x00A9, 0x97}, {0x00AB, 0xAE}, {0x00AC, 0x89},
+    {0x00AD, 0xF0}, {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0x99}, {0x00B3, 0x9A}, {0x00B6, 0x14}, {0x00B7, 0x88}, {0x00BB, 0xAF},
+    {0x00BD, 0xAB}, {0x0384, 0xEF}, {0x0385, 0xF7}, {0x0386, 0x86}, {0x0388, 0x8D}, {0x0389, 0x8F}, {0x038A, 0x90}, {0x038C, 0x92},
+    {0x038E, 0x95}, {0x038F, 0x98}, {0x0390, 0xA1}, {0x0391, 0xA4}, {0x0392, 0xA5}, {0x0393, 0xA6}, {0x0394, 0xA7}, {0x0395, 0xA8},
+    {0x0396, 0xA9}, {0x0397, 0xAA}, {0x0398, 0xAC}, {0x0399, 0xAD}, {0x039A, 0xB5}, {0x039B, 0xB6}, {0x039C, 0xB7}, {0x039D, 0xB8},
+    {0x039E, 0xBD}, {0x039F, 0xBE}, {0x03A0, 0xC6}, {0x03A1, 0xC7}, {0x03A3, 0xCF}, {0x03A4, 0xD0}, {0x03A5, 0xD1}, {0x03A6, 0xD2},
+    {0x03A7, 0xD3}, {0x03A8, 0xD4}, {0x03A9, 0xD5}, {0x03AA, 0x91}, {0x03AB, 0x96}, {0x03AC, 0x9B}, {0x03AD, 0x9D}, {0x03AE, 0x9E},
+    {0x03AF, 0x9F}, {0x03B0, 0xFC}, {0x03B1, 0xD6}, {0x03B2, 0xD7}, {0x03B3, 0xD8}, {0x03B4, 0xDD}, {0x03B5, 0xDE}, {0x03B6, 0xE0},
+    {0x03B7, 0xE1}, {0x03B8, 0xE2}, {0x03B9, 0xE3}, {0x03BA, 0xE4}, {0x03BB, 0xE5}, {0x03BC, 0xE6}, {0x03BD, 0xE7}, {0x03BE, 0xE8},
+    {0x03BF, 0xE9}, {0x03C0, 0xEA}, {0x03C1, 0xEB}, {0x03C2, 0xED}, {0x03C3, 0xEC}, {0x03C4, 0xEE}, {0x03C5, 0xF2}, {0x03C6, 0xF3},
+    {0x03C7, 0xF4}, {0x03C8, 0xF6}, {0x03C9, 0xFA}, {0x03CA, 0xA0}, {0x03CB, 0xFB}, {0x03CC, 0xA2}, {0x03CD, 0xA3}, {0x03CE, 0xFD},
+    {0x2015, 0x8E}, {0x2018, 0x8B}, {0x2019, 0x8C}, {0x2022, 0x07}, {0x203C, 0x13}, {0x2190, 0x1B}, {0x2191, 0x18}, {0x2192, 0x1A},
+    {0x2193, 0x19}, {0x2194, 0x1D}, {0x2195, 0x12}, {0x21A8, 0x17}, {0x221F, 0x1C}, {0x2302, 0x7F}, {0x2500, 0xC4}, {0x2502, 0xB3},
+    {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0}, {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2}, {0x2534, 0xC1},
+    {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA}, {0x2554, 0xC9}, {0x2557, 0xBB}, {0x255A, 0xC8}, {0x255D, 0xBC}, {0x2560, 0xCC},
+    {0x2563, 0xB9}, {0x2566, 0xCB}, {0x2569, 0xCA}, {0x256C, 0xCE}, {0x2580, 0xDF}, {0x2584, 0xDC}, {0x2588, 0xDB}, {0x2591, 0xB0},
+    {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE}, {0x25AC, 0x16}, {0x25B2, 0x1E}, {0x25BA, 0x10}, {0x25BC, 0x1F}, {0x25C4, 0x11},
+    {0x25CB, 0x09}, {0x25D8, 0x08}, {0x25D9, 0x0A}, {0x263A, 0x01}, {0x263B, 0x02}, {0x263C, 0x0F}, {0x2640, 0x0C}, {0x2642, 0x0B},
+    {0x2660, 0x06}, {0x2663, 0x05}, {0x2665, 0x03}, {0x2666, 0x04}, {0x266A, 0x0D}, {0x266B, 0x0E},
+};
+
+const uint16_t koi8_r_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x2500, 0x2502, 0x250C, 0x2510, 0x2514, 0x2518, 0x251C, 0x2524, 0x252C, 0x2534, 0x253C, 0x2580, 0x2584, 0x2588, 0x258C, 0x2590, /* 0x80 */
+    0x2591, 0x2592, 0x2593, 0x2320, 0x25A0, 0x2219, 0x221A, 0x2248, 0x2264, 0x2265, 0x00A0, 0x2321, 0x00B0, 0x00B2, 0x00B7, 0x00F7, /* 0x90 */
+    0x2550, 0x2551, 0x2552, 0x0451, 0x2553, 0x2554, 0x2555, 0x2556, 0x2557, 0x2558, 0x2559, 0x255A, 0x255B, 0x255C, 0x255D, 0x255E, /* 0xA0 */
+    0x255F, 0x2560, 0x2561, 0x0401, 0x2562, 0x2563, 0x2564, 0x2565, 0x2566, 0x2567, 0x2568, 0x2569, 0x256A, 0x256B, 0x256C, 0x00A9, /* 0xB0 */
+    0x044E, 0x0430, 0x0431, 0x0446, 0x0434, 0x0435, 0x0444, 0x0433, 0x0445, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, /* 0xC0 */
+    0x043F, 0x044F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0436, 0x0432, 0x044C, 0x044B, 0x0437, 0x0448, 0x044D, 0x0449, 0x0447, 0x044A, /* 0xD0 */
+    0x042E, 0x0410, 0x0411, 0x0426, 0x0414, 0x0415, 0x0424, 0x0413, 0x0425, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, /* 0xE0 */
+    0x041F, 0x042F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0416, 0x0412, 0x042C, 0x042B, 0x0417, 0x0428, 0x042D, 0x0429, 0x0427, 0x042A, /* 0xF0 */
+};
+
+const struct sb_reverse_entry koi8_r_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0x9A}, {0x00A9, 0xBF}, {0x00B0, 0x9C}, {0x00B2, 0x9D}, {0x00B7, 0x9E}, {0x00F7, 0x9F}, {0x0401, 0xB3}, {0x0410, 0xE1},
+    {0x0411, 0xE2}, {0x0412, 0xF7}, {0x0413, 0xE7}, {0x0414, 0xE4}, {0x0415, 0xE5}, {0x0416, 0xF6}, {0x0417, 0xFA}, {0x0418, 0xE9},
+    {0x0419, 0xEA}, {0x041A, 0xEB}, {0x041B, 0xEC}, {0x041C, 0xED}, {0x041D, 0xEE}, {0x041E, 0xEF}, {0x041F, 0xF0}, {0x0420, 0xF2},
+    {0x0421, 0xF3}, {0x0422, 0xF4}, {0x0423, 0xF5}, {0x0424, 0xE6}, {0x0425, 0xE8}, {0x0426, 0xE3}, {0x0427, 0xFE}, {0x0428, 0xFB},
+    {0x0429, 0xFD}, {0x042A, 0xFF}, {0x042B, 0xF9}, {0x042C, 0xF8}, {0x042D, 0xFC}, {0x042E, 0xE0}, {0x042F, 0xF1}, {0x0430, 0xC1},
+    {0x0431, 0xC2}, {0x0432, 0xD7}, {0x0433, 0xC7}, {0x0434, 0xC4}, {0x0435, 0xC5}, {0x0436, 0xD6}, {0x0437, 0xDA}, {0x0438, 0xC9},
+    {0x0439, 0xCA}, {0x043A, 0xCB}, {0x043B, 0xCC}, {0x043C, 0xCD}, {0x043D, 0xCE}, {0x043E, 0xCF}, {0x043F, 0xD0}, {0x0440, 0xD2},
+    {0x0441, 0xD3}, {0x0442, 0xD4}, {0x0443, 0xD5}, {0x0444, 0xC6}, {0x0445, 0xC8}, {0x0446, 0xC3}, {0x0447, 0xDE}, {0x0448, 0xDB},
+    {0x0449, 0xDD}, {0x044A, 0xDF}, {0x044B, 0xD9}, {0x044C, 0xD8}, {0x044D, 0xDC}, {0x044E, 0xC0}, {0x044F, 0xD1}, {0x0451, 0xA3},
+    {0x2219, 0x95}, {0x221A, 0x96}, {0x2248, 0x97}, {0x2264, 0x98}, {0x2265, 0x99}, {0x2320, 0x93}, {0x2321, 0x9B}, {0x2500, 0x80},
+    {0x2502, 0x81}, {0x250C, 0x82}, {0x2510, 0x83}, {0x2514, 0x84}, {0x2518, 0x85}, {0x251C, 0x86}, {0x2524, 0x87}, {0x252C, 0x88},
+    {0x2534, 0x89}, {0x253C, 0x8A}, {0x2550, 0xA0}, {0x2551, 0xA1}, {0x2552, 0xA2}, {0x2553, 0xA4}, {0x2554, 0xA5}, {0x2555, 0xA6},
+    {0x2556, 0xA7}, {0x2557, 0xA8}, {0x2558, 0xA9}, {0x2559, 0xAA}, {0x255A, 0xAB}, {0x255B, 0xAC}, {0x255C, 0xAD}, {0x255D, 0xAE},
+    {0x255E, 0xAF}, {0x255F, 0xB0}, {0x2560, 0xB1}, {0x2561, 0xB2}, {0x2562, 0xB4}, {0x2563, 0xB5}, {0x2564, 0xB6}, {0x2565, 0xB7},
+    {0x2566, 0xB8}, {0x2567, 0xB9}, {0x2568, 0xBA}, {0x2569, 0xBB}, {0x256A, 0xBC}, {0x256B, 0xBD}, {0x256C, 0xBE}, {0x2580, 0x8B},
+    {0x2584, 0x8C}, {0x2588, 0x8D}, {0x258C, 0x8E}, {0x2590, 0x8F}, {0x2591, 0x90}, {0x2592, 0x91}, {0x2593, 0x92}, {0x25A0, 0x94},
+};
+
+const uint16_t koi8_u_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x2500, 0x2502, 0x250C, 0x2510, 0x2514, 0x2518, 0x251C, 0x2524, 0x252C, 0x2534, 0x253C, 0x2580, 0x2584, 0x2588, 0x258C, 0x2590, /* 0x80 */
+    0x2591, 0x2592, 0x2593, 0x2320, 0x25A0, 0x2219, 0x221A, 0x2248, 0x2264, 0x2265, 0x00A0, 0x2321, 0x00B0, 0x00B2, 0x00B7, 0x00F7, /* 0x90 */
+    0x2550, 0x2551, 0x2552, 0x0451, 0x0454, 0x2554, 0x0456, 0x0457, 0x2557, 0x2558, 0x2559, 0x255A, 0x255B, 0x0491, 0x255D, 0x255E, /* 0xA0 */
+    0x255F, 0x2560, 0x2561, 0x0401, 0x0404, 0x2563, 0x0406, 0x0407, 0x2566, 0x2567, 0x2568, 0x2569, 0x256A, 0x0490, 0x256C, 0x00A9, /* 0xB0 */
+    0x044E, 0x0430, 0x0431, 0x0446, 0x0434, 0x0435, 0x0444, 0x0433, 0x0445, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, /* 0xC0 */
+    0x043F, 0x044F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0436, 0x0432, 0x044C, 0x044B, 0x0437, 0x0448, 0x044D, 0x0449, 0x0447, 0x044A, /* 0xD0 */
+    0x042E, 0x0410, 0x0411, 0x0426, 0x0414, 0x0415, 0x0424, 0x0413, 0x0425, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, /* 0xE0 */
+    0x041F, 0x042F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0416, 0x0412, 0x042C, 0x042B, 0x0417, 0x0428, 0x042D, 0x0429, 0x0427, 0x042A, /* 0xF0 */
+};
+
+const struct sb_reverse_entry koi8_u_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0x9A}, {0x00A9, 0xBF}, {0x00B0, 0x9C}, {0x00B2, 0x9D}, {0x00B7, 0x9E}, {0x00F7, 0x9F}, {0x0401, 0xB3}, {0x0404, 0xB4},
+    {0x0406, 0xB6}, {0x0407, 0xB7}, {0x0410, 0xE1}, {0x0411, 0xE2}, {0x0412, 0xF7}, {0x0413, 0xE7}, {0x0414, 0xE4}, {0x0415, 0xE5},
+    {0x0416, 0xF6}, {0x0417, 0xFA}, {0x0418, 0xE9}, {0x0419, 0xEA}, {0x041A, 0xEB}, {0x041B, 0xEC}, {0x041C, 0xED}, {0x041D, 0xEE},
+    {0x041E, 0xEF}, {0x041F, 0xF0}, {0x0420, 0xF2}, {0x0421, 0xF3}, {0x0422, 0xF4}, {0x0423, 0xF5}, {0x0424, 0xE6}, {0x0425, 0xE8},
+    {0x0426, 0xE3}, {0x0427, 0xFE}, {0x0428, 0xFB}, {0x0429, 0xFD}, {0x042A, 0xFF}, {0x042B, 0xF9}, {0x042C, 0xF8}, {0x042D, 0xFC},
+    {0x042E, 0xE0}, {0x042F, 0xF1}, {0x0430, 0xC1}, {0x0431, 0xC2}, {0x0432, 0xD7}, {0x0433, 0xC7}, {0x0434, 0xC4}, {0x0435, 0xC5},
+    {0x0436, 0xD6}, {0x0437, 0xDA}, {0x0438, 0xC9}, {0x0439, 0xCA}, {0x043A, 0xCB}, {0x043B, 0xCC}, {0x043C, 0xCD}, {0x043D, 0xCE},
+    {0x043E, 0xCF}, {0x043F, 0xD0}, {0x0440, 0xD2}, {0x0441, 0xD3}, {0x0442, 0xD4}, {0x0443, 0xD5}, {0x0444, 0xC6}, {0x0445, 0xC8},
+    {0x0446, 0xC3}, {0x0447, 0xDE}, {0x0448, 0xDB}, {0x0449, 0xDD}, {0x044A, 0xDF}, {0x044B, 0xD9}, {0x044C, 0xD8}, {0x044D, 0xDC},
+    {0x044E, 0xC0}, {0x044F, 0xD1}, {0x0451, 0xA3}, {0x0454, 0xA4}, {0x0456, 0xA6}, {0x0457, 0xA7}, {0x0490, 0xBD}, {0x0491, 0xAD},
+    {0x2219, 0x95}, {0x221A, 0x96}, {0x2248, 0x97}, {0x2264, 0x98}, {0x2265, 0x99}, {0x2320, 0x93}, {0x2321, 0x9B}, {0x2500, 0x80},
+    {0x2502, 0x81}, {0x250C, 0x82}, {0x2510, 0x83}, {0x2514, 0x84}, {0x2518, 0x85}, {0x251C, 0x86}, {0x2524, 0x87}, {0x252C, 0x88},
+    {0x2534, 0x89}, {0x253C, 0x8A}, {0x2550, 0xA0}, {0x2551, 0xA1}, {0x2552, 0xA2}, {0x2554, 0xA5}, {0x2557, 0xA8}, {0x2558, 0xA9},
+    {0x2559, 0xAA}, {0x255A, 0xAB}, {0x255B, 0xAC}, {0x255D, 0xAE}, {0x255E, 0xAF}, {0x255F, 0xB0}, {0x2560, 0xB1}, {0x2561, 0xB2},
+    {0x2563, 0xB5}, {0x2566, 0xB8}, {0x2567, 0xB9}, {0x2568, 0xBA}, {0x2569, 0xBB}, {0x256A, 0xBC}, {0x256C, 0xBE}, {0x2580, 0x8B},
+    {0x2584, 0x8C}, {0x2588, 0x8D}, {0x258C, 0x8E}, {0x2590, 0x8F}, {0x2591, 0x90}, {0x2592, 0x91}, {0x2593, 0x92}, {0x25A0, 0x94},
+};
+
+const uint16_t mac_roman_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C4, 0x00C5, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1, 0x00E0, 0x00E2, 0x00E4, 0x00E3, 0x00E5, 0x00E7, 0x00E9, 0x00E8, /* 0x80 */
+    0x00EA, 0x00EB, 0x00ED, 0x00EC, 0x00EE, 0x00EF, 0x00F1, 0x00F3, 0x00F2, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x00F9, 0x00FB, 0x00FC, /* 0x90 */
+    0x2020, 0x00B0, 0x00A2, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x00DF, 0x00AE, 0x00A9, 0x2122, 0x00B4, 0x00A8, 0x2260, 0x00C6, 0x00D8, /* 0xA0 */
+    0x221E, 0x00B1, 0x2264, 0x2265, 0x00A5, 0x00B5, 0x2202, 0x2211, 0x220F, 0x03C0, 0x222B, 0x00AA, 0x00BA, 0x03A9, 0x00E6, 0x00F8, /* 0xB0 */
+    0x00BF, 0x00A1, 0x00AC, 0x221A, 0x0192, 0x2248, 0x2206, 0x00AB, 0x00BB, 0x2026, 0x00A0, 0x00C0, 0x00C3, 0x00D5, 0x0152, 0x0153, /* 0xC0 */
+    0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x25CA, 0x00FF, 0x0178, 0x2044, 0x20AC, 0x2039, 0x203A, 0xFB01, 0xFB02, /* 0xD0 */
+    0x2021, 0x00B7, 0x201A, 0x201E, 0x2030, 0x00C2, 0x00CA, 0x00C1, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x00D3, 0x00D4, /* 0xE0 */
+    0xF8FF, 0x00D2, 0x00DA, 0x00DB, 0x00D9, 0x0131, 0x02C6, 0x02DC, 0x00AF, 0x02D8, 0x02D9, 0x02DA, 0x00B8, 0x02DD, 0x02DB, 0x02C7, /* 0xF0 */
+};
+
+const struct sb_reverse_entry mac_roman_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xCA}, {0x00A1, 0xC1}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A5, 0xB4}, {0x00A7, 0xA4}, {0x00A8, 0xAC}, {0x00A9, 0xA9},
+    {0x00AA, 0xBB}, {0x00AB, 0xC7}, {0x00AC, 0xC2}, {0x00AE, 0xA8}, {0x00AF, 0xF8}, {0x00B0, 0xA1}, {0x00B1, 0xB1}, {0x00B4, 0xAB},
+    {0x00B5, 0xB5}, {0x00B6, 0xA6}, {0x00B7, 0xE1}, {0x00B8, 0xFC}, {0x00BA, 0xBC}, {0x00BB, 0xC8}, {0x00BF, 0xC0}, {0x00C0, 0xCB},
+    {0x00C1, 0xE7}, {0x00C2, 0xE5}, {0x00C3, 0xCC}, {0x00C4, 0x80}, {0x00C5, 0x81}, {0x00C6, 0xAE}, {0x00C7, 0x82}, {0x00C8, 0xE9},
+    {0x00C9, 0x83}, {0x00CA, 0xE6}, {0x00CB, 0xE8}, {0x00CC, 0xED}, {0x00CD, 0xEA}, {0x00CE, 0xEB}, {0x00CF, 0xEC}, {0x00D1, 0x84},
+    {0x00D2, 0xF1}, {0x00D3, 0xEE}, {0x00D4, 0xEF}, {0x00D5, 0xCD}, {0x00D6, 0x85}, {0x00D8, 0xAF}, {0x00D9, 0xF4}, {0x00DA, 0xF2},
+    {0x00DB, 0xF3}, {0x00DC, 0x86}, {0x00DF, 0xA7}, {0x00E0, 0x88}, {0x00E1, 0x87}, {0x00E2, 0x89}, {0x00E3, 0x8B}, {0x00E4, 0x8A},
+    {0x00E5, 0x8C}, {0x00E6, 0xBE}, {0x00E7, 0x8D}, {0x00E8, 0x8F}, {0x00E9, 0x8E}, {0x00EA, 0x90}, {0x00EB, 0x91}, {0x00EC, 0x93},
+    {0x00ED, 0x92}, {0x00EE, 0x94}, {0x00EF, 0x95}, {0x00F1, 0x96}, {0x00F2, 0x98}, {0x00F3, 0x97}, {0x00F4, 0x99}, {0x00F5, 0x9B},
+    {0x00F6, 0x9A}, {0x00F7, 0xD6}, {0x00F8, 0xBF}, {0x00F9, 0x9D}, {0x00FA, 0x9C}, {0x00FB, 0x9E}, {0x00FC, 0x9F}, {0x00FF, 0xD8},
+    {0x0131, 0xF5}, {0x0152, 0xCE}, {0x0153, 0xCF}, {0x0178, 0xD9}, {0x0192, 0xC4}, {0x02C6, 0xF6}, {0x02C7, 0xFF}, {0x02D8, 0xF9},
+    {0x02D9, 0xFA}, {0x02DA, 0xFB}, {0x02DB, 0xFE}, {0x02DC, 0xF7}, {0x02DD, 0xFD}, {0x03A9, 0xBD}, {0x03C0, 0xB9}, {0x2013, 0xD0},
+    {0x2014, 0xD1}, {0x2018, 0xD4}, {0x2019, 0xD5}, {0x201A, 0xE2}, {0x201C, 0xD2}, {0x201D, 0xD3}, {0x201E, 0xE3}, {0x2020, 0xA0},
+    {0x2021, 0xE0}, {0x2022, 0xA5}, {0x2026, 0xC9}, {0x2030, 0xE4}, {0x2039, 0xDC}, {0x203A, 0xDD}, {0x2044, 0xDA}, {0x20AC, 0xDB},
+    {0x2122, 0xAA}, {0x2202, 0xB6}, {0x2206, 0xC6}, {0x220F, 0xB8}, {0x2211, 0xB7}, {0x221A, 0xC3}, {0x221E, 0xB0}, {0x222B, 0xBA},
+    {0x2248, 0xC5}, {0x2260, 0xAD}, {0x2264, 0xB2}, {0x2265, 0xB3}, {0x25CA, 0xD7}, {0xF8FF, 0xF0}, {0xFB01, 0xDE}, {0xFB02, 0xDF},
+};
+
+const uint16_t mac_cyrillic_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F, /* 0x80 */
+    0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F, /* 0x90 */
+    0x2020, 0x00B0, 0x0490, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x0406, 0x00AE, 0x00A9, 0x2122, 0x0402, 0x0452, 0x2260, 0x0403, 0x0453, /* 0xA0 */
+    0x221E, 0x00B1, 0x2264, 0x2265, 0x0456, 0x00B5, 0x0491, 0x0408, 0x0404, 0x0454, 0x0407, 0x0457, 0x0409, 0x0459, 0x040A, 0x045A, /* 0xB0 */
+    0x0458, 0x0405, 0x00AC, 0x221A, 0x0192, 0x2248, 0x2206, 0x00AB, 0x00BB, 0x2026, 0x00A0, 0x040B, 0x045B, 0x040C, 0x045C, 0x0455, /* 0xC0 */
+    0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x201E, 0x040E, 0x045E, 0x040F, 0x045F, 0x2116, 0x0401, 0x0451, 0x044F, /* 0xD0 */
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, /* 0xE0 */
+    0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x20AC, /* 0xF0 */
+};
+
+const struct sb_reverse_entry mac_cyrillic_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xCA}, {0x00A3, 0xA3}, {0x00A7, 0xA4}, {0x00A9, 0xA9}, {0x00AB, 0xC7}, {0x00AC, 0xC2}, {0x00AE, 0xA8}, {0x00B0, 0xA1},
+    {0x00B1, 0xB1}, {0x00B5, 0xB5}, {0x00B6, 0xA6}, {0x00BB, 0xC8}, {0x00F7, 0xD6}, {0x0192, 0xC4}, {0x0401, 0xDD}, {0x0402, 0xAB},
+    {0x0403, 0xAE}, {0x0404, 0xB8}, {0x0405, 0xC1}, {0x0406, 0xA7}, {0x0407, 0xBA}, {0x0408, 0xB7}, {0x0409, 0xBC}, {0x040A, 0xBE},
+    {0x040B, 0xCB}, {0x040C, 0xCD}, {0x040E, 0xD8}, {0x040F, 0xDA}, {0x0410, 0x80}, {0x0411, 0x81}, {0x0412, 0x82}, {0x0413, 0x83},
+    {0x0414, 0x84}, {0x0415, 0x85}, {0x0416, 0x86}, {0x0417, 0x87}, {0x0418, 0x88}, {0x0419, 0x89}, {0x041A, 0x8A}, {0x041B, 0x8B},
+    {0x041C, 0x8C}, {0x041D, 0x8D}, {0x041E, 0x8E}, {0x041F, 0x8F}, {0x0420, 0x90}, {0x0421, 0x91}, {0x0422, 0x92}, {0x0423, 0x93},
+    {0x0424, 0x94}, {0x0425, 0x95}, {0x0426, 0x96}, {0x0427, 0x97}, {0x0428, 0x98}, {0x0429, 0x99}, {0x042A, 0x9A}, {0x042B, 0x9B},
+    {0x042C, 0x9C}, {0x042D, 0x9D}, {0x042E, 0x9E}, {0x042F, 0x9F}, {0x0430, 0xE0}, {0x0431, 0xE1}, {0x0432, 0xE2}, {0x0433, 0xE3},
+    {0x0434, 0xE4}, {0x0435, 0xE5}, {0x0436, 0xE6}, {0x0437, 0xE7}, {0x0438, 0xE8}, {0x0439, 0xE9}, {0x043A, 0xEA}, {0x043B, 0xEB},
+    {0x043C, 0xEC}, {0x043D, 0xED}, {0x043E, 0xEE}, {0x043F, 0xEF}, {0x0440, 0xF0}, {0x0441, 0xF1}, {0x0442, 0xF2}, {0x0443, 0xF3},
+    {0x0444, 0xF4}, {0x0445, 0xF5}, {0x0446, 0xF6}, {0x0447, 0xF7}, {0x0448, 0xF8}, {0x0449, 0xF9}, {0x044A, 0xFA}, {0x044B, 0xFB},
+    {0x044C, 0xFC}, {0x044D, 0xFD}, {0x044E, 0xFE}, {0x044F, 0xDF}, {0x0451, 0xDE}, {0x0452, 0xAC}, {0x0453, 0xAF}, {0x0454, 0xB9},
+    {0x0455, 0xCF}, {0x0456, 0xB4}, {0x0457, 0xBB}, {0x0458, 0xC0}, {0x0459, 0xBD}, {0x045A, 0xBF}, {0x045B, 0xCC}, {0x045C, 0xCE},
+    {0x045E, 0xD9}, {0x045F, 0xDB}, {0x0490, 0xA2}, {0x0491, 0xB6}, {0x2013, 0xD0}, {0x2014, 0xD1}, {0x2018, 0xD4}, {0x2019, 0xD5},
+    {0x201C, 0xD2}, {0x201D, 0xD3}, {0x201E, 0xD7}, {0x2020, 0xA0}, {0x2022, 0xA5}, {0x2026, 0xC9}, {0x20AC, 0xFF}, {0x2116, 0xDC},
+    {0x2122, 0xAA}, {0x2206, 0xC6}, {0x221A, 0xC3}, {0x221E, 0xB0}, {0x2248, 0xC5}, {0x2260, 0xAD}, {0x2264, 0xB2}, {0x2265, 0xB3},
+};
+
+const uint16_t mac_greek_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C4, 0x00B9, 0x00B2, 0x00C9, 0x00B3, 0x00D6, 0x00DC, 0x0385, 0x00E0, 0x00E2, 0x00E4, 0x0384, 0x00A8, 0x00E7, 0x00E9, 0x00E8, /* 0x80 */
+    0x00EA, 0x00EB, 0x00A3, 0x2122, 0x00EE, 0x00EF, 0x2022, 0x00BD, 0x2030, 0x00F4, 0x00F6, 0x00A6, 0x20AC, 0x00F9, 0x00FB, 0x00FC, /* 0x90 */
+    0x2020, 0x0393, 0x0394, 0x0398, 0x039B, 0x039E, 0x03A0, 0x00DF, 0x00AE, 0x00A9, 0x03A3, 0x03AA, 0x00A7, 0x2260, 0x00B0, 0x00B7, /* 0xA0 */
+    0x0391, 0x00B1, 0x2264, 0x2265, 0x00A5, 0x0392, 0x0395, 0x0396, 0x0397, 0x0399, 0x039A, 0x039C, 0x03A6, 0x03AB, 0x03A8, 0x03A9, /* 0xB0 */
+    0x03AC, 0x039D, 0x00AC, 0x039F, 0x03A1, 0x2248, 0x03A4, 0x00AB, 0x00BB, 0x2026, 0x00A0, 0x03A5, 0x03A7, 0x0386, 0x0388, 0x0153, /* 0xC0 */
+    0x2013, 0x2015, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x0389, 0x038A, 0x038C, 0x038E, 0x03AD, 0x03AE, 0x03AF, 0x03CC, 0x038F, /* 0xD0 */
+    0x03CD, 0x03B1, 0x03B2, 0x03C8, 0x03B4, 0x03B5, 0x03C6, 0x03B3, 0x03B7, 0x03B9, 0x03BE, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BF, /* 0xE0 */
+    0x03C0, 0x03CE, 0x03C1, 0x03C3, 0x03C4, 0x03B8, 0x03C9, 0x03C2, 0x03C7, 0x03C5, 0x03B6, 0x03CA, 0x03CB, 0x0390, 0x03B0, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry mac_greek_from_unicode[255] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xCA}, {0x00A3, 0x92}, {0x00A5, 0xB4}, {0x00A6, 0x9B}, {0x00A7, 0xAC}, {0x00A8, 0x8C}, {0x00A9, 0xA9}, {0x00AB, 0xC7},
+    {0x00AC, 0xC2}, {0x00AE, 0xA8}, {0x00B0, 0xAE}, {0x00B1, 0xB1}, {0x00B2, 0x82}, {0x00B3, 0x84}, {0x00B7, 0xAF}, {0x00B9, 0x81},
+    {0x00BB, 0xC8}, {0x00BD, 0x97}, {0x00C4, 0x80}, {0x00C9, 0x83}, {0x00D6, 0x85}, {0x00DC, 0x86}, {0x00DF, 0xA7}, {0x00E0, 0x88},
+    {0x00E2, 0x89}, {0x00E4, 0x8A}, {0x00E7, 0x8D}, {0x00E8, 0x8F}, {0x00E9, 0x8E}, {0x00EA, 0x90}, {0x00EB, 0x91}, {0x00EE, 0x94},
+    {0x00EF, 0x95}, {0x00F4, 0x99}, {0x00F6, 0x9A}, {0x00F7, 0xD6}, {0x00F9, 0x9D}, {0x00FB, 0x9E}, {0x00FC, 0x9F}, {0x0153, 0xCF},
+    {0x0384, 0x8B}, {0x0385, 0x87}, {0x0386, 0xCD}, {0x0388, 0xCE}, {0x0389, 0xD7}, {0x038A, 0xD8}, {0x038C, 0xD9}, {0x038E, 0xDA},
+    {0x038F, 0xDF}, {0x0390, 0xFD}, {0x0391, 0xB0}, {0x0392, 0xB5}, {0x0393, 0xA1}, {0x0394, 0xA2}, {0x0395, 0xB6}, {0x0396, 0xB7},
+    {0x0397, 0xB8}, {0x0398, 0xA3}, {0x0399, 0xB9}, {0x039A, 0xBA}, {0x039B, 0xA4}, {0x039C, 0xBB}, {0x039D, 0xC1}, {0x039E, 0xA5},
+    {0x039F, 0xC3}, {0x03A0, 0xA6}, {0x03A1, 0xC4}, {0x03A3, 0xAA}, {0x03A4, 0xC6}, {0x03A5, 0xCB}, {0x03A6, 0xBC}, {0x03A7, 0xCC},
+    {0x03A8, 0xBE}, {0x03A9, 0xBF}, {0x03AA, 0xAB}, {0x03AB, 0xBD}, {0x03AC, 0xC0}, {0x03AD, 0xDB}, {0x03AE, 0xDC}, {0x03AF, 0xDD},
+    {0x03B0, 0xFE}, {0x03B1, 0xE1}, {0x03B2, 0xE2}, {0x03B3, 0xE7}, {0x03B4, 0xE4}, {0x03B5, 0xE5}, {0x03B6, 0xFA}, {0x03B7, 0xE8},
+    {0x03B8, 0xF5}, {0x03B9, 0xE9}, {0x03BA, 0xEB}, {0x03BB, 0xEC}, {0x03BC, 0xED}, {0x03BD, 0xEE}, {0x03BE, 0xEA}, {0x03BF, 0xEF},
+    {0x03C0, 0xF0}, {0x03C1, 0xF2}, {0x03C2, 0xF7}, {0x03C3, 0xF3}, {0x03C4, 0xF4}, {0x03C5, 0xF9}, {0x03C6, 0xE6}, {0x03C7, 0xF8},
+    {0x03C8, 0xE3}, {0x03C9, 0xF6}, {0x03CA, 0xFB}, {0x03CB, 0xFC}, {0x03CC, 0xDE}, {0x03CD, 0xE0}, {0x03CE, 0xF1}, {0x2013, 0xD0},
+    {0x2015, 0xD1}, {0x2018, 0xD4}, {0x2019, 0xD5}, {0x201C, 0xD2}, {0x201D, 0xD3}, {0x2020, 0xA0}, {0x2022, 0x96}, {0x2026, 0xC9},
+    {0x2030, 0x98}, {0x20AC, 0x9C}, {0x2122, 0x93}, {0x2248, 0xC5}, {0x2260, 0xAD}, {0x2264, 0xB2}, {0x2265, 0xB3},
+};
+
+const uint16_t mac_turkish_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C4, 0x00C5, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1, 0x00E0, 0x00E2, 0x00E4, 0x00E3, 0x00E5, 0x00E7, 0x00E9, 0x00E8, /* 0x80 */
+    0x00EA, 0x00EB, 0x00ED, 0x00EC, 0x00EE, 0x00EF, 0x00F1, 0x00F3, 0x00F2, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x00F9, 0x00FB, 0x00FC, /* 0x90 */
+    0x2020, 0x00B0, 0x00A2, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x00DF, 0x00AE, 0x00A9, 0x2122, 0x00B4, 0x00A8, 0x2260, 0x00C6, 0x00D8, /* 0xA0 */
+    0x221E, 0x00B1, 0x2264, 0x2265, 0x00A5, 0x00B5, 0x2202, 0x2211, 0x220F, 0x03C0, 0x222B, 0x00AA, 0x00BA, 0x03A9, 0x00E6, 0x00F8, /* 0xB0 */
+    0x00BF, 0x00A1, 0x00AC, 0x221A, 0x0192, 0x2248, 0x2206, 0x00AB, 0x00BB, 0x2026, 0x00A0, 0x00C0, 0x00C3, 0x00D5, 0x0152, 0x0153, /* 0xC0 */
+    0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x25CA, 0x00FF, 0x0178, 0x011E, 0x011F, 0x0130, 0x0131, 0x015E, 0x015F, /* 0xD0 */
+    0x2021, 0x00B7, 0x201A, 0x201E, 0x2030, 0x00C2, 0x00CA, 0x00C1, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x00D3, 0x00D4, /* 0xE0 */
+    0xF8FF, 0x00D2, 0x00DA, 0x00DB, 0x00D9, 0xFFFD, 0x02C6, 0x02DC, 0x00AF, 0x02D8, 0x02D9, 0x02DA, 0x00B8, 0x02DD, 0x02DB, 0x02C7, /* 0xF0 */
+};
+
+const struct sb_reverse_entry mac_turkish_from_unicode[255] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xCA}, {0x00A1, 0xC1}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A5, 0xB4}, {0x00A7, 0xA4}, {0x00A8, 0xAC}, {0x00A9, 0xA9},
+    {0x00AA, 0xBB}, {0x00AB, 0xC7}, {0x00AC, 0xC2}, {0x00AE, 0xA8}, {0x00AF, 0xF8}, {0x00B0, 0xA1}, {0x00B1, 0xB1}, {0x00B4, 0xAB},
+    {0x00B5, 0xB5}, {0x00B6, 0xA6}, {0x00B7, 0xE1}, {0x00B8, 0xFC}, {0x00BA, 0xBC}, {0x00BB, 0xC8}, {0x00BF, 0xC0}, {0x00C0, 0xCB},
+    {0x00C1, 0xE7}, {0x00C2, 0xE5}, {0x00C3, 0xCC}, {0x00C4, 0x80}, {0x00C5, 0x81}, {0x00C6, 0xAE}, {0x00C7, 0x82}, {0x00C8, 0xE9},
+    {0x00C9, 0x83}, {0x00CA, 0xE6}, {0x00CB, 0xE8}, {0x00CC, 0xED}, {0x00CD, 0xEA}, {0x00CE, 0xEB}, {0x00CF, 0xEC}, {0x00D1, 0x84},
+    {0x00D2, 0xF1}, {0x00D3, 0xEE}, {0x00D4, 0xEF}, {0x00D5, 0xCD}, {0x00D6, 0x85}, {0x00D8, 0xAF}, {0x00D9, 0xF4}, {0x00DA, 0xF2},
+    {0x00DB, 0xF3}, {0x00DC, 0x86}, {0x00DF, 0xA7}, {0x00E0, 0x88}, {0x00E1, 0x87}, {0x00E2, 0x89}, {0x00E3, 0x8B}, {0x00E4, 0x8A},
+    {0x00E5, 0x8C}, {0x00E6, 0xBE}, {0x00E7, 0x8D}, {0x00E8, 0x8F}, {0x00E9, 0x8E}, {0x00EA, 0x90}, {0x00EB, 0x91}, {0x00EC, 0x93},
+    {0x00ED, 0x92}, {0x00EE, 0x94}, {0x00EF, 0x95}, {0x00F1, 0x96}, {0x00F2, 0x98}, {0x00F3, 0x97}, {0x00F4, 0x99}, {0x00F5, 0x9B},
+    {0x00F6, 0x9A}, {0x00F7, 0xD6}, {0x00F8, 0xBF}, {0x00F9, 0x9D}, {0x00FA, 0x9C}, {0x00FB, 0x9E}, {0x00FC, 0x9F}, {0x00FF, 0xD8},
+    {0x011E, 0xDA}, {0x011F, 0xDB}, {0x0130, 0xDC}, {0x0131, 0xDD}, {0x0152, 0xCE}, {0x0153, 0xCF}, {0x015E, 0xDE}, {0x015F, 0xDF},
+    {0x0178, 0xD9}, {0x0192, 0xC4}, {0x02C6, 0xF6}, {0x02C7, 0xFF}, {0x02D8, 0xF9}, {0x02D9, 0xFA}, {0x02DA, 0xFB}, {0x02DB, 0xFE},
+    {0x02DC, 0xF7}, {0x02DD, 0xFD}, {0x03A9, 0xBD}, {0x03C0, 0xB9}, {0x2013, 0xD0}, {0x2014, 0xD1}, {0x2018, 0xD4}, {0x2019, 0xD5},
+    {0x201A, 0xE2}, {0x201C, 0xD2}, {0x201D, 0xD3}, {0x201E, 0xE3}, {0x2020, 0xA0}, {0x2021, 0xE0}, {0x2022, 0xA5}, {0x2026, 0xC9},
+    {0x2030, 0xE4}, {0x2122, 0xAA}, {0x2202, 0xB6}, {0x2206, 0xC6}, {0x220F, 0xB8}, {0x2211, 0xB7}, {0x221A, 0xC3}, {0x221E, 0xB0},
+    {0x222B, 0xBA}, {0x2248, 0xC5}, {0x2260, 0xAD}, {0x2264, 0xB2}, {0x2265, 0xB3}, {0x25CA, 0xD7}, {0xF8FF, 0xF0},
+};
+
+const uint16_t mac_central_europe_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C4, 0x0100, 0x0101, 0x00C9, 0x0104, 0x00D6, 0x00DC, 0x00E1, 0x0105, 0x010C, 0x00E4, 0x010D, 0x0106, 0x0107, 0x00E9, 0x0179, /* 0x80 */
+    0x017A, 0x010E, 0x00ED, 0x010F, 0x0112, 0x0113, 0x0116, 0x00F3, 0x0117, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x011A, 0x011B, 0x00FC, /* 0x90 */
+    0x2020, 0x00B0, 0x0118, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x00DF, 0x00AE, 0x00A9, 0x2122, 0x0119, 0x00A8, 0x2260, 0x0123, 0x012E, /* 0xA0 */
+    0x012F, 0x012A, 0x2264, 0x2265, 0x012B, 0x0136, 0x2202, 0x2211, 0x0142, 0x013B, 0x013C, 0x013D, 0x013E, 0x0139, 0x013A, 0x0145, /* 0xB0 */
+    0x0146, 0x0143, 0x00AC, 0x221A, 0x0144, 0x0147, 0x2206, 0x00AB, 0x00BB, 0x2026, 0x00A0, 0x0148, 0x0150, 0x00D5, 0x0151, 0x014C, /* 0xC0 */
+    0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x25CA, 0x014D, 0x0154, 0x0155, 0x0158, 0x2039, 0x203A, 0x0159, 0x0156, /* 0xD0 */
+    0x0157, 0x0160, 0x201A, 0x201E, 0x0161, 0x015A, 0x015B, 0x00C1, 0x0164, 0x0165, 0x00CD, 0x017D, 0x017E, 0x016A, 0x00D3, 0x00D4, /* 0xE0 */
+    0x016B, 0x016E, 0x00DA, 0x016F, 0x0170, 0x0171, 0x0172, 0x0173, 0x00DD, 0x00FD, 0x0137, 0x017B, 0x0141, 0x017C, 0x0122, 0x02C7, /* 0xF0 */
+};
+
+const struct sb_reverse_entry mac_central_europe_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xCA}, {0x00A3, 0xA3}, {0x00A7, 0xA4}, {0x00A8, 0xAC}, {0x00A9, 0xA9}, {0x00AB, 0xC7}, {0x00AC, 0xC2}, {0x00AE, 0xA8},
+    {0x00B0, 0xA1}, {0x00B6, 0xA6}, {0x00BB, 0xC8}, {0x00C1, 0xE7}, {0x00C4, 0x80}, {0x00C9, 0x83}, {0x00CD, 0xEA}, {0x00D3, 0xEE},
+    {0x00D4, 0xEF}, {0x00D5, 0xCD}, {0x00D6, 0x85}, {0x00DA, 0xF2}, {0x00DC, 0x86}, {0x00DD, 0xF8}, {0x00DF, 0xA7}, {0x00E1, 0x87},
+    {0x00E4, 0x8A}, {0x00E9, 0x8E}, {0x00ED, 0x92}, {0x00F3, 0x97}, {0x00F4, 0x99}, {0x00F5, 0x9B}, {0x00F6, 0x9A}, {0x00F7, 0xD6},
+    {0x00FA, 0x9C}, {0x00FC, 0x9F}, {0x00FD, 0xF9}, {0x0100, 0x81}, {0x0101, 0x82}, {0x0104, 0x84}, {0x0105, 0x88}, {0x0106, 0x8C},
+    {0x0107, 0x8D}, {0x010C, 0x89}, {0x010D, 0x8B}, {0x010E, 0x91}, {0x010F, 0x93}, {0x0112, 0x94}, {0x0113, 0x95}, {0x0116, 0x96},
+    {0x0117, 0x98}, {0x0118, 0xA2}, {0x0119, 0xAB}, {0x011A, 0x9D}, {0x011B, 0x9E}, {0x0122, 0xFE}, {0x0123, 0xAE}, {0x012A, 0xB1},
+    {0x012B, 0xB4}, {0x012E, 0xAF}, {0x012F, 0xB0}, {0x0136, 0xB5}, {0x0137, 0xFA}, {0x0139, 0xBD}, {0x013A, 0xBE}, {0x013B, 0xB9},
+    {0x013C, 0xBA}, {0x013D, 0xBB}, {0x013E, 0xBC}, {0x0141, 0xFC}, {0x0142, 0xB8}, {0x0143, 0xC1}, {0x0144, 0xC4}, {0x0145, 0xBF},
+    {0x0146, 0xC0}, {0x0147, 0xC5}, {0x0148, 0xCB}, {0x014C, 0xCF}, {0x014D, 0xD8}, {0x0150, 0xCC}, {0x0151, 0xCE}, {0x0154, 0xD9},
+    {0x0155, 0xDA}, {0x0156, 0xDF}, {0x0157, 0xE0}, {0x0158, 0xDB}, {0x0159, 0xDE}, {0x015A, 0xE5}, {0x015B, 0xE6}, {0x0160, 0xE1},
+    {0x0161, 0xE4}, {0x0164, 0xE8}, {0x0165, 0xE9}, {0x016A, 0xED}, {0x016B, 0xF0}, {0x016E, 0xF1}, {0x016F, 0xF3}, {0x0170, 0xF4},
+    {0x0171, 0xF5}, {0x0172, 0xF6}, {0x0173, 0xF7}, {0x0179, 0x8F}, {0x017A, 0x90}, {0x017B, 0xFB}, {0x017C, 0xFD}, {0x017D, 0xEB},
+    {0x017E, 0xEC}, {0x02C7, 0xFF}, {0x2013, 0xD0}, {0x2014, 0xD1}, {0x2018, 0xD4}, {0x2019, 0xD5}, {0x201A, 0xE2}, {0x201C, 0xD2},
+    {0x201D, 0xD3}, {0x201E, 0xE3}, {0x2020, 0xA0}, {0x2022, 0xA5}, {0x2026, 0xC9}, {0x2039, 0xDC}, {0x203A, 0xDD}, {0x2122, 0xAA},
+    {0x2202, 0xB6}, {0x2206, 0xC6}, {0x2211, 0xB7}, {0x221A, 0xC3}, {0x2260, 0xAD}, {0x2264, 0xB2}, {0x2265, 0xB3}, {0x25CA, 0xD7},
+};
+
+const uint16_t mac_icelandic_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C4, 0x00C5, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1, 0x00E0, 0x00E2, 0x00E4, 0x00E3, 0x00E5, 0x00E7, 0x00E9, 0x00E8, /* 0x80 */
+    0x00EA, 0x00EB, 0x00ED, 0x00EC, 0x00EE, 0x00EF, 0x00F1, 0x00F3, 0x00F2, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x00F9, 0x00FB, 0x00FC, /* 0x90 */
+    0x00DD, 0x00B0, 0x00A2, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x00DF, 0x00AE, 0x00A9, 0x2122, 0x00B4, 0x00A8, 0x2260, 0x00C6, 0x00D8, /* 0xA0 */
+    0x221E, 0x00B1, 0x2264, 0x2265, 0x00A5, 0x00B5, 0x2202, 0x2211, 0x220F, 0x03C0, 0x222B, 0x00AA, 0x00BA, 0x03A9, 0x00E6, 0x00F8, /* 0xB0 */
+    0x00BF, 0x00A1, 0x00AC, 0x221A, 0x0192, 0x2248, 0x2206, 0x00AB, 0x00BB, 0x2026, 0x00A0, 0x00C0, 0x00C3, 0x00D5, 0x0152, 0x0153, /* 0xC0 */
+    0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x25CA, 0x00FF, 0x0178, 0x2044, 0x20AC, 0x00D0, 0x00F0, 0x00DE, 0x00FE, /* 0xD0 */
+    0x00FD, 0x00B7, 0x201A, 0x201E, 0x2030, 0x00C2, 0x00CA, 0x00C1, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x00D3, 0x00D4, /* 0xE0 */
+    0xF8FF, 0x00D2, 0x00DA, 0x00DB, 0x00D9, 0x0131, 0x02C6, 0x02DC, 0x00AF, 0x02D8, 0x02D9, 0x02DA, 0x00B8, 0x02DD, 0x02DB, 0x02C7, /* 0xF0 */
+};
+
+const struct sb_reverse_entry mac_icelandic_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xCA}, {0x00A1, 0xC1}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A5, 0xB4}, {0x00A7, 0xA4}, {0x00A8, 0xAC}, {0x00A9, 0xA9},
+    {0x00AA, 0xBB}, {0x00AB, 0xC7}, {0x00AC, 0xC2}, {0x00AE, 0xA8}, {0x00AF, 0xF8}, {0x00B0, 0xA1}, {0x00B1, 0xB1}, {0x00B4, 0xAB},
+    {0x00B5, 0xB5}, {0x00B6, 0xA6}, {0x00B7, 0xE1}, {0x00B8, 0xFC}, {0x00BA, 0xBC}, {0x00BB, 0xC8}, {0x00BF, 0xC0}, {0x00C0, 0xCB},
+    {0x00C1, 0xE7}, {0x00C2, 0xE5}, {0x00C3, 0xCC}, {0x00C4, 0x80}, {0x00C5, 0x81}, {0x00C6, 0xAE}, {0x00C7, 0x82}, {0x00C8, 0xE9},
+    {0x00C9, 0x83}, {0x00CA, 0xE6}, {0x00CB, 0xE8}, {0x00CC, 0xED}, {0x00CD, 0xEA}, {0x00CE, 0xEB}, {0x00CF, 0xEC}, {0x00D0, 0xDC},
+    {0x00D1, 0x84}, {0x00D2, 0xF1}, {0x00D3, 0xEE}, {0x00D4, 0xEF}, {0x00D5, 0xCD}, {0x00D6, 0x85}, {0x00D8, 0xAF}, {0x00D9, 0xF4},
+    {0x00DA, 0xF2}, {0x00DB, 0xF3}, {0x00DC, 0x86}, {0x00DD, 0xA0}, {0x00DE, 0xDE}, {0x00DF, 0xA7}, {0x00E0, 0x88}, {0x00E1, 0x87},
+    {0x00E2, 0x89}, {0x00E3, 0x8B}, {0x00E4, 0x8A}, {0x00E5, 0x8C}, {0x00E6, 0xBE}, {0x00E7, 0x8D}, {0x00E8, 0x8F}, {0x00E9, 0x8E},
+    {0x00EA, 0x90}, {0x00EB, 0x91}, {0x00EC, 0x93}, {0x00ED, 0x92}, {0x00EE, 0x94}, {0x00EF, 0x95}, {0x00F0, 0xDD}, {0x00F1, 0x96},
+    {0x00F2, 0x98}, {0x00F3, 0x97}, {0x00F4, 0x99}, {0x00F5, 0x9B}, {0x00F6, 0x9A}, {0x00F7, 0xD6}, {0x00F8, 0xBF}, {0x00F9, 0x9D},
+    {0x00FA, 0x9C}, {0x00FB, 0x9E}, {0x00FC, 0x9F}, {0x00FD, 0xE0}, {0x00FE, 0xDF}, {0x00FF, 0xD8}, {0x0131, 0xF5}, {0x0152, 0xCE},
+    {0x0153, 0xCF}, {0x0178, 0xD9}, {0x0192, 0xC4}, {0x02C6, 0xF6}, {0x02C7, 0xFF}, {0x02D8, 0xF9}, {0x02D9, 0xFA}, {0x02DA, 0xFB},
+    {0x02DB, 0xFE}, {0x02DC, 0xF7}, {0x02DD, 0xFD}, {0x03A9, 0xBD}, {0x03C0, 0xB9}, {0x2013, 0xD0}, {0x2014, 0xD1}, {0x2018, 0xD4},
+    {0x2019, 0xD5}, {0x201A, 0xE2}, {0x201C, 0xD2}, {0x201D, 0xD3}, {0x201E, 0xE3}, {0x2022, 0xA5}, {0x2026, 0xC9}, {0x2030, 0xE4},
+    {0x2044, 0xDA}, {0x20AC, 0xDB}, {0x2122, 0xAA}, {0x2202, 0xB6}, {0x2206, 0xC6}, {0x220F, 0xB8}, {0x2211, 0xB7}, {0x221A, 0xC3},
+    {0x221E, 0xB0}, {0x222B, 0xBA}, {0x2248, 0xC5}, {0x2260, 0xAD}, {0x2264, 0xB2}, {0x2265, 0xB3}, {0x25CA, 0xD7}, {0xF8FF, 0xF0},
+};
+
+const uint16_t mac_croatian_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C4, 0x00C5, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1, 0x00E0, 0x00E2, 0x00E4, 0x00E3, 0x00E5, 0x00E7, 0x00E9, 0x00E8, /* 0x80 */
+    0x00EA, 0x00EB, 0x00ED, 0x00EC, 0x00EE, 0x00EF, 0x00F1, 0x00F3, 0x00F2, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x00F9, 0x00FB, 0x00FC, /* 0x90 */
+    0x2020, 0x00B0, 0x00A2, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x00DF, 0x00AE, 0x0160, 0x2122, 0x00B4, 0x00A8, 0x2260, 0x017D, 0x00D8, /* 0xA0 */
+    0x221E, 0x00B1, 0x2264, 0x2265, 0x2206, 0x00B5, 0x2202, 0x2211, 0x220F, 0x0161, 0x222B, 0x00AA, 0x00BA, 0x03A9, 0x017E, 0x00F8, /* 0xB0 */
+    0x00BF, 0x00A1, 0x00AC, 0x221A, 0x0192, 0x2248, 0x0106, 0x00AB, 0x010C, 0x2026, 0x00A0, 0x00C0, 0x00C3, 0x00D5, 0x0152, 0x0153, /* 0xC0 */
+    0x0110, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x25CA, 0xFFFD, 0x0178, 0x2044, 0x20AC, 0x2039, 0x203A, 0x00C6, 0x00BB, /* 0xD0 */
+    0x2013, 0x00B7, 0x201A, 0x201E, 0x2030, 0x00C2, 0x0107, 0x00C1, 0x010D, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x00D3, 0x00D4, /* 0xE0 */
+    0x0111, 0x00D2, 0x00DA, 0x00DB, 0x00D9, 0x0131, 0x02C6, 0x02DC, 0x00AF, 0x03C0, 0x00CB, 0x02DA, 0x00B8, 0x00CA, 0x00E6, 0x02C7, /* 0xF0 */
+};
+
+const struct sb_reverse_entry mac_croatian_from_unicode[255] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xCA}, {0x00A1, 0xC1}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A7, 0xA4}, {0x00A8, 0xAC}, {0x00AA, 0xBB}, {0x00AB, 0xC7},
+    {0x00AC, 0xC2}, {0x00AE, 0xA8}, {0x00AF, 0xF8}, {0x00B0, 0xA1}, {0x00B1, 0xB1}, {0x00B4, 0xAB}, {0x00B5, 0xB5}, {0x00B6, 0xA6},
+    {0x00B7, 0xE1}, {0x00B8, 0xFC}, {0x00BA, 0xBC}, {0x00BB, 0xDF}, {0x00BF, 0xC0}, {0x00C0, 0xCB}, {0x00C1, 0xE7}, {0x00C2, 0xE5},
+    {0x00C3, 0xCC}, {0x00C4, 0x80}, {0x00C5, 0x81}, {0x00C6, 0xDE}, {0x00C7, 0x82}, {0x00C8, 0xE9}, {0x00C9, 0x83}, {0x00CA, 0xFD},
+    {0x00CB, 0xFA}, {0x00CC, 0xED}, {0x00CD, 0xEA}, {0x00CE, 0xEB}, {0x00CF, 0xEC}, {0x00D1, 0x84}, {0x00D2, 0xF1}, {0x00D3, 0xEE},
+    {0x00D4, 0xEF}, {0x00D5, 0xCD}, {0x00D6, 0x85}, {0x00D8, 0xAF}, {0x00D9, 0xF4}, {0x00DA, 0xF2}, {0x00DB, 0xF3}, {0x00DC, 0x86},
+    {0x00DF, 0xA7}, {0x00E0, 0x88}, {0x00E1, 0x87}, {0x00E2, 0x89}, {0x00E3, 0x8B}, {0x00E4, 0x8A}, {0x00E5, 0x8C}, {0x00E6, 0xFE},
+    {0x00E7, 0x8D}, {0x00E8, 0x8F}, {0x00E9, 0x8E}, {0x00EA, 0x90}, {0x00EB, 0x91}, {0x00EC, 0x93}, {0x00ED, 0x92}, {0x00EE, 0x94},
+    {0x00EF, 0x95}, {0x00F1, 0x96}, {0x00F2, 0x98}, {0x00F3, 0x97}, {0x00F4, 0x99}, {0x00F5, 0x9B}, {0x00F6, 0x9A}, {0x00F7, 0xD6},
+    {0x00F8, 0xBF}, {0x00F9, 0x9D}, {0x00FA, 0x9C}, {0x00FB, 0x9E}, {0x00FC, 0x9F}, {0x0106, 0xC6}, {0x0107, 0xE6}, {0x010C, 0xC8},
+    {0x010D, 0xE8}, {0x0110, 0xD0}, {0x0111, 0xF0}, {0x0131, 0xF5}, {0x0152, 0xCE}, {0x0153, 0xCF}, {0x0160, 0xA9}, {0x0161, 0xB9},
+    {0x0178, 0xD9}, {0x017D, 0xAE}, {0x017E, 0xBE}, {0x0192, 0xC4}, {0x02C6, 0xF6}, {0x02C7, 0xFF}, {0x02DA, 0xFB}, {0x02DC, 0xF7},
+    {0x03A9, 0xBD}, {0x03C0, 0xF9}, {0x2013, 0xE0}, {0x2014, 0xD1}, {0x2018, 0xD4}, {0x2019, 0xD5}, {0x201A, 0xE2}, {0x201C, 0xD2},
+    {0x201D, 0xD3}, {0x201E, 0xE3}, {0x2020, 0xA0}, {0x2022, 0xA5}, {0x2026, 0xC9}, {0x2030, 0xE4}, {0x2039, 0xDC}, {0x203A, 0xDD},
+    {0x2044, 0xDA}, {0x20AC, 0xDB}, {0x2122, 0xAA}, {0x2202, 0xB6}, {0x2206, 0xB4}, {0x220F, 0xB8}, {0x2211, 0xB7}, {0x221A, 0xC3},
+    {0x221E, 0xB0}, {0x222B, 0xBA}, {0x2248, 0xC5}, {0x2260, 0xAD}, {0x2264, 0xB2}, {0x2265, 0xB3}, {0x25CA, 0xD7},
+};
+
+const uint16_t mac_romanian_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C4, 0x00C5, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1, 0x00E0, 0x00E2, 0x00E4, 0x00E3, 0x00E5, 0x00E7, 0x00E9, 0x00E8, /* 0x80 */
+    0x00EA, 0x00EB, 0x00ED, 0x00EC, 0x00EE, 0x00EF, 0x00F1, 0x00F3, 0x00F2, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x00F9, 0x00FB, 0x00FC, /* 0x90 */
+    0x2020, 0x00B0, 0x00A2, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x00DF, 0x00AE, 0x00A9, 0x2122, 0x00B4, 0x00A8, 0x2260, 0x0102, 0x0218, /* 0xA0 */
+    0x221E, 0x00B1, 0x2264, 0x2265, 0x00A5, 0x00B5, 0x2202, 0x2211, 0x220F, 0x03C0, 0x222B, 0x00AA, 0x00BA, 0x03A9, 0x0103, 0x0219, /* 0xB0 */
+    0x00BF, 0x00A1, 0x00AC, 0x221A, 0x0192, 0x2248, 0x2206, 0x00AB, 0x00BB, 0x2026, 0x00A0, 0x00C0, 0x00C3, 0x00D5, 0x0152, 0x0153, /* 0xC0 */
+    0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x25CA, 0x00FF, 0x0178, 0x2044, 0x20AC, 0x2039, 0x203A, 0x021A, 0x021B, /* 0xD0 */
+    0x2021, 0x00B7, 0x201A, 0x201E, 0x2030, 0x00C2, 0x00CA, 0x00C1, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x00D3, 0x00D4, /* 0xE0 */
+    0xF8FF, 0x00D2, 0x00DA, 0x00DB, 0x00D9, 0x0131, 0x02C6, 0x02DC, 0x00AF, 0x02D8, 0x02D9, 0x02DA, 0x00B8, 0x02DD, 0x02DB, 0x02C7, /* 0xF0 */
+};
+
+const struct sb_reverse_entry mac_romanian_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xCA}, {0x00A1, 0xC1}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A5, 0xB4}, {0x00A7, 0xA4}, {0x00A8, 0xAC}, {0x00A9, 0xA9},
+    {0x00AA, 0xBB}, {0x00AB, 0xC7}, {0x00AC, 0xC2}, {0x00AE, 0xA8}, {0x00AF, 0xF8}, {0x00B0, 0xA1}, {0x00B1, 0xB1}, {0x00B4, 0xAB},
+    {0x00B5, 0xB5}, {0x00B6, 0xA6}, {0x00B7, 0xE1}, {0x00B8, 0xFC}, {0x00BA, 0xBC}, {0x00BB, 0xC8}, {0x00BF, 0xC0}, {0x00C0, 0xCB},
+    {0x00C1, 0xE7}, {0x00C2, 0xE5}, {0x00C3, 0xCC}, {0x00C4, 0x80}, {0x00C5, 0x81}, {0x00C7, 0x82}, {0x00C8, 0xE9}, {0x00C9, 0x83},
+    {0x00CA, 0xE6}, {0x00CB, 0xE8}, {0x00CC, 0xED}, {0x00CD, 0xEA}, {0x00CE, 0xEB}, {0x00CF, 0xEC}, {0x00D1, 0x84}, {0x00D2, 0xF1},
+    {0x00D3, 0xEE}, {0x00D4, 0xEF}, {0x00D5, 0xCD}, {0x00D6, 0x85}, {0x00D9, 0xF4}, {0x00DA, 0xF2}, {0x00DB, 0xF3}, {0x00DC, 0x86},
+    {0x00DF, 0xA7}, {0x00E0, 0x88}, {0x00E1, 0x87}, {0x00E2, 0x89}, {0x00E3, 0x8B}, {0x00E4, 0x8A}, {0x00E5, 0x8C}, {0x00E7, 0x8D},
+    {0x00E8, 0x8F}, {0x00E9, 0x8E}, {0x00EA, 0x90}, {0x00EB, 0x91}, {0x00EC, 0x93}, {0x00ED, 0x92}, {0x00EE, 0x94}, {0x00EF, 0x95},
+    {0x00F1, 0x96}, {0x00F2, 0x98}, {0x00F3, 0x97}, {0x00F4, 0x99}, {0x00F5, 0x9B}, {0x00F6, 0x9A}, {0x00F7, 0xD6}, {0x00F9, 0x9D},
+    {0x00FA, 0x9C}, {0x00FB, 0x9E}, {0x00FC, 0x9F}, {0x00FF, 0xD8}, {0x0102, 0xAE}, {0x0103, 0xBE}, {0x0131, 0xF5}, {0x0152, 0xCE},
+    {0x0153, 0xCF}, {0x0178, 0xD9}, {0x0192, 0xC4}, {0x0218, 0xAF}, {0x0219, 0xBF}, {0x021A, 0xDE}, {0x021B, 0xDF}, {0x02C6, 0xF6},
+    {0x02C7, 0xFF}, {0x02D8, 0xF9}, {0x02D9, 0xFA}, {0x02DA, 0xFB}, {0x02DB, 0xFE}, {0x02DC, 0xF7}, {0x02DD, 0xFD}, {0x03A9, 0xBD},
+    {0x03C0, 0xB9}, {0x2013, 0xD0}, {0x2014, 0xD1}, {0x2018, 0xD4}, {0x2019, 0xD5}, {0x201A, 0xE2}, {0x201C, 0xD2}, {0x201D, 0xD3},
+    {0x201E, 0xE3}, {0x2020, 0xA0}, {0x2021, 0xE0}, {0x2022, 0xA5}, {0x2026, 0xC9}, {0x2030, 0xE4}, {0x2039, 0xDC}, {0x203A, 0xDD},
+    {0x2044, 0xDA}, {0x20AC, 0xDB}, {0x2122, 0xAA}, {0x2202, 0xB6}, {0x2206, 0xC6}, {0x220F, 0xB8}, {0x2211, 0xB7}, {0x221A, 0xC3},
+    {0x221E, 0xB0}, {0x222B, 0xBA}, {0x2248, 0xC5}, {0x2260, 0xAD}, {0x2264, 0xB2}, {0x2265, 0xB3}, {0x25CA, 0xD7}, {0xF8FF, 0xF0},
+};
+
+const uint16_t mac_arabic_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C4, 0x00A0, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1, 0x00E0, 0x00E2, 0x00E4, 0x06BA, 0x00AB, 0x00E7, 0x00E9, 0x00E8, /* 0x80 */
+    0x00EA, 0x00EB, 0x00ED, 0x2026, 0x00EE, 0x00EF, 0x00F1, 0x00F3, 0x00BB, 0x00F4, 0x00F6, 0x00F7, 0x00FA, 0x00F9, 0x00FB, 0x00FC, /* 0x90 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x066A, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x060C, 0x002D, 0x002E, 0x002F, /* 0xA0 */
+    0x0660, 0x0661, 0x0662, 0x0663, 0x0664, 0x0665, 0x0666, 0x0667, 0x0668, 0x0669, 0x003A, 0x061B, 0x003C, 0x003D, 0x003E, 0x061F, /* 0xB0 */
+    0x274A, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627, 0x0628, 0x0629, 0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F, /* 0xC0 */
+    0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x0637, 0x0638, 0x0639, 0x063A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0xD0 */
+    0x0640, 0x0641, 0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647, 0x0648, 0x0649, 0x064A, 0x064B, 0x064C, 0x064D, 0x064E, 0x064F, /* 0xE0 */
+    0x0650, 0x0651, 0x0652, 0x067E, 0x0679, 0x0686, 0x06D5, 0x06A4, 0x06AF, 0x0688, 0x0691, 0x007B, 0x007C, 0x007D, 0x0698, 0x06D2, /* 0xF0 */
+};
+
+const struct sb_reverse_entry mac_arabic_from_unicode[230] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0xA0}, {0x0021, 0xA1}, {0x0022, 0xA2}, {0x0023, 0xA3}, {0x0024, 0xA4}, {0x0025, 0x25}, {0x0026, 0xA6}, {0x0027, 0xA7},
+    {0x0028, 0xA8}, {0x0029, 0xA9}, {0x002A, 0xAA}, {0x002B, 0xAB}, {0x002C, 0x2C}, {0x002D, 0xAD}, {0x002E, 0xAE}, {0x002F, 0xAF},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0xBA}, {0x003B, 0x3B}, {0x003C, 0xBC}, {0x003D, 0xBD}, {0x003E, 0xBE}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0xDB}, {0x005C, 0xDC}, {0x005D, 0xDD}, {0x005E, 0xDE}, {0x005F, 0xDF},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0xFB}, {0x007C, 0xFC}, {0x007D, 0xFD}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0x81}, {0x00AB, 0x8C}, {0x00BB, 0x98}, {0x00C4, 0x80}, {0x00C7, 0x82}, {0x00C9, 0x83}, {0x00D1, 0x84}, {0x00D6, 0x85},
+    {0x00DC, 0x86}, {0x00E0, 0x88}, {0x00E1, 0x87}, {0x00E2, 0x89}, {0x00E4, 0x8A}, {0x00E7, 0x8D}, {0x00E8, 0x8F}, {0x00E9, 0x8E},
+    {0x00EA, 0x90}, {0x00EB, 0x91}, {0x00ED, 0x92}, {0x00EE, 0x94}, {0x00EF, 0x95}, {0x00F1, 0x96}, {0x00F3, 0x97}, {0x00F4, 0x99},
+    {0x00F6, 0x9A}, {0x00F7, 0x9B}, {0x00F9, 0x9D}, {0x00FA, 0x9C}, {0x00FB, 0x9E}, {0x00FC, 0x9F}, {0x060C, 0xAC}, {0x061B, 0xBB},
+    {0x061F, 0xBF}, {0x0621, 0xC1}, {0x0622, 0xC2}, {0x0623, 0xC3}, {0x0624, 0xC4}, {0x0625, 0xC5}, {0x0626, 0xC6}, {0x0627, 0xC7},
+    {0x0628, 0xC8}, {0x0629, 0xC9}, {0x062A, 0xCA}, {0x062B, 0xCB}, {0x062C, 0xCC}, {0x062D, 0xCD}, {0x062E, 0xCE}, {0x062F, 0xCF},
+    {0x0630, 0xD0}, {0x0631, 0xD1}, {0x0632, 0xD2}, {0x0633, 0xD3}, {0x0634, 0xD4}, {0x0635, 0xD5}, {0x0636, 0xD6}, {0x0637, 0xD7},
+    {0x0638, 0xD8}, {0x0639, 0xD9}, {0x063A, 0xDA}, {0x0640, 0xE0}, {0x0641, 0xE1}, {0x0642, 0xE2}, {0x0643, 0xE3}, {0x0644, 0xE4},
+    {0x0645, 0xE5}, {0x0646, 0xE6}, {0x0647, 0xE7}, {0x0648, 0xE8}, {0x0649, 0xE9}, {0x064A, 0xEA}, {0x064B, 0xEB}, {0x064C, 0xEC},
+    {0x064D, 0xED}, {0x064E, 0xEE}, {0x064F, 0xEF}, {0x0650, 0xF0}, {0x0651, 0xF1}, {0x0652, 0xF2}, {0x0660, 0xB0}, {0x0661, 0xB1},
+    {0x0662, 0xB2}, {0x0663, 0xB3}, {0x0664, 0xB4}, {0x0665, 0xB5}, {0x0666, 0xB6}, {0x0667, 0xB7}, {0x0668, 0xB8}, {0x0669, 0xB9},
+    {0x066A, 0xA5}, {0x0679, 0xF4}, {0x067E, 0xF3}, {0x0686, 0xF5}, {0x0688, 0xF9}, {0x0691, 0xFA}, {0x0698, 0xFE}, {0x06A4, 0xF7},
+    {0x06AF, 0xF8}, {0x06BA, 0x8B}, {0x06D2, 0xFF}, {0x06D5, 0xF6}, {0x2026, 0x93}, {0x274A, 0xC0},
+};
+
+const uint16_t mac_hebrew_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00C4, 0xFB1F, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1, 0x00E0, 0x00E2, 0x00E4, 0x00E3, 0x00E5, 0x00E7, 0x00E9, 0x00E8, /* 0x80 */
+    0x00EA, 0x00EB, 0x00ED, 0x00EC, 0x00EE, 0x00EF, 0x00F1, 0x00F3, 0x00F2, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x00F9, 0x00FB, 0x00FC, /* 0x90 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x20AA, 0x0027, 0x0029, 0x0028, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0xA0 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0xB0 */
+    0xFFFD, 0x201E, 0xF89B, 0xF89C, 0xF89D, 0xF89E, 0x05BC, 0xFB4B, 0xFB35, 0x2026, 0x00A0, 0x05B8, 0x05B7, 0x05B5, 0x05B6, 0x05B4, /* 0xC0 */
+    0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0xFB2A, 0xFB2B, 0x05BF, 0x05B0, 0x05B2, 0x05B1, 0x05BB, 0x05B9, 0xFFFD, 0x05B3, /* 0xD0 */
+    0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF, /* 0xE0 */
+    0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0x007D, 0x007C, 0x007B, 0x05C3, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry mac_hebrew_from_unicode[219] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0xA0}, {0x0021, 0xA1}, {0x0022, 0xA2}, {0x0023, 0xA3}, {0x0024, 0xA4}, {0x0025, 0xA5}, {0x0026, 0x26}, {0x0027, 0xA7},
+    {0x0028, 0xA9}, {0x0029, 0xA8}, {0x002A, 0xAA}, {0x002B, 0xAB}, {0x002C, 0xAC}, {0x002D, 0xAD}, {0x002E, 0xAE}, {0x002F, 0xAF},
+    {0x0030, 0xB0}, {0x0031, 0xB1}, {0x0032, 0xB2}, {0x0033, 0xB3}, {0x0034, 0xB4}, {0x0035, 0xB5}, {0x0036, 0xB6}, {0x0037, 0xB7},
+    {0x0038, 0xB8}, {0x0039, 0xB9}, {0x003A, 0xBA}, {0x003B, 0xBB}, {0x003C, 0xBC}, {0x003D, 0xBD}, {0x003E, 0xBE}, {0x003F, 0xBF},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0xFD}, {0x007C, 0xFC}, {0x007D, 0xFB}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xCA}, {0x00C4, 0x80}, {0x00C7, 0x82}, {0x00C9, 0x83}, {0x00D1, 0x84}, {0x00D6, 0x85}, {0x00DC, 0x86}, {0x00E0, 0x88},
+    {0x00E1, 0x87}, {0x00E2, 0x89}, {0x00E3, 0x8B}, {0x00E4, 0x8A}, {0x00E5, 0x8C}, {0x00E7, 0x8D}, {0x00E8, 0x8F}, {0x00E9, 0x8E},
+    {0x00EA, 0x90}, {0x00EB, 0x91}, {0x00EC, 0x93}, {0x00ED, 0x92}, {0x00EE, 0x94}, {0x00EF, 0x95}, {0x00F1, 0x96}, {0x00F2, 0x98},
+    {0x00F3, 0x97}, {0x00F4, 0x99}, {0x00F5, 0x9B}, {0x00F6, 0x9A}, {0x00F9, 0x9D}, {0x00FA, 0x9C}, {0x00FB, 0x9E}, {0x00FC, 0x9F},
+    {0x05B0, 0xD9}, {0x05B1, 0xDB}, {0x05B2, 0xDA}, {0x05B3, 0xDF}, {0x05B4, 0xCF}, {0x05B5, 0xCD}, {0x05B6, 0xCE}, {0x05B7, 0xCC},
+    {0x05B8, 0xCB}, {0x05B9, 0xDD}, {0x05BB, 0xDC}, {0x05BC, 0xC6}, {0x05BF, 0xD8}, {0x05C3, 0xFE}, {0x05D0, 0xE0}, {0x05D1, 0xE1},
+    {0x05D2, 0xE2}, {0x05D3, 0xE3}, {0x05D4, 0xE4}, {0x05D5, 0xE5}, {0x05D6, 0xE6}, {0x05D7, 0xE7}, {0x05D8, 0xE8}, {0x05D9, 0xE9},
+    {0x05DA, 0xEA}, {0x05DB, 0xEB}, {0x05DC, 0xEC}, {0x05DD, 0xED}, {0x05DE, 0xEE}, {0x05DF, 0xEF}, {0x05E0, 0xF0}, {0x05E1, 0xF1},
+    {0x05E2, 0xF2}, {0x05E3, 0xF3}, {0x05E4, 0xF4}, {0x05E5, 0xF5}, {0x05E6, 0xF6}, {0x05E7, 0xF7}, {0x05E8, 0xF8}, {0x05E9, 0xF9},
+    {0x05EA, 0xFA}, {0x2013, 0xD0}, {0x2014, 0xD1}, {0x2018, 0xD4}, {0x2019, 0xD5}, {0x201C, 0xD2}, {0x201D, 0xD3}, {0x201E, 0xC1},
+    {0x2026, 0xC9}, {0x20AA, 0xA6}, {0xF89B, 0xC2}, {0xF89C, 0xC3}, {0xF89D, 0xC4}, {0xF89E, 0xC5}, {0xFB1F, 0x81}, {0xFB2A, 0xD6},
+    {0xFB2B, 0xD7}, {0xFB35, 0xC8}, {0xFB4B, 0xC7},
+};
+
+const uint16_t mac_thai_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x00AB, 0x00BB, 0x2026, 0xF88C, 0xF88F, 0xF892, 0xF895, 0xF898, 0xF88B, 0xF88E, 0xF891, 0xF894, 0xF897, 0x201C, 0x201D, 0xF899, /* 0x80 */
+    0xFFFD, 0x2022, 0xF884, 0xF889, 0xF885, 0xF886, 0xF887, 0xF888, 0xF88A, 0xF88D, 0xF890, 0xF893, 0xF896, 0x2018, 0x2019, 0xFFFD, /* 0x90 */
+    0x00A0, 0x0E01, 0x0E02, 0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07, 0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F, /* 0xA0 */
+    0x0E10, 0x0E11, 0x0E12, 0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0E17, 0x0E18, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F, /* 0xB0 */
+    0x0E20, 0x0E21, 0x0E22, 0x0E23, 0x0E24, 0x0E25, 0x0E26, 0x0E27, 0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D, 0x0E2E, 0x0E2F, /* 0xC0 */
+    0x0E30, 0x0E31, 0x0E32, 0x0E33, 0x0E34, 0x0E35, 0x0E36, 0x0E37, 0x0E38, 0x0E39, 0x0E3A, 0xFEFF, 0x200B, 0x2013, 0x2014, 0x0E3F, /* 0xD0 */
+    0x0E40, 0x0E41, 0x0E42, 0x0E43, 0x0E44, 0x0E45, 0x0E46, 0x0E47, 0x0E48, 0x0E49, 0x0E4A, 0x0E4B, 0x0E4C, 0x0E4D, 0x2122, 0x0E4F, /* 0xE0 */
+    0x0E50, 0x0E51, 0x0E52, 0x0E53, 0x0E54, 0x0E55, 0x0E56, 0x0E57, 0x0E58, 0x0E59, 0x00AE, 0x00A9, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry mac_thai_from_unicode[250] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xA0}, {0x00A9, 0xFB}, {0x00AB, 0x80}, {0x00AE, 0xFA}, {0x00BB, 0x81}, {0x0E01, 0xA1}, {0x0E02, 0xA2}, {0x0E03, 0xA3},
+    {0x0E04, 0xA4}, {0x0E05, 0xA5}, {0x0E06, 0xA6}, {0x0E07, 0xA7}, {0x0E08, 0xA8}, {0x0E09, 0xA9}, {0x0E0A, 0xAA}, {0x0E0B, 0xAB},
+    {0x0E0C, 0xAC}, {0x0E0D, 0xAD}, {0x0E0E, 0xAE}, {0x0E0F, 0xAF}, {0x0E10, 0xB0}, {0x0E11, 0xB1}, {0x0E12, 0xB2}, {0x0E13, 0xB3},
+    {0x0E14, 0xB4}, {0x0E15, 0xB5}, {0x0E16, 0xB6}, {0x0E17, 0xB7}, {0x0E18, 0xB8}, {0x0E19, 0xB9}, {0x0E1A, 0xBA}, {0x0E1B, 0xBB},
+    {0x0E1C, 0xBC}, {0x0E1D, 0xBD}, {0x0E1E, 0xBE}, {0x0E1F, 0xBF}, {0x0E20, 0xC0}, {0x0E21, 0xC1}, {0x0E22, 0xC2}, {0x0E23, 0xC3},
+    {0x0E24, 0xC4}, {0x0E25, 0xC5}, {0x0E26, 0xC6}, {0x0E27, 0xC7}, {0x0E28, 0xC8}, {0x0E29, 0xC9}, {0x0E2A, 0xCA}, {0x0E2B, 0xCB},
+    {0x0E2C, 0xCC}, {0x0E2D, 0xCD}, {0x0E2E, 0xCE}, {0x0E2F, 0xCF}, {0x0E30, 0xD0}, {0x0E31, 0xD1}, {0x0E32, 0xD2}, {0x0E33, 0xD3},
+    {0x0E34, 0xD4}, {0x0E35, 0xD5}, {0x0E36, 0xD6}, {0x0E37, 0xD7}, {0x0E38, 0xD8}, {0x0E39, 0xD9}, {0x0E3A, 0xDA}, {0x0E3F, 0xDF},
+    {0x0E40, 0xE0}, {0x0E41, 0xE1}, {0x0E42, 0xE2}, {0x0E43, 0xE3}, {0x0E44, 0xE4}, {0x0E45, 0xE5}, {0x0E46, 0xE6}, {0x0E47, 0xE7},
+    {0x0E48, 0xE8}, {0x0E49, 0xE9}, {0x0E4A, 0xEA}, {0x0E4B, 0xEB}, {0x0E4C, 0xEC}, {0x0E4D, 0xED}, {0x0E4F, 0xEF}, {0x0E50, 0xF0},
+    {0x0E51, 0xF1}, {0x0E52, 0xF2}, {0x0E53, 0xF3}, {0x0E54, 0xF4}, {0x0E55, 0xF5}, {0x0E56, 0xF6}, {0x0E57, 0xF7}, {0x0E58, 0xF8},
+    {0x0E59, 0xF9}, {0x200B, 0xDC}, {0x2013, 0xDD}, {0x2014, 0xDE}, {0x2018, 0x9D}, {0x2019, 0x9E}, {0x201C, 0x8D}, {0x201D, 0x8E},
+    {0x2022, 0x91}, {0x2026, 0x82}, {0x2122, 0xEE}, {0xF884, 0x92}, {0xF885, 0x94}, {0xF886, 0x95}, {0xF887, 0x96}, {0xF888, 0x97},
+    {0xF889, 0x93}, {0xF88A, 0x98}, {0xF88B, 0x88}, {0xF88C, 0x83}, {0xF88D, 0x99}, {0xF88E, 0x89}, {0xF88F, 0x84}, {0xF890, 0x9A},
+    {0xF891, 0x8A}, {0xF892, 0x85}, {0xF893, 0x9B}, {0xF894, 0x8B}, {0xF895, 0x86}, {0xF896, 0x9C}, {0xF897, 0x8C}, {0xF898, 0x87},
+    {0xF899, 0x8F}, {0xFEFF, 0xDB},
+};
+
+const uint16_t cp037_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007, /* 0x20 */
+    0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A, /* 0x30 */
+    0x0020, 0x00A0, 0x00E2, 0x00E4, 0x00E0, 0x00E1, 0x00E3, 0x00E5, 0x00E7, 0x00F1, 0x00A2, 0x002E, 0x003C, 0x0028, 0x002B, 0x007C, /* 0x40 */
+    0x0026, 0x00E9, 0x00EA, 0x00EB, 0x00E8, 0x00ED, 0x00EE, 0x00EF, 0x00EC, 0x00DF, 0x0021, 0x0024, 0x002A, 0x0029, 0x003B, 0x00AC, /* 0x50 */
+    0x002D, 0x002F, 0x00C2, 0x00C4, 0x00C0, 0x00C1, 0x00C3, 0x00C5, 0x00C7, 0x00D1, 0x00A6, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F, /* 0x60 */
+    0x00F8, 0x00C9, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x0060, 0x003A, 0x0023, 0x0040, 0x0027, 0x003D, 0x0022, /* 0x70 */
+    0x00D8, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x00F0, 0x00FD, 0x00FE, 0x00B1, /* 0x80 */
+    0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x00C6, 0x00A4, /* 0x90 */
+    0x00B5, 0x007E, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x00D0, 0x00DD, 0x00DE, 0x00AE, /* 0xA0 */
+    0x005E, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x00A7, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x005B, 0x005D, 0x00AF, 0x00A8, 0x00B4, 0x00D7, /* 0xB0 */
+    0x007B, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x00F6, 0x00F2, 0x00F3, 0x00F5, /* 0xC0 */
+    0x007D, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x00FC, 0x00F9, 0x00FA, 0x00FF, /* 0xD0 */
+    0x005C, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x00D6, 0x00D2, 0x00D3, 0x00D5, /* 0xE0 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x00DC, 0x00D9, 0x00DA, 0x009F, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp037_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x37}, {0x0005, 0x2D}, {0x0006, 0x2E}, {0x0007, 0x2F},
+    {0x0008, 0x16}, {0x0009, 0x05}, {0x000A, 0x25}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x3C}, {0x0015, 0x3D}, {0x0016, 0x32}, {0x0017, 0x26},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x3F}, {0x001B, 0x27}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x40}, {0x0021, 0x5A}, {0x0022, 0x7F}, {0x0023, 0x7B}, {0x0024, 0x5B}, {0x0025, 0x6C}, {0x0026, 0x50}, {0x0027, 0x7D},
+    {0x0028, 0x4D}, {0x0029, 0x5D}, {0x002A, 0x5C}, {0x002B, 0x4E}, {0x002C, 0x6B}, {0x002D, 0x60}, {0x002E, 0x4B}, {0x002F, 0x61},
+    {0x0030, 0xF0}, {0x0031, 0xF1}, {0x0032, 0xF2}, {0x0033, 0xF3}, {0x0034, 0xF4}, {0x0035, 0xF5}, {0x0036, 0xF6}, {0x0037, 0xF7},
+    {0x0038, 0xF8}, {0x0039, 0xF9}, {0x003A, 0x7A}, {0x003B, 0x5E}, {0x003C, 0x4C}, {0x003D, 0x7E}, {0x003E, 0x6E}, {0x003F, 0x6F},
+    {0x0040, 0x7C}, {0x0041, 0xC1}, {0x0042, 0xC2}, {0x0043, 0xC3}, {0x0044, 0xC4}, {0x0045, 0xC5}, {0x0046, 0xC6}, {0x0047, 0xC7},
+    {0x0048, 0xC8}, {0x0049, 0xC9}, {0x004A, 0xD1}, {0x004B, 0xD2}, {0x004C, 0xD3}, {0x004D, 0xD4}, {0x004E, 0xD5}, {0x004F, 0xD6},
+    {0x0050, 0xD7}, {0x0051, 0xD8}, {0x0052, 0xD9}, {0x0053, 0xE2}, {0x0054, 0xE3}, {0x0055, 0xE4}, {0x0056, 0xE5}, {0x0057, 0xE6},
+    {0x0058, 0xE7}, {0x0059, 0xE8}, {0x005A, 0xE9}, {0x005B, 0xBA}, {0x005C, 0xE0}, {0x005D, 0xBB}, {0x005E, 0xB0}, {0x005F, 0x6D},
+    {0x0060, 0x79}, {0x0061, 0x81}, {0x0062, 0x82}, {0x0063, 0x83}, {0x0064, 0x84}, {0x0065, 0x85}, {0x0066, 0x86}, {0x0067, 0x87},
+    {0x0068, 0x88}, {0x0069, 0x89}, {0x006A, 0x91}, {0x006B, 0x92}, {0x006C, 0x93}, {0x006D, 0x94}, {0x006E, 0x95}, {0x006F, 0x96},
+    {0x0070, 0x97}, {0x0071, 0x98}, {0x0072, 0x99}, {0x0073, 0xA2}, {0x0074, 0xA3}, {0x0075, 0xA4}, {0x0076, 0xA5}, {0x0077, 0xA6},
+    {0x0078, 0xA7}, {0x0079, 0xA8}, {0x007A, 0xA9}, {0x007B, 0xC0}, {0x007C, 0x4F}, {0x007D, 0xD0}, {0x007E, 0xA1}, {0x007F, 0x07},
+    {0x0080, 0x20}, {0x0081, 0x21}, {0x0082, 0x22}, {0x0083, 0x23}, {0x0084, 0x24}, {0x0085, 0x15}, {0x0086, 0x06}, {0x0087, 0x17},
+    {0x0088, 0x28}, {0x0089, 0x29}, {0x008A, 0x2A}, {0x008B, 0x2B}, {0x008C, 0x2C}, {0x008D, 0x09}, {0x008E, 0x0A}, {0x008F, 0x1B},
+    {0x0090, 0x30}, {0x0091, 0x31}, {0x0092, 0x1A}, {0x0093, 0x33}, {0x0094, 0x34}, {0x0095, 0x35}, {0x0096, 0x36}, {0x0097, 0x08},
+    {0x0098, 0x38}, {0x0099, 0x39}, {0x009A, 0x3A}, {0x009B, 0x3B}, {0x009C, 0x04}, {0x009D, 0x14}, {0x009E, 0x3E}, {0x009F, 0xFF},
+    {0x00A0, 0x41}, {0x00A1, 0xAA}, {0x00A2, 0x4A}, {0x00A3, 0xB1}, {0x00A4, 0x9F}, {0x00A5, 0xB2}, {0x00A6, 0x6A}, {0x00A7, 0xB5},
+    {0x00A8, 0xBD}, {0x00A9, 0xB4}, {0x00AA, 0x9A}, {0x00AB, 0x8A}, {0x00AC, 0x5F}, {0x00AD, 0xCA}, {0x00AE, 0xAF}, {0x00AF, 0xBC},
+    {0x00B0, 0x90}, {0x00B1, 0x8F}, {0x00B2, 0xEA}, {0x00B3, 0xFA}, {0x00B4, 0xBE}, {0x00B5, 0xA0}, {0x00B6, 0xB6}, {0x00B7, 0xB3},
+    {0x00B8, 0x9D}, {0x00B9, 0xDA}, {0x00BA, 0x9B}, {0x00BB, 0x8B}, {0x00BC, 0xB7}, {0x00BD, 0xB8}, {0x00BE, 0xB9}, {0x00BF, 0xAB},
+    {0x00C0, 0x64}, {0x00C1, 0x65}, {0x00C2, 0x62}, {0x00C3, 0x66}, {0x00C4, 0x63}, {0x00C5, 0x67}, {0x00C6, 0x9E}, {0x00C7, 0x68},
+    {0x00C8, 0x74}, {0x00C9, 0x71}, {0x00CA, 0x72}, {0x00CB, 0x73}, {0x00CC, 0x78}, {0x00CD, 0x75}, {0x00CE, 0x76}, {0x00CF, 0x77},
+    {0x00D0, 0xAC}, {0x00D1, 0x69}, {0x00D2, 0xED}, {0x00D3, 0xEE}, {0x00D4, 0xEB}, {0x00D5, 0xEF}, {0x00D6, 0xEC}, {0x00D7, 0xBF},
+    {0x00D8, 0x80}, {0x00D9, 0xFD}, {0x00DA, 0xFE}, {0x00DB, 0xFB}, {0x00DC, 0xFC}, {0x00DD, 0xAD}, {0x00DE, 0xAE}, {0x00DF, 0x59},
+    {0x00E0, 0x44}, {0x00E1, 0x45}, {0x00E2, 0x42}, {0x00E3, 0x46}, {0x00E4, 0x43}, {0x00E5, 0x47}, {0x00E6, 0x9C}, {0x00E7, 0x48},
+    {0x00E8, 0x54}, {0x00E9, 0x51}, {0x00EA, 0x52}, {0x00EB, 0x53}, {0x00EC, 0x58}, {0x00ED, 0x55}, {0x00EE, 0x56}, {0x00EF, 0x57},
+    {0x00F0, 0x8C}, {0x00F1, 0x49}, {0x00F2, 0xCD}, {0x00F3, 0xCE}, {0x00F4, 0xCB}, {0x00F5, 0xCF}, {0x00F6, 0xCC}, {0x00F7, 0xE1},
+    {0x00F8, 0x70}, {0x00F9, 0xDD}, {0x00FA, 0xDE}, {0x00FB, 0xDB}, {0x00FC, 0xDC}, {0x00FD, 0x8D}, {0x00FE, 0x8E}, {0x00FF, 0xDF},
+};
+
+const uint16_t cp500_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007, /* 0x20 */
+    0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A, /* 0x30 */
+    0x0020, 0x00A0, 0x00E2, 0x00E4, 0x00E0, 0x00E1, 0x00E3, 0x00E5, 0x00E7, 0x00F1, 0x005B, 0x002E, 0x003C, 0x0028, 0x002B, 0x0021, /* 0x40 */
+    0x0026, 0x00E9, 0x00EA, 0x00EB, 0x00E8, 0x00ED, 0x00EE, 0x00EF, 0x00EC, 0x00DF, 0x005D, 0x0024, 0x002A, 0x0029, 0x003B, 0x005E, /* 0x50 */
+    0x002D, 0x002F, 0x00C2, 0x00C4, 0x00C0, 0x00C1, 0x00C3, 0x00C5, 0x00C7, 0x00D1, 0x00A6, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F, /* 0x60 */
+    0x00F8, 0x00C9, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x0060, 0x003A, 0x0023, 0x0040, 0x0027, 0x003D, 0x0022, /* 0x70 */
+    0x00D8, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x00F0, 0x00FD, 0x00FE, 0x00B1, /* 0x80 */
+    0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x00C6, 0x00A4, /* 0x90 */
+    0x00B5, 0x007E, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x00D0, 0x00DD, 0x00DE, 0x00AE, /* 0xA0 */
+    0x00A2, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x00A7, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x00AC, 0x007C, 0x00AF, 0x00A8, 0x00B4, 0x00D7, /* 0xB0 */
+    0x007B, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x00F6, 0x00F2, 0x00F3, 0x00F5, /* 0xC0 */
+    0x007D, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x00FC, 0x00F9, 0x00FA, 0x00FF, /* 0xD0 */
+    0x005C, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x00D6, 0x00D2, 0x00D3, 0x00D5, /* 0xE0 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x00DC, 0x00D9, 0x00DA, 0x009F, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp500_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x37}, {0x0005, 0x2D}, {0x0006, 0x2E}, {0x0007, 0x2F},
+    {0x0008, 0x16}, {0x0009, 0x05}, {0x000A, 0x25}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x3C}, {0x0015, 0x3D}, {0x0016, 0x32}, {0x0017, 0x26},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x3F}, {0x001B, 0x27}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x40}, {0x0021, 0x4F}, {0x0022, 0x7F}, {0x0023, 0x7B}, {0x0024, 0x5B}, {0x0025, 0x6C}, {0x0026, 0x50}, {0x0027, 0x7D},
+    {0x0028, 0x4D}, {0x0029, 0x5D}, {0x002A, 0x5C}, {0x002B, 0x4E}, {0x002C, 0x6B}, {0x002D, 0x60}, {0x002E, 0x4B}, {0x002F, 0x61},
+    {0x0030, 0xF0}, {0x0031, 0xF1}, {0x0032, 0xF2}, {0x0033, 0xF3}, {0x0034, 0xF4}, {0x0035, 0xF5}, {0x0036, 0xF6}, {0x0037, 0xF7},
+    {0x0038, 0xF8}, {0x0039, 0xF9}, {0x003A, 0x7A}, {0x003B, 0x5E}, {0x003C, 0x4C}, {0x003D, 0x7E}, {0x003E, 0x6E}, {0x003F, 0x6F},
+    {0x0040, 0x7C}, {0x0041, 0xC1}, {0x0042, 0xC2}, {0x0043, 0xC3}, {0x0044, 0xC4}, {0x0045, 0xC5}, {0x0046, 0xC6}, {0x0047, 0xC7},
+    {0x0048, 0xC8}, {0x0049, 0xC9}, {0x004A, 0xD1}, {0x004B, 0xD2}, {0x004C, 0xD3}, {0x004D, 0xD4}, {0x004E, 0xD5}, {0x004F, 0xD6},
+    {0x0050, 0xD7}, {0x0051, 0xD8}, {0x0052, 0xD9}, {0x0053, 0xE2}, {0x0054, 0xE3}, {0x0055, 0xE4}, {0x0056, 0xE5}, {0x0057, 0xE6},
+    {0x0058, 0xE7}, {0x0059, 0xE8}, {0x005A, 0xE9}, {0x005B, 0x4A}, {0x005C, 0xE0}, {0x005D, 0x5A}, {0x005E, 0x5F}, {0x005F, 0x6D},
+    {0x0060, 0x79}, {0x0061, 0x81}, {0x0062, 0x82}, {0x0063, 0x83}, {0x0064, 0x84}, {0x0065, 0x85}, {0x0066, 0x86}, {0x0067, 0x87},
+    {0x0068, 0x88}, {0x0069, 0x89}, {0x006A, 0x91}, {0x006B, 0x92}, {0x006C, 0x93}, {0x006D, 0x94}, {0x006E, 0x95}, {0x006F, 0x96},
+    {0x0070, 0x97}, {0x0071, 0x98}, {0x0072, 0x99}, {0x0073, 0xA2}, {0x0074, 0xA3}, {0x0075, 0xA4}, {0x0076, 0xA5}, {0x0077, 0xA6},
+    {0x0078, 0xA7}, {0x0079, 0xA8}, {0x007A, 0xA9}, {0x007B, 0xC0}, {0x007C, 0xBB}, {0x007D, 0xD0}, {0x007E, 0xA1}, {0x007F, 0x07},
+    {0x0080, 0x20}, {0x0081, 0x21}, {0x0082, 0x22}, {0x0083, 0x23}, {0x0084, 0x24}, {0x0085, 0x15}, {0x0086, 0x06}, {0x0087, 0x17},
+    {0x0088, 0x28}, {0x0089, 0x29}, {0x008A, 0x2A}, {0x008B, 0x2B}, {0x008C, 0x2C}, {0x008D, 0x09}, {0x008E, 0x0A}, {0x008F, 0x1B},
+    {0x0090, 0x30}, {0x0091, 0x31}, {0x0092, 0x1A}, {0x0093, 0x33}, {0x0094, 0x34}, {0x0095, 0x35}, {0x0096, 0x36}, {0x0097, 0x08},
+    {0x0098, 0x38}, {0x0099, 0x39}, {0x009A, 0x3A}, {0x009B, 0x3B}, {0x009C, 0x04}, {0x009D, 0x14}, {0x009E, 0x3E}, {0x009F, 0xFF},
+    {0x00A0, 0x41}, {0x00A1, 0xAA}, {0x00A2, 0xB0}, {0x00A3, 0xB1}, {0x00A4, 0x9F}, {0x00A5, 0xB2}, {0x00A6, 0x6A}, {0x00A7, 0xB5},
+    {0x00A8, 0xBD}, {0x00A9, 0xB4}, {0x00AA, 0x9A}, {0x00AB, 0x8A}, {0x00AC, 0xBA}, {0x00AD, 0xCA}, {0x00AE, 0xAF}, {0x00AF, 0xBC},
+    {0x00B0, 0x90}, {0x00B1, 0x8F}, {0x00B2, 0xEA}, {0x00B3, 0xFA}, {0x00B4, 0xBE}, {0x00B5, 0xA0}, {0x00B6, 0xB6}, {0x00B7, 0xB3},
+    {0x00B8, 0x9D}, {0x00B9, 0xDA}, {0x00BA, 0x9B}, {0x00BB, 0x8B}, {0x00BC, 0xB7}, {0x00BD, 0xB8}, {0x00BE, 0xB9}, {0x00BF, 0xAB},
+    {0x00C0, 0x64}, {0x00C1, 0x65}, {0x00C2, 0x62}, {0x00C3, 0x66}, {0x00C4, 0x63}, {0x00C5, 0x67}, {0x00C6, 0x9E}, {0x00C7, 0x68},
+    {0x00C8, 0x74}, {0x00C9, 0x71}, {0x00CA, 0x72}, {0x00CB, 0x73}, {0x00CC, 0x78}, {0x00CD, 0x75}, {0x00CE, 0x76}, {0x00CF, 0x77},
+    {0x00D0, 0xAC}, {0x00D1, 0x69}, {0x00D2, 0xED}, {0x00D3, 0xEE}, {0x00D4, 0xEB}, {0x00D5, 0xEF}, {0x00D6, 0xEC}, {0x00D7, 0xBF},
+    {0x00D8, 0x80}, {0x00D9, 0xFD}, {0x00DA, 0xFE}, {0x00DB, 0xFB}, {0x00DC, 0xFC}, {0x00DD, 0xAD}, {0x00DE, 0xAE}, {0x00DF, 0x59},
+    {0x00E0, 0x44}, {0x00E1, 0x45}, {0x00E2, 0x42}, {0x00E3, 0x46}, {0x00E4, 0x43}, {0x00E5, 0x47}, {0x00E6, 0x9C}, {0x00E7, 0x48},
+    {0x00E8, 0x54}, {0x00E9, 0x51}, {0x00EA, 0x52}, {0x00EB, 0x53}, {0x00EC, 0x58}, {0x00ED, 0x55}, {0x00EE, 0x56}, {0x00EF, 0x57},
+    {0x00F0, 0x8C}, {0x00F1, 0x49}, {0x00F2, 0xCD}, {0x00F3, 0xCE}, {0x00F4, 0xCB}, {0x00F5, 0xCF}, {0x00F6, 0xCC}, {0x00F7, 0xE1},
+    {0x00F8, 0x70}, {0x00F9, 0xDD}, {0x00FA, 0xDE}, {0x00FB, 0xDB}, {0x00FC, 0xDC}, {0x00FD, 0x8D}, {0x00FE, 0x8E}, {0x00FF, 0xDF},
+};
+
+const uint16_t cp875_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007, /* 0x20 */
+    0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A, /* 0x30 */
+    0x0020, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x005B, 0x002E, 0x003C, 0x0028, 0x002B, 0x0021, /* 0x40 */
+    0x0026, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x03A3, 0x005D, 0x0024, 0x002A, 0x0029, 0x003B, 0x005E, /* 0x50 */
+    0x002D, 0x002F, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x00A6, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F, /* 0x60 */
+    0x00A8, 0x0386, 0x0388, 0x0389, 0x00A0, 0x038A, 0x038C, 0x038E, 0x038F, 0x0060, 0x003A, 0x0023, 0x0040, 0x0027, 0x003D, 0x0022, /* 0x70 */
+    0x0385, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, /* 0x80 */
+    0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, /* 0x90 */
+    0x00B4, 0x007E, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3, /* 0xA0 */
+    0x00A3, 0x03AC, 0x03AD, 0x03AE, 0x03CA, 0x03AF, 0x03CC, 0x03CD, 0x03CB, 0x03CE, 0x03C2, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, /* 0xB0 */
+    0x007B, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x03C9, 0x0390, 0x03B0, 0x2018, 0x2015, /* 0xC0 */
+    0x007D, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B1, 0x00BD, 0xFFFD, 0x0387, 0x2019, 0x00A6, /* 0xD0 */
+    0x005C, 0xFFFD, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00A7, 0xFFFD, 0xFFFD, 0x00AB, 0x00AC, /* 0xE0 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00A9, 0xFFFD, 0xFFFD, 0x00BB, 0x009F, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp875_from_unicode[249] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x37}, {0x0005, 0x2D}, {0x0006, 0x2E}, {0x0007, 0x2F},
+    {0x0008, 0x16}, {0x0009, 0x05}, {0x000A, 0x25}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x3C}, {0x0015, 0x3D}, {0x0016, 0x32}, {0x0017, 0x26},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x3F}, {0x001B, 0x27}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x40}, {0x0021, 0x4F}, {0x0022, 0x7F}, {0x0023, 0x7B}, {0x0024, 0x5B}, {0x0025, 0x6C}, {0x0026, 0x50}, {0x0027, 0x7D},
+    {0x0028, 0x4D}, {0x0029, 0x5D}, {0x002A, 0x5C}, {0x002B, 0x4E}, {0x002C, 0x6B}, {0x002D, 0x60}, {0x002E, 0x4B}, {0x002F, 0x61},
+    {0x0030, 0xF0}, {0x0031, 0xF1}, {0x0032, 0xF2}, {0x0033, 0xF3}, {0x0034, 0xF4}, {0x0035, 0xF5}, {0x0036, 0xF6}, {0x0037, 0xF7},
+    {0x0038, 0xF8}, {0x0039, 0xF9}, {0x003A, 0x7A}, {0x003B, 0x5E}, {0x003C, 0x4C}, {0x003D, 0x7E}, {0x003E, 0x6E}, {0x003F, 0x6F},
+    {0x0040, 0x7C}, {0x0041, 0xC1}, {0x0042, 0xC2}, {0x0043, 0xC3}, {0x0044, 0xC4}, {0x0045, 0xC5}, {0x0046, 0xC6}, {0x0047, 0xC7},
+    {0x0048, 0xC8}, {0x0049, 0xC9}, {0x004A, 0xD1}, {0x004B, 0xD2}, {0x004C, 0xD3}, {0x004D, 0xD4}, {0x004E, 0xD5}, {0x004F, 0xD6},
+    {0x0050, 0xD7}, {0x0051, 0xD8}, {0x0052, 0xD9}, {0x0053, 0xE2}, {0x0054, 0xE3}, {0x0055, 0xE4}, {0x0056, 0xE5}, {0x0057, 0xE6},
+    {0x0058, 0xE7}, {0x0059, 0xE8}, {0x005A, 0xE9}, {0x005B, 0x4A}, {0x005C, 0xE0}, {0x005D, 0x5A}, {0x005E, 0x5F}, {0x005F, 0x6D},
+    {0x0060, 0x79}, {0x0061, 0x81}, {0x0062, 0x82}, {0x0063, 0x83}, {0x0064, 0x84}, {0x0065, 0x85}, {0x0066, 0x86}, {0x0067, 0x87},
+    {0x0068, 0x88}, {0x0069, 0x89}, {0x006A, 0x91}, {0x006B, 0x92}, {0x006C, 0x93}, {0x006D, 0x94}, {0x006E, 0x95}, {0x006F, 0x96},
+    {0x0070, 0x97}, {0x0071, 0x98}, {0x0072, 0x99}, {0x0073, 0xA2}, {0x0074, 0xA3}, {0x0075, 0xA4}, {0x0076, 0xA5}, {0x0077, 0xA6},
+    {0x0078, 0xA7}, {0x0079, 0xA8}, {0x007A, 0xA9}, {0x007B, 0xC0}, {0x007D, 0xD0}, {0x007E, 0xA1}, {0x007F, 0x07}, {0x0080, 0x20},
+    {0x0081, 0x21}, {0x0082, 0x22}, {0x0083, 0x23}, {0x0084, 0x24}, {0x0085, 0x15}, {0x0086, 0x06}, {0x0087, 0x17}, {0x0088, 0x28},
+    {0x0089, 0x29}, {0x008A, 0x2A}, {0x008B, 0x2B}, {0x008C, 0x2C}, {0x008D, 0x09}, {0x008E, 0x0A}, {0x008F, 0x1B}, {0x0090, 0x30},
+    {0x0091, 0x31}, {0x0092, 0x1A}, {0x0093, 0x33}, {0x0094, 0x34}, {0x0095, 0x35}, {0x0096, 0x36}, {0x0097, 0x08}, {0x0098, 0x38},
+    {0x0099, 0x39}, {0x009A, 0x3A}, {0x009B, 0x3B}, {0x009C, 0x04}, {0x009D, 0x14}, {0x009E, 0x3E}, {0x009F, 0xFF}, {0x00A0, 0x74},
+    {0x00A3, 0xB0}, {0x00A6, 0xDF}, {0x00A7, 0xEB}, {0x00A8, 0x70}, {0x00A9, 0xFB}, {0x00AB, 0xEE}, {0x00AC, 0xEF}, {0x00AD, 0xCA},
+    {0x00B0, 0x90}, {0x00B1, 0xDA}, {0x00B2, 0xEA}, {0x00B3, 0xFA}, {0x00B4, 0xA0}, {0x00BB, 0xFE}, {0x00BD, 0xDB}, {0x0385, 0x80},
+    {0x0386, 0x71}, {0x0387, 0xDD}, {0x0388, 0x72}, {0x0389, 0x73}, {0x038A, 0x75}, {0x038C, 0x76}, {0x038E, 0x77}, {0x038F, 0x78},
+    {0x0390, 0xCC}, {0x0391, 0x41}, {0x0392, 0x42}, {0x0393, 0x43}, {0x0394, 0x44}, {0x0395, 0x45}, {0x0396, 0x46}, {0x0397, 0x47},
+    {0x0398, 0x48}, {0x0399, 0x49}, {0x039A, 0x51}, {0x039B, 0x52}, {0x039C, 0x53}, {0x039D, 0x54}, {0x039E, 0x55}, {0x039F, 0x56},
+    {0x03A0, 0x57}, {0x03A1, 0x58}, {0x03A3, 0x59}, {0x03A4, 0x62}, {0x03A5, 0x63}, {0x03A6, 0x64}, {0x03A7, 0x65}, {0x03A8, 0x66},
+    {0x03A9, 0x67}, {0x03AA, 0x68}, {0x03AB, 0x69}, {0x03AC, 0xB1}, {0x03AD, 0xB2}, {0x03AE, 0xB3}, {0x03AF, 0xB5}, {0x03B0, 0xCD},
+    {0x03B1, 0x8A}, {0x03B2, 0x8B}, {0x03B3, 0x8C}, {0x03B4, 0x8D}, {0x03B5, 0x8E}, {0x03B6, 0x8F}, {0x03B7, 0x9A}, {0x03B8, 0x9B},
+    {0x03B9, 0x9C}, {0x03BA, 0x9D}, {0x03BB, 0x9E}, {0x03BC, 0x9F}, {0x03BD, 0xAA}, {0x03BE, 0xAB}, {0x03BF, 0xAC}, {0x03C0, 0xAD},
+    {0x03C1, 0xAE}, {0x03C2, 0xBA}, {0x03C3, 0xAF}, {0x03C4, 0xBB}, {0x03C5, 0xBC}, {0x03C6, 0xBD}, {0x03C7, 0xBE}, {0x03C8, 0xBF},
+    {0x03C9, 0xCB}, {0x03CA, 0xB4}, {0x03CB, 0xB8}, {0x03CC, 0xB6}, {0x03CD, 0xB7}, {0x03CE, 0xB9}, {0x2015, 0xCF}, {0x2018, 0xCE},
+    {0x2019, 0xDE},
+};
+
+const uint16_t cp1026_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007, /* 0x20 */
+    0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A, /* 0x30 */
+    0x0020, 0x00A0, 0x00E2, 0x00E4, 0x00E0, 0x00E1, 0x00E3, 0x00E5, 0x007B, 0x00F1, 0x00C7, 0x002E, 0x003C, 0x0028, 0x002B, 0x0021, /* 0x40 */
+    0x0026, 0x00E9, 0x00EA, 0x00EB, 0x00E8, 0x00ED, 0x00EE, 0x00EF, 0x00EC, 0x00DF, 0x011E, 0x0130, 0x002A, 0x0029, 0x003B, 0x005E, /* 0x50 */
+    0x002D, 0x002F, 0x00C2, 0x00C4, 0x00C0, 0x00C1, 0x00C3, 0x00C5, 0x005B, 0x00D1, 0x015E, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F, /* 0x60 */
+    0x00F8, 0x00C9, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x0131, 0x003A, 0x00D6, 0x015F, 0x0027, 0x003D, 0x00DC, /* 0x70 */
+    0x00D8, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x007D, 0x0060, 0x00A6, 0x00B1, /* 0x80 */
+    0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x00C6, 0x00A4, /* 0x90 */
+    0x00B5, 0x00F6, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x005D, 0x0024, 0x0040, 0x00AE, /* 0xA0 */
+    0x00A2, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x00A7, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x00AC, 0x007C, 0x00AF, 0x00A8, 0x00B4, 0x00D7, /* 0xB0 */
+    0x00E7, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x007E, 0x00F2, 0x00F3, 0x00F5, /* 0xC0 */
+    0x011F, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x005C, 0x00F9, 0x00FA, 0x00FF, /* 0xD0 */
+    0x00FC, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x0023, 0x00D2, 0x00D3, 0x00D5, /* 0xE0 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x0022, 0x00D9, 0x00DA, 0x009F, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp1026_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x37}, {0x0005, 0x2D}, {0x0006, 0x2E}, {0x0007, 0x2F},
+    {0x0008, 0x16}, {0x0009, 0x05}, {0x000A, 0x25}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x3C}, {0x0015, 0x3D}, {0x0016, 0x32}, {0x0017, 0x26},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x3F}, {0x001B, 0x27}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x40}, {0x0021, 0x4F}, {0x0022, 0xFC}, {0x0023, 0xEC}, {0x0024, 0xAD}, {0x0025, 0x6C}, {0x0026, 0x50}, {0x0027, 0x7D},
+    {0x0028, 0x4D}, {0x0029, 0x5D}, {0x002A, 0x5C}, {0x002B, 0x4E}, {0x002C, 0x6B}, {0x002D, 0x60}, {0x002E, 0x4B}, {0x002F, 0x61},
+    {0x0030, 0xF0}, {0x0031, 0xF1}, {0x0032, 0xF2}, {0x0033, 0xF3}, {0x0034, 0xF4}, {0x0035, 0xF5}, {0x0036, 0xF6}, {0x0037, 0xF7},
+    {0x0038, 0xF8}, {0x0039, 0xF9}, {0x003A, 0x7A}, {0x003B, 0x5E}, {0x003C, 0x4C}, {0x003D, 0x7E}, {0x003E, 0x6E}, {0x003F, 0x6F},
+    {0x0040, 0xAE}, {0x0041, 0xC1}, {0x0042, 0xC2}, {0x0043, 0xC3}, {0x0044, 0xC4}, {0x0045, 0xC5}, {0x0046, 0xC6}, {0x0047, 0xC7},
+    {0x0048, 0xC8}, {0x0049, 0xC9}, {0x004A, 0xD1}, {0x004B, 0xD2}, {0x004C, 0xD3}, {0x004D, 0xD4}, {0x004E, 0xD5}, {0x004F, 0xD6},
+    {0x0050, 0xD7}, {0x0051, 0xD8}, {0x0052, 0xD9}, {0x0053, 0xE2}, {0x0054, 0xE3}, {0x0055, 0xE4}, {0x0056, 0xE5}, {0x0057, 0xE6},
+    {0x0058, 0xE7}, {0x0059, 0xE8}, {0x005A, 0xE9}, {0x005B, 0x68}, {0x005C, 0xDC}, {0x005D, 0xAC}, {0x005E, 0x5F}, {0x005F, 0x6D},
+    {0x0060, 0x8D}, {0x0061, 0x81}, {0x0062, 0x82}, {0x0063, 0x83}, {0x0064, 0x84}, {0x0065, 0x85}, {0x0066, 0x86}, {0x0067, 0x87},
+    {0x0068, 0x88}, {0x0069, 0x89}, {0x006A, 0x91}, {0x006B, 0x92}, {0x006C, 0x93}, {0x006D, 0x94}, {0x006E, 0x95}, {0x006F, 0x96},
+    {0x0070, 0x97}, {0x0071, 0x98}, {0x0072, 0x99}, {0x0073, 0xA2}, {0x0074, 0xA3}, {0x0075, 0xA4}, {0x0076, 0xA5}, {0x0077, 0xA6},
+    {0x0078, 0xA7}, {0x0079, 0xA8}, {0x007A, 0xA9}, {0x007B, 0x48}, {0x007C, 0xBB}, {0x007D, 0x8C}, {0x007E, 0xCC}, {0x007F, 0x07},
+    {0x0080, 0x20}, {0x0081, 0x21}, {0x0082, 0x22}, {0x0083, 0x23}, {0x0084, 0x24}, {0x0085, 0x15}, {0x0086, 0x06}, {0x0087, 0x17},
+    {0x0088, 0x28}, {0x0089, 0x29}, {0x008A, 0x2A}, {0x008B, 0x2B}, {0x008C, 0x2C}, {0x008D, 0x09}, {0x008E, 0x0A}, {0x008F, 0x1B},
+    {0x0090, 0x30}, {0x0091, 0x31}, {0x0092, 0x1A}, {0x0093, 0x33}, {0x0094, 0x34}, {0x0095, 0x35}, {0x0096, 0x36}, {0x0097, 0x08},
+    {0x0098, 0x38}, {0x0099, 0x39}, {0x009A, 0x3A}, {0x009B, 0x3B}, {0x009C, 0x04}, {0x009D, 0x14}, {0x009E, 0x3E}, {0x009F, 0xFF},
+    {0x00A0, 0x41}, {0x00A1, 0xAA}, {0x00A2, 0xB0}, {0x00A3, 0xB1}, {0x00A4, 0x9F}, {0x00A5, 0xB2}, {0x00A6, 0x8E}, {0x00A7, 0xB5},
+    {0x00A8, 0xBD}, {0x00A9, 0xB4}, {0x00AA, 0x9A}, {0x00AB, 0x8A}, {0x00AC, 0xBA}, {0x00AD, 0xCA}, {0x00AE, 0xAF}, {0x00AF, 0xBC},
+    {0x00B0, 0x90}, {0x00B1, 0x8F}, {0x00B2, 0xEA}, {0x00B3, 0xFA}, {0x00B4, 0xBE}, {0x00B5, 0xA0}, {0x00B6, 0xB6}, {0x00B7, 0xB3},
+    {0x00B8, 0x9D}, {0x00B9, 0xDA}, {0x00BA, 0x9B}, {0x00BB, 0x8B}, {0x00BC, 0xB7}, {0x00BD, 0xB8}, {0x00BE, 0xB9}, {0x00BF, 0xAB},
+    {0x00C0, 0x64}, {0x00C1, 0x65}, {0x00C2, 0x62}, {0x00C3, 0x66}, {0x00C4, 0x63}, {0x00C5, 0x67}, {0x00C6, 0x9E}, {0x00C7, 0x4A},
+    {0x00C8, 0x74}, {0x00C9, 0x71}, {0x00CA, 0x72}, {0x00CB, 0x73}, {0x00CC, 0x78}, {0x00CD, 0x75}, {0x00CE, 0x76}, {0x00CF, 0x77},
+    {0x00D1, 0x69}, {0x00D2, 0xED}, {0x00D3, 0xEE}, {0x00D4, 0xEB}, {0x00D5, 0xEF}, {0x00D6, 0x7B}, {0x00D7, 0xBF}, {0x00D8, 0x80},
+    {0x00D9, 0xFD}, {0x00DA, 0xFE}, {0x00DB, 0xFB}, {0x00DC, 0x7F}, {0x00DF, 0x59}, {0x00E0, 0x44}, {0x00E1, 0x45}, {0x00E2, 0x42},
+    {0x00E3, 0x46}, {0x00E4, 0x43}, {0x00E5, 0x47}, {0x00E6, 0x9C}, {0x00E7, 0xC0}, {0x00E8, 0x54}, {0x00E9, 0x51}, {0x00EA, 0x52},
+    {0x00EB, 0x53}, {0x00EC, 0x58}, {0x00ED, 0x55}, {0x00EE, 0x56}, {0x00EF, 0x57}, {0x00F1, 0x49}, {0x00F2, 0xCD}, {0x00F3, 0xCE},
+    {0x00F4, 0xCB}, {0x00F5, 0xCF}, {0x00F6, 0xA1}, {0x00F7, 0xE1}, {0x00F8, 0x70}, {0x00F9, 0xDD}, {0x00FA, 0xDE}, {0x00FB, 0xDB},
+    {0x00FC, 0xE0}, {0x00FF, 0xDF}, {0x011E, 0x5A}, {0x011F, 0xD0}, {0x0130, 0x5B}, {0x0131, 0x79}, {0x015E, 0x6A}, {0x015F, 0x7C},
+};
+
+const uint16_t cp1140_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007, /* 0x20 */
+    0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A, /* 0x30 */
+    0x0020, 0x00A0, 0x00E2, 0x00E4, 0x00E0, 0x00E1, 0x00E3, 0x00E5, 0x00E7, 0x00F1, 0x00A2, 0x002E, 0x003C, 0x0028, 0x002B, 0x007C, /* 0x40 */
+    0x0026, 0x00E9, 0x00EA, 0x00EB, 0x00E8, 0x00ED, 0x00EE, 0x00EF, 0x00EC, 0x00DF, 0x0021, 0x0024, 0x002A, 0x0029, 0x003B, 0x00AC, /* 0x50 */
+    0x002D, 0x002F, 0x00C2, 0x00C4, 0x00C0, 0x00C1, 0x00C3, 0x00C5, 0x00C7, 0x00D1, 0x00A6, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F, /* 0x60 */
+    0x00F8, 0x00C9, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x0060, 0x003A, 0x0023, 0x0040, 0x0027, 0x003D, 0x0022, /* 0x70 */
+    0x00D8, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x00F0, 0x00FD, 0x00FE, 0x00B1, /* 0x80 */
+    0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x00C6, 0x20AC, /* 0x90 */
+    0x00B5, 0x007E, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x00D0, 0x00DD, 0x00DE, 0x00AE, /* 0xA0 */
+    0x005E, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x00A7, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x005B, 0x005D, 0x00AF, 0x00A8, 0x00B4, 0x00D7, /* 0xB0 */
+    0x007B, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x00F6, 0x00F2, 0x00F3, 0x00F5, /* 0xC0 */
+    0x007D, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x00FC, 0x00F9, 0x00FA, 0x00FF, /* 0xD0 */
+    0x005C, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x00D6, 0x00D2, 0x00D3, 0x00D5, /* 0xE0 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x00DC, 0x00D9, 0x00DA, 0x009F, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp1140_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x37}, {0x0005, 0x2D}, {0x0006, 0x2E}, {0x0007, 0x2F},
+    {0x0008, 0x16}, {0x0009, 0x05}, {0x000A, 0x25}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x3C}, {0x0015, 0x3D}, {0x0016, 0x32}, {0x0017, 0x26},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x3F}, {0x001B, 0x27}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x40}, {0x0021, 0x5A}, {0x0022, 0x7F}, {0x0023, 0x7B}, {0x0024, 0x5B}, {0x0025, 0x6C}, {0x0026, 0x50}, {0x0027, 0x7D},
+    {0x0028, 0x4D}, {0x0029, 0x5D}, {0x002A, 0x5C}, {0x002B, 0x4E}, {0x002C, 0x6B}, {0x002D, 0x60}, {0x002E, 0x4B}, {0x002F, 0x61},
+    {0x0030, 0xF0}, {0x0031, 0xF1}, {0x0032, 0xF2}, {0x0033, 0xF3}, {0x0034, 0xF4}, {0x0035, 0xF5}, {0x0036, 0xF6}, {0x0037, 0xF7},
+    {0x0038, 0xF8}, {0x0039, 0xF9}, {0x003A, 0x7A}, {0x003B, 0x5E}, {0x003C, 0x4C}, {0x003D, 0x7E}, {0x003E, 0x6E}, {0x003F, 0x6F},
+    {0x0040, 0x7C}, {0x0041, 0xC1}, {0x0042, 0xC2}, {0x0043, 0xC3}, {0x0044, 0xC4}, {0x0045, 0xC5}, {0x0046, 0xC6}, {0x0047, 0xC7},
+    {0x0048, 0xC8}, {0x0049, 0xC9}, {0x004A, 0xD1}, {0x004B, 0xD2}, {0x004C, 0xD3}, {0x004D, 0xD4}, {0x004E, 0xD5}, {0x004F, 0xD6},
+    {0x0050, 0xD7}, {0x0051, 0xD8}, {0x0052, 0xD9}, {0x0053, 0xE2}, {0x0054, 0xE3}, {0x0055, 0xE4}, {0x0056, 0xE5}, {0x0057, 0xE6},
+    {0x0058, 0xE7}, {0x0059, 0xE8}, {0x005A, 0xE9}, {0x005B, 0xBA}, {0x005C, 0xE0}, {0x005D, 0xBB}, {0x005E, 0xB0}, {0x005F, 0x6D},
+    {0x0060, 0x79}, {0x0061, 0x81}, {0x0062, 0x82}, {0x0063, 0x83}, {0x0064, 0x84}, {0x0065, 0x85}, {0x0066, 0x86}, {0x0067, 0x87},
+    {0x0068, 0x88}, {0x0069, 0x89}, {0x006A, 0x91}, {0x006B, 0x92}, {0x006C, 0x93}, {0x006D, 0x94}, {0x006E, 0x95}, {0x006F, 0x96},
+    {0x0070, 0x97}, {0x0071, 0x98}, {0x0072, 0x99}, {0x0073, 0xA2}, {0x0074, 0xA3}, {0x0075, 0xA4}, {0x0076, 0xA5}, {0x0077, 0xA6},
+    {0x0078, 0xA7}, {0x0079, 0xA8}, {0x007A, 0xA9}, {0x007B, 0xC0}, {0x007C, 0x4F}, {0x007D, 0xD0}, {0x007E, 0xA1}, {0x007F, 0x07},
+    {0x0080, 0x20}, {0x0081, 0x21}, {0x0082, 0x22}, {0x0083, 0x23}, {0x0084, 0x24}, {0x0085, 0x15}, {0x0086, 0x06}, {0x0087, 0x17},
+    {0x0088, 0x28}, {0x0089, 0x29}, {0x008A, 0x2A}, {0x008B, 0x2B}, {0x008C, 0x2C}, {0x008D, 0x09}, {0x008E, 0x0A}, {0x008F, 0x1B},
+    {0x0090, 0x30}, {0x0091, 0x31}, {0x0092, 0x1A}, {0x0093, 0x33}, {0x0094, 0x34}, {0x0095, 0x35}, {0x0096, 0x36}, {0x0097, 0x08},
+    {0x0098, 0x38}, {0x0099, 0x39}, {0x009A, 0x3A}, {0x009B, 0x3B}, {0x009C, 0x04}, {0x009D, 0x14}, {0x009E, 0x3E}, {0x009F, 0xFF},
+    {0x00A0, 0x41}, {0x00A1, 0xAA}, {0x00A2, 0x4A}, {0x00A3, 0xB1}, {0x00A5, 0xB2}, {0x00A6, 0x6A}, {0x00A7, 0xB5}, {0x00A8, 0xBD},
+    {0x00A9, 0xB4}, {0x00AA, 0x9A}, {0x00AB, 0x8A}, {0x00AC, 0x5F}, {0x00AD, 0xCA}, {0x00AE, 0xAF}, {0x00AF, 0xBC}, {0x00B0, 0x90},
+    {0x00B1, 0x8F}, {0x00B2, 0xEA}, {0x00B3, 0xFA}, {0x00B4, 0xBE}, {0x00B5, 0xA0}, {0x00B6, 0xB6}, {0x00B7, 0xB3}, {0x00B8, 0x9D},
+    {0x00B9, 0xDA}, {0x00BA, 0x9B}, {0x00BB, 0x8B}, {0x00BC, 0xB7}, {0x00BD, 0xB8}, {0x00BE, 0xB9}, {0x00BF, 0xAB}, {0x00C0, 0x64},
+    {0x00C1, 0x65}, {0x00C2, 0x62}, {0x00C3, 0x66}, {0x00C4, 0x63}, {0x00C5, 0x67}, {0x00C6, 0x9E}, {0x00C7, 0x68}, {0x00C8, 0x74},
+    {0x00C9, 0x71}, {0x00CA, 0x72}, {0x00CB, 0x73}, {0x00CC, 0x78}, {0x00CD, 0x75}, {0x00CE, 0x76}, {0x00CF, 0x77}, {0x00D0, 0xAC},
+    {0x00D1, 0x69}, {0x00D2, 0xED}, {0x00D3, 0xEE}, {0x00D4, 0xEB}, {0x00D5, 0xEF}, {0x00D6, 0xEC}, {0x00D7, 0xBF}, {0x00D8, 0x80},
+    {0x00D9, 0xFD}, {0x00DA, 0xFE}, {0x00DB, 0xFB}, {0x00DC, 0xFC}, {0x00DD, 0xAD}, {0x00DE, 0xAE}, {0x00DF, 0x59}, {0x00E0, 0x44},
+    {0x00E1, 0x45}, {0x00E2, 0x42}, {0x00E3, 0x46}, {0x00E4, 0x43}, {0x00E5, 0x47}, {0x00E6, 0x9C}, {0x00E7, 0x48}, {0x00E8, 0x54},
+    {0x00E9, 0x51}, {0x00EA, 0x52}, {0x00EB, 0x53}, {0x00EC, 0x58}, {0x00ED, 0x55}, {0x00EE, 0x56}, {0x00EF, 0x57}, {0x00F0, 0x8C},
+    {0x00F1, 0x49}, {0x00F2, 0xCD}, {0x00F3, 0xCE}, {0x00F4, 0xCB}, {0x00F5, 0xCF}, {0x00F6, 0xCC}, {0x00F7, 0xE1}, {0x00F8, 0x70},
+    {0x00F9, 0xDD}, {0x00FA, 0xDE}, {0x00FB, 0xDB}, {0x00FC, 0xDC}, {0x00FD, 0x8D}, {0x00FE, 0x8E}, {0x00FF, 0xDF}, {0x20AC, 0x9F},
+};
+
+const uint16_t cp1141_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007, /* 0x20 */
+    0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A, /* 0x30 */
+    0x0020, 0x00A0, 0x00E2, 0x007B, 0x00E0, 0x00E1, 0x00E3, 0x00E5, 0x00E7, 0x00F1, 0x00C4, 0x002E, 0x003C, 0x0028, 0x002B, 0x0021, /* 0x40 */
+    0x0026, 0x00E9, 0x00EA, 0x00EB, 0x00E8, 0x00ED, 0x00EE, 0x00EF, 0x00EC, 0x007E, 0x00DC, 0x0024, 0x002A, 0x0029, 0x003B, 0x005E, /* 0x50 */
+    0x002D, 0x002F, 0x00C2, 0x005B, 0x00C0, 0x00C1, 0x00C3, 0x00C5, 0x00C7, 0x00D1, 0x00F6, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F, /* 0x60 */
+    0x00F8, 0x00C9, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x0060, 0x003A, 0x0023, 0x00A7, 0x0027, 0x003D, 0x0022, /* 0x70 */
+    0x00D8, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x00F0, 0x00FD, 0x00FE, 0x00B1, /* 0x80 */
+    0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x00C6, 0x20AC, /* 0x90 */
+    0x00B5, 0x00DF, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x00D0, 0x00DD, 0x00DE, 0x00AE, /* 0xA0 */
+    0x00A2, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x0040, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x00AC, 0x007C, 0x00AF, 0x00A8, 0x00B4, 0x00D7, /* 0xB0 */
+    0x00E4, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x00A6, 0x00F2, 0x00F3, 0x00F5, /* 0xC0 */
+    0x00FC, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x007D, 0x00F9, 0x00FA, 0x00FF, /* 0xD0 */
+    0x00D6, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x005C, 0x00D2, 0x00D3, 0x00D5, /* 0xE0 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x005D, 0x00D9, 0x00DA, 0x009F, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp1141_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x37}, {0x0005, 0x2D}, {0x0006, 0x2E}, {0x0007, 0x2F},
+    {0x0008, 0x16}, {0x0009, 0x05}, {0x000A, 0x25}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x3C}, {0x0015, 0x3D}, {0x0016, 0x32}, {0x0017, 0x26},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x3F}, {0x001B, 0x27}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x40}, {0x0021, 0x4F}, {0x0022, 0x7F}, {0x0023, 0x7B}, {0x0024, 0x5B}, {0x0025, 0x6C}, {0x0026, 0x50}, {0x0027, 0x7D},
+    {0x0028, 0x4D}, {0x0029, 0x5D}, {0x002A, 0x5C}, {0x002B, 0x4E}, {0x002C, 0x6B}, {0x002D, 0x60}, {0x002E, 0x4B}, {0x002F, 0x61},
+    {0x0030, 0xF0}, {0x0031, 0xF1}, {0x0032, 0xF2}, {0x0033, 0xF3}, {0x0034, 0xF4}, {0x0035, 0xF5}, {0x0036, 0xF6}, {0x0037, 0xF7},
+    {0x0038, 0xF8}, {0x0039, 0xF9}, {0x003A, 0x7A}, {0x003B, 0x5E}, {0x003C, 0x4C}, {0x003D, 0x7E}, {0x003E, 0x6E}, {0x003F, 0x6F},
+    {0x0040, 0xB5}, {0x0041, 0xC1}, {0x0042, 0xC2}, {0x0043, 0xC3}, {0x0044, 0xC4}, {0x0045, 0xC5}, {0x0046, 0xC6}, {0x0047, 0xC7},
+    {0x0048, 0xC8}, {0x0049, 0xC9}, {0x004A, 0xD1}, {0x004B, 0xD2}, {0x004C, 0xD3}, {0x004D, 0xD4}, {0x004E, 0xD5}, {0x004F, 0xD6},
+    {0x0050, 0xD7}, {0x0051, 0xD8}, {0x0052, 0xD9}, {0x0053, 0xE2}, {0x0054, 0xE3}, {0x0055, 0xE4}, {0x0056, 0xE5}, {0x0057, 0xE6},
+    {0x0058, 0xE7}, {0x0059, 0xE8}, {0x005A, 0xE9}, {0x005B, 0x63}, {0x005C, 0xEC}, {0x005D, 0xFC}, {0x005E, 0x5F}, {0x005F, 0x6D},
+    {0x0060, 0x79}, {0x0061, 0x81}, {0x0062, 0x82}, {0x0063, 0x83}, {0x0064, 0x84}, {0x0065, 0x85}, {0x0066, 0x86}, {0x0067, 0x87},
+    {0x0068, 0x88}, {0x0069, 0x89}, {0x006A, 0x91}, {0x006B, 0x92}, {0x006C, 0x93}, {0x006D, 0x94}, {0x006E, 0x95}, {0x006F, 0x96},
+    {0x0070, 0x97}, {0x0071, 0x98}, {0x0072, 0x99}, {0x0073, 0xA2}, {0x0074, 0xA3}, {0x0075, 0xA4}, {0x0076, 0xA5}, {0x0077, 0xA6},
+    {0x0078, 0xA7}, {0x0079, 0xA8}, {0x007A, 0xA9}, {0x007B, 0x43}, {0x007C, 0xBB}, {0x007D, 0xDC}, {0x007E, 0x59}, {0x007F, 0x07},
+    {0x0080, 0x20}, {0x0081, 0x21}, {0x0082, 0x22}, {0x0083, 0x23}, {0x0084, 0x24}, {0x0085, 0x15}, {0x0086, 0x06}, {0x0087, 0x17},
+    {0x0088, 0x28}, {0x0089, 0x29}, {0x008A, 0x2A}, {0x008B, 0x2B}, {0x008C, 0x2C}, {0x008D, 0x09}, {0x008E, 0x0A}, {0x008F, 0x1B},
+    {0x0090, 0x30}, {0x0091, 0x31}, {0x0092, 0x1A}, {0x0093, 0x33}, {0x0094, 0x34}, {0x0095, 0x35}, {0x0096, 0x36}, {0x0097, 0x08},
+    {0x0098, 0x38}, {0x0099, 0x39}, {0x009A, 0x3A}, {0x009B, 0x3B}, {0x009C, 0x04}, {0x009D, 0x14}, {0x009E, 0x3E}, {0x009F, 0xFF},
+    {0x00A0, 0x41}, {0x00A1, 0xAA}, {0x00A2, 0xB0}, {0x00A3, 0xB1}, {0x00A5, 0xB2}, {0x00A6, 0xCC}, {0x00A7, 0x7C}, {0x00A8, 0xBD},
+    {0x00A9, 0xB4}, {0x00AA, 0x9A}, {0x00AB, 0x8A}, {0x00AC, 0xBA}, {0x00AD, 0xCA}, {0x00AE, 0xAF}, {0x00AF, 0xBC}, {0x00B0, 0x90},
+    {0x00B1, 0x8F}, {0x00B2, 0xEA}, {0x00B3, 0xFA}, {0x00B4, 0xBE}, {0x00B5, 0xA0}, {0x00B6, 0xB6}, {0x00B7, 0xB3}, {0x00B8, 0x9D},
+    {0x00B9, 0xDA}, {0x00BA, 0x9B}, {0x00BB, 0x8B}, {0x00BC, 0xB7}, {0x00BD, 0xB8}, {0x00BE, 0xB9}, {0x00BF, 0xAB}, {0x00C0, 0x64},
+    {0x00C1, 0x65}, {0x00C2, 0x62}, {0x00C3, 0x66}, {0x00C4, 0x4A}, {0x00C5, 0x67}, {0x00C6, 0x9E}, {0x00C7, 0x68}, {0x00C8, 0x74},
+    {0x00C9, 0x71}, {0x00CA, 0x72}, {0x00CB, 0x73}, {0x00CC, 0x78}, {0x00CD, 0x75}, {0x00CE, 0x76}, {0x00CF, 0x77}, {0x00D0, 0xAC},
+    {0x00D1, 0x69}, {0x00D2, 0xED}, {0x00D3, 0xEE}, {0x00D4, 0xEB}, {0x00D5, 0xEF}, {0x00D6, 0xE0}, {0x00D7, 0xBF}, {0x00D8, 0x80},
+    {0x00D9, 0xFD}, {0x00DA, 0xFE}, {0x00DB, 0xFB}, {0x00DC, 0x5A}, {0x00DD, 0xAD}, {0x00DE, 0xAE}, {0x00DF, 0xA1}, {0x00E0, 0x44},
+    {0x00E1, 0x45}, {0x00E2, 0x42}, {0x00E3, 0x46}, {0x00E4, 0xC0}, {0x00E5, 0x47}, {0x00E6, 0x9C}, {0x00E7, 0x48}, {0x00E8, 0x54},
+    {0x00E9, 0x51}, {0x00EA, 0x52}, {0x00EB, 0x53}, {0x00EC, 0x58}, {0x00ED, 0x55}, {0x00EE, 0x56}, {0x00EF, 0x57}, {0x00F0, 0x8C},
+    {0x00F1, 0x49}, {0x00F2, 0xCD}, {0x00F3, 0xCE}, {0x00F4, 0xCB}, {0x00F5, 0xCF}, {0x00F6, 0x6A}, {0x00F7, 0xE1}, {0x00F8, 0x70},
+    {0x00F9, 0xDD}, {0x00FA, 0xDE}, {0x00FB, 0xDB}, {0x00FC, 0xD0}, {0x00FD, 0x8D}, {0x00FE, 0x8E}, {0x00FF, 0xDF}, {0x20AC, 0x9F},
+};
+
+const uint16_t cp1142_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007, /* 0x20 */
+    0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A, /* 0x30 */
+    0x0020, 0x00A0, 0x00E2, 0x00E4, 0x00E0, 0x00E1, 0x00E3, 0x007D, 0x00E7, 0x00F1, 0x0023, 0x002E, 0x003C, 0x0028, 0x002B, 0x0021, /* 0x40 */
+    0x0026, 0x00E9, 0x00EA, 0x00EB, 0x00E8, 0x00ED, 0x00EE, 0x00EF, 0x00EC, 0x00DF, 0x00A4, 0x00C5, 0x002A, 0x0029, 0x003B, 0x005E, /* 0x50 */
+    0x002D, 0x002F, 0x00C2, 0x00C4, 0x00C0, 0x00C1, 0x00C3, 0x0024, 0x00C7, 0x00D1, 0x00F8, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F, /* 0x60 */
+    0x00A6, 0x00C9, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x0060, 0x003A, 0x00C6, 0x00D8, 0x0027, 0x003D, 0x0022, /* 0x70 */
+    0x0040, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x00F0, 0x00FD, 0x00FE, 0x00B1, /* 0x80 */
+    0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x007B, 0x20AC, /* 0x90 */
+    0x00B5, 0x00FC, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x00D0, 0x00DD, 0x00DE, 0x00AE, /* 0xA0 */
+    0x00A2, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x00A7, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x00AC, 0x007C, 0x00AF, 0x00A8, 0x00B4, 0x00D7, /* 0xB0 */
+    0x00E5, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x00F6, 0x00F2, 0x00F3, 0x00F5, /* 0xC0 */
+    0x007E, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x005C, 0x00F9, 0x00FA, 0x00FF, /* 0xD0 */
+    0x00D6, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x005B, 0x00D2, 0x00D3, 0x00D5, /* 0xE0 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x00DC, 0x00D9, 0x00DA, 0x009F, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp1142_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x37}, {0x0005, 0x2D}, {0x0006, 0x2E}, {0x0007, 0x2F},
+    {0x0008, 0x16}, {0x0009, 0x05}, {0x000A, 0x25}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x3C}, {0x0015, 0x3D}, {0x0016, 0x32}, {0x0017, 0x26},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x3F}, {0x001B, 0x27}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x40}, {0x0021, 0x4F}, {0x0022, 0x7F}, {0x0023, 0x4A}, {0x0024, 0x67}, {0x0025, 0x6C}, {0x0026, 0x50}, {0x0027, 0x7D},
+    {0x0028, 0x4D}, {0x0029, 0x5D}, {0x002A, 0x5C}, {0x002B, 0x4E}, {0x002C, 0x6B}, {0x002D, 0x60}, {0x002E, 0x4B}, {0x002F, 0x61},
+    {0x0030, 0xF0}, {0x0031, 0xF1}, {0x0032, 0xF2}, {0x0033, 0xF3}, {0x0034, 0xF4}, {0x0035, 0xF5}, {0x0036, 0xF6}, {0x0037, 0xF7},
+    {0x0038, 0xF8}, {0x0039, 0xF9}, {0x003A, 0x7A}, {0x003B, 0x5E}, {0x003C, 0x4C}, {0x003D, 0x7E}, {0x003E, 0x6E}, {0x003F, 0x6F},
+    {0x0040, 0x80}, {0x0041, 0xC1}, {0x0042, 0xC2}, {0x0043, 0xC3}, {0x0044, 0xC4}, {0x0045, 0xC5}, {0x0046, 0xC6}, {0x0047, 0xC7},
+    {0x0048, 0xC8}, {0x0049, 0xC9}, {0x004A, 0xD1}, {0x004B, 0xD2}, {0x004C, 0xD3}, {0x004D, 0xD4}, {0x004E, 0xD5}, {0x004F, 0xD6},
+    {0x0050, 0xD7}, {0x0051, 0xD8}, {0x0052, 0xD9}, {0x0053, 0xE2}, {0x0054, 0xE3}, {0x0055, 0xE4}, {0x0056, 0xE5}, {0x0057, 0xE6},
+    {0x0058, 0xE7}, {0x0059, 0xE8}, {0x005A, 0xE9}, {0x005B, 0xEC}, {0x005C, 0xDC}, {0x005E, 0x5F}, {0x005F, 0x6D}, {0x0060, 0x79},
+    {0x0061, 0x81}, {0x0062, 0x82}, {0x0063, 0x83}, {0x0064, 0x84}, {0x0065, 0x85}, {0x0066, 0x86}, {0x0067, 0x87}, {0x0068, 0x88},
+    {0x0069, 0x89}, {0x006A, 0x91}, {0x006B, 0x92}, {0x006C, 0x93}, {0x006D, 0x94}, {0x006E, 0x95}, {0x006F, 0x96}, {0x0070, 0x97},
+    {0x0071, 0x98}, {0x0072, 0x99}, {0x0073, 0xA2}, {0x0074, 0xA3}, {0x0075, 0xA4}, {0x0076, 0xA5}, {0x0077, 0xA6}, {0x0078, 0xA7},
+    {0x0079, 0xA8}, {0x007A, 0xA9}, {0x007B, 0x9E}, {0x007C, 0xBB}, {0x007D, 0x47}, {0x007E, 0xD0}, {0x007F, 0x07}, {0x0080, 0x20},
+    {0x0081, 0x21}, {0x0082, 0x22}, {0x0083, 0x23}, {0x0084, 0x24}, {0x0085, 0x15}, {0x0086, 0x06}, {0x0087, 0x17}, {0x0088, 0x28},
+    {0x0089, 0x29}, {0x008A, 0x2A}, {0x008B, 0x2B}, {0x008C, 0x2C}, {0x008D, 0x09}, {0x008E, 0x0A}, {0x008F, 0x1B}, {0x0090, 0x30},
+    {0x0091, 0x31}, {0x0092, 0x1A}, {0x0093, 0x33}, {0x0094, 0x34}, {0x0095, 0x35}, {0x0096, 0x36}, {0x0097, 0x08}, {0x0098, 0x38},
+    {0x0099, 0x39}, {0x009A, 0x3A}, {0x009B, 0x3B}, {0x009C, 0x04}, {0x009D, 0x14}, {0x009E, 0x3E}, {0x009F, 0xFF}, {0x00A0, 0x41},
+    {0x00A1, 0xAA}, {0x00A2, 0xB0}, {0x00A3, 0xB1}, {0x00A4, 0x5A}, {0x00A5, 0xB2}, {0x00A6, 0x70}, {0x00A7, 0xB5}, {0x00A8, 0xBD},
+    {0x00A9, 0xB4}, {0x00AA, 0x9A}, {0x00AB, 0x8A}, {0x00AC, 0xBA}, {0x00AD, 0xCA}, {0x00AE, 0xAF}, {0x00AF, 0xBC}, {0x00B0, 0x90},
+    {0x00B1, 0x8F}, {0x00B2, 0xEA}, {0x00B3, 0xFA}, {0x00B4, 0xBE}, {0x00B5, 0xA0}, {0x00B6, 0xB6}, {0x00B7, 0xB3}, {0x00B8, 0x9D},
+    {0x00B9, 0xDA}, {0x00BA, 0x9B}, {0x00BB, 0x8B}, {0x00BC, 0xB7}, {0x00BD, 0xB8}, {0x00BE, 0xB9}, {0x00BF, 0xAB}, {0x00C0, 0x64},
+    {0x00C1, 0x65}, {0x00C2, 0x62}, {0x00C3, 0x66}, {0x00C4, 0x63}, {0x00C5, 0x5B}, {0x00C6, 0x7B}, {0x00C7, 0x68}, {0x00C8, 0x74},
+    {0x00C9, 0x71}, {0x00CA, 0x72}, {0x00CB, 0x73}, {0x00CC, 0x78}, {0x00CD, 0x75}, {0x00CE, 0x76}, {0x00CF, 0x77}, {0x00D0, 0xAC},
+    {0x00D1, 0x69}, {0x00D2, 0xED}, {0x00D3, 0xEE}, {0x00D4, 0xEB}, {0x00D5, 0xEF}, {0x00D6, 0xE0}, {0x00D7, 0xBF}, {0x00D8, 0x7C},
+    {0x00D9, 0xFD}, {0x00DA, 0xFE}, {0x00DB, 0xFB}, {0x00DC, 0xFC}, {0x00DD, 0xAD}, {0x00DE, 0xAE}, {0x00DF, 0x59}, {0x00E0, 0x44},
+    {0x00E1, 0x45}, {0x00E2, 0x42}, {0x00E3, 0x46}, {0x00E4, 0x43}, {0x00E5, 0xC0}, {0x00E6, 0x9C}, {0x00E7, 0x48}, {0x00E8, 0x54},
+    {0x00E9, 0x51}, {0x00EA, 0x52}, {0x00EB, 0x53}, {0x00EC, 0x58}, {0x00ED, 0x55}, {0x00EE, 0x56}, {0x00EF, 0x57}, {0x00F0, 0x8C},
+    {0x00F1, 0x49}, {0x00F2, 0xCD}, {0x00F3, 0xCE}, {0x00F4, 0xCB}, {0x00F5, 0xCF}, {0x00F6, 0xCC}, {0x00F7, 0xE1}, {0x00F8, 0x6A},
+    {0x00F9, 0xDD}, {0x00FA, 0xDE}, {0x00FB, 0xDB}, {0x00FC, 0xA1}, {0x00FD, 0x8D}, {0x00FE, 0x8E}, {0x00FF, 0xDF}, {0x20AC, 0x9F},
+};
+
+const uint16_t cp1143_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007, /* 0x20 */
+    0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A, /* 0x30 */
+    0x0020, 0x00A0, 0x00E2, 0x007B, 0x00E0, 0x00E1, 0x00E3, 0x007D, 0x00E7, 0x00F1, 0x00A7, 0x002E, 0x003C, 0x0028, 0x002B, 0x0021, /* 0x40 */
+    0x0026, 0x0060, 0x00EA, 0x00EB, 0x00E8, 0x00ED, 0x00EE, 0x00EF, 0x00EC, 0x00DF, 0x00A4, 0x00C5, 0x002A, 0x0029, 0x003B, 0x005E, /* 0x50 */
+    0x002D, 0x002F, 0x00C2, 0x0023, 0x00C0, 0x00C1, 0x00C3, 0x0024, 0x00C7, 0x00D1, 0x00F6, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F, /* 0x60 */
+    0x00F8, 0x005C, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x00E9, 0x003A, 0x00C4, 0x00D6, 0x0027, 0x003D, 0x0022, /* 0x70 */
+    0x00D8, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x00F0, 0x00FD, 0x00FE, 0x00B1, /* 0x80 */
+    0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x00C6, 0x20AC, /* 0x90 */
+    0x00B5, 0x00FC, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x00D0, 0x00DD, 0x00DE, 0x00AE, /* 0xA0 */
+    0x00A2, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x005B, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x00AC, 0x007C, 0x00AF, 0x00A8, 0x00B4, 0x00D7, /* 0xB0 */
+    0x00E4, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x00A6, 0x00F2, 0x00F3, 0x00F5, /* 0xC0 */
+    0x00E5, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x007E, 0x00F9, 0x00FA, 0x00FF, /* 0xD0 */
+    0x00C9, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x0040, 0x00D2, 0x00D3, 0x00D5, /* 0xE0 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x005D, 0x00D9, 0x00DA, 0x009F, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp1143_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x37}, {0x0005, 0x2D}, {0x0006, 0x2E}, {0x0007, 0x2F},
+    {0x0008, 0x16}, {0x0009, 0x05}, {0x000A, 0x25}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x3C}, {0x0015, 0x3D}, {0x0016, 0x32}, {0x0017, 0x26},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x3F}, {0x001B, 0x27}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x40}, {0x0021, 0x4F}, {0x0022, 0x7F}, {0x0023, 0x63}, {0x0024, 0x67}, {0x0025, 0x6C}, {0x0026, 0x50}, {0x0027, 0x7D},
+    {0x0028, 0x4D}, {0x0029, 0x5D}, {0x002A, 0x5C}, {0x002B, 0x4E}, {0x002C, 0x6B}, {0x002D, 0x60}, {0x002E, 0x4B}, {0x002F, 0x61},
+    {0x0030, 0xF0}, {0x0031, 0xF1}, {0x0032, 0xF2}, {0x0033, 0xF3}, {0x0034, 0xF4}, {0x0035, 0xF5}, {0x0036, 0xF6}, {0x0037, 0xF7},
+    {0x0038, 0xF8}, {0x0039, 0xF9}, {0x003A, 0x7A}, {0x003B, 0x5E}, {0x003C, 0x4C}, {0x003D, 0x7E}, {0x003E, 0x6E}, {0x003F, 0x6F},
+    {0x0040, 0xEC}, {0x0041, 0xC1}, {0x0042, 0xC2}, {0x0043, 0xC3}, {0x0044, 0xC4}, {0x0045, 0xC5}, {0x0046, 0xC6}, {0x0047, 0xC7},
+    {0x0048, 0xC8}, {0x0049, 0xC9}, {0x004A, 0xD1}, {0x004B, 0xD2}, {0x004C, 0xD3}, {0x004D, 0xD4}, {0x004E, 0xD5}, {0x004F, 0xD6},
+    {0x0050, 0xD7}, {0x0051, 0xD8}, {0x0052, 0xD9}, {0x0053, 0xE2}, {0x0054, 0xE3}, {0x0055, 0xE4}, {0x0056, 0xE5}, {0x0057, 0xE6},
+    {0x0058, 0xE7}, {0x0059, 0xE8}, {0x005A, 0xE9}, {0x005B, 0xB5}, {0x005C, 0x71}, {0x005D, 0xFC}, {0x005E, 0x5F}, {0x005F, 0x6D},
+    {0x0060, 0x51}, {0x0061, 0x81}, {0x0062, 0x82}, {0x0063, 0x83}, {0x0064, 0x84}, {0x0065, 0x85}, {0x0066, 0x86}, {0x0067, 0x87},
+    {0x0068, 0x88}, {0x0069, 0x89}, {0x006A, 0x91}, {0x006B, 0x92}, {0x006C, 0x93}, {0x006D, 0x94}, {0x006E, 0x95}, {0x006F, 0x96},
+    {0x0070, 0x97}, {0x0071, 0x98}, {0x0072, 0x99}, {0x0073, 0xA2}, {0x0074, 0xA3}, {0x0075, 0xA4}, {0x0076, 0xA5}, {0x0077, 0xA6},
+    {0x0078, 0xA7}, {0x0079, 0xA8}, {0x007A, 0xA9}, {0x007B, 0x43}, {0x007C, 0xBB}, {0x007D, 0x47}, {0x007E, 0xDC}, {0x007F, 0x07},
+    {0x0080, 0x20}, {0x0081, 0x21}, {0x0082, 0x22}, {0x0083, 0x23}, {0x0084, 0x24}, {0x0085, 0x15}, {0x0086, 0x06}, {0x0087, 0x17},
+    {0x0088, 0x28}, {0x0089, 0x29}, {0x008A, 0x2A}, {0x008B, 0x2B}, {0x008C, 0x2C}, {0x008D, 0x09}, {0x008E, 0x0A}, {0x008F, 0x1B},
+    {0x0090, 0x30}, {0x0091, 0x31}, {0x0092, 0x1A}, {0x0093, 0x33}, {0x0094, 0x34}, {0x0095, 0x35}, {0x0096, 0x36}, {0x0097, 0x08},
+    {0x0098, 0x38}, {0x0099, 0x39}, {0x009A, 0x3A}, {0x009B, 0x3B}, {0x009C, 0x04}, {0x009D, 0x14}, {0x009E, 0x3E}, {0x009F, 0xFF},
+    {0x00A0, 0x41}, {0x00A1, 0xAA}, {0x00A2, 0xB0}, {0x00A3, 0xB1}, {0x00A4, 0x5A}, {0x00A5, 0xB2}, {0x00A6, 0xCC}, {0x00A7, 0x4A},
+    {0x00A8, 0xBD}, {0x00A9, 0xB4}, {0x00AA, 0x9A}, {0x00AB, 0x8A}, {0x00AC, 0xBA}, {0x00AD, 0xCA}, {0x00AE, 0xAF}, {0x00AF, 0xBC},
+    {0x00B0, 0x90}, {0x00B1, 0x8F}, {0x00B2, 0xEA}, {0x00B3, 0xFA}, {0x00B4, 0xBE}, {0x00B5, 0xA0}, {0x00B6, 0xB6}, {0x00B7, 0xB3},
+    {0x00B8, 0x9D}, {0x00B9, 0xDA}, {0x00BA, 0x9B}, {0x00BB, 0x8B}, {0x00BC, 0xB7}, {0x00BD, 0xB8}, {0x00BE, 0xB9}, {0x00BF, 0xAB},
+    {0x00C0, 0x64}, {0x00C1, 0x65}, {0x00C2, 0x62}, {0x00C3, 0x66}, {0x00C4, 0x7B}, {0x00C5, 0x5B}, {0x00C6, 0x9E}, {0x00C7, 0x68},
+    {0x00C8, 0x74}, {0x00C9, 0xE0}, {0x00CA, 0x72}, {0x00CB, 0x73}, {0x00CC, 0x78}, {0x00CD, 0x75}, {0x00CE, 0x76}, {0x00CF, 0x77},
+    {0x00D0, 0xAC}, {0x00D1, 0x69}, {0x00D2, 0xED}, {0x00D3, 0xEE}, {0x00D4, 0xEB}, {0x00D5, 0xEF}, {0x00D6, 0x7C}, {0x00D7, 0xBF},
+    {0x00D8, 0x80}, {0x00D9, 0xFD}, {0x00DA, 0xFE}, {0x00DB, 0xFB}, {0x00DD, 0xAD}, {0x00DE, 0xAE}, {0x00DF, 0x59}, {0x00E0, 0x44},
+    {0x00E1, 0x45}, {0x00E2, 0x42}, {0x00E3, 0x46}, {0x00E4, 0xC0}, {0x00E5, 0xD0}, {0x00E6, 0x9C}, {0x00E7, 0x48}, {0x00E8, 0x54},
+    {0x00E9, 0x79}, {0x00EA, 0x52}, {0x00EB, 0x53}, {0x00EC, 0x58}, {0x00ED, 0x55}, {0x00EE, 0x56}, {0x00EF, 0x57}, {0x00F0, 0x8C},
+    {0x00F1, 0x49}, {0x00F2, 0xCD}, {0x00F3, 0xCE}, {0x00F4, 0xCB}, {0x00F5, 0xCF}, {0x00F6, 0x6A}, {0x00F7, 0xE1}, {0x00F8, 0x70},
+    {0x00F9, 0xDD}, {0x00FA, 0xDE}, {0x00FB, 0xDB}, {0x00FC, 0xA1}, {0x00FD, 0x8D}, {0x00FE, 0x8E}, {0x00FF, 0xDF}, {0x20AC, 0x9F},
+};
+
+const uint16_t cp1144_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007, /* 0x20 */
+    0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A, /* 0x30 */
+    0x0020, 0x00A0, 0x00E2, 0x00E4, 0x007B, 0x00E1, 0x00E3, 0x00E5, 0x005C, 0x00F1, 0x00B0, 0x002E, 0x003C, 0x0028, 0x002B, 0x0021, /* 0x40 */
+    0x0026, 0x005D, 0x00EA, 0x00EB, 0x007D, 0x00ED, 0x00EE, 0x00EF, 0x007E, 0x00DF, 0x00E9, 0x0024, 0x002A, 0x0029, 0x003B, 0x005E, /* 0x50 */
+    0x002D, 0x002F, 0x00C2, 0x00C4, 0x00C0, 0x00C1, 0x00C3, 0x00C5, 0x00C7, 0x00D1, 0x00F2, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F, /* 0x60 */
+    0x00F8, 0x00C9, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x00E0, 0x003A, 0x0023, 0x00A7, 0x0027, 0x003D, 0x0022, /* 0x70 */
+    0x00D8, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x00F0, 0x00FD, 0x00FE, 0x00B1, /* 0x80 */
+    0x00E8, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x00C6, 0x20AC, /* 0x90 */
+    0x00B5, 0x00EC, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x00D0, 0x00DD, 0x00DE, 0x00AE, /* 0xA0 */
+    0x00A2, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x0040, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x00AC, 0x007C, 0x00AF, 0x00A8, 0x00B4, 0x00D7, /* 0xB0 */
+    0x00E7, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x00F6, 0x00A6, 0x00F3, 0x00F5, /* 0xC0 */
+    0x00F9, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x00FC, 0x0060, 0x00FA, 0x00FF, /* 0xD0 */
+    0x00F1, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x00D6, 0x00D2, 0x00D3, 0x00D5, /* 0xE0 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x00DC, 0x00D9, 0x00DA, 0x009F, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp1144_from_unicode[255] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x37}, {0x0005, 0x2D}, {0x0006, 0x2E}, {0x0007, 0x2F},
+    {0x0008, 0x16}, {0x0009, 0x05}, {0x000A, 0x25}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x3C}, {0x0015, 0x3D}, {0x0016, 0x32}, {0x0017, 0x26},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x3F}, {0x001B, 0x27}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x40}, {0x0021, 0x4F}, {0x0022, 0x7F}, {0x0023, 0x7B}, {0x0024, 0x5B}, {0x0025, 0x6C}, {0x0026, 0x50}, {0x0027, 0x7D},
+    {0x0028, 0x4D}, {0x0029, 0x5D}, {0x002A, 0x5C}, {0x002B, 0x4E}, {0x002C, 0x6B}, {0x002D, 0x60}, {0x002E, 0x4B}, {0x002F, 0x61},
+    {0x0030, 0xF0}, {0x0031, 0xF1}, {0x0032, 0xF2}, {0x0033, 0xF3}, {0x0034, 0xF4}, {0x0035, 0xF5}, {0x0036, 0xF6}, {0x0037, 0xF7},
+    {0x0038, 0xF8}, {0x0039, 0xF9}, {0x003A, 0x7A}, {0x003B, 0x5E}, {0x003C, 0x4C}, {0x003D, 0x7E}, {0x003E, 0x6E}, {0x003F, 0x6F},
+    {0x0040, 0xB5}, {0x0041, 0xC1}, {0x0042, 0xC2}, {0x0043, 0xC3}, {0x0044, 0xC4}, {0x0045, 0xC5}, {0x0046, 0xC6}, {0x0047, 0xC7},
+    {0x0048, 0xC8}, {0x0049, 0xC9}, {0x004A, 0xD1}, {0x004B, 0xD2}, {0x004C, 0xD3}, {0x004D, 0xD4}, {0x004E, 0xD5}, {0x004F, 0xD6},
+    {0x0050, 0xD7}, {0x0051, 0xD8}, {0x0052, 0xD9}, {0x0053, 0xE2}, {0x0054, 0xE3}, {0x0055, 0xE4}, {0x0056, 0xE5}, {0x0057, 0xE6},
+    {0x0058, 0xE7}, {0x0059, 0xE8}, {0x005A, 0xE9}, {0x005C, 0x48}, {0x005D, 0x51}, {0x005E, 0x5F}, {0x005F, 0x6D}, {0x0060, 0xDD},
+    {0x0061, 0x81}, {0x0062, 0x82}, {0x0063, 0x83}, {0x0064, 0x84}, {0x0065, 0x85}, {0x0066, 0x86}, {0x0067, 0x87}, {0x0068, 0x88},
+    {0x0069, 0x89}, {0x006A, 0x91}, {0x006B, 0x92}, {0x006C, 0x93}, {0x006D, 0x94}, {0x006E, 0x95}, {0x006F, 0x96}, {0x0070, 0x97},
+    {0x0071, 0x98}, {0x0072, 0x99}, {0x0073, 0xA2}, {0x0074, 0xA3}, {0x0075, 0xA4}, {0x0076, 0xA5}, {0x0077, 0xA6}, {0x0078, 0xA7},
+    {0x0079, 0xA8}, {0x007A, 0xA9}, {0x007B, 0x44}, {0x007C, 0xBB}, {0x007D, 0x54}, {0x007E, 0x58}, {0x007F, 0x07}, {0x0080, 0x20},
+    {0x0081, 0x21}, {0x0082, 0x22}, {0x0083, 0x23}, {0x0084, 0x24}, {0x0085, 0x15}, {0x0086, 0x06}, {0x0087, 0x17}, {0x0088, 0x28},
+    {0x0089, 0x29}, {0x008A, 0x2A}, {0x008B, 0x2B}, {0x008C, 0x2C}, {0x008D, 0x09}, {0x008E, 0x0A}, {0x008F, 0x1B}, {0x0090, 0x30},
+    {0x0091, 0x31}, {0x0092, 0x1A}, {0x0093, 0x33}, {0x0094, 0x34}, {0x0095, 0x35}, {0x0096, 0x36}, {0x0097, 0x08}, {0x0098, 0x38},
+    {0x0099, 0x39}, {0x009A, 0x3A}, {0x009B, 0x3B}, {0x009C, 0x04}, {0x009D, 0x14}, {0x009E, 0x3E}, {0x009F, 0xFF}, {0x00A0, 0x41},
+    {0x00A1, 0xAA}, {0x00A2, 0xB0}, {0x00A3, 0xB1}, {0x00A5, 0xB2}, {0x00A6, 0xCD}, {0x00A7, 0x7C}, {0x00A8, 0xBD}, {0x00A9, 0xB4},
+    {0x00AA, 0x9A}, {0x00AB, 0x8A}, {0x00AC, 0xBA}, {0x00AD, 0xCA}, {0x00AE, 0xAF}, {0x00AF, 0xBC}, {0x00B0, 0x4A}, {0x00B1, 0x8F},
+    {0x00B2, 0xEA}, {0x00B3, 0xFA}, {0x00B4, 0xBE}, {0x00B5, 0xA0}, {0x00B6, 0xB6}, {0x00B7, 0xB3}, {0x00B8, 0x9D}, {0x00B9, 0xDA},
+    {0x00BA, 0x9B}, {0x00BB, 0x8B}, {0x00BC, 0xB7}, {0x00BD, 0xB8}, {0x00BE, 0xB9}, {0x00BF, 0xAB}, {0x00C0, 0x64}, {0x00C1, 0x65},
+    {0x00C2, 0x62}, {0x00C3, 0x66}, {0x00C4, 0x63}, {0x00C5, 0x67}, {0x00C6, 0x9E}, {0x00C7, 0x68}, {0x00C8, 0x74}, {0x00C9, 0x71},
+    {0x00CA, 0x72}, {0x00CB, 0x73}, {0x00CC, 0x78}, {0x00CD, 0x75}, {0x00CE, 0x76}, {0x00CF, 0x77}, {0x00D0, 0xAC}, {0x00D1, 0x69},
+    {0x00D2, 0xED}, {0x00D3, 0xEE}, {0x00D4, 0xEB}, {0x00D5, 0xEF}, {0x00D6, 0xEC}, {0x00D7, 0xBF}, {0x00D8, 0x80}, {0x00D9, 0xFD},
+    {0x00DA, 0xFE}, {0x00DB, 0xFB}, {0x00DC, 0xFC}, {0x00DD, 0xAD}, {0x00DE, 0xAE}, {0x00DF, 0x59}, {0x00E0, 0x79}, {0x00E1, 0x45},
+    {0x00E2, 0x42}, {0x00E3, 0x46}, {0x00E4, 0x43}, {0x00E5, 0x47}, {0x00E6, 0x9C}, {0x00E7, 0xC0}, {0x00E8, 0x90}, {0x00E9, 0x5A},
+    {0x00EA, 0x52}, {0x00EB, 0x53}, {0x00EC, 0xA1}, {0x00ED, 0x55}, {0x00EE, 0x56}, {0x00EF, 0x57}, {0x00F0, 0x8C}, {0x00F1, 0xE0},
+    {0x00F2, 0x6A}, {0x00F3, 0xCE}, {0x00F4, 0xCB}, {0x00F5, 0xCF}, {0x00F6, 0xCC}, {0x00F7, 0xE1}, {0x00F8, 0x70}, {0x00F9, 0xD0},
+    {0x00FA, 0xDE}, {0x00FB, 0xDB}, {0x00FC, 0xDC}, {0x00FD, 0x8D}, {0x00FE, 0x8E}, {0x00FF, 0xDF}, {0x20AC, 0x9F},
+};
+
+const uint16_t cp1145_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007, /* 0x20 */
+    0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A, /* 0x30 */
+    0x0020, 0x00A0, 0x00E2, 0x00E4, 0x00E0, 0x00E1, 0x00E3, 0x00E5, 0x00E7, 0x00A6, 0x005B, 0x002E, 0x003C, 0x0028, 0x002B, 0x007C, /* 0x40 */
+    0x0026, 0x00E9, 0x00EA, 0x00EB, 0x00E8, 0x00ED, 0x00EE, 0x00EF, 0x00EC, 0x00DF, 0x005D, 0x0024, 0x002A, 0x0029, 0x003B, 0x00AC, /* 0x50 */
+    0x002D, 0x002F, 0x00C2, 0x00C4, 0x00C0, 0x00C1, 0x00C3, 0x00C5, 0x00C7, 0x0023, 0x00F1, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F, /* 0x60 */
+    0x00F8, 0x00C9, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x0060, 0x003A, 0x00D1, 0x0040, 0x0027, 0x003D, 0x0022, /* 0x70 */
+    0x00D8, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x00F0, 0x00FD, 0x00FE, 0x00B1, /* 0x80 */
+    0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x00C6, 0x20AC, /* 0x90 */
+    0x00B5, 0x00A8, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x00D0, 0x00DD, 0x00DE, 0x00AE, /* 0xA0 */
+    0x00A2, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x00A7, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x005E, 0x0021, 0x00AF, 0x007E, 0x00B4, 0x00D7, /* 0xB0 */
+    0x007B, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x00F6, 0x00F2, 0x00F3, 0x00F5, /* 0xC0 */
+    0x007D, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x00FC, 0x00F9, 0x00FA, 0x00FF, /* 0xD0 */
+    0x005C, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x00D6, 0x00D2, 0x00D3, 0x00D5, /* 0xE0 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x00DC, 0x00D9, 0x00DA, 0x009F, /* 0xF0 */
+};
+
+const struct sb_reverse_entry cp1145_from_unicode[256] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x37}, {0x0005, 0x2D}, {0x0006, 0x2E}, {0x0007, 0x2F},
+    {0x0008, 0x16}, {0x0009, 0x05}, {0x000A, 0x25}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x3C}, {0x0015, 0x3D}, {0x0016, 0x32}, {0x0017, 0x26},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x3F}, {0x001B, 0x27}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x40}, {0x0021, 0xBB}, {0x0022, 0x7F}, {0x0023, 0x69}, {0x0024, 0x5B}, {0x0025, 0x6C}, {0x0026, 0x50}, {0x0027, 0x7D},
+    {0x0028, 0x4D}, {0x0029, 0x5D}, {0x002A, 0x5C}, {0x002B, 0x4E}, {0x002C, 0x6B}, {0x002D, 0x60}, {0x002E, 0x4B}, {0x002F, 0x61},
+    {0x0030, 0xF0}, {0x0031, 0xF1}, {0x0032, 0xF2}, {0x0033, 0xF3}, {0x0034, 0xF4}, {0x0035, 0xF5}, {0x0036, 0xF6}, {0x0037, 0xF7},
+    {0x0038, 0xF8}, {0x0039, 0xF9}, {0x003A, 0x7A}, {0x003B, 0x5E}, {0x003C, 0x4C}, {0x003D, 0x7E}, {0x003E, 0x6E}, {0x003F, 0x6F},
+    {0x0040, 0x7C}, {0x0041, 0xC1}, {0x0042, 0xC2}, {0x0043, 0xC3}, {0x0044, 0xC4}, {0x0045, 0xC5}, {0x0046, 0xC6}, {0x0047, 0xC7},
+    {0x0048, 0xC8}, {0x0049, 0xC9}, {0x004A, 0xD1}, {0x004B, 0xD2}, {0x004C, 0xD3}, {0x004D, 0xD4}, {0x004E, 0xD5}, {0x004F, 0xD6},
+    {0x0050, 0xD7}, {0x0051, 0xD8}, {0x0052, 0xD9}, {0x0053, 0xE2}, {0x0054, 0xE3}, {0x0055, 0xE4}, {0x0056, 0xE5}, {0x0057, 0xE6},
+    {0x0058, 0xE7}, {0x0059, 0xE8}, {0x005A, 0xE9}, {0x005B, 0x4A}, {0x005C, 0xE0}, {0x005D, 0x5A}, {0x005E, 0xBA}, {0x005F, 0x6D},
+    {0x0060, 0x79}, {0x0061, 0x81}, {0x0062, 0x82}, {0x0063, 0x83}, {0x0064, 0x84}, {0x0065, 0x85}, {0x0066, 0x86}, {0x0067, 0x87},
+    {0x0068, 0x88}, {0x0069, 0x89}, {0x006A, 0x91}, {0x006B, 0x92}, {0x006C, 0x93}, {0x006D, 0x94}, {0x006E, 0x95}, {0x006F, 0x96},
+    {0x0070, 0x97}, {0x0071, 0x98}, {0x0072, 0x99}, {0x0073, 0xA2}, {0x0074, 0xA3}, {0x0075, 0xA4}, {0x0076, 0xA5}, {0x0077, 0xA6},
+    {0x0078, 0xA7}, {0x0079, 0xA8}, {0x007A, 0xA9}, {0x007B, 0xC0}, {0x007C, 0x4F}, {0x007D, 0xD0}, {0x007E, 0xBD}, {0x007F, 0x07},
+    {0x0080, 0x20}, {0x0081, 0x21}, {0x0082, 0x22}, {0x0083, 0x23}, {0x0084, 0x24}, {0x0085, 0x15}, {0x0086, 0x06}, {0x0087, 0x17},
+    {0x0088, 0x28}, {0x0089, 0x29}, {0x008A, 0x2A}, {0x008B, 0x2B}, {0x008C, 0x2C}, {0x008D, 0x09}, {0x008E, 0x0A}, {0x008F, 0x1B},
+    {0x0090, 0x30}, {0x0091, 0x31}, {0x0092, 0x1A}, {0x0093, 0x33}, {0x0094, 0x34}, {0x0095, 0x35}, {0x0096, 0x36}, {0x0097, 0x08},
+    {0x0098, 0x38}, {0x0099, 0x39}, {0x009A, 0x3A}, {0x009B, 0x3B}, {0x009C, 0x04}, {0x009D, 0x14}, {0x009E, 0x3E}, {0x009F, 0xFF},
+    {0x00A0, 0x41}, {0x00A1, 0xAA}, {0x00A2, 0xB0}, {0x00A3, 0xB1}, {0x00A5, 0xB2}, {0x00A6, 0x49}, {0x00A7, 0xB5}, {0x00A8, 0xA1},
+    {0x00A9, 0xB4}, {0x00AA, 0x9A}, {0x00AB, 0x8A}, {0x00AC, 0x5F}, {0x00AD, 0xCA}, {0x00AE, 0xAF}, {0x00AF, 0xBC}, {0x00B0, 0x90},
+    {0x00B1, 0x8F}, {0x00B2, 0xEA}, {0x00B3, 0xFA}, {0x00B4, 0xBE}, {0x00B5, 0xA0}, {0x00B6, 0xB6}, {0x00B7, 0xB3}, {0x00B8, 0x9D},
+    {0x00B9, 0xDA}, {0x00BA, 0x9B}, {0x00BB, 0x8B}, {0x00BC, 0xB7}, {0x00BD, 0xB8}, {0x00BE, 0xB9}, {0x00BF, 0xAB}, {0x00C0, 0x64},
+    {0x00C1, 0x65}, {0x00C2, 0x62}, {0x00C3, 0x66}, {0x00C4, 0x63}, {0x00C5, 0x67}, {0x00C6, 0x9E}, {0x00C7, 0x68}, {0x00C8, 0x74},
+    {0x00C9, 0x71}, {0x00CA, 0x72}, {0x00CB, 0x73}, {0x00CC, 0x78}, {0x00CD, 0x75}, {0x00CE, 0x76}, {0x00CF, 0x77}, {0x00D0, 0xAC},
+    {0x00D1, 0x7B}, {0x00D2, 0xED}, {0x00D3, 0xEE}, {0x00D4, 0xEB}, {0x00D5, 0xEF}, {0x00D6, 0xEC}, {0x00D7, 0xBF}, {0x00D8, 0x80},
+    {0x00D9, 0xFD}, {0x00DA, 0xFE}, {0x00DB, 0xFB}, {0x00DC, 0xFC}, {0x00DD, 0xAD}, {0x00DE, 0xAE}, {0x00DF, 0x59}, {0x00E0, 0x44},
+    {0x00E1, 0x45}, {0x00E2, 0x42}, {0x00E3, 0x46}, {0x00E4, 0x43}, {0x00E5, 0x47}, {0x00E6, 0x9C}, {0x00E7, 0x48}, {0x00E8, 0x54},
+    {0x00E9, 0x51}, {0x00EA, 0x52}, {0x00EB, 0x53}, {0x00EC, 0x58}, {0x00ED, 0x55}, {0x00EE, 0x56}, {0x00EF, 0x57}, {0x00F0, 0x8C},
+    {0x00F1, 0x6A}, {0x00F2, 0xCD}, {0x00F3, 0xCE}, {0x00F4, 0xCB}, {0x00F5, 0xCF}, {0x00F6, 0xCC}, {0x00F7, 0xE1}, {0x00F8, 0x70},
+    {0x00F9, 0xDD}, {0x00FA, 0xDE}, {0x00FB, 0xDB}, {0x00FC, 0xDC}, {0x00FD, 0x8D}, {0x00FE, 0x8E}, {0x00FF, 0xDF}, {0x20AC, 0x9F},
+};
+
+const uint16_t hp_roman8_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x80 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x90 */
+    0x00A0, 0x00C0, 0x00C2, 0x00C8, 0x00CA, 0x00CB, 0x00CE, 0x00CF, 0x00B4, 0x02CB, 0x02C6, 0x00A8, 0x02DC, 0x00D9, 0x00DB, 0x20A4, /* 0xA0 */
+    0x00AF, 0x00DD, 0x00FD, 0x00B0, 0x00C7, 0x00E7, 0x00D1, 0x00F1, 0x00A1, 0x00BF, 0x00A4, 0x00A3, 0x00A5, 0x00A7, 0x0192, 0x00A2, /* 0xB0 */
+    0x00E2, 0x00EA, 0x00F4, 0x00FB, 0x00E1, 0x00E9, 0x00F3, 0x00FA, 0x00E0, 0x00E8, 0x00F2, 0x00F9, 0x00E4, 0x00EB, 0x00F6, 0x00FC, /* 0xC0 */
+    0x00C5, 0x00EE, 0x00D8, 0x00C6, 0x00E5, 0x00ED, 0x00F8, 0x00E6, 0x00C4, 0x00EC, 0x00D6, 0x00DC, 0x00C9, 0x00EF, 0x00DF, 0x00D4, /* 0xD0 */
+    0x00C1, 0x00C3, 0x00E3, 0x00D0, 0x00F0, 0x00CD, 0x00CC, 0x00D3, 0x00D2, 0x00D5, 0x00F5, 0x0160, 0x0161, 0x00DA, 0x0178, 0x00FF, /* 0xE0 */
+    0x00DE, 0x00FE, 0x00B7, 0x00B5, 0x00B6, 0x00BE, 0x2014, 0x00BC, 0x00BD, 0x00AA, 0x00BA, 0x00AB, 0x25A0, 0x00BB, 0x00B1, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry hp_roman8_from_unicode[223] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xA0}, {0x00A1, 0xB8}, {0x00A2, 0xBF}, {0x00A3, 0xBB}, {0x00A4, 0xBA}, {0x00A5, 0xBC}, {0x00A7, 0xBD}, {0x00A8, 0xAB},
+    {0x00AA, 0xF9}, {0x00AB, 0xFB}, {0x00AF, 0xB0}, {0x00B0, 0xB3}, {0x00B1, 0xFE}, {0x00B4, 0xA8}, {0x00B5, 0xF3}, {0x00B6, 0xF4},
+    {0x00B7, 0xF2}, {0x00BA, 0xFA}, {0x00BB, 0xFD}, {0x00BC, 0xF7}, {0x00BD, 0xF8}, {0x00BE, 0xF5}, {0x00BF, 0xB9}, {0x00C0, 0xA1},
+    {0x00C1, 0xE0}, {0x00C2, 0xA2}, {0x00C3, 0xE1}, {0x00C4, 0xD8}, {0x00C5, 0xD0}, {0x00C6, 0xD3}, {0x00C7, 0xB4}, {0x00C8, 0xA3},
+    {0x00C9, 0xDC}, {0x00CA, 0xA4}, {0x00CB, 0xA5}, {0x00CC, 0xE6}, {0x00CD, 0xE5}, {0x00CE, 0xA6}, {0x00CF, 0xA7}, {0x00D0, 0xE3},
+    {0x00D1, 0xB6}, {0x00D2, 0xE8}, {0x00D3, 0xE7}, {0x00D4, 0xDF}, {0x00D5, 0xE9}, {0x00D6, 0xDA}, {0x00D8, 0xD2}, {0x00D9, 0xAD},
+    {0x00DA, 0xED}, {0x00DB, 0xAE}, {0x00DC, 0xDB}, {0x00DD, 0xB1}, {0x00DE, 0xF0}, {0x00DF, 0xDE}, {0x00E0, 0xC8}, {0x00E1, 0xC4},
+    {0x00E2, 0xC0}, {0x00E3, 0xE2}, {0x00E4, 0xCC}, {0x00E5, 0xD4}, {0x00E6, 0xD7}, {0x00E7, 0xB5}, {0x00E8, 0xC9}, {0x00E9, 0xC5},
+    {0x00EA, 0xC1}, {0x00EB, 0xCD}, {0x00EC, 0xD9}, {0x00ED, 0xD5}, {0x00EE, 0xD1}, {0x00EF, 0xDD}, {0x00F0, 0xE4}, {0x00F1, 0xB7},
+    {0x00F2, 0xCA}, {0x00F3, 0xC6}, {0x00F4, 0xC2}, {0x00F5, 0xEA}, {0x00F6, 0xCE}, {0x00F8, 0xD6}, {0x00F9, 0xCB}, {0x00FA, 0xC7},
+    {0x00FB, 0xC3}, {0x00FC, 0xCF}, {0x00FD, 0xB2}, {0x00FE, 0xF1}, {0x00FF, 0xEF}, {0x0160, 0xEB}, {0x0161, 0xEC}, {0x0178, 0xEE},
+    {0x0192, 0xBE}, {0x02C6, 0xAA}, {0x02CB, 0xA9}, {0x02DC, 0xAC}, {0x2014, 0xF6}, {0x20A4, 0xAF}, {0x25A0, 0xFC},
+};
+
+const uint16_t dec_mcs_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x80 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x90 */
+    0xFFFD, 0x00A1, 0x00A2, 0x00A3, 0xFFFD, 0x00A5, 0xFFFD, 0x00A7, 0x00A4, 0x00A9, 0x00AA, 0x00AB, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0xFFFD, 0x00B5, 0x00B6, 0x00B7, 0xFFFD, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0xFFFD, 0x00BF, /* 0xB0 */
+    0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, /* 0xC0 */
+    0xFFFD, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x0152, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x0178, 0xFFFD, 0x00DF, /* 0xD0 */
+    0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, /* 0xE0 */
+    0xFFFD, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x0153, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FF, 0xFFFD, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry dec_mcs_from_unicode[209] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A1, 0xA1}, {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A4, 0xA8}, {0x00A5, 0xA5}, {0x00A7, 0xA7}, {0x00A9, 0xA9}, {0x00AA, 0xAA},
+    {0x00AB, 0xAB}, {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B2, 0xB2}, {0x00B3, 0xB3}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7},
+    {0x00B9, 0xB9}, {0x00BA, 0xBA}, {0x00BB, 0xBB}, {0x00BC, 0xBC}, {0x00BD, 0xBD}, {0x00BF, 0xBF}, {0x00C0, 0xC0}, {0x00C1, 0xC1},
+    {0x00C2, 0xC2}, {0x00C3, 0xC3}, {0x00C4, 0xC4}, {0x00C5, 0xC5}, {0x00C6, 0xC6}, {0x00C7, 0xC7}, {0x00C8, 0xC8}, {0x00C9, 0xC9},
+    {0x00CA, 0xCA}, {0x00CB, 0xCB}, {0x00CC, 0xCC}, {0x00CD, 0xCD}, {0x00CE, 0xCE}, {0x00CF, 0xCF}, {0x00D1, 0xD1}, {0x00D2, 0xD2},
+    {0x00D3, 0xD3}, {0x00D4, 0xD4}, {0x00D5, 0xD5}, {0x00D6, 0xD6}, {0x00D8, 0xD8}, {0x00D9, 0xD9}, {0x00DA, 0xDA}, {0x00DB, 0xDB},
+    {0x00DC, 0xDC}, {0x00DF, 0xDF}, {0x00E0, 0xE0}, {0x00E1, 0xE1}, {0x00E2, 0xE2}, {0x00E3, 0xE3}, {0x00E4, 0xE4}, {0x00E5, 0xE5},
+    {0x00E6, 0xE6}, {0x00E7, 0xE7}, {0x00E8, 0xE8}, {0x00E9, 0xE9}, {0x00EA, 0xEA}, {0x00EB, 0xEB}, {0x00EC, 0xEC}, {0x00ED, 0xED},
+    {0x00EE, 0xEE}, {0x00EF, 0xEF}, {0x00F1, 0xF1}, {0x00F2, 0xF2}, {0x00F3, 0xF3}, {0x00F4, 0xF4}, {0x00F5, 0xF5}, {0x00F6, 0xF6},
+    {0x00F8, 0xF8}, {0x00F9, 0xF9}, {0x00FA, 0xFA}, {0x00FB, 0xFB}, {0x00FC, 0xFC}, {0x00FF, 0xFD}, {0x0152, 0xD7}, {0x0153, 0xF7},
+    {0x0178, 0xDD},
+};
+
+const uint16_t jis_x0201_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x00A5, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x203E, 0x007F, /* 0x70 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x80 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x90 */
+    0xFFFD, 0xFF61, 0xFF62, 0xFF63, 0xFF64, 0xFF65, 0xFF66, 0xFF67, 0xFF68, 0xFF69, 0xFF6A, 0xFF6B, 0xFF6C, 0xFF6D, 0xFF6E, 0xFF6F, /* 0xA0 */
+    0xFF70, 0xFF71, 0xFF72, 0xFF73, 0xFF74, 0xFF75, 0xFF76, 0xFF77, 0xFF78, 0xFF79, 0xFF7A, 0xFF7B, 0xFF7C, 0xFF7D, 0xFF7E, 0xFF7F, /* 0xB0 */
+    0xFF80, 0xFF81, 0xFF82, 0xFF83, 0xFF84, 0xFF85, 0xFF86, 0xFF87, 0xFF88, 0xFF89, 0xFF8A, 0xFF8B, 0xFF8C, 0xFF8D, 0xFF8E, 0xFF8F, /* 0xC0 */
+    0xFF90, 0xFF91, 0xFF92, 0xFF93, 0xFF94, 0xFF95, 0xFF96, 0xFF97, 0xFF98, 0xFF99, 0xFF9A, 0xFF9B, 0xFF9C, 0xFF9D, 0xFF9E, 0xFF9F, /* 0xD0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xE0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry jis_x0201_from_unicode[191] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F}, {0x0060, 0x60},
+    {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67}, {0x0068, 0x68},
+    {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F}, {0x0070, 0x70},
+    {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77}, {0x0078, 0x78},
+    {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007F, 0x7F}, {0x00A5, 0x5C}, {0x203E, 0x7E},
+    {0xFF61, 0xA1}, {0xFF62, 0xA2}, {0xFF63, 0xA3}, {0xFF64, 0xA4}, {0xFF65, 0xA5}, {0xFF66, 0xA6}, {0xFF67, 0xA7}, {0xFF68, 0xA8},
+    {0xFF69, 0xA9}, {0xFF6A, 0xAA}, {0xFF6B, 0xAB}, {0xFF6C, 0xAC}, {0xFF6D, 0xAD}, {0xFF6E, 0xAE}, {0xFF6F, 0xAF}, {0xFF70, 0xB0},
+    {0xFF71, 0xB1}, {0xFF72, 0xB2}, {0xFF73, 0xB3}, {0xFF74, 0xB4}, {0xFF75, 0xB5}, {0xFF76, 0xB6}, {0xFF77, 0xB7}, {0xFF78, 0xB8},
+    {0xFF79, 0xB9}, {0xFF7A, 0xBA}, {0xFF7B, 0xBB}, {0xFF7C, 0xBC}, {0xFF7D, 0xBD}, {0xFF7E, 0xBE}, {0xFF7F, 0xBF}, {0xFF80, 0xC0},
+    {0xFF81, 0xC1}, {0xFF82, 0xC2}, {0xFF83, 0xC3}, {0xFF84, 0xC4}, {0xFF85, 0xC5}, {0xFF86, 0xC6}, {0xFF87, 0xC7}, {0xFF88, 0xC8},
+    {0xFF89, 0xC9}, {0xFF8A, 0xCA}, {0xFF8B, 0xCB}, {0xFF8C, 0xCC}, {0xFF8D, 0xCD}, {0xFF8E, 0xCE}, {0xFF8F, 0xCF}, {0xFF90, 0xD0},
+    {0xFF91, 0xD1}, {0xFF92, 0xD2}, {0xFF93, 0xD3}, {0xFF94, 0xD4}, {0xFF95, 0xD5}, {0xFF96, 0xD6}, {0xFF97, 0xD7}, {0xFF98, 0xD8},
+    {0xFF99, 0xD9}, {0xFF9A, 0xDA}, {0xFF9B, 0xDB}, {0xFF9C, 0xDC}, {0xFF9D, 0xDD}, {0xFF9E, 0xDE}, {0xFF9F, 0xDF},
+};
+
+const uint16_t kz_1048_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x04B0, 0x04B1, 0x201A, 0x0493, 0x201E, 0x2026, 0x2020, 0x2021, 0xFFFD, 0x2030, 0x04D8, 0x2039, 0x04E8, 0x04A2, 0x049A, 0x04BA, /* 0x80 */
+    0x04B8, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0xFFFD, 0x2122, 0x04D9, 0x203A, 0x04E9, 0x04A3, 0x049B, 0x04BB, /* 0x90 */
+    0x00A0, 0x04B2, 0x04B3, 0x04AE, 0x00A4, 0x04AF, 0x00A6, 0x00A7, 0x0401, 0x00A9, 0x0492, 0x00AB, 0x00AC, 0x04B9, 0x00AE, 0x04A0, /* 0xA0 */
+    0x00B0, 0x00B1, 0x0406, 0x0456, 0x04A1, 0x00B5, 0x00B6, 0x00B7, 0x0451, 0x2116, 0x0493, 0x00BB, 0x04D8, 0x04E8, 0x04D9, 0x04E9, /* 0xB0 */
+    0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F, /* 0xC0 */
+    0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F, /* 0xD0 */
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, /* 0xE0 */
+    0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F, /* 0xF0 */
+};
+
+const struct sb_reverse_entry kz_1048_from_unicode[249] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x007F, 0x7F},
+    {0x00A0, 0xA0}, {0x00A4, 0xA4}, {0x00A6, 0xA6}, {0x00A7, 0xA7}, {0x00A9, 0xA9}, {0x00AB, 0xAB}, {0x00AC, 0xAC}, {0x00AE, 0xAE},
+    {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7}, {0x00BB, 0xBB}, {0x0401, 0xA8}, {0x0406, 0xB2},
+    {0x0410, 0xC0}, {0x0411, 0xC1}, {0x0412, 0xC2}, {0x0413, 0xC3}, {0x0414, 0xC4}, {0x0415, 0xC5}, {0x0416, 0xC6}, {0x0417, 0xC7},
+    {0x0418, 0xC8}, {0x0419, 0xC9}, {0x041A, 0xCA}, {0x041B, 0xCB}, {0x041C, 0xCC}, {0x041D, 0xCD}, {0x041E, 0xCE}, {0x041F, 0xCF},
+    {0x0420, 0xD0}, {0x0421, 0xD1}, {0x0422, 0xD2}, {0x0423, 0xD3}, {0x0424, 0xD4}, {0x0425, 0xD5}, {0x0426, 0xD6}, {0x0427, 0xD7},
+    {0x0428, 0xD8}, {0x0429, 0xD9}, {0x042A, 0xDA}, {0x042B, 0xDB}, {0x042C, 0xDC}, {0x042D, 0xDD}, {0x042E, 0xDE}, {0x042F, 0xDF},
+    {0x0430, 0xE0}, {0x0431, 0xE1}, {0x0432, 0xE2}, {0x0433, 0xE3}, {0x0434, 0xE4}, {0x0435, 0xE5}, {0x0436, 0xE6}, {0x0437, 0xE7},
+    {0x0438, 0xE8}, {0x0439, 0xE9}, {0x043A, 0xEA}, {0x043B, 0xEB}, {0x043C, 0xEC}, {0x043D, 0xED}, {0x043E, 0xEE}, {0x043F, 0xEF},
+    {0x0440, 0xF0}, {0x0441, 0xF1}, {0x0442, 0xF2}, {0x0443, 0xF3}, {0x0444, 0xF4}, {0x0445, 0xF5}, {0x0446, 0xF6}, {0x0447, 0xF7},
+    {0x0448, 0xF8}, {0x0449, 0xF9}, {0x044A, 0xFA}, {0x044B, 0xFB}, {0x044C, 0xFC}, {0x044D, 0xFD}, {0x044E, 0xFE}, {0x044F, 0xFF},
+    {0x0451, 0xB8}, {0x0456, 0xB3}, {0x0492, 0xAA}, {0x0493, 0xBA}, {0x049A, 0x8E}, {0x049B, 0x9E}, {0x04A0, 0xAF}, {0x04A1, 0xB4},
+    {0x04A2, 0x8D}, {0x04A3, 0x9D}, {0x04AE, 0xA3}, {0x04AF, 0xA5}, {0x04B0, 0x80}, {0x04B1, 0x81}, {0x04B2, 0xA1}, {0x04B3, 0xA2},
+    {0x04B8, 0x90}, {0x04B9, 0xAD}, {0x04BA, 0x8F}, {0x04BB, 0x9F}, {0x04D8, 0xBC}, {0x04D9, 0xBE}, {0x04E8, 0xBD}, {0x04E9, 0xBF},
+    {0x2013, 0x96}, {0x2014, 0x97}, {0x2018, 0x91}, {0x2019, 0x92}, {0x201A, 0x82}, {0x201C, 0x93}, {0x201D, 0x94}, {0x201E, 0x84},
+    {0x2020, 0x86}, {0x2021, 0x87}, {0x2022, 0x95}, {0x2026, 0x85}, {0x2030, 0x89}, {0x2039, 0x8B}, {0x203A, 0x9B}, {0x2116, 0xB9},
+    {0x2122, 0x99},
+};
+
+const uint16_t gsm_03_38_to_unicode[256] = {
+    0x0040, 0x00A3, 0x0024, 0x00A5, 0x00E8, 0x00E9, 0x00F9, 0x00EC, 0x00F2, 0x00C7, 0x000A, 0x00D8, 0x00F8, 0x000D, 0x00C5, 0x00E5, /* 0x00 */
+    0x0394, 0x005F, 0x03A6, 0x0393, 0x039B, 0x03A9, 0x03A0, 0x03A8, 0x03A3, 0x0398, 0x039E, 0x00A0, 0x00C6, 0x00E6, 0x00DF, 0x00C9, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x00A4, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x00A1, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00C4, 0x00D6, 0x00D1, 0x00DC, 0x00A7, /* 0x50 */
+    0x00BF, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00E4, 0x00F6, 0x00F1, 0x00FC, 0x00E0, /* 0x70 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x80 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x90 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xA0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xB0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xC0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xD0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xE0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry gsm_03_38_from_unicode[128] = {
+    {0x000A, 0x0A}, {0x000D, 0x0D}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x02}, {0x0025, 0x25},
+    {0x0026, 0x26}, {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D},
+    {0x002E, 0x2E}, {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35},
+    {0x0036, 0x36}, {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D},
+    {0x003E, 0x3E}, {0x003F, 0x3F}, {0x0040, 0x00}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45},
+    {0x0046, 0x46}, {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D},
+    {0x004E, 0x4E}, {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55},
+    {0x0056, 0x56}, {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005F, 0x11}, {0x0061, 0x61}, {0x0062, 0x62},
+    {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A},
+    {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72},
+    {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A},
+    {0x00A0, 0x1B}, {0x00A1, 0x40}, {0x00A3, 0x01}, {0x00A4, 0x24}, {0x00A5, 0x03}, {0x00A7, 0x5F}, {0x00BF, 0x60}, {0x00C4, 0x5B},
+    {0x00C5, 0x0E}, {0x00C6, 0x1C}, {0x00C7, 0x09}, {0x00C9, 0x1F}, {0x00D1, 0x5D}, {0x00D6, 0x5C}, {0x00D8, 0x0B}, {0x00DC, 0x5E},
+    {0x00DF, 0x1E}, {0x00E0, 0x7F}, {0x00E4, 0x7B}, {0x00E5, 0x0F}, {0x00E6, 0x1D}, {0x00E8, 0x04}, {0x00E9, 0x05}, {0x00EC, 0x07},
+    {0x00F1, 0x7D}, {0x00F2, 0x08}, {0x00F6, 0x7C}, {0x00F8, 0x0C}, {0x00F9, 0x06}, {0x00FC, 0x7E}, {0x0393, 0x13}, {0x0394, 0x10},
+    {0x0398, 0x19}, {0x039B, 0x14}, {0x039E, 0x1A}, {0x03A0, 0x16}, {0x03A3, 0x18}, {0x03A6, 0x12}, {0x03A8, 0x17}, {0x03A9, 0x15},
+};
+
+const uint16_t viscii_to_unicode[256] = {
+    0x0000, 0x0001, 0x1EB2, 0x0003, 0x0004, 0x1EB4, 0x1EAA, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x1EF6, 0x0015, 0x0016, 0x0017, 0x0018, 0x1EF8, 0x001A, 0x001B, 0x001C, 0x001D, 0x1EF4, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, /* 0x70 */
+    0x1EA0, 0x1EAE, 0x1EB0, 0x1EB6, 0x1EA4, 0x1EA6, 0x1EA8, 0x1EAC, 0x1EBC, 0x1EB8, 0x1EBE, 0x1EC0, 0x1EC2, 0x1EC4, 0x1EC6, 0x1ED0, /* 0x80 */
+    0x1ED2, 0x1ED4, 0x1ED6, 0x1ED8, 0x1EE0, 0x1EDE, 0x1EDA, 0x1EDC, 0x1ECA, 0x1ECC, 0x1EE2, 0x1EE4, 0x1EEA, 0x1EEC, 0x1EE6, 0x1EE8, /* 0x90 */
+    0x1EF0, 0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x1EA2, 0x0102, 0x1EEE, 0x00C8, 0x00C9, 0x00CA, 0x1EBA, 0x00CC, 0x00CD, 0x0128, 0x1EC8, /* 0xA0 */
+    0x0110, 0x1EE6, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x1ECE, 0x01A0, 0x1EDA, 0x00D9, 0x00DA, 0x0168, 0x01AF, 0x00DD, 0x1EF2, 0x1EE4, /* 0xB0 */
+    0x1EA1, 0x1EAF, 0x1EB1, 0x1EB7, 0x1EA5, 0x1EA7, 0x1EA9, 0x1EAD, 0x1EBD, 0x1EB9, 0x1EBF, 0x1EC1, 0x1EC3, 0x1EC5, 0x1EC7, 0x1ED1, /* 0xC0 */
+    0x1ED3, 0x1ED5, 0x1ED7, 0x1ED9, 0x1EE1, 0x1EDF, 0x1EDB, 0x1EDD, 0x1ECB, 0x1ECD, 0x1EE3, 0x1EE5, 0x1EEB, 0x1EED, 0x1EE7, 0x1EE9, /* 0xD0 */
+    0x1EF1, 0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x1EA3, 0x0103, 0x1EEF, 0x00E8, 0x00E9, 0x00EA, 0x1EBB, 0x00EC, 0x00ED, 0x0129, 0x1EC9, /* 0xE0 */
+    0x0111, 0x1EE7, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x1ECF, 0x01A1, 0x1EDB, 0x00F9, 0x00FA, 0x0169, 0x01B0, 0x00FD, 0x1EF3, 0x1EF9, /* 0xF0 */
+};
+
+const struct sb_reverse_entry viscii_from_unicode[251] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0007, 0x07}, {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A},
+    {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F}, {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12},
+    {0x0013, 0x13}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17}, {0x0018, 0x18}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C},
+    {0x001D, 0x1D}, {0x001F, 0x1F}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25},
+    {0x0026, 0x26}, {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D},
+    {0x002E, 0x2E}, {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35},
+    {0x0036, 0x36}, {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D},
+    {0x003E, 0x3E}, {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45},
+    {0x0046, 0x46}, {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D},
+    {0x004E, 0x4E}, {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55},
+    {0x0056, 0x56}, {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D},
+    {0x005E, 0x5E}, {0x005F, 0x5F}, {0x0060, 0x60}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65},
+    {0x0066, 0x66}, {0x0067, 0x67}, {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D},
+    {0x006E, 0x6E}, {0x006F, 0x6F}, {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75},
+    {0x0076, 0x76}, {0x0077, 0x77}, {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D},
+    {0x007E, 0x7E}, {0x007F, 0x7F}, {0x00C0, 0xA1}, {0x00C1, 0xA2}, {0x00C2, 0xA3}, {0x00C3, 0xA4}, {0x00C8, 0xA8}, {0x00C9, 0xA9},
+    {0x00CA, 0xAA}, {0x00CC, 0xAC}, {0x00CD, 0xAD}, {0x00D2, 0xB2}, {0x00D3, 0xB3}, {0x00D4, 0xB4}, {0x00D5, 0xB5}, {0x00D9, 0xB9},
+    {0x00DA, 0xBA}, {0x00DD, 0xBD}, {0x00E0, 0xE1}, {0x00E1, 0xE2}, {0x00E2, 0xE3}, {0x00E3, 0xE4}, {0x00E8, 0xE8}, {0x00E9, 0xE9},
+    {0x00EA, 0xEA}, {0x00EC, 0xEC}, {0x00ED, 0xED}, {0x00F2, 0xF2}, {0x00F3, 0xF3}, {0x00F4, 0xF4}, {0x00F5, 0xF5}, {0x00F9, 0xF9},
+    {0x00FA, 0xFA}, {0x00FD, 0xFD}, {0x0102, 0xA6}, {0x0103, 0xE6}, {0x0110, 0xB0}, {0x0111, 0xF0}, {0x0128, 0xAE}, {0x0129, 0xEE},
+    {0x0168, 0xBB}, {0x0169, 0xFB}, {0x01A0, 0xB7}, {0x01A1, 0xF7}, {0x01AF, 0xBC}, {0x01B0, 0xFC}, {0x1EA0, 0x80}, {0x1EA1, 0xC0},
+    {0x1EA2, 0xA5}, {0x1EA3, 0xE5}, {0x1EA4, 0x84}, {0x1EA5, 0xC4}, {0x1EA6, 0x85}, {0x1EA7, 0xC5}, {0x1EA8, 0x86}, {0x1EA9, 0xC6},
+    {0x1EAA, 0x06}, {0x1EAC, 0x87}, {0x1EAD, 0xC7}, {0x1EAE, 0x81}, {0x1EAF, 0xC1}, {0x1EB0, 0x82}, {0x1EB1, 0xC2}, {0x1EB2, 0x02},
+    {0x1EB4, 0x05}, {0x1EB6, 0x83}, {0x1EB7, 0xC3}, {0x1EB8, 0x89}, {0x1EB9, 0xC9}, {0x1EBA, 0xAB}, {0x1EBB, 0xEB}, {0x1EBC, 0x88},
+    {0x1EBD, 0xC8}, {0x1EBE, 0x8A}, {0x1EBF, 0xCA}, {0x1EC0, 0x8B}, {0x1EC1, 0xCB}, {0x1EC2, 0x8C}, {0x1EC3, 0xCC}, {0x1EC4, 0x8D},
+    {0x1EC5, 0xCD}, {0x1EC6, 0x8E}, {0x1EC7, 0xCE}, {0x1EC8, 0xAF}, {0x1EC9, 0xEF}, {0x1ECA, 0x98}, {0x1ECB, 0xD8}, {0x1ECC, 0x99},
+    {0x1ECD, 0xD9}, {0x1ECE, 0xB6}, {0x1ECF, 0xF6}, {0x1ED0, 0x8F}, {0x1ED1, 0xCF}, {0x1ED2, 0x90}, {0x1ED3, 0xD0}, {0x1ED4, 0x91},
+    {0x1ED5, 0xD1}, {0x1ED6, 0x92}, {0x1ED7, 0xD2}, {0x1ED8, 0x93}, {0x1ED9, 0xD3}, {0x1EDA, 0xB8}, {0x1EDB, 0xF8}, {0x1EDC, 0x97},
+    {0x1EDD, 0xD7}, {0x1EDE, 0x95}, {0x1EDF, 0xD5}, {0x1EE0, 0x94}, {0x1EE1, 0xD4}, {0x1EE2, 0x9A}, {0x1EE3, 0xDA}, {0x1EE4, 0xBF},
+    {0x1EE5, 0xDB}, {0x1EE6, 0xB1}, {0x1EE7, 0xF1}, {0x1EE8, 0x9F}, {0x1EE9, 0xDF}, {0x1EEA, 0x9C}, {0x1EEB, 0xDC}, {0x1EEC, 0x9D},
+    {0x1EED, 0xDD}, {0x1EEE, 0xA7}, {0x1EEF, 0xE7}, {0x1EF0, 0xA0}, {0x1EF1, 0xE0}, {0x1EF2, 0xBE}, {0x1EF3, 0xFE}, {0x1EF4, 0x1E},
+    {0x1EF6, 0x14}, {0x1EF8, 0x19}, {0x1EF9, 0xFF},
+};
+
+const uint16_t atascii_to_unicode[256] = {
+    0x2665, 0x251C, 0x2595, 0x2518, 0x2524, 0x2510, 0x2571, 0x2572, 0x25E2, 0x2597, 0x25E3, 0x259D, 0x2598, 0x2594, 0x2581, 0x2596, /* 0x00 */
+    0x2663, 0x250C, 0x2500, 0x253C, 0x2022, 0x2584, 0x2580, 0x252C, 0x2534, 0x258C, 0x2514, 0x001B, 0x2191, 0x2193, 0x2190, 0x2192, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x2666, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x2660, 0x007C, 0x21B0, 0x25C0, 0x25B6, /* 0x70 */
+    0x2665, 0x251C, 0x2595, 0x2518, 0x2524, 0x2510, 0x2571, 0x2572, 0x25E2, 0x2597, 0x25E3, 0x259D, 0x2598, 0x2594, 0x2581, 0x2596, /* 0x80 */
+    0x2663, 0x250C, 0x2500, 0x253C, 0x2022, 0x2584, 0x2580, 0x252C, 0x2534, 0x258C, 0x2514, 0x009B, 0x2191, 0x2193, 0x2190, 0x2192, /* 0x90 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0xA0 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0xB0 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0xC0 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0xD0 */
+    0x2666, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0xE0 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x2660, 0x007C, 0x21B0, 0x25C0, 0x25B6, /* 0xF0 */
+};
+
+const struct sb_reverse_entry atascii_from_unicode[129] = {
+    {0x001B, 0x1B}, {0x0020, 0xA0}, {0x0021, 0xA1}, {0x0022, 0xA2}, {0x0023, 0xA3}, {0x0024, 0xA4}, {0x0025, 0xA5}, {0x0026, 0xA6},
+    {0x0027, 0xA7}, {0x0028, 0xA8}, {0x0029, 0xA9}, {0x002A, 0xAA}, {0x002B, 0xAB}, {0x002C, 0xAC}, {0x002D, 0xAD}, {0x002E, 0xAE},
+    {0x002F, 0xAF}, {0x0030, 0xB0}, {0x0031, 0xB1}, {0x0032, 0xB2}, {0x0033, 0xB3}, {0x0034, 0xB4}, {0x0035, 0xB5}, {0x0036, 0xB6},
+    {0x0037, 0xB7}, {0x0038, 0xB8}, {0x0039, 0xB9}, {0x003A, 0xBA}, {0x003B, 0xBB}, {0x003C, 0xBC}, {0x003D, 0xBD}, {0x003E, 0xBE},
+    {0x003F, 0xBF}, {0x0040, 0xC0}, {0x0041, 0xC1}, {0x0042, 0xC2}, {0x0043, 0xC3}, {0x0044, 0xC4}, {0x0045, 0xC5}, {0x0046, 0xC6},
+    {0x0047, 0xC7}, {0x0048, 0xC8}, {0x0049, 0xC9}, {0x004A, 0xCA}, {0x004B, 0xCB}, {0x004C, 0xCC}, {0x004D, 0xCD}, {0x004E, 0xCE},
+    {0x004F, 0xCF}, {0x0050, 0xD0}, {0x0051, 0xD1}, {0x0052, 0xD2}, {0x0053, 0xD3}, {0x0054, 0xD4}, {0x0055, 0xD5}, {0x0056, 0xD6},
+    {0x0057, 0xD7}, {0x0058, 0xD8}, {0x0059, 0xD9}, {0x005A, 0xDA}, {0x005B, 0xDB}, {0x005C, 0xDC}, {0x005D, 0xDD}, {0x005E, 0xDE},
+    {0x005F, 0xDF}, {0x0061, 0xE1}, {0x0062, 0xE2}, {0x0063, 0xE3}, {0x0064, 0xE4}, {0x0065, 0xE5}, {0x0066, 0xE6}, {0x0067, 0xE7},
+    {0x0068, 0xE8}, {0x0069, 0xE9}, {0x006A, 0xEA}, {0x006B, 0xEB}, {0x006C, 0xEC}, {0x006D, 0xED}, {0x006E, 0xEE}, {0x006F, 0xEF},
+    {0x0070, 0xF0}, {0x0071, 0xF1}, {0x0072, 0xF2}, {0x0073, 0xF3}, {0x0074, 0xF4}, {0x0075, 0xF5}, {0x0076, 0xF6}, {0x0077, 0xF7},
+    {0x0078, 0xF8}, {0x0079, 0xF9}, {0x007A, 0xFA}, {0x007C, 0xFC}, {0x009B, 0x9B}, {0x2022, 0x94}, {0x2190, 0x9E}, {0x2191, 0x9C},
+    {0x2192, 0x9F}, {0x2193, 0x9D}, {0x21B0, 0xFD}, {0x2500, 0x92}, {0x250C, 0x91}, {0x2510, 0x85}, {0x2514, 0x9A}, {0x2518, 0x83},
+    {0x251C, 0x81}, {0x2524, 0x84}, {0x252C, 0x97}, {0x2534, 0x98}, {0x253C, 0x93}, {0x2571, 0x86}, {0x2572, 0x87}, {0x2580, 0x96},
+    {0x2581, 0x8E}, {0x2584, 0x95}, {0x258C, 0x99}, {0x2594, 0x8D}, {0x2595, 0x82}, {0x2596, 0x8F}, {0x2597, 0x89}, {0x2598, 0x8C},
+    {0x259D, 0x8B}, {0x25B6, 0xFF}, {0x25C0, 0xFE}, {0x25E2, 0x88}, {0x25E3, 0x8A}, {0x2660, 0xFB}, {0x2663, 0x90}, {0x2665, 0x80},
+    {0x2666, 0xE0},
+};
+
+const uint16_t petscii_to_unicode[256] = {
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x000D, 0xFFFD, 0xFFFD, /* 0x00 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x00A3, 0x005D, 0x2191, 0x2190, /* 0x50 */
+    0x2500, 0x2660, 0x2502, 0x2500, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x256E, 0x2570, 0x256F, 0xFFFD, 0x256D, 0x253C, 0xFFFD, /* 0x60 */
+    0xFFFD, 0x2022, 0xFFFD, 0x2665, 0xFFFD, 0x256D, 0x2573, 0x25CB, 0x2663, 0xFFFD, 0x2666, 0x253C, 0xFFFD, 0x2502, 0x03C0, 0x25E5, /* 0x70 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x000D, 0xFFFD, 0xFFFD, /* 0x80 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x90 */
+    0x00A0, 0x258C, 0x2584, 0x2594, 0x2581, 0x258F, 0x2592, 0x2595, 0xFFFD, 0x25E4, 0xFFFD, 0x251C, 0x2597, 0x2514, 0x2510, 0x2582, /* 0xA0 */
+    0x250C, 0x2534, 0x252C, 0x2524, 0x258E, 0x258D, 0xFFFD, 0xFFFD, 0xFFFD, 0x2583, 0xFFFD, 0x2596, 0x259D, 0x2518, 0x2598, 0x259A, /* 0xB0 */
+    0x2500, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0xC0 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x253C, 0xFFFD, 0x2502, 0x2592, 0xFFFD, /* 0xD0 */
+    0x00A0, 0x258C, 0x2584, 0x2594, 0x2581, 0x258F, 0x2592, 0x2595, 0xFFFD, 0x25E4, 0xFFFD, 0x251C, 0x2597, 0x2514, 0x2510, 0x2582, /* 0xE0 */
+    0x250C, 0x2534, 0x252C, 0x2524, 0x258E, 0x258D, 0xFFFD, 0xFFFD, 0xFFFD, 0x2583, 0xFFFD, 0x2596, 0x259D, 0x2518, 0x2598, 0x03C0, /* 0xF0 */
+};
+
+const struct sb_reverse_entry petscii_from_unicode[133] = {
+    {0x000D, 0x8D}, {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26},
+    {0x0027, 0x27}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E},
+    {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36},
+    {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E},
+    {0x003F, 0x3F}, {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46},
+    {0x0047, 0x47}, {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E},
+    {0x004F, 0x4F}, {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56},
+    {0x0057, 0x57}, {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005D, 0x5D}, {0x0061, 0xC1}, {0x0062, 0xC2},
+    {0x0063, 0xC3}, {0x0064, 0xC4}, {0x0065, 0xC5}, {0x0066, 0xC6}, {0x0067, 0xC7}, {0x0068, 0xC8}, {0x0069, 0xC9}, {0x006A, 0xCA},
+    {0x006B, 0xCB}, {0x006C, 0xCC}, {0x006D, 0xCD}, {0x006E, 0xCE}, {0x006F, 0xCF}, {0x0070, 0xD0}, {0x0071, 0xD1}, {0x0072, 0xD2},
+    {0x0073, 0xD3}, {0x0074, 0xD4}, {0x0075, 0xD5}, {0x0076, 0xD6}, {0x0077, 0xD7}, {0x0078, 0xD8}, {0x0079, 0xD9}, {0x007A, 0xDA},
+    {0x00A0, 0xE0}, {0x00A3, 0x5C}, {0x03C0, 0xFF}, {0x2022, 0x71}, {0x2190, 0x5F}, {0x2191, 0x5E}, {0x2500, 0xC0}, {0x2502, 0xDD},
+    {0x250C, 0xF0}, {0x2510, 0xEE}, {0x2514, 0xED}, {0x2518, 0xFD}, {0x251C, 0xEB}, {0x2524, 0xF3}, {0x252C, 0xF2}, {0x2534, 0xF1},
+    {0x253C, 0xDB}, {0x256D, 0x75}, {0x256E, 0x69}, {0x256F, 0x6B}, {0x2570, 0x6A}, {0x2573, 0x76}, {0x2581, 0xE4}, {0x2582, 0xEF},
+    {0x2583, 0xF9}, {0x2584, 0xE2}, {0x258C, 0xE1}, {0x258D, 0xF5}, {0x258E, 0xF4}, {0x258F, 0xE5}, {0x2592, 0xE6}, {0x2594, 0xE3},
+    {0x2595, 0xE7}, {0x2596, 0xFB}, {0x2597, 0xEC}, {0x2598, 0xFE}, {0x259A, 0xBF}, {0x259D, 0xFC}, {0x25CB, 0x77}, {0x25E4, 0xE9},
+    {0x25E5, 0x7F}, {0x2660, 0x61}, {0x2663, 0x78}, {0x2665, 0x73}, {0x2666, 0x7A},
+};
+
+const uint16_t adobe_standard_to_unicode[256] = {
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x00 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x2019, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, /* 0x50 */
+    0x2018, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0xFFFD, /* 0x70 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x80 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x90 */
+    0xFFFD, 0x00A1, 0x00A2, 0x00A3, 0x2044, 0x00A5, 0x0192, 0x00A7, 0x00A4, 0x0027, 0x201C, 0x00AB, 0x2039, 0x203A, 0xFB01, 0xFB02, /* 0xA0 */
+    0xFFFD, 0x2013, 0x2020, 0x2021, 0x00B7, 0xFFFD, 0x00B6, 0x2022, 0x201A, 0x201E, 0x201D, 0x00BB, 0x2026, 0x2030, 0xFFFD, 0x00BF, /* 0xB0 */
+    0xFFFD, 0x0060, 0x00B4, 0x02C6, 0x02DC, 0x00AF, 0x02D8, 0x02D9, 0x00A8, 0xFFFD, 0x02DA, 0x00B8, 0xFFFD, 0x02DD, 0x02DB, 0x02C7, /* 0xC0 */
+    0x2014, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xD0 */
+    0xFFFD, 0x00C6, 0xFFFD, 0x00AA, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x0141, 0x00D8, 0x0152, 0x00BA, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xE0 */
+    0xFFFD, 0x00E6, 0xFFFD, 0xFFFD, 0xFFFD, 0x0131, 0xFFFD, 0xFFFD, 0x0142, 0x00F8, 0x0153, 0x00DF, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry adobe_standard_from_unicode[149] = {
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0x23}, {0x0024, 0x24}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0xA9},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005C, 0x5C}, {0x005D, 0x5D}, {0x005E, 0x5E}, {0x005F, 0x5F},
+    {0x0060, 0xC1}, {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67},
+    {0x0068, 0x68}, {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F},
+    {0x0070, 0x70}, {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77},
+    {0x0078, 0x78}, {0x0079, 0x79}, {0x007A, 0x7A}, {0x007B, 0x7B}, {0x007C, 0x7C}, {0x007D, 0x7D}, {0x007E, 0x7E}, {0x00A1, 0xA1},
+    {0x00A2, 0xA2}, {0x00A3, 0xA3}, {0x00A4, 0xA8}, {0x00A5, 0xA5}, {0x00A7, 0xA7}, {0x00A8, 0xC8}, {0x00AA, 0xE3}, {0x00AB, 0xAB},
+    {0x00AF, 0xC5}, {0x00B4, 0xC2}, {0x00B6, 0xB6}, {0x00B7, 0xB4}, {0x00B8, 0xCB}, {0x00BA, 0xEB}, {0x00BB, 0xBB}, {0x00BF, 0xBF},
+    {0x00C6, 0xE1}, {0x00D8, 0xE9}, {0x00DF, 0xFB}, {0x00E6, 0xF1}, {0x00F8, 0xF9}, {0x0131, 0xF5}, {0x0141, 0xE8}, {0x0142, 0xF8},
+    {0x0152, 0xEA}, {0x0153, 0xFA}, {0x0192, 0xA6}, {0x02C6, 0xC3}, {0x02C7, 0xCF}, {0x02D8, 0xC6}, {0x02D9, 0xC7}, {0x02DA, 0xCA},
+    {0x02DB, 0xCE}, {0x02DC, 0xC4}, {0x02DD, 0xCD}, {0x2013, 0xB1}, {0x2014, 0xD0}, {0x2018, 0x60}, {0x2019, 0x27}, {0x201A, 0xB8},
+    {0x201C, 0xAA}, {0x201D, 0xBA}, {0x201E, 0xB9}, {0x2020, 0xB2}, {0x2021, 0xB3}, {0x2022, 0xB7}, {0x2026, 0xBC}, {0x2030, 0xBD},
+    {0x2039, 0xAC}, {0x203A, 0xAD}, {0x2044, 0xA4}, {0xFB01, 0xAE}, {0xFB02, 0xAF},
+};
+
+const uint16_t adobe_symbol_to_unicode[256] = {
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x00 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x10 */
+    0x0020, 0x0021, 0x2200, 0x0023, 0x2203, 0x0025, 0x0026, 0x220B, 0x0028, 0x0029, 0x2217, 0x002B, 0x002C, 0x2212, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x2245, 0x0391, 0x0392, 0x03A7, 0x0394, 0x0395, 0x03A6, 0x0393, 0x0397, 0x0399, 0x03D1, 0x039A, 0x039B, 0x039C, 0x039D, 0x039F, /* 0x40 */
+    0x03A0, 0x0398, 0x03A1, 0x03A3, 0x03A4, 0x03A5, 0x03C2, 0x03A9, 0x039E, 0x03A8, 0x0396, 0x005B, 0x2234, 0x005D, 0x22A5, 0x005F, /* 0x50 */
+    0xF8E5, 0x03B1, 0x03B2, 0x03C7, 0x03B4, 0x03B5, 0x03C6, 0x03B3, 0x03B7, 0x03B9, 0x03D5, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BF, /* 0x60 */
+    0x03C0, 0x03B8, 0x03C1, 0x03C3, 0x03C4, 0x03C5, 0x03D6, 0x03C9, 0x03BE, 0x03C8, 0x03B6, 0x007B, 0x007C, 0x007D, 0x223C, 0xFFFD, /* 0x70 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x80 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x90 */
+    0x20AC, 0x03D2, 0x2032, 0x2264, 0x2044, 0x221E, 0x0192, 0x2663, 0x2666, 0x2665, 0x2660, 0x2194, 0x2190, 0x2191, 0x2192, 0x2193, /* 0xA0 */
+    0x00B0, 0x00B1, 0x2033, 0x2265, 0x00D7, 0x221D, 0x2202, 0x2022, 0x00F7, 0x2260, 0x2261, 0x2248, 0x2026, 0xF8E6, 0xF8E7, 0x21B5, /* 0xB0 */
+    0x2135, 0x2111, 0x211C, 0x2118, 0x2297, 0x2295, 0x2205, 0x2229, 0x222A, 0x2283, 0x2287, 0x2284, 0x2282, 0x2286, 0x2208, 0x2209, /* 0xC0 */
+    0x2220, 0x2207, 0xF6DA, 0xF6D9, 0xF6DB, 0x220F, 0x221A, 0x22C5, 0x00AC, 0x2227, 0x2228, 0x21D4, 0x21D0, 0x21D1, 0x21D2, 0x21D3, /* 0xD0 */
+    0x25CA, 0x2329, 0xF8E8, 0xF8E9, 0xF8EA, 0x2211, 0x239B, 0x239C, 0x239D, 0x23A1, 0x23A2, 0x23A3, 0x23A7, 0x23A8, 0x23A9, 0x23AA, /* 0xE0 */
+    0xFFFD, 0x232A, 0x222B, 0x2320, 0x23AE, 0x2321, 0x239E, 0x239F, 0x23A0, 0x23A4, 0x23A5, 0x23A6, 0x23AB, 0x23AC, 0x23AD, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry adobe_symbol_from_unicode[189] = {
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0023, 0x23}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0028, 0x28}, {0x0029, 0x29}, {0x002B, 0x2B},
+    {0x002C, 0x2C}, {0x002E, 0x2E}, {0x002F, 0x2F}, {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34},
+    {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37}, {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C},
+    {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F}, {0x005B, 0x5B}, {0x005D, 0x5D}, {0x005F, 0x5F}, {0x007B, 0x7B}, {0x007C, 0x7C},
+    {0x007D, 0x7D}, {0x00AC, 0xD8}, {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00D7, 0xB4}, {0x00F7, 0xB8}, {0x0192, 0xA6}, {0x0391, 0x41},
+    {0x0392, 0x42}, {0x0393, 0x47}, {0x0394, 0x44}, {0x0395, 0x45}, {0x0396, 0x5A}, {0x0397, 0x48}, {0x0398, 0x51}, {0x0399, 0x49},
+    {0x039A, 0x4B}, {0x039B, 0x4C}, {0x039C, 0x4D}, {0x039D, 0x4E}, {0x039E, 0x58}, {0x039F, 0x4F}, {0x03A0, 0x50}, {0x03A1, 0x52},
+    {0x03A3, 0x53}, {0x03A4, 0x54}, {0x03A5, 0x55}, {0x03A6, 0x46}, {0x03A7, 0x43}, {0x03A8, 0x59}, {0x03A9, 0x57}, {0x03B1, 0x61},
+    {0x03B2, 0x62}, {0x03B3, 0x67}, {0x03B4, 0x64}, {0x03B5, 0x65}, {0x03B6, 0x7A}, {0x03B7, 0x68}, {0x03B8, 0x71}, {0x03B9, 0x69},
+    {0x03BA, 0x6B}, {0x03BB, 0x6C}, {0x03BC, 0x6D}, {0x03BD, 0x6E}, {0x03BE, 0x78}, {0x03BF, 0x6F}, {0x03C0, 0x70}, {0x03C1, 0x72},
+    {0x03C2, 0x56}, {0x03C3, 0x73}, {0x03C4, 0x74}, {0x03C5, 0x75}, {0x03C6, 0x66}, {0x03C7, 0x63}, {0x03C8, 0x79}, {0x03C9, 0x77},
+    {0x03D1, 0x4A}, {0x03D2, 0xA1}, {0x03D5, 0x6A}, {0x03D6, 0x76}, {0x2022, 0xB7}, {0x2026, 0xBC}, {0x2032, 0xA2}, {0x2033, 0xB2},
+    {0x2044, 0xA4}, {0x20AC, 0xA0}, {0x2111, 0xC1}, {0x2118, 0xC3}, {0x211C, 0xC2}, {0x2135, 0xC0}, {0x2190, 0xAC}, {0x2191, 0xAD},
+    {0x2192, 0xAE}, {0x2193, 0xAF}, {0x2194, 0xAB}, {0x21B5, 0xBF}, {0x21D0, 0xDC}, {0x21D1, 0xDD}, {0x21D2, 0xDE}, {0x21D3, 0xDF},
+    {0x21D4, 0xDB}, {0x2200, 0x22}, {0x2202, 0xB6}, {0x2203, 0x24}, {0x2205, 0xC6}, {0x2207, 0xD1}, {0x2208, 0xCE}, {0x2209, 0xCF},
+    {0x220B, 0x27}, {0x220F, 0xD5}, {0x2211, 0xE5}, {0x2212, 0x2D}, {0x2217, 0x2A}, {0x221A, 0xD6}, {0x221D, 0xB5}, {0x221E, 0xA5},
+    {0x2220, 0xD0}, {0x2227, 0xD9}, {0x2228, 0xDA}, {0x2229, 0xC7}, {0x222A, 0xC8}, {0x222B, 0xF2}, {0x2234, 0x5C}, {0x223C, 0x7E},
+    {0x2245, 0x40}, {0x2248, 0xBB}, {0x2260, 0xB9}, {0x2261, 0xBA}, {0x2264, 0xA3}, {0x2265, 0xB3}, {0x2282, 0xCC}, {0x2283, 0xC9},
+    {0x2284, 0xCB}, {0x2286, 0xCD}, {0x2287, 0xCA}, {0x2295, 0xC5}, {0x2297, 0xC4}, {0x22A5, 0x5E}, {0x22C5, 0xD7}, {0x2320, 0xF3},
+    {0x2321, 0xF5}, {0x2329, 0xE1}, {0x232A, 0xF1}, {0x239B, 0xE6}, {0x239C, 0xE7}, {0x239D, 0xE8}, {0x239E, 0xF6}, {0x239F, 0xF7},
+    {0x23A0, 0xF8}, {0x23A1, 0xE9}, {0x23A2, 0xEA}, {0x23A3, 0xEB}, {0x23A4, 0xF9}, {0x23A5, 0xFA}, {0x23A6, 0xFB}, {0x23A7, 0xEC},
+    {0x23A8, 0xED}, {0x23A9, 0xEE}, {0x23AA, 0xEF}, {0x23AB, 0xFC}, {0x23AC, 0xFD}, {0x23AD, 0xFE}, {0x23AE, 0xF4}, {0x25CA, 0xE0},
+    {0x2660, 0xAA}, {0x2663, 0xA7}, {0x2665, 0xA9}, {0x2666, 0xA8}, {0xF6D9, 0xD3}, {0xF6DA, 0xD2}, {0xF6DB, 0xD4}, {0xF8E5, 0x60},
+    {0xF8E6, 0xBD}, {0xF8E7, 0xBE}, {0xF8E8, 0xE2}, {0xF8E9, 0xE3}, {0xF8EA, 0xE4},
+};
+
+const uint16_t t61_to_unicode[256] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, /* 0x00 */
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, /* 0x10 */
+    0x0020, 0x0021, 0x0022, 0xFFFD, 0xFFFD, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, /* 0x20 */
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, /* 0x30 */
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, /* 0x40 */
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0xFFFD, 0x005D, 0xFFFD, 0x005F, /* 0x50 */
+    0xFFFD, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, /* 0x60 */
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0xFFFD, 0x007C, 0xFFFD, 0xFFFD, 0x007F, /* 0x70 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x80 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0x90 */
+    0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x0024, 0x00A5, 0x0023, 0x00A7, 0x00A4, 0xFFFD, 0xFFFD, 0x00AB, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xA0 */
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00D7, 0x00B5, 0x00B6, 0x00B7, 0x00F7, 0xFFFD, 0xFFFD, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, /* 0xB0 */
+    0xFFFD, 0x0060, 0x00B4, 0x005E, 0x007E, 0x00AF, 0x02D8, 0x02D9, 0x00A8, 0xFFFD, 0x02DA, 0x00B8, 0xFFFD, 0x02DD, 0x02DB, 0x02C7, /* 0xC0 */
+    0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, /* 0xD0 */
+    0x2126, 0x00C6, 0x00D0, 0x00AA, 0x0126, 0xFFFD, 0x0132, 0x013F, 0x0141, 0x00D8, 0x0152, 0x00BA, 0x00DE, 0x0166, 0x014A, 0x0149, /* 0xE0 */
+    0x0138, 0x00E6, 0x0111, 0x00F0, 0x0127, 0x0131, 0x0133, 0x0140, 0x0142, 0x00F8, 0x0153, 0x00DF, 0x00FE, 0x0167, 0x014B, 0xFFFD, /* 0xF0 */
+};
+
+const struct sb_reverse_entry t61_from_unicode[187] = {
+    {0x0000, 0x00}, {0x0001, 0x01}, {0x0002, 0x02}, {0x0003, 0x03}, {0x0004, 0x04}, {0x0005, 0x05}, {0x0006, 0x06}, {0x0007, 0x07},
+    {0x0008, 0x08}, {0x0009, 0x09}, {0x000A, 0x0A}, {0x000B, 0x0B}, {0x000C, 0x0C}, {0x000D, 0x0D}, {0x000E, 0x0E}, {0x000F, 0x0F},
+    {0x0010, 0x10}, {0x0011, 0x11}, {0x0012, 0x12}, {0x0013, 0x13}, {0x0014, 0x14}, {0x0015, 0x15}, {0x0016, 0x16}, {0x0017, 0x17},
+    {0x0018, 0x18}, {0x0019, 0x19}, {0x001A, 0x1A}, {0x001B, 0x1B}, {0x001C, 0x1C}, {0x001D, 0x1D}, {0x001E, 0x1E}, {0x001F, 0x1F},
+    {0x0020, 0x20}, {0x0021, 0x21}, {0x0022, 0x22}, {0x0023, 0xA6}, {0x0024, 0xA4}, {0x0025, 0x25}, {0x0026, 0x26}, {0x0027, 0x27},
+    {0x0028, 0x28}, {0x0029, 0x29}, {0x002A, 0x2A}, {0x002B, 0x2B}, {0x002C, 0x2C}, {0x002D, 0x2D}, {0x002E, 0x2E}, {0x002F, 0x2F},
+    {0x0030, 0x30}, {0x0031, 0x31}, {0x0032, 0x32}, {0x0033, 0x33}, {0x0034, 0x34}, {0x0035, 0x35}, {0x0036, 0x36}, {0x0037, 0x37},
+    {0x0038, 0x38}, {0x0039, 0x39}, {0x003A, 0x3A}, {0x003B, 0x3B}, {0x003C, 0x3C}, {0x003D, 0x3D}, {0x003E, 0x3E}, {0x003F, 0x3F},
+    {0x0040, 0x40}, {0x0041, 0x41}, {0x0042, 0x42}, {0x0043, 0x43}, {0x0044, 0x44}, {0x0045, 0x45}, {0x0046, 0x46}, {0x0047, 0x47},
+    {0x0048, 0x48}, {0x0049, 0x49}, {0x004A, 0x4A}, {0x004B, 0x4B}, {0x004C, 0x4C}, {0x004D, 0x4D}, {0x004E, 0x4E}, {0x004F, 0x4F},
+    {0x0050, 0x50}, {0x0051, 0x51}, {0x0052, 0x52}, {0x0053, 0x53}, {0x0054, 0x54}, {0x0055, 0x55}, {0x0056, 0x56}, {0x0057, 0x57},
+    {0x0058, 0x58}, {0x0059, 0x59}, {0x005A, 0x5A}, {0x005B, 0x5B}, {0x005D, 0x5D}, {0x005E, 0xC3}, {0x005F, 0x5F}, {0x0060, 0xC1},
+    {0x0061, 0x61}, {0x0062, 0x62}, {0x0063, 0x63}, {0x0064, 0x64}, {0x0065, 0x65}, {0x0066, 0x66}, {0x0067, 0x67}, {0x0068, 0x68},
+    {0x0069, 0x69}, {0x006A, 0x6A}, {0x006B, 0x6B}, {0x006C, 0x6C}, {0x006D, 0x6D}, {0x006E, 0x6E}, {0x006F, 0x6F}, {0x0070, 0x70},
+    {0x0071, 0x71}, {0x0072, 0x72}, {0x0073, 0x73}, {0x0074, 0x74}, {0x0075, 0x75}, {0x0076, 0x76}, {0x0077, 0x77}, {0x0078, 0x78},
+    {0x0079, 0x79}, {0x007A, 0x7A}, {0x007C, 0x7C}, {0x007E, 0xC4}, {0x007F, 0x7F}, {0x00A0, 0xA0}, {0x00A1, 0xA1}, {0x00A2, 0xA2},
+    {0x00A3, 0xA3}, {0x00A4, 0xA8}, {0x00A5, 0xA5}, {0x00A7, 0xA7}, {0x00A8, 0xC8}, {0x00AA, 0xE3}, {0x00AB, 0xAB}, {0x00AF, 0xC5},
+    {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B2, 0xB2}, {0x00B3, 0xB3}, {0x00B4, 0xC2}, {0x00B5, 0xB5}, {0x00B6, 0xB6}, {0x00B7, 0xB7},
+    {0x00B8, 0xCB}, {0x00BA, 0xEB}, {0x00BB, 0xBB}, {0x00BC, 0xBC}, {0x00BD, 0xBD}, {0x00BE, 0xBE}, {0x00BF, 0xBF}, {0x00C6, 0xE1},
+    {0x00D0, 0xE2}, {0x00D7, 0xB4}, {0x00D8, 0xE9}, {0x00DE, 0xEC}, {0x00DF, 0xFB}, {0x00E6, 0xF1}, {0x00F0, 0xF3}, {0x00F7, 0xB8},
+    {0x00F8, 0xF9}, {0x00FE, 0xFC}, {0x0111, 0xF2}, {0x0126, 0xE4}, {0x0127, 0xF4}, {0x0131, 0xF5}, {0x0132, 0xE6}, {0x0133, 0xF6},
+    {0x0138, 0xF0}, {0x013F, 0xE7}, {0x0140, 0xF7}, {0x0141, 0xE8}, {0x0142, 0xF8}, {0x0149, 0xEF}, {0x014A, 0xEE}, {0x014B, 0xFE},
+    {0x0152, 0xEA}, {0x0153, 0xFA}, {0x0166, 0xED}, {0x0167, 0xFD}, {0x02C7, 0xCF}, {0x02D8, 0xC6}, {0x02D9, 0xC7}, {0x02DA, 0xCA},
+    {0x02DB, 0xCE}, {0x02DD, 0xCD}, {0x2126, 0xE0},
+};
+
@@ -0,0 +1,4495 @@
+/* strategy_tables.h - Auto-generated by gen_strategy_tables.py */
+/* Do not edit manually. */
+/* Unicode data version 14.0.0 */
+
+#ifndef STRATEGY_TABLES_H
+#define STRATEGY_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * Lookup: off = X_index[X_page[cp >> 8]][cp & 0xFF] for cp < X_LIMIT;
+ * off != 0 points at a length byte in X_pool followed by the text.
+ */
+
+/* html_named: 253 entries in 10 blocks, pool 1422 bytes */
+#define HTML_NAMED_LIMIT 0x2700
+
+static const uint8_t html_named_page[39] = {
+    1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 6, 7, 8, 0, 9, 10,
+};
+
+static const uint16_t html_named_index[11][256] = {
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 6, 10,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 15, 0, 18, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        21, 26, 32, 37, 43, 50, 54, 61,
+        66, 70, 75, 80, 86, 90, 94, 98,
+        103, 107, 114, 119, 124, 130, 136, 141,
+        148, 154, 159, 164, 170, 177, 184, 191,
+        198, 205, 212, 218, 225, 230, 236, 242,
+        249, 256, 263, 269, 274, 281, 288, 294,
+        299, 303, 310, 317, 324, 330, 337, 342,
+        348, 355, 362, 369, 375, 380, 387, 393,
+        399, 406, 413, 419, 426, 431, 437, 443,
+        450, 457, 464, 470, 475, 482, 489, 495,
+        500, 504, 511, 518, 525, 531, 538, 543,
+        550, 557, 564, 571, 577, 582, 589, 595,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 600, 606, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        612, 619, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        626, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 631, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 636, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 641, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 647, 653, 658, 664, 670, 678, 683,
+        687, 693, 698, 704, 711, 714, 717, 720,
+        728, 731, 0, 735, 741, 745, 753, 757,
+        761, 765, 0, 0, 0, 0, 0, 0,
+        0, 771, 777, 782, 788, 794, 802, 807,
+        811, 817, 822, 828, 835, 838, 841, 844,
+        852, 855, 859, 866, 872, 876, 884, 888,
+        892, 896, 0, 0, 0, 0, 0, 0,
+        0, 902, 911, 0, 0, 0, 917, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 921, 926, 0, 0, 0, 0,
+        0, 931, 0, 0, 938, 943, 947, 951,
+        0, 0, 0, 955, 961, 0, 0, 0,
+        967, 973, 979, 0, 985, 991, 997, 0,
+        1003, 1010, 1017, 0, 0, 0, 1022, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1029, 0, 1036, 1042, 0, 0, 0, 0,
+        0, 1048, 1055, 0, 0, 0, 1062, 0,
+        0, 0, 0, 0, 1068, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1074, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1079, 0, 0, 0, 0, 0, 0,
+        1085, 0, 0, 0, 1092, 0, 0, 0,
+        0, 0, 1097, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1103, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1111, 1116, 1121, 1126, 1131, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1136, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1142, 1147, 1152, 1157, 1162, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1167, 0, 1174, 1179, 0, 1185, 0, 1191,
+        1197, 1202, 0, 1208, 0, 0, 0, 1211,
+        0, 1216, 1220, 0, 0, 0, 0, 1226,
+        0, 0, 1233, 0, 0, 1239, 1244, 0,
+        1250, 0, 0, 0, 0, 0, 0, 1254,
+        1258, 1261, 1265, 1269, 0, 0, 0, 0,
+        0, 0, 0, 0, 1273, 0, 0, 0,
+        0, 0, 0, 0, 1280, 0, 0, 0,
+        0, 0, 0, 0, 0, 1284, 0, 0,
+        1289, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1295, 1298, 0, 0, 1304, 1307, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1310, 1314, 1318, 0, 1323, 1328,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1333, 0, 1339,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1346, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1351, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1356, 1362, 1368, 1375, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1382, 1387, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1392, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1396, 0, 0, 1403, 0, 1409, 1416, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+};
+
+static const char html_named_pool[1422] =
+    "\000"
+    "\004quot"  /* U+0022 */
+    "\003amp"  /* U+0026 */
+    "\004apos"  /* U+0027 */
+    "\002lt"  /* U+003C */
+    "\002gt"  /* U+003E */
+    "\004nbsp"  /* U+00A0 */
+    "\005iexcl"  /* U+00A1 */
+    "\004cent"  /* U+00A2 */
+    "\005pound"  /* U+00A3 */
+    "\006curren"  /* U+00A4 */
+    "\003yen"  /* U+00A5 */
+    "\006brvbar"  /* U+00A6 */
+    "\004sect"  /* U+00A7 */
+    "\003uml"  /* U+00A8 */
+    "\004copy"  /* U+00A9 */
+    "\004ordf"  /* U+00AA */
+    "\005laquo"  /* U+00AB */
+    "\003not"  /* U+00AC */
+    "\003shy"  /* U+00AD */
+    "\003reg"  /* U+00AE */
+    "\004macr"  /* U+00AF */
+    "\003deg"  /* U+00B0 */
+    "\006plusmn"  /* U+00B1 */
+    "\004sup2"  /* U+00B2 */
+    "\004sup3"  /* U+00B3 */
+    "\005acute"  /* U+00B4 */
+    "\005micro"  /* U+00B5 */
+    "\004para"  /* U+00B6 */
+    "\006middot"  /* U+00B7 */
+    "\005cedil"  /* U+00B8 */
+    "\004sup1"  /* U+00B9 */
+    "\004ordm"  /* U+00BA */
+    "\005raquo"  /* U+00BB */
+    "\006frac14"  /* U+00BC */
+    "\006frac12"  /* U+00BD */
+    "\006frac34"  /* U+00BE */
+    "\006iquest"  /* U+00BF */
+    "\006Agrave"  /* U+00C0 */
+    "\006Aacute"  /* U+00C1 */
+    "\005Acirc"  /* U+00C2 */
+    "\006Atilde"  /* U+00C3 */
+    "\004Auml"  /* U+00C4 */
+    "\005Aring"  /* U+00C5 */
+    "\005AElig"  /* U+00C6 */
+    "\006Ccedil"  /* U+00C7 */
+    "\006Egrave"  /* U+00C8 */
+    "\006Eacute"  /* U+00C9 */
+    "\005Ecirc"  /* U+00CA */
+    "\004Euml"  /* U+00CB */
+    "\006Igrave"  /* U+00CC */
+    "\006Iacute"  /* U+00CD */
+    "\005Icirc"  /* U+00CE */
+    "\004Iuml"  /* U+00CF */
+    "\003ETH"  /* U+00D0 */
+    "\006Ntilde"  /* U+00D1 */
+    "\006Ograve"  /* U+00D2 */
+    "\006Oacute"  /* U+00D3 */
+    "\005Ocirc"  /* U+00D4 */
+    "\006Otilde"  /* U+00D5 */
+    "\004Ouml"  /* U+00D6 */
+    "\005times"  /* U+00D7 */
+    "\006Oslash"  /* U+00D8 */
+    "\006Ugrave"  /* U+00D9 */
+    "\006Uacute"  /* U+00DA */
+    "\005Ucirc"  /* U+00DB */
+    "\004Uuml"  /* U+00DC */
+    "\006Yacute"  /* U+00DD */
+    "\005THORN"  /* U+00DE */
+    "\005szlig"  /* U+00DF */
+    "\006agrave"  /* U+00E0 */
+    "\006aacute"  /* U+00E1 */
+    "\005acirc"  /* U+00E2 */
+    "\006atilde"  /* U+00E3 */
+    "\004auml"  /* U+00E4 */
+    "\005aring"  /* U+00E5 */
+    "\005aelig"  /* U+00E6 */
+    "\006ccedil"  /* U+00E7 */
+    "\006egrave"  /* U+00E8 */
+    "\006eacute"  /* U+00E9 */
+    "\005ecirc"  /* U+00EA */
+    "\004euml"  /* U+00EB */
+    "\006igrave"  /* U+00EC */
+    "\006iacute"  /* U+00ED */
+    "\005icirc"  /* U+00EE */
+    "\004iuml"  /* U+00EF */
+    "\003eth"  /* U+00F0 */
+    "\006ntilde"  /* U+00F1 */
+    "\006ograve"  /* U+00F2 */
+    "\006oacute"  /* U+00F3 */
+    "\005ocirc"  /* U+00F4 */
+    "\006otilde"  /* U+00F5 */
+    "\004ouml"  /* U+00F6 */
+    "\006divide"  /* U+00F7 */
+    "\006oslash"  /* U+00F8 */
+    "\006ugrave"  /* U+00F9 */
+    "\006uacute"  /* U+00FA */
+    "\005ucirc"  /* U+00FB */
+    "\004uuml"  /* U+00FC */
+    "\006yacute"  /* U+00FD */
+    "\005thorn"  /* U+00FE */
+    "\004yuml"  /* U+00FF */
+    "\005OElig"  /* U+0152 */
+    "\005oelig"  /* U+0153 */
+    "\006Scaron"  /* U+0160 */
+    "\006scaron"  /* U+0161 */
+    "\004Yuml"  /* U+0178 */
+    "\004fnof"  /* U+0192 */
+    "\004circ"  /* U+02C6 */
+    "\005tilde"  /* U+02DC */
+    "\005Alpha"  /* U+0391 */
+    "\004Beta"  /* U+0392 */
+    "\005Gamma"  /* U+0393 */
+    "\005Delta"  /* U+0394 */
+    "\007Epsilon"  /* U+0395 */
+    "\004Zeta"  /* U+0396 */
+    "\003Eta"  /* U+0397 */
+    "\005Theta"  /* U+0398 */
+    "\004Iota"  /* U+0399 */
+    "\005Kappa"  /* U+039A */
+    "\006Lambda"  /* U+039B */
+    "\002Mu"  /* U+039C */
+    "\002Nu"  /* U+039D */
+    "\002Xi"  /* U+039E */
+    "\007Omicron"  /* U+039F */
+    "\002Pi"  /* U+03A0 */
+    "\003Rho"  /* U+03A1 */
+    "\005Sigma"  /* U+03A3 */
+    "\003Tau"  /* U+03A4 */
+    "\007Upsilon"  /* U+03A5 */
+    "\003Phi"  /* U+03A6 */
+    "\003Chi"  /* U+03A7 */
+    "\003Psi"  /* U+03A8 */
+    "\005Omega"  /* U+03A9 */
+    "\005alpha"  /* U+03B1 */
+    "\004beta"  /* U+03B2 */
+    "\005gamma"  /* U+03B3 */
+    "\005delta"  /* U+03B4 */
+    "\007epsilon"  /* U+03B5 */
+    "\004zeta"  /* U+03B6 */
+    "\003eta"  /* U+03B7 */
+    "\005theta"  /* U+03B8 */
+    "\004iota"  /* U+03B9 */
+    "\005kappa"  /* U+03BA */
+    "\006lambda"  /* U+03BB */
+    "\002mu"  /* U+03BC */
+    "\002nu"  /* U+03BD */
+    "\002xi"  /* U+03BE */
+    "\007omicron"  /* U+03BF */
+    "\002pi"  /* U+03C0 */
+    "\003rho"  /* U+03C1 */
+    "\006sigmaf"  /* U+03C2 */
+    "\005sigma"  /* U+03C3 */
+    "\003tau"  /* U+03C4 */
+    "\007upsilon"  /* U+03C5 */
+    "\003phi"  /* U+03C6 */
+    "\003chi"  /* U+03C7 */
+    "\003psi"  /* U+03C8 */
+    "\005omega"  /* U+03C9 */
+    "\010thetasym"  /* U+03D1 */
+    "\005upsih"  /* U+03D2 */
+    "\003piv"  /* U+03D6 */
+    "\004ensp"  /* U+2002 */
+    "\004emsp"  /* U+2003 */
+    "\006thinsp"  /* U+2009 */
+    "\004zwnj"  /* U+200C */
+    "\003zwj"  /* U+200D */
+    "\003lrm"  /* U+200E */
+    "\003rlm"  /* U+200F */
+    "\005ndash"  /* U+2013 */
+    "\005mdash"  /* U+2014 */
+    "\005lsquo"  /* U+2018 */
+    "\005rsquo"  /* U+2019 */
+    "\005sbquo"  /* U+201A */
+    "\005ldquo"  /* U+201C */
+    "\005rdquo"  /* U+201D */
+    "\005bdquo"  /* U+201E */
+    "\006dagger"  /* U+2020 */
+    "\006Dagger"  /* U+2021 */
+    "\004bull"  /* U+2022 */
+    "\006hellip"  /* U+2026 */
+    "\006permil"  /* U+2030 */
+    "\005prime"  /* U+2032 */
+    "\005Prime"  /* U+2033 */
+    "\006lsaquo"  /* U+2039 */
+    "\006rsaquo"  /* U+203A */
+    "\005oline"  /* U+203E */
+    "\005frasl"  /* U+2044 */
+    "\004euro"  /* U+20AC */
+    "\005image"  /* U+2111 */
+    "\006weierp"  /* U+2118 */
+    "\004real"  /* U+211C */
+    "\005trade"  /* U+2122 */
+    "\007alefsym"  /* U+2135 */
+    "\004larr"  /* U+2190 */
+    "\004uarr"  /* U+2191 */
+    "\004rarr"  /* U+2192 */
+    "\004darr"  /* U+2193 */
+    "\004harr"  /* U+2194 */
+    "\005crarr"  /* U+21B5 */
+    "\004lArr"  /* U+21D0 */
+    "\004uArr"  /* U+21D1 */
+    "\004rArr"  /* U+21D2 */
+    "\004dArr"  /* U+21D3 */
+    "\004hArr"  /* U+21D4 */
+    "\006forall"  /* U+2200 */
+    "\004part"  /* U+2202 */
+    "\005exist"  /* U+2203 */
+    "\005empty"  /* U+2205 */
+    "\005nabla"  /* U+2207 */
+    "\004isin"  /* U+2208 */
+    "\005notin"  /* U+2209 */
+    "\002ni"  /* U+220B */
+    "\004prod"  /* U+220F */
+    "\003sum"  /* U+2211 */
+    "\005minus"  /* U+2212 */
+    "\006lowast"  /* U+2217 */
+    "\005radic"  /* U+221A */
+    "\004prop"  /* U+221D */
+    "\005infin"  /* U+221E */
+    "\003ang"  /* U+2220 */
+    "\003and"  /* U+2227 */
+    "\002or"  /* U+2228 */
+    "\003cap"  /* U+2229 */
+    "\003cup"  /* U+222A */
+    "\003int"  /* U+222B */
+    "\006there4"  /* U+2234 */
+    "\003sim"  /* U+223C */
+    "\004cong"  /* U+2245 */
+    "\005asymp"  /* U+2248 */
+    "\002ne"  /* U+2260 */
+    "\005equiv"  /* U+2261 */
+    "\002le"  /* U+2264 */
+    "\002ge"  /* U+2265 */
+    "\003sub"  /* U+2282 */
+    "\003sup"  /* U+2283 */
+    "\004nsub"  /* U+2284 */
+    "\004sube"  /* U+2286 */
+    "\004supe"  /* U+2287 */
+    "\005oplus"  /* U+2295 */
+    "\006otimes"  /* U+2297 */
+    "\004perp"  /* U+22A5 */
+    "\004sdot"  /* U+22C5 */
+    "\005lceil"  /* U+2308 */
+    "\005rceil"  /* U+2309 */
+    "\006lfloor"  /* U+230A */
+    "\006rfloor"  /* U+230B */
+    "\004lang"  /* U+2329 */
+    "\004rang"  /* U+232A */
+    "\003loz"  /* U+25CA */
+    "\006spades"  /* U+2660 */
+    "\005clubs"  /* U+2663 */
+    "\006hearts"  /* U+2665 */
+    "\005diams"  /* U+2666 */
+    ;
+
+/* translit: 2772 entries in 29 blocks, pool 6224 bytes */
+#define TRANSLIT_LIMIT 0x1FC00
+
+static const uint8_t translit_page[508] = {
+    1, 2, 3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 8,
+    9, 10, 11, 0, 12, 0, 0, 0, 0, 0, 13, 0, 14, 0, 0, 0,
+    15, 0, 16, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 21, 22,
+    0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 24, 25, 26, 27, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29,
+};
+
+static const uint16_t translit_index[30][256] = {
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 3, 5, 7, 0, 11, 0, 0,
+        0, 15, 19, 21, 0, 0, 24, 0,
+        0, 28, 32, 34, 0, 36, 0, 0,
+        0, 38, 40, 42, 45, 49, 53, 57,
+        59, 61, 63, 65, 67, 69, 71, 74,
+        76, 78, 80, 82, 84, 86, 88, 90,
+        92, 94, 96, 98, 100, 102, 104, 106,
+        108, 110, 112, 114, 116, 118, 120, 123,
+        126, 128, 130, 132, 134, 136, 138, 141,
+        143, 145, 147, 149, 151, 153, 155, 157,
+        159, 161, 163, 165, 167, 169, 171, 173,
+        175, 177, 179, 181, 183, 185, 187, 190,
+    },
+    {
+        192, 194, 196, 198, 200, 202, 204, 206,
+        208, 210, 212, 214, 216, 218, 220, 222,
+        224, 226, 228, 230, 232, 234, 236, 238,
+        240, 242, 244, 246, 248, 250, 252, 254,
+        256, 258, 260, 262, 264, 266, 268, 270,
+        272, 274, 276, 278, 280, 282, 284, 286,
+        288, 290, 292, 295, 298, 300, 302, 304,
+        0, 306, 308, 310, 312, 314, 316, 0,
+        0, 318, 320, 322, 324, 326, 328, 330,
+        332, 334, 337, 339, 341, 343, 345, 347,
+        349, 351, 353, 356, 359, 361, 363, 365,
+        367, 369, 371, 373, 375, 377, 379, 381,
+        383, 385, 387, 389, 391, 393, 395, 397,
+        399, 401, 403, 405, 407, 409, 411, 413,
+        415, 417, 419, 421, 423, 425, 427, 429,
+        431, 433, 435, 437, 439, 441, 443, 445,
+        447, 0, 0, 0, 0, 0, 0, 0,
+        0, 449, 0, 0, 0, 0, 0, 0,
+        0, 451, 453, 0, 0, 0, 0, 455,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        457, 459, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 461,
+        463, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 465, 468, 471, 474,
+        477, 480, 483, 486, 489, 492, 494, 496,
+        498, 500, 502, 504, 506, 508, 510, 512,
+        514, 516, 518, 520, 522, 0, 524, 526,
+        528, 530, 532, 535, 538, 540, 542, 544,
+        546, 548, 550, 552, 554, 556, 0, 0,
+        558, 560, 563, 566, 569, 571, 0, 0,
+        573, 575, 577, 579, 581, 584, 587, 589,
+    },
+    {
+        591, 593, 595, 597, 599, 601, 603, 605,
+        607, 609, 611, 613, 615, 617, 619, 621,
+        623, 625, 627, 629, 631, 633, 635, 637,
+        639, 641, 643, 645, 0, 0, 647, 649,
+        0, 0, 0, 0, 0, 0, 651, 653,
+        655, 657, 659, 661, 663, 665, 667, 669,
+        671, 673, 675, 677, 0, 0, 0, 679,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 681, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 683, 0, 0, 0, 0, 0, 0,
+        685, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        687, 0, 689, 691, 0, 0, 0, 693,
+        695, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 697, 699, 701, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 703, 0,
+        0, 0, 0, 0, 0, 0, 705, 0,
+        707, 709, 711, 0, 713, 0, 715, 717,
+        719, 721, 723, 725, 727, 729, 731, 733,
+        735, 738, 740, 742, 744, 746, 748, 750,
+        752, 754, 0, 756, 758, 760, 762, 764,
+        767, 770, 772, 774, 776, 778, 780, 782,
+        784, 786, 788, 790, 792, 794, 796, 798,
+        800, 803, 805, 807, 809, 811, 813, 815,
+        817, 819, 821, 823, 825, 827, 829, 831,
+        834, 837, 839, 841, 843, 845, 847, 0,
+        849, 851, 854, 856, 858, 860, 862, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        864, 866, 868, 0, 870, 873, 0, 0,
+        0, 875, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        877, 879, 882, 885, 887, 890, 893, 895,
+        898, 900, 903, 906, 908, 910, 912, 914,
+        917, 919, 921, 923, 925, 927, 929, 932,
+        934, 936, 938, 940, 942, 944, 946, 948,
+        950, 952, 954, 956, 958, 960, 963, 966,
+        969, 972, 977, 979, 981, 983, 985, 988,
+        991, 993, 995, 997, 999, 1001, 1003, 1006,
+        1008, 1010, 1012, 1014, 1016, 1018, 1020, 1022,
+        1024, 1026, 1028, 1030, 1032, 1034, 1037, 1040,
+        1043, 1046, 1051, 1053, 1055, 1057, 1059, 1062,
+        1065, 1067, 1070, 1073, 1075, 1078, 1081, 1083,
+        1086, 1088, 1091, 1094, 1096, 1098, 1100, 1102,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1105, 1107, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1109, 1112, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1115, 1117, 1119, 1121, 0, 0, 1123, 1125,
+        0, 0, 0, 0, 1127, 1130, 1133, 1135,
+        0, 0, 1137, 1139, 1141, 1143, 1145, 1147,
+        0, 0, 0, 0, 1149, 1151, 1153, 1155,
+        1157, 1159, 1161, 1163, 1165, 1168, 0, 0,
+        1171, 1173, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1175, 1177, 1180, 0,
+        1182, 1184, 0, 1186, 1188, 1190, 1192, 1194,
+        1196, 1198, 1200, 0, 1202, 0, 1204, 1206,
+        1208, 1210, 1212, 1214, 0, 1216, 0, 1218,
+        1220, 1222, 0, 0, 0, 1224, 0, 1226,
+        1228, 1230, 1232, 0, 0, 0, 1234, 1236,
+        1238, 0, 0, 1240, 0, 1242, 1244, 1246,
+        1248, 1250, 1253, 1255, 1257, 1259, 1261, 1263,
+        1265, 1267, 1269, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1272, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1274, 0, 1276, 0,
+        1278, 0, 1280, 0, 1282, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1284, 0, 0, 0, 1286,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1289, 1291, 1293, 1295, 1297, 1299, 1301, 1303,
+        1305, 1307, 1309, 1311, 1313, 1315, 1317, 1319,
+        1321, 1323, 1325, 1327, 1329, 1331, 1333, 1335,
+        1337, 1339, 1341, 1343, 1345, 1347, 1349, 1351,
+        1353, 1355, 1357, 1359, 1361, 1363, 1365, 1367,
+        1369, 1371, 1373, 1375, 1377, 1379, 1381, 1383,
+        1385, 1387, 1389, 1391, 1393, 1395, 1397, 1399,
+        1401, 1403, 1405, 1407, 1409, 1411, 1413, 1415,
+        1417, 1419, 1421, 1423, 1425, 1427, 1429, 1431,
+        1433, 1435, 1437, 1439, 1441, 1443, 1445, 1447,
+        1449, 1451, 1453, 1455, 1457, 1459, 1461, 1463,
+        1465, 1467, 1469, 1471, 1473, 1475, 1477, 1479,
+        1481, 1483, 1485, 1487, 1489, 1491, 1493, 1495,
+        1497, 1499, 1501, 1503, 1505, 1507, 1509, 1511,
+        1513, 1515, 1517, 1519, 1521, 1523, 1525, 1527,
+        1529, 1531, 1533, 1535, 1537, 1539, 1541, 1543,
+        1545, 1547, 1549, 1551, 1553, 1555, 1557, 1559,
+        1561, 1563, 1565, 1567, 1569, 1571, 1573, 1575,
+        1577, 1579, 1581, 1583, 1585, 1587, 1589, 1591,
+        1593, 1595, 0, 1597, 0, 0, 0, 0,
+        1599, 1601, 1603, 1605, 1607, 1609, 1611, 1613,
+        1615, 1617, 1619, 1621, 1623, 1625, 1627, 1629,
+        1631, 1633, 1635, 1637, 1639, 1641, 1643, 1645,
+        1647, 1649, 1651, 1653, 1655, 1657, 1659, 1661,
+        1663, 1665, 1667, 1669, 1671, 1673, 1675, 1677,
+        1679, 1681, 1683, 1685, 1687, 1689, 1691, 1693,
+        1695, 1697, 1699, 1701, 1703, 1705, 1707, 1709,
+        1711, 1713, 1715, 1717, 1719, 1721, 1723, 1725,
+        1727, 1729, 1731, 1733, 1735, 1737, 1739, 1741,
+        1743, 1745, 1747, 1749, 1751, 1753, 1755, 1757,
+        1759, 1761, 1763, 1765, 1767, 1769, 1771, 1773,
+        1775, 1777, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1779, 1781, 1783, 1785, 1787, 1789, 1791, 1793,
+        1795, 1797, 1799, 1801, 1803, 1805, 1807, 1809,
+        1811, 1813, 1815, 1817, 1819, 1821, 0, 0,
+        1823, 1825, 1827, 1829, 1831, 1833, 0, 0,
+        1835, 1837, 1839, 1841, 1843, 1845, 1847, 1849,
+        1851, 1853, 1855, 1857, 1859, 1861, 1863, 1865,
+        1867, 1869, 1871, 1873, 1875, 1877, 1879, 1881,
+        1883, 1885, 1887, 1889, 1891, 1893, 1895, 1897,
+        1899, 1901, 1903, 1905, 1907, 1909, 0, 0,
+        1911, 1913, 1915, 1917, 1919, 1921, 0, 0,
+        1923, 1925, 1927, 1929, 1931, 1933, 1935, 1937,
+        0, 1939, 0, 1941, 0, 1943, 0, 1945,
+        1947, 1949, 1951, 1953, 1955, 1957, 1959, 1961,
+        1963, 1965, 1967, 1969, 1971, 1973, 1975, 1977,
+        1979, 1981, 1983, 1985, 1987, 1989, 1991, 1993,
+        1995, 1997, 1999, 2001, 2003, 2005, 0, 0,
+        2007, 2009, 2011, 2013, 2015, 2017, 2019, 2021,
+        2023, 2025, 2027, 2029, 2031, 2033, 2035, 2037,
+        2039, 2041, 2043, 2045, 2047, 2049, 2051, 2053,
+        2055, 2057, 2059, 2061, 2063, 2065, 2067, 2069,
+        2071, 2073, 2075, 2077, 2079, 2081, 2083, 2085,
+        2087, 2089, 2091, 2093, 2095, 2097, 2099, 2101,
+        2103, 2105, 2107, 2109, 2111, 0, 2113, 2115,
+        2117, 2119, 2121, 2123, 2125, 0, 2127, 0,
+        0, 0, 2129, 2131, 2133, 0, 2135, 2137,
+        2139, 2141, 2143, 2145, 2147, 0, 0, 0,
+        2149, 2151, 2153, 2155, 0, 0, 2157, 2159,
+        2161, 2163, 2165, 2167, 0, 0, 0, 0,
+        2169, 2171, 2173, 2175, 2177, 2179, 2181, 2183,
+        2185, 2187, 2189, 2191, 2193, 0, 0, 2195,
+        0, 0, 2197, 2199, 2201, 0, 2203, 2205,
+        2207, 2209, 2211, 2213, 2215, 0, 0, 0,
+    },
+    {
+        2217, 2219, 2221, 2223, 2225, 2227, 2229, 2231,
+        2233, 2235, 2237, 0, 0, 0, 0, 0,
+        2239, 2241, 2243, 2245, 2247, 2250, 0, 0,
+        2253, 2255, 2257, 2259, 2261, 2263, 2265, 2267,
+        0, 0, 2269, 0, 2271, 2273, 2276, 0,
+        0, 0, 0, 0, 0, 0, 0, 2280,
+        0, 0, 2282, 2284, 2287, 0, 0, 0,
+        0, 2291, 2293, 0, 2295, 0, 0, 0,
+        0, 0, 0, 0, 2298, 0, 0, 2300,
+        2303, 2306, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 2309,
+        0, 0, 0, 0, 0, 0, 0, 2314,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        2316, 2318, 0, 0, 2320, 2322, 2324, 2326,
+        2328, 2330, 2332, 2334, 2336, 2338, 2340, 2342,
+        2344, 2346, 2348, 2350, 2352, 2354, 2356, 2358,
+        2360, 2362, 2364, 2366, 2368, 2370, 2372, 0,
+        2374, 2376, 2378, 2380, 0, 2382, 2384, 2386,
+        2388, 2390, 2392, 2394, 2396, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        2398, 2401, 2405, 2409, 2413, 0, 0, 0,
+        0, 0, 0, 0, 2417, 0, 0, 0,
+        0, 2421, 2425, 0, 0, 2429, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2433, 2437, 2441, 0, 0, 2443, 2447, 0,
+        0, 0, 2451, 2453, 2455, 2457, 2459, 2461,
+        2463, 2465, 2467, 2469, 0, 2471, 2473, 0,
+        0, 2476, 2478, 2480, 2482, 2484, 0, 0,
+        2486, 2489, 2493, 0, 2498, 0, 2500, 0,
+        2502, 0, 2504, 2506, 2508, 2510, 0, 2512,
+        2514, 2516, 0, 2518, 2520, 0, 0, 0,
+        0, 2522, 0, 2524, 2528, 2530, 2532, 2534,
+        0, 0, 0, 0, 0, 2536, 2538, 2540,
+        2542, 2544, 0, 0, 0, 0, 0, 0,
+        2546, 2550, 2554, 2559, 2563, 2567, 2571, 2575,
+        2579, 2583, 2587, 2591, 2595, 2599, 2603, 2607,
+        2610, 2612, 2615, 2619, 2622, 2624, 2627, 2631,
+        2636, 2639, 2641, 2644, 2648, 2650, 2652, 2654,
+        2656, 2658, 2661, 2665, 2668, 2670, 2673, 2677,
+        2682, 2685, 2687, 2690, 2694, 2696, 2698, 2700,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 2702, 0, 0, 0, 0, 0, 0,
+        2706, 0, 2709, 0, 2712, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        2716, 0, 2719, 0, 2722, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 2726, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        2728, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        2730, 0, 0, 0, 2733, 2736, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        2739, 2741, 2743, 2745, 2747, 2749, 2751, 2753,
+        2755, 2757, 2760, 2763, 2766, 2769, 2772, 2775,
+        2778, 2781, 2784, 2787, 2790, 2794, 2798, 2802,
+        2806, 2810, 2814, 2818, 2822, 2826, 2831, 2836,
+        2841, 2846, 2851, 2856, 2861, 2866, 2871, 2876,
+        2881, 2884, 2887, 2890, 2893, 2896, 2899, 2902,
+        2905, 2908, 2912, 2916, 2920, 2924, 2928, 2932,
+        2936, 2940, 2944, 2948, 2952, 2956, 2960, 2964,
+        2968, 2972, 2976, 2980, 2984, 2988, 2992, 2996,
+        3000, 3004, 3008, 3012, 3016, 3020, 3024, 3028,
+        3032, 3036, 3040, 3044, 3048, 3052, 3056, 3058,
+        3060, 3062, 3064, 3066, 3068, 3070, 3072, 3074,
+        3076, 3078, 3080, 3082, 3084, 3086, 3088, 3090,
+        3092, 3094, 3096, 3098, 3100, 3102, 3104, 3106,
+        3108, 3110, 3112, 3114, 3116, 3118, 3120, 3122,
+        3124, 3126, 3128, 3130, 3132, 3134, 3136, 3138,
+        3140, 3142, 3144, 3146, 3148, 3150, 3152, 3154,
+        3156, 3158, 3160, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 3162, 3166, 3169, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 3173, 3175, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3177, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        3179, 3183, 3186, 3189, 3192, 3195, 3198, 3201,
+        3204, 3207, 3210, 3213, 3216, 3219, 3222, 3225,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 3228, 3231, 3234, 3237, 3240, 3243, 3246,
+        3249, 3252, 3255, 3258, 3261, 3264, 3267, 3270,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 3273, 3276, 3280, 3283,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 3287, 3291, 3294, 3297, 3301, 3304, 3307,
+        3310, 3314, 3318, 0, 0, 0, 0, 0,
+        3321, 3324, 3327, 3330, 3333, 3336, 3339, 3342,
+        3345, 3349, 3354, 3357, 3360, 3363, 3366, 3369,
+        3372, 3375, 3379, 3383, 3387, 3391, 3394, 3397,
+        3400, 3403, 3406, 3409, 3412, 3415, 3418, 3421,
+        3425, 3429, 3432, 3436, 3440, 3444, 3447, 0,
+        0, 3451, 3454, 3458, 3462, 3466, 0, 0,
+        3470, 3473, 3476, 3479, 3482, 3485, 3488, 3491,
+        3494, 3497, 3500, 3503, 3506, 3509, 3512, 3515,
+        3518, 3521, 3524, 3529, 3532, 3535, 0, 3538,
+        3542, 3545, 3548, 3551, 3554, 3557, 3560, 3563,
+        3566, 3569, 3572, 3576, 3579, 3582, 3586, 3590,
+        3593, 3598, 3602, 3605, 3608, 3611, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 3614,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 3618, 3620, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 3622, 3624, 3626, 0, 0, 0,
+        3628, 3630, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3633, 3636, 3639, 3642, 3646, 3650, 3653, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 3656, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        3658, 0, 0, 3660, 3662, 3664, 3666, 0,
+        0, 3668, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        3672, 3675, 3678, 3680, 3682, 3684, 3686, 3688,
+        3690, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 3692,
+        3694, 0, 0, 0, 0, 3696, 3698, 3700,
+        3702, 0, 3704, 0, 3706, 3708, 3710, 3712,
+        3714, 3717, 3719, 3721, 3723, 0, 0, 3725,
+        3727, 3729, 3731, 3733, 3735, 3737, 3739, 0,
+        3741, 3743, 3745, 3747, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 3749, 3751, 3753, 3755, 3757, 3759, 3761,
+        3763, 3765, 3767, 3769, 3771, 3773, 3775, 3777,
+        3779, 3781, 3783, 3785, 3787, 3789, 3791, 3793,
+        3795, 3797, 3799, 3801, 3803, 3805, 3807, 3809,
+        3811, 3813, 3815, 3817, 3819, 3821, 3823, 3825,
+        3827, 3829, 3831, 3833, 3835, 3837, 3839, 3841,
+        3843, 3845, 3847, 3849, 3851, 3853, 3855, 3857,
+        3859, 3861, 3863, 3865, 3867, 3869, 3871, 3873,
+        3875, 3877, 3879, 3881, 3883, 3885, 3887, 3889,
+        3891, 3893, 3895, 3897, 3899, 3901, 3903, 3905,
+        3907, 3909, 3911, 3913, 3915, 3917, 3919, 3921,
+        3923, 3925, 3927, 3929, 3931, 3933, 3935, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        3937, 3939, 0, 0, 0, 3943, 3947, 0,
+        0, 3951, 0, 3954, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 3957, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 3960, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 3962, 0, 0, 3964, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3966, 3968, 3970, 3972, 3974, 3976, 3978, 3980,
+        3982, 3984, 3986, 3988, 3990, 3992, 3994, 3996,
+        3998, 4000, 4002, 4004, 4006, 4008, 4010, 4012,
+        4014, 4016, 4018, 4020, 4022, 4024, 4026, 4028,
+        4030, 4032, 4034, 4036, 4038, 4040, 4042, 4044,
+        4046, 4048, 4050, 4052, 4054, 4056, 4058, 4060,
+        4062, 4064, 4066, 4068, 4070, 4072, 4074, 4076,
+        4078, 4080, 4082, 4084, 4086, 4088, 4090, 4092,
+        4094, 4096, 4098, 4100, 4102, 4104, 4106, 4108,
+        4110, 4112, 4114, 4116, 4118, 4120, 4122, 4124,
+        4126, 4128, 4130, 4132, 4134, 0, 4136, 4138,
+        4140, 4142, 4144, 4146, 4148, 4150, 4152, 4154,
+        4156, 4158, 4160, 4162, 4164, 4166, 4168, 4170,
+        4172, 4174, 4176, 4178, 4180, 4182, 4184, 4186,
+        4188, 4190, 4192, 4194, 4196, 4198, 4200, 4202,
+        4204, 4206, 4208, 4210, 4212, 4214, 4216, 4218,
+        4220, 4222, 4224, 4226, 4228, 4230, 4232, 4234,
+        4236, 4238, 4240, 4242, 4244, 4246, 4248, 4250,
+        4252, 4254, 4256, 4258, 4260, 4262, 4264, 4266,
+        4268, 4270, 4272, 4274, 4276, 0, 4278, 4280,
+        0, 0, 4282, 0, 0, 4284, 4286, 0,
+        0, 4288, 4290, 4292, 4294, 0, 4296, 4298,
+        4300, 4302, 4304, 4306, 4308, 4310, 4312, 4314,
+        4316, 4318, 0, 4320, 0, 4322, 4324, 4326,
+        4328, 4330, 4332, 4334, 0, 4336, 4338, 4340,
+        4342, 4344, 4346, 4348, 4350, 4352, 4354, 4356,
+        4358, 4360, 4362, 4364, 4366, 4368, 4370, 4372,
+        4374, 4376, 4378, 4380, 4382, 4384, 4386, 4388,
+        4390, 4392, 4394, 4396, 4398, 4400, 4402, 4404,
+        4406, 4408, 4410, 4412, 4414, 4416, 4418, 4420,
+        4422, 4424, 4426, 4428, 4430, 4432, 4434, 4436,
+        4438, 4440, 4442, 4444, 4446, 4448, 4450, 4452,
+    },
+    {
+        4454, 4456, 4458, 4460, 4462, 4464, 0, 4466,
+        4468, 4470, 4472, 0, 0, 4474, 4476, 4478,
+        4480, 4482, 4484, 4486, 4488, 0, 4490, 4492,
+        4494, 4496, 4498, 4500, 4502, 0, 4504, 4506,
+        4508, 4510, 4512, 4514, 4516, 4518, 4520, 4522,
+        4524, 4526, 4528, 4530, 4532, 4534, 4536, 4538,
+        4540, 4542, 4544, 4546, 4548, 4550, 4552, 4554,
+        4556, 4558, 0, 4560, 4562, 4564, 4566, 0,
+        4568, 4570, 4572, 4574, 4576, 0, 4578, 0,
+        0, 0, 4580, 4582, 4584, 4586, 4588, 4590,
+        4592, 0, 4594, 4596, 4598, 4600, 4602, 4604,
+        4606, 4608, 4610, 4612, 4614, 4616, 4618, 4620,
+        4622, 4624, 4626, 4628, 4630, 4632, 4634, 4636,
+        4638, 4640, 4642, 4644, 4646, 4648, 4650, 4652,
+        4654, 4656, 4658, 4660, 4662, 4664, 4666, 4668,
+        4670, 4672, 4674, 4676, 4678, 4680, 4682, 4684,
+        4686, 4688, 4690, 4692, 4694, 4696, 4698, 4700,
+        4702, 4704, 4706, 4708, 4710, 4712, 4714, 4716,
+        4718, 4720, 4722, 4724, 4726, 4728, 4730, 4732,
+        4734, 4736, 4738, 4740, 4742, 4744, 4746, 4748,
+        4750, 4752, 4754, 4756, 4758, 4760, 4762, 4764,
+        4766, 4768, 4770, 4772, 4774, 4776, 4778, 4780,
+        4782, 4784, 4786, 4788, 4790, 4792, 4794, 4796,
+        4798, 4800, 4802, 4804, 4806, 4808, 4810, 4812,
+        4814, 4816, 4818, 4820, 4822, 4824, 4826, 4828,
+        4830, 4832, 4834, 4836, 4838, 4840, 4842, 4844,
+        4846, 4848, 4850, 4852, 4854, 4856, 4858, 4860,
+        4862, 4864, 4866, 4868, 4870, 4872, 4874, 4876,
+        4878, 4880, 4882, 4884, 4886, 4888, 4890, 4892,
+        4894, 4896, 4898, 4900, 4902, 4904, 4906, 4908,
+        4910, 4912, 4914, 4916, 4918, 4920, 4922, 4924,
+        4926, 4928, 4930, 4932, 4934, 4936, 4938, 4940,
+    },
+    {
+        4942, 4944, 4946, 4948, 4950, 4952, 4954, 4956,
+        4958, 4960, 4962, 4964, 4966, 4968, 4970, 4972,
+        4974, 4976, 4978, 4980, 4982, 4984, 4986, 4988,
+        4990, 4992, 4994, 4996, 4998, 5000, 5002, 5004,
+        5006, 5008, 5010, 5012, 5014, 5016, 5018, 5020,
+        5022, 5024, 5026, 5028, 5030, 5032, 5034, 5036,
+        5038, 5040, 5042, 5044, 5046, 5048, 5050, 5052,
+        5054, 5056, 5058, 5060, 5062, 5064, 5066, 5068,
+        5070, 5072, 5074, 5076, 5078, 5080, 5082, 5084,
+        5086, 5088, 5090, 5092, 5094, 5096, 5098, 5100,
+        5102, 5104, 5106, 5108, 5110, 5112, 5114, 5116,
+        5118, 5120, 5122, 5124, 5126, 5128, 5130, 5132,
+        5134, 5136, 5138, 5140, 5142, 5144, 5146, 5148,
+        5150, 5152, 5154, 5156, 5158, 5160, 5162, 5164,
+        5166, 5168, 5170, 5172, 5174, 5176, 5178, 5180,
+        5182, 5184, 5186, 5188, 5190, 5192, 5194, 5196,
+        5198, 5200, 5202, 5204, 5206, 5208, 5210, 5212,
+        5214, 5216, 5218, 5220, 5222, 5224, 5226, 5228,
+        5230, 5232, 5234, 5236, 5238, 5240, 5242, 5244,
+        5246, 5248, 5250, 5252, 5254, 5256, 5258, 5260,
+        5262, 5264, 5266, 5268, 5270, 5272, 0, 0,
+        5274, 5276, 5278, 5280, 5282, 5284, 5286, 5288,
+        5291, 5293, 5295, 5297, 5299, 5301, 5303, 5305,
+        5307, 5309, 5312, 5314, 5316, 5318, 5320, 5323,
+        5326, 0, 5328, 5330, 5332, 5334, 5336, 5338,
+        5340, 5342, 5345, 5347, 5349, 5351, 5353, 5355,
+        5357, 5359, 5361, 5363, 5365, 5367, 5369, 5371,
+        5373, 5376, 5379, 0, 5381, 5383, 5386, 5388,
+        5390, 5392, 5394, 5396, 5398, 5400, 5402, 5404,
+        5406, 5408, 5411, 5413, 5415, 5417, 5419, 5421,
+        5423, 5425, 5427, 5429, 5432, 5434, 5436, 5438,
+        5440, 5443, 5446, 0, 5448, 5450, 5452, 5454,
+    },
+    {
+        5456, 5458, 5460, 5462, 5465, 5467, 5469, 5471,
+        5473, 5475, 5477, 5479, 5481, 5483, 5485, 5487,
+        5489, 5491, 5493, 5496, 5499, 0, 5501, 5503,
+        5506, 5508, 5510, 5512, 5514, 5516, 5518, 5520,
+        5522, 5524, 5526, 5528, 5531, 5533, 5535, 5537,
+        5539, 5541, 5543, 5545, 5547, 5549, 5552, 5554,
+        5556, 5558, 5560, 5563, 5566, 0, 5568, 5570,
+        5572, 5574, 5576, 5578, 5580, 5582, 5585, 5587,
+        5589, 5591, 5593, 5595, 5597, 5599, 5601, 5603,
+        5605, 5607, 5609, 5611, 5613, 5616, 5619, 0,
+        5621, 5623, 5626, 5628, 5630, 5632, 5634, 5636,
+        5638, 5640, 5642, 5644, 5646, 5648, 5651, 5653,
+        5655, 5657, 5659, 5661, 5663, 5665, 5667, 5669,
+        5672, 5674, 5676, 5678, 5680, 5683, 5686, 0,
+        5688, 5690, 5692, 5694, 5696, 5698, 5700, 5702,
+        5705, 5707, 5709, 5711, 5713, 5715, 5717, 5719,
+        5721, 5723, 5725, 5727, 5729, 5731, 5733, 5736,
+        5739, 0, 5741, 5743, 5746, 5748, 5750, 5752,
+        5754, 5756, 5758, 5760, 5762, 5764, 5766, 5768,
+        5771, 5773, 5775, 5777, 5779, 5781, 5783, 5785,
+        5787, 5789, 5792, 5794, 5796, 5798, 5800, 5803,
+        5806, 0, 5808, 5810, 5812, 5814, 5816, 5818,
+        5820, 5822, 5825, 5827, 5829, 5831, 5833, 5835,
+        5837, 5839, 5841, 5843, 5845, 5847, 5849, 5851,
+        5853, 5856, 5859, 0, 5861, 5863, 5866, 5868,
+        5870, 5872, 0, 0, 0, 0, 5874, 5876,
+        5878, 5880, 5882, 5884, 5886, 5888, 5890, 5892,
+        5894, 5896, 5898, 5900, 5902, 5904, 5906, 5908,
+        5910, 5912, 5914, 5916, 5918, 5920, 5922, 5924,
+        5926, 5928, 5930, 5932, 5934, 5936, 5938, 5940,
+        5942, 5944, 5946, 5948, 5950, 5952, 5954, 5956,
+        5958, 5960, 5962, 5964, 5966, 5968, 5970, 5972,
+    },
+    {
+        5974, 5977, 5980, 5983, 5986, 5989, 5992, 5995,
+        5998, 6001, 6004, 0, 0, 0, 0, 0,
+        6007, 6011, 6015, 6019, 6023, 6027, 6031, 6035,
+        6039, 6043, 6047, 6051, 6055, 6059, 6063, 6067,
+        6071, 6075, 6079, 6083, 6087, 6091, 6095, 6099,
+        6103, 6107, 0, 6111, 6113, 6115, 6118, 0,
+        6121, 6123, 6125, 6127, 6129, 6131, 6133, 6135,
+        6137, 6139, 6141, 6143, 6145, 6147, 6149, 6151,
+        6153, 6155, 6157, 6159, 6161, 6163, 6165, 6167,
+        6169, 6171, 6173, 6176, 6179, 6182, 6185, 6189,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 6192, 6195, 6198, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        6201, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        6204, 6206, 6208, 6210, 6212, 6214, 6216, 6218,
+        6220, 6222, 0, 0, 0, 0, 0, 0,
+    },
+};
+
+static const char translit_pool[6224] =
+    "\000"
+    "\001 "  /* U+00A0 */
+    "\001!"  /* U+00A1 */
+    "\001c"  /* U+00A2 */
+    "\003GBP"  /* U+00A3 */
+    "\003JPY"  /* U+00A5 */
+    "\003(c)"  /* U+00A9 */
+    "\001a"  /* U+00AA */
+    "\002<<"  /* U+00AB */
+    "\003(R)"  /* U+00AE */
+    "\003+/-"  /* U+00B1 */
+    "\0012"  /* U+00B2 */
+    "\0013"  /* U+00B3 */
+    "\001m"  /* U+00B5 */
+    "\0011"  /* U+00B9 */
+    "\001o"  /* U+00BA */
+    "\002>>"  /* U+00BB */
+    "\0031/4"  /* U+00BC */
+    "\0031/2"  /* U+00BD */
+    "\0033/4"  /* U+00BE */
+    "\001\?"  /* U+00BF */
+    "\001A"  /* U+00C0 */
+    "\001A"  /* U+00C1 */
+    "\001A"  /* U+00C2 */
+    "\001A"  /* U+00C3 */
+    "\001A"  /* U+00C4 */
+    "\001A"  /* U+00C5 */
+    "\002AE"  /* U+00C6 */
+    "\001C"  /* U+00C7 */
+    "\001E"  /* U+00C8 */
+    "\001E"  /* U+00C9 */
+    "\001E"  /* U+00CA */
+    "\001E"  /* U+00CB */
+    "\001I"  /* U+00CC */
+    "\001I"  /* U+00CD */
+    "\001I"  /* U+00CE */
+    "\001I"  /* U+00CF */
+    "\001D"  /* U+00D0 */
+    "\001N"  /* U+00D1 */
+    "\001O"  /* U+00D2 */
+    "\001O"  /* U+00D3 */
+    "\001O"  /* U+00D4 */
+    "\001O"  /* U+00D5 */
+    "\001O"  /* U+00D6 */
+    "\001x"  /* U+00D7 */
+    "\001O"  /* U+00D8 */
+    "\001U"  /* U+00D9 */
+    "\001U"  /* U+00DA */
+    "\001U"  /* U+00DB */
+    "\001U"  /* U+00DC */
+    "\001Y"  /* U+00DD */
+    "\002Th"  /* U+00DE */
+    "\002ss"  /* U+00DF */
+    "\001a"  /* U+00E0 */
+    "\001a"  /* U+00E1 */
+    "\001a"  /* U+00E2 */
+    "\001a"  /* U+00E3 */
+    "\001a"  /* U+00E4 */
+    "\001a"  /* U+00E5 */
+    "\002ae"  /* U+00E6 */
+    "\001c"  /* U+00E7 */
+    "\001e"  /* U+00E8 */
+    "\001e"  /* U+00E9 */
+    "\001e"  /* U+00EA */
+    "\001e"  /* U+00EB */
+    "\001i"  /* U+00EC */
+    "\001i"  /* U+00ED */
+    "\001i"  /* U+00EE */
+    "\001i"  /* U+00EF */
+    "\001d"  /* U+00F0 */
+    "\001n"  /* U+00F1 */
+    "\001o"  /* U+00F2 */
+    "\001o"  /* U+00F3 */
+    "\001o"  /* U+00F4 */
+    "\001o"  /* U+00F5 */
+    "\001o"  /* U+00F6 */
+    "\001/"  /* U+00F7 */
+    "\001o"  /* U+00F8 */
+    "\001u"  /* U+00F9 */
+    "\001u"  /* U+00FA */
+    "\001u"  /* U+00FB */
+    "\001u"  /* U+00FC */
+    "\001y"  /* U+00FD */
+    "\002th"  /* U+00FE */
+    "\001y"  /* U+00FF */
+    "\001A"  /* U+0100 */
+    "\001a"  /* U+0101 */
+    "\001A"  /* U+0102 */
+    "\001a"  /* U+0103 */
+    "\001A"  /* U+0104 */
+    "\001a"  /* U+0105 */
+    "\001C"  /* U+0106 */
+    "\001c"  /* U+0107 */
+    "\001C"  /* U+0108 */
+    "\001c"  /* U+0109 */
+    "\001C"  /* U+010A */
+    "\001c"  /* U+010B */
+    "\001C"  /* U+010C */
+    "\001c"  /* U+010D */
+    "\001D"  /* U+010E */
+    "\001d"  /* U+010F */
+    "\001D"  /* U+0110 */
+    "\001d"  /* U+0111 */
+    "\001E"  /* U+0112 */
+    "\001e"  /* U+0113 */
+    "\001E"  /* U+0114 */
+    "\001e"  /* U+0115 */
+    "\001E"  /* U+0116 */
+    "\001e"  /* U+0117 */
+    "\001E"  /* U+0118 */
+    "\001e"  /* U+0119 */
+    "\001E"  /* U+011A */
+    "\001e"  /* U+011B */
+    "\001G"  /* U+011C */
+    "\001g"  /* U+011D */
+    "\001G"  /* U+011E */
+    "\001g"  /* U+011F */
+    "\001G"  /* U+0120 */
+    "\001g"  /* U+0121 */
+    "\001G"  /* U+0122 */
+    "\001g"  /* U+0123 */
+    "\001H"  /* U+0124 */
+    "\001h"  /* U+0125 */
+    "\001H"  /* U+0126 */
+    "\001h"  /* U+0127 */
+    "\001I"  /* U+0128 */
+    "\001i"  /* U+0129 */
+    "\001I"  /* U+012A */
+    "\001i"  /* U+012B */
+    "\001I"  /* U+012C */
+    "\001i"  /* U+012D */
+    "\001I"  /* U+012E */
+    "\001i"  /* U+012F */
+    "\001I"  /* U+0130 */
+    "\001i"  /* U+0131 */
+    "\002IJ"  /* U+0132 */
+    "\002ij"  /* U+0133 */
+    "\001J"  /* U+0134 */
+    "\001j"  /* U+0135 */
+    "\001K"  /* U+0136 */
+    "\001k"  /* U+0137 */
+    "\001L"  /* U+0139 */
+    "\001l"  /* U+013A */
+    "\001L"  /* U+013B */
+    "\001l"  /* U+013C */
+    "\001L"  /* U+013D */
+    "\001l"  /* U+013E */
+    "\001L"  /* U+0141 */
+    "\001l"  /* U+0142 */
+    "\001N"  /* U+0143 */
+    "\001n"  /* U+0144 */
+    "\001N"  /* U+0145 */
+    "\001n"  /* U+0146 */
+    "\001N"  /* U+0147 */
+    "\001n"  /* U+0148 */
+    "\002'n"  /* U+0149 */
+    "\001N"  /* U+014A */
+    "\001n"  /* U+014B */
+    "\001O"  /* U+014C */
+    "\001o"  /* U+014D */
+    "\001O"  /* U+014E */
+    "\001o"  /* U+014F */
+    "\001O"  /* U+0150 */
+    "\001o"  /* U+0151 */
+    "\002OE"  /* U+0152 */
+    "\002oe"  /* U+0153 */
+    "\001R"  /* U+0154 */
+    "\001r"  /* U+0155 */
+    "\001R"  /* U+0156 */
+    "\001r"  /* U+0157 */
+    "\001R"  /* U+0158 */
+    "\001r"  /* U+0159 */
+    "\001S"  /* U+015A */
+    "\001s"  /* U+015B */
+    "\001S"  /* U+015C */
+    "\001s"  /* U+015D */
+    "\001S"  /* U+015E */
+    "\001s"  /* U+015F */
+    "\001S"  /* U+0160 */
+    "\001s"  /* U+0161 */
+    "\001T"  /* U+0162 */
+    "\001t"  /* U+0163 */
+    "\001T"  /* U+0164 */
+    "\001t"  /* U+0165 */
+    "\001T"  /* U+0166 */
+    "\001t"  /* U+0167 */
+    "\001U"  /* U+0168 */
+    "\001u"  /* U+0169 */
+    "\001U"  /* U+016A */
+    "\001u"  /* U+016B */
+    "\001U"  /* U+016C */
+    "\001u"  /* U+016D */
+    "\001U"  /* U+016E */
+    "\001u"  /* U+016F */
+    "\001U"  /* U+0170 */
+    "\001u"  /* U+0171 */
+    "\001U"  /* U+0172 */
+    "\001u"  /* U+0173 */
+    "\001W"  /* U+0174 */
+    "\001w"  /* U+0175 */
+    "\001Y"  /* U+0176 */
+    "\001y"  /* U+0177 */
+    "\001Y"  /* U+0178 */
+    "\001Z"  /* U+0179 */
+    "\001z"  /* U+017A */
+    "\001Z"  /* U+017B */
+    "\001z"  /* U+017C */
+    "\001Z"  /* U+017D */
+    "\001z"  /* U+017E */
+    "\001s"  /* U+017F */
+    "\001b"  /* U+0180 */
+    "\001D"  /* U+0189 */
+    "\001F"  /* U+0191 */
+    "\001f"  /* U+0192 */
+    "\001I"  /* U+0197 */
+    "\001O"  /* U+01A0 */
+    "\001o"  /* U+01A1 */
+    "\001U"  /* U+01AF */
+    "\001u"  /* U+01B0 */
+    "\002DZ"  /* U+01C4 */
+    "\002Dz"  /* U+01C5 */
+    "\002dz"  /* U+01C6 */
+    "\002LJ"  /* U+01C7 */
+    "\002Lj"  /* U+01C8 */
+    "\002lj"  /* U+01C9 */
+    "\002NJ"  /* U+01CA */
+    "\002Nj"  /* U+01CB */
+    "\002nj"  /* U+01CC */
+    "\001A"  /* U+01CD */
+    "\001a"  /* U+01CE */
+    "\001I"  /* U+01CF */
+    "\001i"  /* U+01D0 */
+    "\001O"  /* U+01D1 */
+    "\001o"  /* U+01D2 */
+    "\001U"  /* U+01D3 */
+    "\001u"  /* U+01D4 */
+    "\001U"  /* U+01D5 */
+    "\001u"  /* U+01D6 */
+    "\001U"  /* U+01D7 */
+    "\001u"  /* U+01D8 */
+    "\001U"  /* U+01D9 */
+    "\001u"  /* U+01DA */
+    "\001U"  /* U+01DB */
+    "\001u"  /* U+01DC */
+    "\001A"  /* U+01DE */
+    "\001a"  /* U+01DF */
+    "\001A"  /* U+01E0 */
+    "\001a"  /* U+01E1 */
+    "\002AE"  /* U+01E2 */
+    "\002ae"  /* U+01E3 */
+    "\001G"  /* U+01E4 */
+    "\001g"  /* U+01E5 */
+    "\001G"  /* U+01E6 */
+    "\001g"  /* U+01E7 */
+    "\001K"  /* U+01E8 */
+    "\001k"  /* U+01E9 */
+    "\001O"  /* U+01EA */
+    "\001o"  /* U+01EB */
+    "\001O"  /* U+01EC */
+    "\001o"  /* U+01ED */
+    "\001j"  /* U+01F0 */
+    "\002DZ"  /* U+01F1 */
+    "\002Dz"  /* U+01F2 */
+    "\002dz"  /* U+01F3 */
+    "\001G"  /* U+01F4 */
+    "\001g"  /* U+01F5 */
+    "\001N"  /* U+01F8 */
+    "\001n"  /* U+01F9 */
+    "\001A"  /* U+01FA */
+    "\001a"  /* U+01FB */
+    "\002AE"  /* U+01FC */
+    "\002ae"  /* U+01FD */
+    "\001O"  /* U+01FE */
+    "\001o"  /* U+01FF */
+    "\001A"  /* U+0200 */
+    "\001a"  /* U+0201 */
+    "\001A"  /* U+0202 */
+    "\001a"  /* U+0203 */
+    "\001E"  /* U+0204 */
+    "\001e"  /* U+0205 */
+    "\001E"  /* U+0206 */
+    "\001e"  /* U+0207 */
+    "\001I"  /* U+0208 */
+    "\001i"  /* U+0209 */
+    "\001I"  /* U+020A */
+    "\001i"  /* U+020B */
+    "\001O"  /* U+020C */
+    "\001o"  /* U+020D */
+    "\001O"  /* U+020E */
+    "\001o"  /* U+020F */
+    "\001R"  /* U+0210 */
+    "\001r"  /* U+0211 */
+    "\001R"  /* U+0212 */
+    "\001r"  /* U+0213 */
+    "\001U"  /* U+0214 */
+    "\001u"  /* U+0215 */
+    "\001U"  /* U+0216 */
+    "\001u"  /* U+0217 */
+    "\001S"  /* U+0218 */
+    "\001s"  /* U+0219 */
+    "\001T"  /* U+021A */
+    "\001t"  /* U+021B */
+    "\001H"  /* U+021E */
+    "\001h"  /* U+021F */
+    "\001A"  /* U+0226 */
+    "\001a"  /* U+0227 */
+    "\001E"  /* U+0228 */
+    "\001e"  /* U+0229 */
+    "\001O"  /* U+022A */
+    "\001o"  /* U+022B */
+    "\001O"  /* U+022C */
+    "\001o"  /* U+022D */
+    "\001O"  /* U+022E */
+    "\001o"  /* U+022F */
+    "\001O"  /* U+0230 */
+    "\001o"  /* U+0231 */
+    "\001Y"  /* U+0232 */
+    "\001y"  /* U+0233 */
+    "\001j"  /* U+0237 */
+    "\001a"  /* U+0251 */
+    "\001g"  /* U+0261 */
+    "\001i"  /* U+0268 */
+    "\001h"  /* U+02B0 */
+    "\001j"  /* U+02B2 */
+    "\001r"  /* U+02B3 */
+    "\001w"  /* U+02B7 */
+    "\001y"  /* U+02B8 */
+    "\001l"  /* U+02E1 */
+    "\001s"  /* U+02E2 */
+    "\001x"  /* U+02E3 */
+    "\001;"  /* U+037E */
+    "\001A"  /* U+0386 */
+    "\001E"  /* U+0388 */
+    "\001E"  /* U+0389 */
+    "\001I"  /* U+038A */
+    "\001O"  /* U+038C */
+    "\001Y"  /* U+038E */
+    "\001O"  /* U+038F */
+    "\001i"  /* U+0390 */
+    "\001A"  /* U+0391 */
+    "\001B"  /* U+0392 */
+    "\001G"  /* U+0393 */
+    "\001D"  /* U+0394 */
+    "\001E"  /* U+0395 */
+    "\001Z"  /* U+0396 */
+    "\001E"  /* U+0397 */
+    "\002Th"  /* U+0398 */
+    "\001I"  /* U+0399 */
+    "\001K"  /* U+039A */
+    "\001L"  /* U+039B */
+    "\001M"  /* U+039C */
+    "\001N"  /* U+039D */
+    "\001X"  /* U+039E */
+    "\001O"  /* U+039F */
+    "\001P"  /* U+03A0 */
+    "\001R"  /* U+03A1 */
+    "\001S"  /* U+03A3 */
+    "\001T"  /* U+03A4 */
+    "\001Y"  /* U+03A5 */
+    "\001F"  /* U+03A6 */
+    "\002Ch"  /* U+03A7 */
+    "\002Ps"  /* U+03A8 */
+    "\001O"  /* U+03A9 */
+    "\001I"  /* U+03AA */
+    "\001Y"  /* U+03AB */
+    "\001a"  /* U+03AC */
+    "\001e"  /* U+03AD */
+    "\001e"  /* U+03AE */
+    "\001i"  /* U+03AF */
+    "\001y"  /* U+03B0 */
+    "\001a"  /* U+03B1 */
+    "\001b"  /* U+03B2 */
+    "\001g"  /* U+03B3 */
+    "\001d"  /* U+03B4 */
+    "\001e"  /* U+03B5 */
+    "\001z"  /* U+03B6 */
+    "\001e"  /* U+03B7 */
+    "\002th"  /* U+03B8 */
+    "\001i"  /* U+03B9 */
+    "\001k"  /* U+03BA */
+    "\001l"  /* U+03BB */
+    "\001m"  /* U+03BC */
+    "\001n"  /* U+03BD */
+    "\001x"  /* U+03BE */
+    "\001o"  /* U+03BF */
+    "\001p"  /* U+03C0 */
+    "\001r"  /* U+03C1 */
+    "\001s"  /* U+03C2 */
+    "\001s"  /* U+03C3 */
+    "\001t"  /* U+03C4 */
+    "\001y"  /* U+03C5 */
+    "\001f"  /* U+03C6 */
+    "\002ch"  /* U+03C7 */
+    "\002ps"  /* U+03C8 */
+    "\001o"  /* U+03C9 */
+    "\001i"  /* U+03CA */
+    "\001y"  /* U+03CB */
+    "\001o"  /* U+03CC */
+    "\001y"  /* U+03CD */
+    "\001o"  /* U+03CE */
+    "\001b"  /* U+03D0 */
+    "\002th"  /* U+03D1 */
+    "\001Y"  /* U+03D2 */
+    "\001Y"  /* U+03D3 */
+    "\001Y"  /* U+03D4 */
+    "\001f"  /* U+03D5 */
+    "\001p"  /* U+03D6 */
+    "\001k"  /* U+03F0 */
+    "\001r"  /* U+03F1 */
+    "\001s"  /* U+03F2 */
+    "\002Th"  /* U+03F4 */
+    "\001e"  /* U+03F5 */
+    "\001S"  /* U+03F9 */
+    "\001E"  /* U+0400 */
+    "\002Yo"  /* U+0401 */
+    "\002Dj"  /* U+0402 */
+    "\001G"  /* U+0403 */
+    "\002Ye"  /* U+0404 */
+    "\002Dz"  /* U+0405 */
+    "\001I"  /* U+0406 */
+    "\002Yi"  /* U+0407 */
+    "\001J"  /* U+0408 */
+    "\002Lj"  /* U+0409 */
+    "\002Nj"  /* U+040A */
+    "\001C"  /* U+040B */
+    "\001K"  /* U+040C */
+    "\001I"  /* U+040D */
+    "\001U"  /* U+040E */
+    "\002Dz"  /* U+040F */
+    "\001A"  /* U+0410 */
+    "\001B"  /* U+0411 */
+    "\001V"  /* U+0412 */
+    "\001G"  /* U+0413 */
+    "\001D"  /* U+0414 */
+    "\001E"  /* U+0415 */
+    "\002Zh"  /* U+0416 */
+    "\001Z"  /* U+0417 */
+    "\001I"  /* U+0418 */
+    "\001J"  /* U+0419 */
+    "\001K"  /* U+041A */
+    "\001L"  /* U+041B */
+    "\001M"  /* U+041C */
+    "\001N"  /* U+041D */
+    "\001O"  /* U+041E */
+    "\001P"  /* U+041F */
+    "\001R"  /* U+0420 */
+    "\001S"  /* U+0421 */
+    "\001T"  /* U+0422 */
+    "\001U"  /* U+0423 */
+    "\001F"  /* U+0424 */
+    "\002Kh"  /* U+0425 */
+    "\002Ts"  /* U+0426 */
+    "\002Ch"  /* U+0427 */
+    "\002Sh"  /* U+0428 */
+    "\004Shch"  /* U+0429 */
+    "\001\""  /* U+042A */
+    "\001Y"  /* U+042B */
+    "\001'"  /* U+042C */
+    "\001E"  /* U+042D */
+    "\002Yu"  /* U+042E */
+    "\002Ya"  /* U+042F */
+    "\001a"  /* U+0430 */
+    "\001b"  /* U+0431 */
+    "\001v"  /* U+0432 */
+    "\001g"  /* U+0433 */
+    "\001d"  /* U+0434 */
+    "\001e"  /* U+0435 */
+    "\002zh"  /* U+0436 */
+    "\001z"  /* U+0437 */
+    "\001i"  /* U+0438 */
+    "\001j"  /* U+0439 */
+    "\001k"  /* U+043A */
+    "\001l"  /* U+043B */
+    "\001m"  /* U+043C */
+    "\001n"  /* U+043D */
+    "\001o"  /* U+043E */
+    "\001p"  /* U+043F */
+    "\001r"  /* U+0440 */
+    "\001s"  /* U+0441 */
+    "\001t"  /* U+0442 */
+    "\001u"  /* U+0443 */
+    "\001f"  /* U+0444 */
+    "\002kh"  /* U+0445 */
+    "\002ts"  /* U+0446 */
+    "\002ch"  /* U+0447 */
+    "\002sh"  /* U+0448 */
+    "\004shch"  /* U+0449 */
+    "\001\""  /* U+044A */
+    "\001y"  /* U+044B */
+    "\001'"  /* U+044C */
+    "\001e"  /* U+044D */
+    "\002yu"  /* U+044E */
+    "\002ya"  /* U+044F */
+    "\001e"  /* U+0450 */
+    "\002yo"  /* U+0451 */
+    "\002dj"  /* U+0452 */
+    "\001g"  /* U+0453 */
+    "\002ye"  /* U+0454 */
+    "\002dz"  /* U+0455 */
+    "\001i"  /* U+0456 */
+    "\002yi"  /* U+0457 */
+    "\001j"  /* U+0458 */
+    "\002lj"  /* U+0459 */
+    "\002nj"  /* U+045A */
+    "\001c"  /* U+045B */
+    "\001k"  /* U+045C */
+    "\001i"  /* U+045D */
+    "\001u"  /* U+045E */
+    "\002dz"  /* U+045F */
+    "\001G"  /* U+0490 */
+    "\001g"  /* U+0491 */
+    "\002Zh"  /* U+04C1 */
+    "\002zh"  /* U+04C2 */
+    "\001A"  /* U+04D0 */
+    "\001a"  /* U+04D1 */
+    "\001A"  /* U+04D2 */
+    "\001a"  /* U+04D3 */
+    "\001E"  /* U+04D6 */
+    "\001e"  /* U+04D7 */
+    "\002Zh"  /* U+04DC */
+    "\002zh"  /* U+04DD */
+    "\001Z"  /* U+04DE */
+    "\001z"  /* U+04DF */
+    "\001I"  /* U+04E2 */
+    "\001i"  /* U+04E3 */
+    "\001I"  /* U+04E4 */
+    "\001i"  /* U+04E5 */
+    "\001O"  /* U+04E6 */
+    "\001o"  /* U+04E7 */
+    "\001E"  /* U+04EC */
+    "\001e"  /* U+04ED */
+    "\001U"  /* U+04EE */
+    "\001u"  /* U+04EF */
+    "\001U"  /* U+04F0 */
+    "\001u"  /* U+04F1 */
+    "\001U"  /* U+04F2 */
+    "\001u"  /* U+04F3 */
+    "\002Ch"  /* U+04F4 */
+    "\002ch"  /* U+04F5 */
+    "\001Y"  /* U+04F8 */
+    "\001y"  /* U+04F9 */
+    "\001A"  /* U+1D2C */
+    "\002AE"  /* U+1D2D */
+    "\001B"  /* U+1D2E */
+    "\001D"  /* U+1D30 */
+    "\001E"  /* U+1D31 */
+    "\001G"  /* U+1D33 */
+    "\001H"  /* U+1D34 */
+    "\001I"  /* U+1D35 */
+    "\001J"  /* U+1D36 */
+    "\001K"  /* U+1D37 */
+    "\001L"  /* U+1D38 */
+    "\001M"  /* U+1D39 */
+    "\001N"  /* U+1D3A */
+    "\001O"  /* U+1D3C */
+    "\001P"  /* U+1D3E */
+    "\001R"  /* U+1D3F */
+    "\001T"  /* U+1D40 */
+    "\001U"  /* U+1D41 */
+    "\001W"  /* U+1D42 */
+    "\001a"  /* U+1D43 */
+    "\001a"  /* U+1D45 */
+    "\001b"  /* U+1D47 */
+    "\001d"  /* U+1D48 */
+    "\001e"  /* U+1D49 */
+    "\001g"  /* U+1D4D */
+    "\001k"  /* U+1D4F */
+    "\001m"  /* U+1D50 */
+    "\001n"  /* U+1D51 */
+    "\001o"  /* U+1D52 */
+    "\001p"  /* U+1D56 */
+    "\001t"  /* U+1D57 */
+    "\001u"  /* U+1D58 */
+    "\001v"  /* U+1D5B */
+    "\001b"  /* U+1D5D */
+    "\001g"  /* U+1D5E */
+    "\001d"  /* U+1D5F */
+    "\001f"  /* U+1D60 */
+    "\002ch"  /* U+1D61 */
+    "\001i"  /* U+1D62 */
+    "\001r"  /* U+1D63 */
+    "\001u"  /* U+1D64 */
+    "\001v"  /* U+1D65 */
+    "\001b"  /* U+1D66 */
+    "\001g"  /* U+1D67 */
+    "\001r"  /* U+1D68 */
+    "\001f"  /* U+1D69 */
+    "\002ch"  /* U+1D6A */
+    "\001n"  /* U+1D78 */
+    "\001c"  /* U+1D9C */
+    "\001d"  /* U+1D9E */
+    "\001f"  /* U+1DA0 */
+    "\001g"  /* U+1DA2 */
+    "\001i"  /* U+1DA4 */
+    "\001z"  /* U+1DBB */
+    "\002th"  /* U+1DBF */
+    "\001A"  /* U+1E00 */
+    "\001a"  /* U+1E01 */
+    "\001B"  /* U+1E02 */
+    "\001b"  /* U+1E03 */
+    "\001B"  /* U+1E04 */
+    "\001b"  /* U+1E05 */
+    "\001B"  /* U+1E06 */
+    "\001b"  /* U+1E07 */
+    "\001C"  /* U+1E08 */
+    "\001c"  /* U+1E09 */
+    "\001D"  /* U+1E0A */
+    "\001d"  /* U+1E0B */
+    "\001D"  /* U+1E0C */
+    "\001d"  /* U+1E0D */
+    "\001D"  /* U+1E0E */
+    "\001d"  /* U+1E0F */
+    "\001D"  /* U+1E10 */
+    "\001d"  /* U+1E11 */
+    "\001D"  /* U+1E12 */
+    "\001d"  /* U+1E13 */
+    "\001E"  /* U+1E14 */
+    "\001e"  /* U+1E15 */
+    "\001E"  /* U+1E16 */
+    "\001e"  /* U+1E17 */
+    "\001E"  /* U+1E18 */
+    "\001e"  /* U+1E19 */
+    "\001E"  /* U+1E1A */
+    "\001e"  /* U+1E1B */
+    "\001E"  /* U+1E1C */
+    "\001e"  /* U+1E1D */
+    "\001F"  /* U+1E1E */
+    "\001f"  /* U+1E1F */
+    "\001G"  /* U+1E20 */
+    "\001g"  /* U+1E21 */
+    "\001H"  /* U+1E22 */
+    "\001h"  /* U+1E23 */
+    "\001H"  /* U+1E24 */
+    "\001h"  /* U+1E25 */
+    "\001H"  /* U+1E26 */
+    "\001h"  /* U+1E27 */
+    "\001H"  /* U+1E28 */
+    "\001h"  /* U+1E29 */
+    "\001H"  /* U+1E2A */
+    "\001h"  /* U+1E2B */
+    "\001I"  /* U+1E2C */
+    "\001i"  /* U+1E2D */
+    "\001I"  /* U+1E2E */
+    "\001i"  /* U+1E2F */
+    "\001K"  /* U+1E30 */
+    "\001k"  /* U+1E31 */
+    "\001K"  /* U+1E32 */
+    "\001k"  /* U+1E33 */
+    "\001K"  /* U+1E34 */
+    "\001k"  /* U+1E35 */
+    "\001L"  /* U+1E36 */
+    "\001l"  /* U+1E37 */
+    "\001L"  /* U+1E38 */
+    "\001l"  /* U+1E39 */
+    "\001L"  /* U+1E3A */
+    "\001l"  /* U+1E3B */
+    "\001L"  /* U+1E3C */
+    "\001l"  /* U+1E3D */
+    "\001M"  /* U+1E3E */
+    "\001m"  /* U+1E3F */
+    "\001M"  /* U+1E40 */
+    "\001m"  /* U+1E41 */
+    "\001M"  /* U+1E42 */
+    "\001m"  /* U+1E43 */
+    "\001N"  /* U+1E44 */
+    "\001n"  /* U+1E45 */
+    "\001N"  /* U+1E46 */
+    "\001n"  /* U+1E47 */
+    "\001N"  /* U+1E48 */
+    "\001n"  /* U+1E49 */
+    "\001N"  /* U+1E4A */
+    "\001n"  /* U+1E4B */
+    "\001O"  /* U+1E4C */
+    "\001o"  /* U+1E4D */
+    "\001O"  /* U+1E4E */
+    "\001o"  /* U+1E4F */
+    "\001O"  /* U+1E50 */
+    "\001o"  /* U+1E51 */
+    "\001O"  /* U+1E52 */
+    "\001o"  /* U+1E53 */
+    "\001P"  /* U+1E54 */
+    "\001p"  /* U+1E55 */
+    "\001P"  /* U+1E56 */
+    "\001p"  /* U+1E57 */
+    "\001R"  /* U+1E58 */
+    "\001r"  /* U+1E59 */
+    "\001R"  /* U+1E5A */
+    "\001r"  /* U+1E5B */
+    "\001R"  /* U+1E5C */
+    "\001r"  /* U+1E5D */
+    "\001R"  /* U+1E5E */
+    "\001r"  /* U+1E5F */
+    "\001S"  /* U+1E60 */
+    "\001s"  /* U+1E61 */
+    "\001S"  /* U+1E62 */
+    "\001s"  /* U+1E63 */
+    "\001S"  /* U+1E64 */
+    "\001s"  /* U+1E65 */
+    "\001S"  /* U+1E66 */
+    "\001s"  /* U+1E67 */
+    "\001S"  /* U+1E68 */
+    "\001s"  /* U+1E69 */
+    "\001T"  /* U+1E6A */
+    "\001t"  /* U+1E6B */
+    "\001T"  /* U+1E6C */
+    "\001t"  /* U+1E6D */
+    "\001T"  /* U+1E6E */
+    "\001t"  /* U+1E6F */
+    "\001T"  /* U+1E70 */
+    "\001t"  /* U+1E71 */
+    "\001U"  /* U+1E72 */
+    "\001u"  /* U+1E73 */
+    "\001U"  /* U+1E74 */
+    "\001u"  /* U+1E75 */
+    "\001U"  /* U+1E76 */
+    "\001u"  /* U+1E77 */
+    "\001U"  /* U+1E78 */
+    "\001u"  /* U+1E79 */
+    "\001U"  /* U+1E7A */
+    "\001u"  /* U+1E7B */
+    "\001V"  /* U+1E7C */
+    "\001v"  /* U+1E7D */
+    "\001V"  /* U+1E7E */
+    "\001v"  /* U+1E7F */
+    "\001W"  /* U+1E80 */
+    "\001w"  /* U+1E81 */
+    "\001W"  /* U+1E82 */
+    "\001w"  /* U+1E83 */
+    "\001W"  /* U+1E84 */
+    "\001w"  /* U+1E85 */
+    "\001W"  /* U+1E86 */
+    "\001w"  /* U+1E87 */
+    "\001W"  /* U+1E88 */
+    "\001w"  /* U+1E89 */
+    "\001X"  /* U+1E8A */
+    "\001x"  /* U+1E8B */
+    "\001X"  /* U+1E8C */
+    "\001x"  /* U+1E8D */
+    "\001Y"  /* U+1E8E */
+    "\001y"  /* U+1E8F */
+    "\001Z"  /* U+1E90 */
+    "\001z"  /* U+1E91 */
+    "\001Z"  /* U+1E92 */
+    "\001z"  /* U+1E93 */
+    "\001Z"  /* U+1E94 */
+    "\001z"  /* U+1E95 */
+    "\001h"  /* U+1E96 */
+    "\001t"  /* U+1E97 */
+    "\001w"  /* U+1E98 */
+    "\001y"  /* U+1E99 */
+    "\001s"  /* U+1E9B */
+    "\001A"  /* U+1EA0 */
+    "\001a"  /* U+1EA1 */
+    "\001A"  /* U+1EA2 */
+    "\001a"  /* U+1EA3 */
+    "\001A"  /* U+1EA4 */
+    "\001a"  /* U+1EA5 */
+    "\001A"  /* U+1EA6 */
+    "\001a"  /* U+1EA7 */
+    "\001A"  /* U+1EA8 */
+    "\001a"  /* U+1EA9 */
+    "\001A"  /* U+1EAA */
+    "\001a"  /* U+1EAB */
+    "\001A"  /* U+1EAC */
+    "\001a"  /* U+1EAD */
+    "\001A"  /* U+1EAE */
+    "\001a"  /* U+1EAF */
+    "\001A"  /* U+1EB0 */
+    "\001a"  /* U+1EB1 */
+    "\001A"  /* U+1EB2 */
+    "\001a"  /* U+1EB3 */
+    "\001A"  /* U+1EB4 */
+    "\001a"  /* U+1EB5 */
+    "\001A"  /* U+1EB6 */
+    "\001a"  /* U+1EB7 */
+    "\001E"  /* U+1EB8 */
+    "\001e"  /* U+1EB9 */
+    "\001E"  /* U+1EBA */
+    "\001e"  /* U+1EBB */
+    "\001E"  /* U+1EBC */
+    "\001e"  /* U+1EBD */
+    "\001E"  /* U+1EBE */
+    "\001e"  /* U+1EBF */
+    "\001E"  /* U+1EC0 */
+    "\001e"  /* U+1EC1 */
+    "\001E"  /* U+1EC2 */
+    "\001e"  /* U+1EC3 */
+    "\001E"  /* U+1EC4 */
+    "\001e"  /* U+1EC5 */
+    "\001E"  /* U+1EC6 */
+    "\001e"  /* U+1EC7 */
+    "\001I"  /* U+1EC8 */
+    "\001i"  /* U+1EC9 */
+    "\001I"  /* U+1ECA */
+    "\001i"  /* U+1ECB */
+    "\001O"  /* U+1ECC */
+    "\001o"  /* U+1ECD */
+    "\001O"  /* U+1ECE */
+    "\001o"  /* U+1ECF */
+    "\001O"  /* U+1ED0 */
+    "\001o"  /* U+1ED1 */
+    "\001O"  /* U+1ED2 */
+    "\001o"  /* U+1ED3 */
+    "\001O"  /* U+1ED4 */
+    "\001o"  /* U+1ED5 */
+    "\001O"  /* U+1ED6 */
+    "\001o"  /* U+1ED7 */
+    "\001O"  /* U+1ED8 */
+    "\001o"  /* U+1ED9 */
+    "\001O"  /* U+1EDA */
+    "\001o"  /* U+1EDB */
+    "\001O"  /* U+1EDC */
+    "\001o"  /* U+1EDD */
+    "\001O"  /* U+1EDE */
+    "\001o"  /* U+1EDF */
+    "\001O"  /* U+1EE0 */
+    "\001o"  /* U+1EE1 */
+    "\001O"  /* U+1EE2 */
+    "\001o"  /* U+1EE3 */
+    "\001U"  /* U+1EE4 */
+    "\001u"  /* U+1EE5 */
+    "\001U"  /* U+1EE6 */
+    "\001u"  /* U+1EE7 */
+    "\001U"  /* U+1EE8 */
+    "\001u"  /* U+1EE9 */
+    "\001U"  /* U+1EEA */
+    "\001u"  /* U+1EEB */
+    "\001U"  /* U+1EEC */
+    "\001u"  /* U+1EED */
+    "\001U"  /* U+1EEE */
+    "\001u"  /* U+1EEF */
+    "\001U"  /* U+1EF0 */
+    "\001u"  /* U+1EF1 */
+    "\001Y"  /* U+1EF2 */
+    "\001y"  /* U+1EF3 */
+    "\001Y"  /* U+1EF4 */
+    "\001y"  /* U+1EF5 */
+    "\001Y"  /* U+1EF6 */
+    "\001y"  /* U+1EF7 */
+    "\001Y"  /* U+1EF8 */
+    "\001y"  /* U+1EF9 */
+    "\001a"  /* U+1F00 */
+    "\001a"  /* U+1F01 */
+    "\001a"  /* U+1F02 */
+    "\001a"  /* U+1F03 */
+    "\001a"  /* U+1F04 */
+    "\001a"  /* U+1F05 */
+    "\001a"  /* U+1F06 */
+    "\001a"  /* U+1F07 */
+    "\001A"  /* U+1F08 */
+    "\001A"  /* U+1F09 */
+    "\001A"  /* U+1F0A */
+    "\001A"  /* U+1F0B */
+    "\001A"  /* U+1F0C */
+    "\001A"  /* U+1F0D */
+    "\001A"  /* U+1F0E */
+    "\001A"  /* U+1F0F */
+    "\001e"  /* U+1F10 */
+    "\001e"  /* U+1F11 */
+    "\001e"  /* U+1F12 */
+    "\001e"  /* U+1F13 */
+    "\001e"  /* U+1F14 */
+    "\001e"  /* U+1F15 */
+    "\001E"  /* U+1F18 */
+    "\001E"  /* U+1F19 */
+    "\001E"  /* U+1F1A */
+    "\001E"  /* U+1F1B */
+    "\001E"  /* U+1F1C */
+    "\001E"  /* U+1F1D */
+    "\001e"  /* U+1F20 */
+    "\001e"  /* U+1F21 */
+    "\001e"  /* U+1F22 */
+    "\001e"  /* U+1F23 */
+    "\001e"  /* U+1F24 */
+    "\001e"  /* U+1F25 */
+    "\001e"  /* U+1F26 */
+    "\001e"  /* U+1F27 */
+    "\001E"  /* U+1F28 */
+    "\001E"  /* U+1F29 */
+    "\001E"  /* U+1F2A */
+    "\001E"  /* U+1F2B */
+    "\001E"  /* U+1F2C */
+    "\001E"  /* U+1F2D */
+    "\001E"  /* U+1F2E */
+    "\001E"  /* U+1F2F */
+    "\001i"  /* U+1F30 */
+    "\001i"  /* U+1F31 */
+    "\001i"  /* U+1F32 */
+    "\001i"  /* U+1F33 */
+    "\001i"  /* U+1F34 */
+    "\001i"  /* U+1F35 */
+    "\001i"  /* U+1F36 */
+    "\001i"  /* U+1F37 */
+    "\001I"  /* U+1F38 */
+    "\001I"  /* U+1F39 */
+    "\001I"  /* U+1F3A */
+    "\001I"  /* U+1F3B */
+    "\001I"  /* U+1F3C */
+    "\001I"  /* U+1F3D */
+    "\001I"  /* U+1F3E */
+    "\001I"  /* U+1F3F */
+    "\001o"  /* U+1F40 */
+    "\001o"  /* U+1F41 */
+    "\001o"  /* U+1F42 */
+    "\001o"  /* U+1F43 */
+    "\001o"  /* U+1F44 */
+    "\001o"  /* U+1F45 */
+    "\001O"  /* U+1F48 */
+    "\001O"  /* U+1F49 */
+    "\001O"  /* U+1F4A */
+    "\001O"  /* U+1F4B */
+    "\001O"  /* U+1F4C */
+    "\001O"  /* U+1F4D */
+    "\001y"  /* U+1F50 */
+    "\001y"  /* U+1F51 */
+    "\001y"  /* U+1F52 */
+    "\001y"  /* U+1F53 */
+    "\001y"  /* U+1F54 */
+    "\001y"  /* U+1F55 */
+    "\001y"  /* U+1F56 */
+    "\001y"  /* U+1F57 */
+    "\001Y"  /* U+1F59 */
+    "\001Y"  /* U+1F5B */
+    "\001Y"  /* U+1F5D */
+    "\001Y"  /* U+1F5F */
+    "\001o"  /* U+1F60 */
+    "\001o"  /* U+1F61 */
+    "\001o"  /* U+1F62 */
+    "\001o"  /* U+1F63 */
+    "\001o"  /* U+1F64 */
+    "\001o"  /* U+1F65 */
+    "\001o"  /* U+1F66 */
+    "\001o"  /* U+1F67 */
+    "\001O"  /* U+1F68 */
+    "\001O"  /* U+1F69 */
+    "\001O"  /* U+1F6A */
+    "\001O"  /* U+1F6B */
+    "\001O"  /* U+1F6C */
+    "\001O"  /* U+1F6D */
+    "\001O"  /* U+1F6E */
+    "\001O"  /* U+1F6F */
+    "\001a"  /* U+1F70 */
+    "\001a"  /* U+1F71 */
+    "\001e"  /* U+1F72 */
+    "\001e"  /* U+1F73 */
+    "\001e"  /* U+1F74 */
+    "\001e"  /* U+1F75 */
+    "\001i"  /* U+1F76 */
+    "\001i"  /* U+1F77 */
+    "\001o"  /* U+1F78 */
+    "\001o"  /* U+1F79 */
+    "\001y"  /* U+1F7A */
+    "\001y"  /* U+1F7B */
+    "\001o"  /* U+1F7C */
+    "\001o"  /* U+1F7D */
+    "\001a"  /* U+1F80 */
+    "\001a"  /* U+1F81 */
+    "\001a"  /* U+1F82 */
+    "\001a"  /* U+1F83 */
+    "\001a"  /* U+1F84 */
+    "\001a"  /* U+1F85 */
+    "\001a"  /* U+1F86 */
+    "\001a"  /* U+1F87 */
+    "\001A"  /* U+1F88 */
+    "\001A"  /* U+1F89 */
+    "\001A"  /* U+1F8A */
+    "\001A"  /* U+1F8B */
+    "\001A"  /* U+1F8C */
+    "\001A"  /* U+1F8D */
+    "\001A"  /* U+1F8E */
+    "\001A"  /* U+1F8F */
+    "\001e"  /* U+1F90 */
+    "\001e"  /* U+1F91 */
+    "\001e"  /* U+1F92 */
+    "\001e"  /* U+1F93 */
+    "\001e"  /* U+1F94 */
+    "\001e"  /* U+1F95 */
+    "\001e"  /* U+1F96 */
+    "\001e"  /* U+1F97 */
+    "\001E"  /* U+1F98 */
+    "\001E"  /* U+1F99 */
+    "\001E"  /* U+1F9A */
+    "\001E"  /* U+1F9B */
+    "\001E"  /* U+1F9C */
+    "\001E"  /* U+1F9D */
+    "\001E"  /* U+1F9E */
+    "\001E"  /* U+1F9F */
+    "\001o"  /* U+1FA0 */
+    "\001o"  /* U+1FA1 */
+    "\001o"  /* U+1FA2 */
+    "\001o"  /* U+1FA3 */
+    "\001o"  /* U+1FA4 */
+    "\001o"  /* U+1FA5 */
+    "\001o"  /* U+1FA6 */
+    "\001o"  /* U+1FA7 */
+    "\001O"  /* U+1FA8 */
+    "\001O"  /* U+1FA9 */
+    "\001O"  /* U+1FAA */
+    "\001O"  /* U+1FAB */
+    "\001O"  /* U+1FAC */
+    "\001O"  /* U+1FAD */
+    "\001O"  /* U+1FAE */
+    "\001O"  /* U+1FAF */
+    "\001a"  /* U+1FB0 */
+    "\001a"  /* U+1FB1 */
+    "\001a"  /* U+1FB2 */
+    "\001a"  /* U+1FB3 */
+    "\001a"  /* U+1FB4 */
+    "\001a"  /* U+1FB6 */
+    "\001a"  /* U+1FB7 */
+    "\001A"  /* U+1FB8 */
+    "\001A"  /* U+1FB9 */
+    "\001A"  /* U+1FBA */
+    "\001A"  /* U+1FBB */
+    "\001A"  /* U+1FBC */
+    "\001i"  /* U+1FBE */
+    "\001e"  /* U+1FC2 */
+    "\001e"  /* U+1FC3 */
+    "\001e"  /* U+1FC4 */
+    "\001e"  /* U+1FC6 */
+    "\001e"  /* U+1FC7 */
+    "\001E"  /* U+1FC8 */
+    "\001E"  /* U+1FC9 */
+    "\001E"  /* U+1FCA */
+    "\001E"  /* U+1FCB */
+    "\001E"  /* U+1FCC */
+    "\001i"  /* U+1FD0 */
+    "\001i"  /* U+1FD1 */
+    "\001i"  /* U+1FD2 */
+    "\001i"  /* U+1FD3 */
+    "\001i"  /* U+1FD6 */
+    "\001i"  /* U+1FD7 */
+    "\001I"  /* U+1FD8 */
+    "\001I"  /* U+1FD9 */
+    "\001I"  /* U+1FDA */
+    "\001I"  /* U+1FDB */
+    "\001y"  /* U+1FE0 */
+    "\001y"  /* U+1FE1 */
+    "\001y"  /* U+1FE2 */
+    "\001y"  /* U+1FE3 */
+    "\001r"  /* U+1FE4 */
+    "\001r"  /* U+1FE5 */
+    "\001y"  /* U+1FE6 */
+    "\001y"  /* U+1FE7 */
+    "\001Y"  /* U+1FE8 */
+    "\001Y"  /* U+1FE9 */
+    "\001Y"  /* U+1FEA */
+    "\001Y"  /* U+1FEB */
+    "\001R"  /* U+1FEC */
+    "\001`"  /* U+1FEF */
+    "\001o"  /* U+1FF2 */
+    "\001o"  /* U+1FF3 */
+    "\001o"  /* U+1FF4 */
+    "\001o"  /* U+1FF6 */
+    "\001o"  /* U+1FF7 */
+    "\001O"  /* U+1FF8 */
+    "\001O"  /* U+1FF9 */
+    "\001O"  /* U+1FFA */
+    "\001O"  /* U+1FFB */
+    "\001O"  /* U+1FFC */
+    "\001 "  /* U+2000 */
+    "\001 "  /* U+2001 */
+    "\001 "  /* U+2002 */
+    "\001 "  /* U+2003 */
+    "\001 "  /* U+2004 */
+    "\001 "  /* U+2005 */
+    "\001 "  /* U+2006 */
+    "\001 "  /* U+2007 */
+    "\001 "  /* U+2008 */
+    "\001 "  /* U+2009 */
+    "\001 "  /* U+200A */
+    "\001-"  /* U+2010 */
+    "\001-"  /* U+2011 */
+    "\001-"  /* U+2012 */
+    "\001-"  /* U+2013 */
+    "\002--"  /* U+2014 */
+    "\002--"  /* U+2015 */
+    "\001'"  /* U+2018 */
+    "\001'"  /* U+2019 */
+    "\001'"  /* U+201A */
+    "\001'"  /* U+201B */
+    "\001\""  /* U+201C */
+    "\001\""  /* U+201D */
+    "\001\""  /* U+201E */
+    "\001\""  /* U+201F */
+    "\001*"  /* U+2022 */
+    "\001."  /* U+2024 */
+    "\002.."  /* U+2025 */
+    "\003..."  /* U+2026 */
+    "\001 "  /* U+202F */
+    "\001'"  /* U+2032 */
+    "\002''"  /* U+2033 */
+    "\003'''"  /* U+2034 */
+    "\001<"  /* U+2039 */
+    "\001>"  /* U+203A */
+    "\002!!"  /* U+203C */
+    "\001/"  /* U+2044 */
+    "\002\?\?"  /* U+2047 */
+    "\002\?!"  /* U+2048 */
+    "\002!\?"  /* U+2049 */
+    "\004''''"  /* U+2057 */
+    "\001 "  /* U+205F */
+    "\0010"  /* U+2070 */
+    "\001i"  /* U+2071 */
+    "\0014"  /* U+2074 */
+    "\0015"  /* U+2075 */
+    "\0016"  /* U+2076 */
+    "\0017"  /* U+2077 */
+    "\0018"  /* U+2078 */
+    "\0019"  /* U+2079 */
+    "\001+"  /* U+207A */
+    "\001-"  /* U+207B */
+    "\001="  /* U+207C */
+    "\001("  /* U+207D */
+    "\001)"  /* U+207E */
+    "\001n"  /* U+207F */
+    "\0010"  /* U+2080 */
+    "\0011"  /* U+2081 */
+    "\0012"  /* U+2082 */
+    "\0013"  /* U+2083 */
+    "\0014"  /* U+2084 */
+    "\0015"  /* U+2085 */
+    "\0016"  /* U+2086 */
+    "\0017"  /* U+2087 */
+    "\0018"  /* U+2088 */
+    "\0019"  /* U+2089 */
+    "\001+"  /* U+208A */
+    "\001-"  /* U+208B */
+    "\001="  /* U+208C */
+    "\001("  /* U+208D */
+    "\001)"  /* U+208E */
+    "\001a"  /* U+2090 */
+    "\001e"  /* U+2091 */
+    "\001o"  /* U+2092 */
+    "\001x"  /* U+2093 */
+    "\001h"  /* U+2095 */
+    "\001k"  /* U+2096 */
+    "\001l"  /* U+2097 */
+    "\001m"  /* U+2098 */
+    "\001n"  /* U+2099 */
+    "\001p"  /* U+209A */
+    "\001s"  /* U+209B */
+    "\001t"  /* U+209C */
+    "\002Rs"  /* U+20A8 */
+    "\003KRW"  /* U+20A9 */
+    "\003ILS"  /* U+20AA */
+    "\003VND"  /* U+20AB */
+    "\003EUR"  /* U+20AC */
+    "\003UAH"  /* U+20B4 */
+    "\003INR"  /* U+20B9 */
+    "\003TRY"  /* U+20BA */
+    "\003RUB"  /* U+20BD */
+    "\003a/c"  /* U+2100 */
+    "\003a/s"  /* U+2101 */
+    "\001C"  /* U+2102 */
+    "\003c/o"  /* U+2105 */
+    "\003c/u"  /* U+2106 */
+    "\001g"  /* U+210A */
+    "\001H"  /* U+210B */
+    "\001H"  /* U+210C */
+    "\001H"  /* U+210D */
+    "\001h"  /* U+210E */
+    "\001h"  /* U+210F */
+    "\001I"  /* U+2110 */
+    "\001I"  /* U+2111 */
+    "\001L"  /* U+2112 */
+    "\001l"  /* U+2113 */
+    "\001N"  /* U+2115 */
+    "\002No"  /* U+2116 */
+    "\001P"  /* U+2119 */
+    "\001Q"  /* U+211A */
+    "\001R"  /* U+211B */
+    "\001R"  /* U+211C */
+    "\001R"  /* U+211D */
+    "\002SM"  /* U+2120 */
+    "\003TEL"  /* U+2121 */
+    "\004(TM)"  /* U+2122 */
+    "\001Z"  /* U+2124 */
+    "\001O"  /* U+2126 */
+    "\001Z"  /* U+2128 */
+    "\001K"  /* U+212A */
+    "\001A"  /* U+212B */
+    "\001B"  /* U+212C */
+    "\001C"  /* U+212D */
+    "\001e"  /* U+212F */
+    "\001E"  /* U+2130 */
+    "\001F"  /* U+2131 */
+    "\001M"  /* U+2133 */
+    "\001o"  /* U+2134 */
+    "\001i"  /* U+2139 */
+    "\003FAX"  /* U+213B */
+    "\001p"  /* U+213C */
+    "\001g"  /* U+213D */
+    "\001G"  /* U+213E */
+    "\001P"  /* U+213F */
+    "\001D"  /* U+2145 */
+    "\001d"  /* U+2146 */
+    "\001e"  /* U+2147 */
+    "\001i"  /* U+2148 */
+    "\001j"  /* U+2149 */
+    "\0031/7"  /* U+2150 */
+    "\0031/9"  /* U+2151 */
+    "\0041/10"  /* U+2152 */
+    "\0031/3"  /* U+2153 */
+    "\0032/3"  /* U+2154 */
+    "\0031/5"  /* U+2155 */
+    "\0032/5"  /* U+2156 */
+    "\0033/5"  /* U+2157 */
+    "\0034/5"  /* U+2158 */
+    "\0031/6"  /* U+2159 */
+    "\0035/6"  /* U+215A */
+    "\0031/8"  /* U+215B */
+    "\0033/8"  /* U+215C */
+    "\0035/8"  /* U+215D */
+    "\0037/8"  /* U+215E */
+    "\0021/"  /* U+215F */
+    "\001I"  /* U+2160 */
+    "\002II"  /* U+2161 */
+    "\003III"  /* U+2162 */
+    "\002IV"  /* U+2163 */
+    "\001V"  /* U+2164 */
+    "\002VI"  /* U+2165 */
+    "\003VII"  /* U+2166 */
+    "\004VIII"  /* U+2167 */
+    "\002IX"  /* U+2168 */
+    "\001X"  /* U+2169 */
+    "\002XI"  /* U+216A */
+    "\003XII"  /* U+216B */
+    "\001L"  /* U+216C */
+    "\001C"  /* U+216D */
+    "\001D"  /* U+216E */
+    "\001M"  /* U+216F */
+    "\001i"  /* U+2170 */
+    "\002ii"  /* U+2171 */
+    "\003iii"  /* U+2172 */
+    "\002iv"  /* U+2173 */
+    "\001v"  /* U+2174 */
+    "\002vi"  /* U+2175 */
+    "\003vii"  /* U+2176 */
+    "\004viii"  /* U+2177 */
+    "\002ix"  /* U+2178 */
+    "\001x"  /* U+2179 */
+    "\002xi"  /* U+217A */
+    "\003xii"  /* U+217B */
+    "\001l"  /* U+217C */
+    "\001c"  /* U+217D */
+    "\001d"  /* U+217E */
+    "\001m"  /* U+217F */
+    "\0030/3"  /* U+2189 */
+    "\002<-"  /* U+2190 */
+    "\002->"  /* U+2192 */
+    "\003<->"  /* U+2194 */
+    "\002<="  /* U+21D0 */
+    "\002=>"  /* U+21D2 */
+    "\003<=>"  /* U+21D4 */
+    "\001-"  /* U+2212 */
+    "\001~"  /* U+2248 */
+    "\002!="  /* U+2260 */
+    "\002<="  /* U+2264 */
+    "\002>="  /* U+2265 */
+    "\0011"  /* U+2460 */
+    "\0012"  /* U+2461 */
+    "\0013"  /* U+2462 */
+    "\0014"  /* U+2463 */
+    "\0015"  /* U+2464 */
+    "\0016"  /* U+2465 */
+    "\0017"  /* U+2466 */
+    "\0018"  /* U+2467 */
+    "\0019"  /* U+2468 */
+    "\00210"  /* U+2469 */
+    "\00211"  /* U+246A */
+    "\00212"  /* U+246B */
+    "\00213"  /* U+246C */
+    "\00214"  /* U+246D */
+    "\00215"  /* U+246E */
+    "\00216"  /* U+246F */
+    "\00217"  /* U+2470 */
+    "\00218"  /* U+2471 */
+    "\00219"  /* U+2472 */
+    "\00220"  /* U+2473 */
+    "\003(1)"  /* U+2474 */
+    "\003(2)"  /* U+2475 */
+    "\003(3)"  /* U+2476 */
+    "\003(4)"  /* U+2477 */
+    "\003(5)"  /* U+2478 */
+    "\003(6)"  /* U+2479 */
+    "\003(7)"  /* U+247A */
+    "\003(8)"  /* U+247B */
+    "\003(9)"  /* U+247C */
+    "\004(10)"  /* U+247D */
+    "\004(11)"  /* U+247E */
+    "\004(12)"  /* U+247F */
+    "\004(13)"  /* U+2480 */
+    "\004(14)"  /* U+2481 */
+    "\004(15)"  /* U+2482 */
+    "\004(16)"  /* U+2483 */
+    "\004(17)"  /* U+2484 */
+    "\004(18)"  /* U+2485 */
+    "\004(19)"  /* U+2486 */
+    "\004(20)"  /* U+2487 */
+    "\0021."  /* U+2488 */
+    "\0022."  /* U+2489 */
+    "\0023."  /* U+248A */
+    "\0024."  /* U+248B */
+    "\0025."  /* U+248C */
+    "\0026."  /* U+248D */
+    "\0027."  /* U+248E */
+    "\0028."  /* U+248F */
+    "\0029."  /* U+2490 */
+    "\00310."  /* U+2491 */
+    "\00311."  /* U+2492 */
+    "\00312."  /* U+2493 */
+    "\00313."  /* U+2494 */
+    "\00314."  /* U+2495 */
+    "\00315."  /* U+2496 */
+    "\00316."  /* U+2497 */
+    "\00317."  /* U+2498 */
+    "\00318."  /* U+2499 */
+    "\00319."  /* U+249A */
+    "\00320."  /* U+249B */
+    "\003(a)"  /* U+249C */
+    "\003(b)"  /* U+249D */
+    "\003(c)"  /* U+249E */
+    "\003(d)"  /* U+249F */
+    "\003(e)"  /* U+24A0 */
+    "\003(f)"  /* U+24A1 */
+    "\003(g)"  /* U+24A2 */
+    "\003(h)"  /* U+24A3 */
+    "\003(i)"  /* U+24A4 */
+    "\003(j)"  /* U+24A5 */
+    "\003(k)"  /* U+24A6 */
+    "\003(l)"  /* U+24A7 */
+    "\003(m)"  /* U+24A8 */
+    "\003(n)"  /* U+24A9 */
+    "\003(o)"  /* U+24AA */
+    "\003(p)"  /* U+24AB */
+    "\003(q)"  /* U+24AC */
+    "\003(r)"  /* U+24AD */
+    "\003(s)"  /* U+24AE */
+    "\003(t)"  /* U+24AF */
+    "\003(u)"  /* U+24B0 */
+    "\003(v)"  /* U+24B1 */
+    "\003(w)"  /* U+24B2 */
+    "\003(x)"  /* U+24B3 */
+    "\003(y)"  /* U+24B4 */
+    "\003(z)"  /* U+24B5 */
+    "\001A"  /* U+24B6 */
+    "\001B"  /* U+24B7 */
+    "\001C"  /* U+24B8 */
+    "\001D"  /* U+24B9 */
+    "\001E"  /* U+24BA */
+    "\001F"  /* U+24BB */
+    "\001G"  /* U+24BC */
+    "\001H"  /* U+24BD */
+    "\001I"  /* U+24BE */
+    "\001J"  /* U+24BF */
+    "\001K"  /* U+24C0 */
+    "\001L"  /* U+24C1 */
+    "\001M"  /* U+24C2 */
+    "\001N"  /* U+24C3 */
+    "\001O"  /* U+24C4 */
+    "\001P"  /* U+24C5 */
+    "\001Q"  /* U+24C6 */
+    "\001R"  /* U+24C7 */
+    "\001S"  /* U+24C8 */
+    "\001T"  /* U+24C9 */
+    "\001U"  /* U+24CA */
+    "\001V"  /* U+24CB */
+    "\001W"  /* U+24CC */
+    "\001X"  /* U+24CD */
+    "\001Y"  /* U+24CE */
+    "\001Z"  /* U+24CF */
+    "\001a"  /* U+24D0 */
+    "\001b"  /* U+24D1 */
+    "\001c"  /* U+24D2 */
+    "\001d"  /* U+24D3 */
+    "\001e"  /* U+24D4 */
+    "\001f"  /* U+24D5 */
+    "\001g"  /* U+24D6 */
+    "\001h"  /* U+24D7 */
+    "\001i"  /* U+24D8 */
+    "\001j"  /* U+24D9 */
+    "\001k"  /* U+24DA */
+    "\001l"  /* U+24DB */
+    "\001m"  /* U+24DC */
+    "\001n"  /* U+24DD */
+    "\001o"  /* U+24DE */
+    "\001p"  /* U+24DF */
+    "\001q"  /* U+24E0 */
+    "\001r"  /* U+24E1 */
+    "\001s"  /* U+24E2 */
+    "\001t"  /* U+24E3 */
+    "\001u"  /* U+24E4 */
+    "\001v"  /* U+24E5 */
+    "\001w"  /* U+24E6 */
+    "\001x"  /* U+24E7 */
+    "\001y"  /* U+24E8 */
+    "\001z"  /* U+24E9 */
+    "\0010"  /* U+24EA */
+    "\003::="  /* U+2A74 */
+    "\002=="  /* U+2A75 */
+    "\003==="  /* U+2A76 */
+    "\001j"  /* U+2C7C */
+    "\001V"  /* U+2C7D */
+    "\001 "  /* U+3000 */
+    "\003PTE"  /* U+3250 */
+    "\00221"  /* U+3251 */
+    "\00222"  /* U+3252 */
+    "\00223"  /* U+3253 */
+    "\00224"  /* U+3254 */
+    "\00225"  /* U+3255 */
+    "\00226"  /* U+3256 */
+    "\00227"  /* U+3257 */
+    "\00228"  /* U+3258 */
+    "\00229"  /* U+3259 */
+    "\00230"  /* U+325A */
+    "\00231"  /* U+325B */
+    "\00232"  /* U+325C */
+    "\00233"  /* U+325D */
+    "\00234"  /* U+325E */
+    "\00235"  /* U+325F */
+    "\00236"  /* U+32B1 */
+    "\00237"  /* U+32B2 */
+    "\00238"  /* U+32B3 */
+    "\00239"  /* U+32B4 */
+    "\00240"  /* U+32B5 */
+    "\00241"  /* U+32B6 */
+    "\00242"  /* U+32B7 */
+    "\00243"  /* U+32B8 */
+    "\00244"  /* U+32B9 */
+    "\00245"  /* U+32BA */
+    "\00246"  /* U+32BB */
+    "\00247"  /* U+32BC */
+    "\00248"  /* U+32BD */
+    "\00249"  /* U+32BE */
+    "\00250"  /* U+32BF */
+    "\002Hg"  /* U+32CC */
+    "\003erg"  /* U+32CD */
+    "\002eV"  /* U+32CE */
+    "\003LTD"  /* U+32CF */
+    "\003hPa"  /* U+3371 */
+    "\002da"  /* U+3372 */
+    "\002AU"  /* U+3373 */
+    "\003bar"  /* U+3374 */
+    "\002oV"  /* U+3375 */
+    "\002pc"  /* U+3376 */
+    "\002dm"  /* U+3377 */
+    "\003dm2"  /* U+3378 */
+    "\003dm3"  /* U+3379 */
+    "\002IU"  /* U+337A */
+    "\002pA"  /* U+3380 */
+    "\002nA"  /* U+3381 */
+    "\002mA"  /* U+3382 */
+    "\002mA"  /* U+3383 */
+    "\002kA"  /* U+3384 */
+    "\002KB"  /* U+3385 */
+    "\002MB"  /* U+3386 */
+    "\002GB"  /* U+3387 */
+    "\003cal"  /* U+3388 */
+    "\004kcal"  /* U+3389 */
+    "\002pF"  /* U+338A */
+    "\002nF"  /* U+338B */
+    "\002mF"  /* U+338C */
+    "\002mg"  /* U+338D */
+    "\002mg"  /* U+338E */
+    "\002kg"  /* U+338F */
+    "\002Hz"  /* U+3390 */
+    "\003kHz"  /* U+3391 */
+    "\003MHz"  /* U+3392 */
+    "\003GHz"  /* U+3393 */
+    "\003THz"  /* U+3394 */
+    "\002ml"  /* U+3395 */
+    "\002ml"  /* U+3396 */
+    "\002dl"  /* U+3397 */
+    "\002kl"  /* U+3398 */
+    "\002fm"  /* U+3399 */
+    "\002nm"  /* U+339A */
+    "\002mm"  /* U+339B */
+    "\002mm"  /* U+339C */
+    "\002cm"  /* U+339D */
+    "\002km"  /* U+339E */
+    "\003mm2"  /* U+339F */
+    "\003cm2"  /* U+33A0 */
+    "\002m2"  /* U+33A1 */
+    "\003km2"  /* U+33A2 */
+    "\003mm3"  /* U+33A3 */
+    "\003cm3"  /* U+33A4 */
+    "\002m3"  /* U+33A5 */
+    "\003km3"  /* U+33A6 */
+    "\002Pa"  /* U+33A9 */
+    "\003kPa"  /* U+33AA */
+    "\003MPa"  /* U+33AB */
+    "\003GPa"  /* U+33AC */
+    "\003rad"  /* U+33AD */
+    "\002ps"  /* U+33B0 */
+    "\002ns"  /* U+33B1 */
+    "\002ms"  /* U+33B2 */
+    "\002ms"  /* U+33B3 */
+    "\002pV"  /* U+33B4 */
+    "\002nV"  /* U+33B5 */
+    "\002mV"  /* U+33B6 */
+    "\002mV"  /* U+33B7 */
+    "\002kV"  /* U+33B8 */
+    "\002MV"  /* U+33B9 */
+    "\002pW"  /* U+33BA */
+    "\002nW"  /* U+33BB */
+    "\002mW"  /* U+33BC */
+    "\002mW"  /* U+33BD */
+    "\002kW"  /* U+33BE */
+    "\002MW"  /* U+33BF */
+    "\002kO"  /* U+33C0 */
+    "\002MO"  /* U+33C1 */
+    "\004a.m."  /* U+33C2 */
+    "\002Bq"  /* U+33C3 */
+    "\002cc"  /* U+33C4 */
+    "\002cd"  /* U+33C5 */
+    "\003Co."  /* U+33C7 */
+    "\002dB"  /* U+33C8 */
+    "\002Gy"  /* U+33C9 */
+    "\002ha"  /* U+33CA */
+    "\002HP"  /* U+33CB */
+    "\002in"  /* U+33CC */
+    "\002KK"  /* U+33CD */
+    "\002KM"  /* U+33CE */
+    "\002kt"  /* U+33CF */
+    "\002lm"  /* U+33D0 */
+    "\002ln"  /* U+33D1 */
+    "\003log"  /* U+33D2 */
+    "\002lx"  /* U+33D3 */
+    "\002mb"  /* U+33D4 */
+    "\003mil"  /* U+33D5 */
+    "\003mol"  /* U+33D6 */
+    "\002PH"  /* U+33D7 */
+    "\004p.m."  /* U+33D8 */
+    "\003PPM"  /* U+33D9 */
+    "\002PR"  /* U+33DA */
+    "\002sr"  /* U+33DB */
+    "\002Sv"  /* U+33DC */
+    "\002Wb"  /* U+33DD */
+    "\003gal"  /* U+33FF */
+    "\001\""  /* U+A69C */
+    "\001'"  /* U+A69D */
+    "\001C"  /* U+A7F2 */
+    "\001F"  /* U+A7F3 */
+    "\001Q"  /* U+A7F4 */
+    "\001H"  /* U+A7F8 */
+    "\002oe"  /* U+A7F9 */
+    "\002ff"  /* U+FB00 */
+    "\002fi"  /* U+FB01 */
+    "\002fl"  /* U+FB02 */
+    "\003ffi"  /* U+FB03 */
+    "\003ffl"  /* U+FB04 */
+    "\002st"  /* U+FB05 */
+    "\002st"  /* U+FB06 */
+    "\001+"  /* U+FB29 */
+    "\001,"  /* U+FE10 */
+    "\001:"  /* U+FE13 */
+    "\001;"  /* U+FE14 */
+    "\001!"  /* U+FE15 */
+    "\001\?"  /* U+FE16 */
+    "\003..."  /* U+FE19 */
+    "\002.."  /* U+FE30 */
+    "\002--"  /* U+FE31 */
+    "\001-"  /* U+FE32 */
+    "\001_"  /* U+FE33 */
+    "\001_"  /* U+FE34 */
+    "\001("  /* U+FE35 */
+    "\001)"  /* U+FE36 */
+    "\001{"  /* U+FE37 */
+    "\001}"  /* U+FE38 */
+    "\001["  /* U+FE47 */
+    "\001]"  /* U+FE48 */
+    "\001_"  /* U+FE4D */
+    "\001_"  /* U+FE4E */
+    "\001_"  /* U+FE4F */
+    "\001,"  /* U+FE50 */
+    "\001."  /* U+FE52 */
+    "\001;"  /* U+FE54 */
+    "\001:"  /* U+FE55 */
+    "\001\?"  /* U+FE56 */
+    "\001!"  /* U+FE57 */
+    "\002--"  /* U+FE58 */
+    "\001("  /* U+FE59 */
+    "\001)"  /* U+FE5A */
+    "\001{"  /* U+FE5B */
+    "\001}"  /* U+FE5C */
+    "\001#"  /* U+FE5F */
+    "\001&"  /* U+FE60 */
+    "\001*"  /* U+FE61 */
+    "\001+"  /* U+FE62 */
+    "\001-"  /* U+FE63 */
+    "\001<"  /* U+FE64 */
+    "\001>"  /* U+FE65 */
+    "\001="  /* U+FE66 */
+    "\001\\"  /* U+FE68 */
+    "\001$"  /* U+FE69 */
+    "\001%"  /* U+FE6A */
+    "\001@"  /* U+FE6B */
+    "\001!"  /* U+FF01 */
+    "\001\""  /* U+FF02 */
+    "\001#"  /* U+FF03 */
+    "\001$"  /* U+FF04 */
+    "\001%"  /* U+FF05 */
+    "\001&"  /* U+FF06 */
+    "\001'"  /* U+FF07 */
+    "\001("  /* U+FF08 */
+    "\001)"  /* U+FF09 */
+    "\001*"  /* U+FF0A */
+    "\001+"  /* U+FF0B */
+    "\001,"  /* U+FF0C */
+    "\001-"  /* U+FF0D */
+    "\001."  /* U+FF0E */
+    "\001/"  /* U+FF0F */
+    "\0010"  /* U+FF10 */
+    "\0011"  /* U+FF11 */
+    "\0012"  /* U+FF12 */
+    "\0013"  /* U+FF13 */
+    "\0014"  /* U+FF14 */
+    "\0015"  /* U+FF15 */
+    "\0016"  /* U+FF16 */
+    "\0017"  /* U+FF17 */
+    "\0018"  /* U+FF18 */
+    "\0019"  /* U+FF19 */
+    "\001:"  /* U+FF1A */
+    "\001;"  /* U+FF1B */
+    "\001<"  /* U+FF1C */
+    "\001="  /* U+FF1D */
+    "\001>"  /* U+FF1E */
+    "\001\?"  /* U+FF1F */
+    "\001@"  /* U+FF20 */
+    "\001A"  /* U+FF21 */
+    "\001B"  /* U+FF22 */
+    "\001C"  /* U+FF23 */
+    "\001D"  /* U+FF24 */
+    "\001E"  /* U+FF25 */
+    "\001F"  /* U+FF26 */
+    "\001G"  /* U+FF27 */
+    "\001H"  /* U+FF28 */
+    "\001I"  /* U+FF29 */
+    "\001J"  /* U+FF2A */
+    "\001K"  /* U+FF2B */
+    "\001L"  /* U+FF2C */
+    "\001M"  /* U+FF2D */
+    "\001N"  /* U+FF2E */
+    "\001O"  /* U+FF2F */
+    "\001P"  /* U+FF30 */
+    "\001Q"  /* U+FF31 */
+    "\001R"  /* U+FF32 */
+    "\001S"  /* U+FF33 */
+    "\001T"  /* U+FF34 */
+    "\001U"  /* U+FF35 */
+    "\001V"  /* U+FF36 */
+    "\001W"  /* U+FF37 */
+    "\001X"  /* U+FF38 */
+    "\001Y"  /* U+FF39 */
+    "\001Z"  /* U+FF3A */
+    "\001["  /* U+FF3B */
+    "\001\\"  /* U+FF3C */
+    "\001]"  /* U+FF3D */
+    "\001^"  /* U+FF3E */
+    "\001_"  /* U+FF3F */
+    "\001`"  /* U+FF40 */
+    "\001a"  /* U+FF41 */
+    "\001b"  /* U+FF42 */
+    "\001c"  /* U+FF43 */
+    "\001d"  /* U+FF44 */
+    "\001e"  /* U+FF45 */
+    "\001f"  /* U+FF46 */
+    "\001g"  /* U+FF47 */
+    "\001h"  /* U+FF48 */
+    "\001i"  /* U+FF49 */
+    "\001j"  /* U+FF4A */
+    "\001k"  /* U+FF4B */
+    "\001l"  /* U+FF4C */
+    "\001m"  /* U+FF4D */
+    "\001n"  /* U+FF4E */
+    "\001o"  /* U+FF4F */
+    "\001p"  /* U+FF50 */
+    "\001q"  /* U+FF51 */
+    "\001r"  /* U+FF52 */
+    "\001s"  /* U+FF53 */
+    "\001t"  /* U+FF54 */
+    "\001u"  /* U+FF55 */
+    "\001v"  /* U+FF56 */
+    "\001w"  /* U+FF57 */
+    "\001x"  /* U+FF58 */
+    "\001y"  /* U+FF59 */
+    "\001z"  /* U+FF5A */
+    "\001{"  /* U+FF5B */
+    "\001|"  /* U+FF5C */
+    "\001}"  /* U+FF5D */
+    "\001~"  /* U+FF5E */
+    "\001c"  /* U+FFE0 */
+    "\003GBP"  /* U+FFE1 */
+    "\003JPY"  /* U+FFE5 */
+    "\003KRW"  /* U+FFE6 */
+    "\002<-"  /* U+FFE9 */
+    "\002->"  /* U+FFEB */
+    "\002ae"  /* U+10783 */
+    "\001h"  /* U+10795 */
+    "\001o"  /* U+107A2 */
+    "\001q"  /* U+107A5 */
+    "\001A"  /* U+1D400 */
+    "\001B"  /* U+1D401 */
+    "\001C"  /* U+1D402 */
+    "\001D"  /* U+1D403 */
+    "\001E"  /* U+1D404 */
+    "\001F"  /* U+1D405 */
+    "\001G"  /* U+1D406 */
+    "\001H"  /* U+1D407 */
+    "\001I"  /* U+1D408 */
+    "\001J"  /* U+1D409 */
+    "\001K"  /* U+1D40A */
+    "\001L"  /* U+1D40B */
+    "\001M"  /* U+1D40C */
+    "\001N"  /* U+1D40D */
+    "\001O"  /* U+1D40E */
+    "\001P"  /* U+1D40F */
+    "\001Q"  /* U+1D410 */
+    "\001R"  /* U+1D411 */
+    "\001S"  /* U+1D412 */
+    "\001T"  /* U+1D413 */
+    "\001U"  /* U+1D414 */
+    "\001V"  /* U+1D415 */
+    "\001W"  /* U+1D416 */
+    "\001X"  /* U+1D417 */
+    "\001Y"  /* U+1D418 */
+    "\001Z"  /* U+1D419 */
+    "\001a"  /* U+1D41A */
+    "\001b"  /* U+1D41B */
+    "\001c"  /* U+1D41C */
+    "\001d"  /* U+1D41D */
+    "\001e"  /* U+1D41E */
+    "\001f"  /* U+1D41F */
+    "\001g"  /* U+1D420 */
+    "\001h"  /* U+1D421 */
+    "\001i"  /* U+1D422 */
+    "\001j"  /* U+1D423 */
+    "\001k"  /* U+1D424 */
+    "\001l"  /* U+1D425 */
+    "\001m"  /* U+1D426 */
+    "\001n"  /* U+1D427 */
+    "\001o"  /* U+1D428 */
+    "\001p"  /* U+1D429 */
+    "\001q"  /* U+1D42A */
+    "\001r"  /* U+1D42B */
+    "\001s"  /* U+1D42C */
+    "\001t"  /* U+1D42D */
+    "\001u"  /* U+1D42E */
+    "\001v"  /* U+1D42F */
+    "\001w"  /* U+1D430 */
+    "\001x"  /* U+1D431 */
+    "\001y"  /* U+1D432 */
+    "\001z"  /* U+1D433 */
+    "\001A"  /* U+1D434 */
+    "\001B"  /* U+1D435 */
+    "\001C"  /* U+1D436 */
+    "\001D"  /* U+1D437 */
+    "\001E"  /* U+1D438 */
+    "\001F"  /* U+1D439 */
+    "\001G"  /* U+1D43A */
+    "\001H"  /* U+1D43B */
+    "\001I"  /* U+1D43C */
+    "\001J"  /* U+1D43D */
+    "\001K"  /* U+1D43E */
+    "\001L"  /* U+1D43F */
+    "\001M"  /* U+1D440 */
+    "\001N"  /* U+1D441 */
+    "\001O"  /* U+1D442 */
+    "\001P"  /* U+1D443 */
+    "\001Q"  /* U+1D444 */
+    "\001R"  /* U+1D445 */
+    "\001S"  /* U+1D446 */
+    "\001T"  /* U+1D447 */
+    "\001U"  /* U+1D448 */
+    "\001V"  /* U+1D449 */
+    "\001W"  /* U+1D44A */
+    "\001X"  /* U+1D44B */
+    "\001Y"  /* U+1D44C */
+    "\001Z"  /* U+1D44D */
+    "\001a"  /* U+1D44E */
+    "\001b"  /* U+1D44F */
+    "\001c"  /* U+1D450 */
+    "\001d"  /* U+1D451 */
+    "\001e"  /* U+1D452 */
+    "\001f"  /* U+1D453 */
+    "\001g"  /* U+1D454 */
+    "\001i"  /* U+1D456 */
+    "\001j"  /* U+1D457 */
+    "\001k"  /* U+1D458 */
+    "\001l"  /* U+1D459 */
+    "\001m"  /* U+1D45A */
+    "\001n"  /* U+1D45B */
+    "\001o"  /* U+1D45C */
+    "\001p"  /* U+1D45D */
+    "\001q"  /* U+1D45E */
+    "\001r"  /* U+1D45F */
+    "\001s"  /* U+1D460 */
+    "\001t"  /* U+1D461 */
+    "\001u"  /* U+1D462 */
+    "\001v"  /* U+1D463 */
+    "\001w"  /* U+1D464 */
+    "\001x"  /* U+1D465 */
+    "\001y"  /* U+1D466 */
+    "\001z"  /* U+1D467 */
+    "\001A"  /* U+1D468 */
+    "\001B"  /* U+1D469 */
+    "\001C"  /* U+1D46A */
+    "\001D"  /* U+1D46B */
+    "\001E"  /* U+1D46C */
+    "\001F"  /* U+1D46D */
+    "\001G"  /* U+1D46E */
+    "\001H"  /* U+1D46F */
+    "\001I"  /* U+1D470 */
+    "\001J"  /* U+1D471 */
+    "\001K"  /* U+1D472 */
+    "\001L"  /* U+1D473 */
+    "\001M"  /* U+1D474 */
+    "\001N"  /* U+1D475 */
+    "\001O"  /* U+1D476 */
+    "\001P"  /* U+1D477 */
+    "\001Q"  /* U+1D478 */
+    "\001R"  /* U+1D479 */
+    "\001S"  /* U+1D47A */
+    "\001T"  /* U+1D47B */
+    "\001U"  /* U+1D47C */
+    "\001V"  /* U+1D47D */
+    "\001W"  /* U+1D47E */
+    "\001X"  /* U+1D47F */
+    "\001Y"  /* U+1D480 */
+    "\001Z"  /* U+1D481 */
+    "\001a"  /* U+1D482 */
+    "\001b"  /* U+1D483 */
+    "\001c"  /* U+1D484 */
+    "\001d"  /* U+1D485 */
+    "\001e"  /* U+1D486 */
+    "\001f"  /* U+1D487 */
+    "\001g"  /* U+1D488 */
+    "\001h"  /* U+1D489 */
+    "\001i"  /* U+1D48A */
+    "\001j"  /* U+1D48B */
+    "\001k"  /* U+1D48C */
+    "\001l"  /* U+1D48D */
+    "\001m"  /* U+1D48E */
+    "\001n"  /* U+1D48F */
+    "\001o"  /* U+1D490 */
+    "\001p"  /* U+1D491 */
+    "\001q"  /* U+1D492 */
+    "\001r"  /* U+1D493 */
+    "\001s"  /* U+1D494 */
+    "\001t"  /* U+1D495 */
+    "\001u"  /* U+1D496 */
+    "\001v"  /* U+1D497 */
+    "\001w"  /* U+1D498 */
+    "\001x"  /* U+1D499 */
+    "\001y"  /* U+1D49A */
+    "\001z"  /* U+1D49B */
+    "\001A"  /* U+1D49C */
+    "\001C"  /* U+1D49E */
+    "\001D"  /* U+1D49F */
+    "\001G"  /* U+1D4A2 */
+    "\001J"  /* U+1D4A5 */
+    "\001K"  /* U+1D4A6 */
+    "\001N"  /* U+1D4A9 */
+    "\001O"  /* U+1D4AA */
+    "\001P"  /* U+1D4AB */
+    "\001Q"  /* U+1D4AC */
+    "\001S"  /* U+1D4AE */
+    "\001T"  /* U+1D4AF */
+    "\001U"  /* U+1D4B0 */
+    "\001V"  /* U+1D4B1 */
+    "\001W"  /* U+1D4B2 */
+    "\001X"  /* U+1D4B3 */
+    "\001Y"  /* U+1D4B4 */
+    "\001Z"  /* U+1D4B5 */
+    "\001a"  /* U+1D4B6 */
+    "\001b"  /* U+1D4B7 */
+    "\001c"  /* U+1D4B8 */
+    "\001d"  /* U+1D4B9 */
+    "\001f"  /* U+1D4BB */
+    "\001h"  /* U+1D4BD */
+    "\001i"  /* U+1D4BE */
+    "\001j"  /* U+1D4BF */
+    "\001k"  /* U+1D4C0 */
+    "\001l"  /* U+1D4C1 */
+    "\001m"  /* U+1D4C2 */
+    "\001n"  /* U+1D4C3 */
+    "\001p"  /* U+1D4C5 */
+    "\001q"  /* U+1D4C6 */
+    "\001r"  /* U+1D4C7 */
+    "\001s"  /* U+1D4C8 */
+    "\001t"  /* U+1D4C9 */
+    "\001u"  /* U+1D4CA */
+    "\001v"  /* U+1D4CB */
+    "\001w"  /* U+1D4CC */
+    "\001x"  /* U+1D4CD */
+    "\001y"  /* U+1D4CE */
+    "\001z"  /* U+1D4CF */
+    "\001A"  /* U+1D4D0 */
+    "\001B"  /* U+1D4D1 */
+    "\001C"  /* U+1D4D2 */
+    "\001D"  /* U+1D4D3 */
+    "\001E"  /* U+1D4D4 */
+    "\001F"  /* U+1D4D5 */
+    "\001G"  /* U+1D4D6 */
+    "\001H"  /* U+1D4D7 */
+    "\001I"  /* U+1D4D8 */
+    "\001J"  /* U+1D4D9 */
+    "\001K"  /* U+1D4DA */
+    "\001L"  /* U+1D4DB */
+    "\001M"  /* U+1D4DC */
+    "\001N"  /* U+1D4DD */
+    "\001O"  /* U+1D4DE */
+    "\001P"  /* U+1D4DF */
+    "\001Q"  /* U+1D4E0 */
+    "\001R"  /* U+1D4E1 */
+    "\001S"  /* U+1D4E2 */
+    "\001T"  /* U+1D4E3 */
+    "\001U"  /* U+1D4E4 */
+    "\001V"  /* U+1D4E5 */
+    "\001W"  /* U+1D4E6 */
+    "\001X"  /* U+1D4E7 */
+    "\001Y"  /* U+1D4E8 */
+    "\001Z"  /* U+1D4E9 */
+    "\001a"  /* U+1D4EA */
+    "\001b"  /* U+1D4EB */
+    "\001c"  /* U+1D4EC */
+    "\001d"  /* U+1D4ED */
+    "\001e"  /* U+1D4EE */
+    "\001f"  /* U+1D4EF */
+    "\001g"  /* U+1D4F0 */
+    "\001h"  /* U+1D4F1 */
+    "\001i"  /* U+1D4F2 */
+    "\001j"  /* U+1D4F3 */
+    "\001k"  /* U+1D4F4 */
+    "\001l"  /* U+1D4F5 */
+    "\001m"  /* U+1D4F6 */
+    "\001n"  /* U+1D4F7 */
+    "\001o"  /* U+1D4F8 */
+    "\001p"  /* U+1D4F9 */
+    "\001q"  /* U+1D4FA */
+    "\001r"  /* U+1D4FB */
+    "\001s"  /* U+1D4FC */
+    "\001t"  /* U+1D4FD */
+    "\001u"  /* U+1D4FE */
+    "\001v"  /* U+1D4FF */
+    "\001w"  /* U+1D500 */
+    "\001x"  /* U+1D501 */
+    "\001y"  /* U+1D502 */
+    "\001z"  /* U+1D503 */
+    "\001A"  /* U+1D504 */
+    "\001B"  /* U+1D505 */
+    "\001D"  /* U+1D507 */
+    "\001E"  /* U+1D508 */
+    "\001F"  /* U+1D509 */
+    "\001G"  /* U+1D50A */
+    "\001J"  /* U+1D50D */
+    "\001K"  /* U+1D50E */
+    "\001L"  /* U+1D50F */
+    "\001M"  /* U+1D510 */
+    "\001N"  /* U+1D511 */
+    "\001O"  /* U+1D512 */
+    "\001P"  /* U+1D513 */
+    "\001Q"  /* U+1D514 */
+    "\001S"  /* U+1D516 */
+    "\001T"  /* U+1D517 */
+    "\001U"  /* U+1D518 */
+    "\001V"  /* U+1D519 */
+    "\001W"  /* U+1D51A */
+    "\001X"  /* U+1D51B */
+    "\001Y"  /* U+1D51C */
+    "\001a"  /* U+1D51E */
+    "\001b"  /* U+1D51F */
+    "\001c"  /* U+1D520 */
+    "\001d"  /* U+1D521 */
+    "\001e"  /* U+1D522 */
+    "\001f"  /* U+1D523 */
+    "\001g"  /* U+1D524 */
+    "\001h"  /* U+1D525 */
+    "\001i"  /* U+1D526 */
+    "\001j"  /* U+1D527 */
+    "\001k"  /* U+1D528 */
+    "\001l"  /* U+1D529 */
+    "\001m"  /* U+1D52A */
+    "\001n"  /* U+1D52B */
+    "\001o"  /* U+1D52C */
+    "\001p"  /* U+1D52D */
+    "\001q"  /* U+1D52E */
+    "\001r"  /* U+1D52F */
+    "\001s"  /* U+1D530 */
+    "\001t"  /* U+1D531 */
+    "\001u"  /* U+1D532 */
+    "\001v"  /* U+1D533 */
+    "\001w"  /* U+1D534 */
+    "\001x"  /* U+1D535 */
+    "\001y"  /* U+1D536 */
+    "\001z"  /* U+1D537 */
+    "\001A"  /* U+1D538 */
+    "\001B"  /* U+1D539 */
+    "\001D"  /* U+1D53B */
+    "\001E"  /* U+1D53C */
+    "\001F"  /* U+1D53D */
+    "\001G"  /* U+1D53E */
+    "\001I"  /* U+1D540 */
+    "\001J"  /* U+1D541 */
+    "\001K"  /* U+1D542 */
+    "\001L"  /* U+1D543 */
+    "\001M"  /* U+1D544 */
+    "\001O"  /* U+1D546 */
+    "\001S"  /* U+1D54A */
+    "\001T"  /* U+1D54B */
+    "\001U"  /* U+1D54C */
+    "\001V"  /* U+1D54D */
+    "\001W"  /* U+1D54E */
+    "\001X"  /* U+1D54F */
+    "\001Y"  /* U+1D550 */
+    "\001a"  /* U+1D552 */
+    "\001b"  /* U+1D553 */
+    "\001c"  /* U+1D554 */
+    "\001d"  /* U+1D555 */
+    "\001e"  /* U+1D556 */
+    "\001f"  /* U+1D557 */
+    "\001g"  /* U+1D558 */
+    "\001h"  /* U+1D559 */
+    "\001i"  /* U+1D55A */
+    "\001j"  /* U+1D55B */
+    "\001k"  /* U+1D55C */
+    "\001l"  /* U+1D55D */
+    "\001m"  /* U+1D55E */
+    "\001n"  /* U+1D55F */
+    "\001o"  /* U+1D560 */
+    "\001p"  /* U+1D561 */
+    "\001q"  /* U+1D562 */
+    "\001r"  /* U+1D563 */
+    "\001s"  /* U+1D564 */
+    "\001t"  /* U+1D565 */
+    "\001u"  /* U+1D566 */
+    "\001v"  /* U+1D567 */
+    "\001w"  /* U+1D568 */
+    "\001x"  /* U+1D569 */
+    "\001y"  /* U+1D56A */
+    "\001z"  /* U+1D56B */
+    "\001A"  /* U+1D56C */
+    "\001B"  /* U+1D56D */
+    "\001C"  /* U+1D56E */
+    "\001D"  /* U+1D56F */
+    "\001E"  /* U+1D570 */
+    "\001F"  /* U+1D571 */
+    "\001G"  /* U+1D572 */
+    "\001H"  /* U+1D573 */
+    "\001I"  /* U+1D574 */
+    "\001J"  /* U+1D575 */
+    "\001K"  /* U+1D576 */
+    "\001L"  /* U+1D577 */
+    "\001M"  /* U+1D578 */
+    "\001N"  /* U+1D579 */
+    "\001O"  /* U+1D57A */
+    "\001P"  /* U+1D57B */
+    "\001Q"  /* U+1D57C */
+    "\001R"  /* U+1D57D */
+    "\001S"  /* U+1D57E */
+    "\001T"  /* U+1D57F */
+    "\001U"  /* U+1D580 */
+    "\001V"  /* U+1D581 */
+    "\001W"  /* U+1D582 */
+    "\001X"  /* U+1D583 */
+    "\001Y"  /* U+1D584 */
+    "\001Z"  /* U+1D585 */
+    "\001a"  /* U+1D586 */
+    "\001b"  /* U+1D587 */
+    "\001c"  /* U+1D588 */
+    "\001d"  /* U+1D589 */
+    "\001e"  /* U+1D58A */
+    "\001f"  /* U+1D58B */
+    "\001g"  /* U+1D58C */
+    "\001h"  /* U+1D58D */
+    "\001i"  /* U+1D58E */
+    "\001j"  /* U+1D58F */
+    "\001k"  /* U+1D590 */
+    "\001l"  /* U+1D591 */
+    "\001m"  /* U+1D592 */
+    "\001n"  /* U+1D593 */
+    "\001o"  /* U+1D594 */
+    "\001p"  /* U+1D595 */
+    "\001q"  /* U+1D596 */
+    "\001r"  /* U+1D597 */
+    "\001s"  /* U+1D598 */
+    "\001t"  /* U+1D599 */
+    "\001u"  /* U+1D59A */
+    "\001v"  /* U+1D59B */
+    "\001w"  /* U+1D59C */
+    "\001x"  /* U+1D59D */
+    "\001y"  /* U+1D59E */
+    "\001z"  /* U+1D59F */
+    "\001A"  /* U+1D5A0 */
+    "\001B"  /* U+1D5A1 */
+    "\001C"  /* U+1D5A2 */
+    "\001D"  /* U+1D5A3 */
+    "\001E"  /* U+1D5A4 */
+    "\001F"  /* U+1D5A5 */
+    "\001G"  /* U+1D5A6 */
+    "\001H"  /* U+1D5A7 */
+    "\001I"  /* U+1D5A8 */
+    "\001J"  /* U+1D5A9 */
+    "\001K"  /* U+1D5AA */
+    "\001L"  /* U+1D5AB */
+    "\001M"  /* U+1D5AC */
+    "\001N"  /* U+1D5AD */
+    "\001O"  /* U+1D5AE */
+    "\001P"  /* U+1D5AF */
+    "\001Q"  /* U+1D5B0 */
+    "\001R"  /* U+1D5B1 */
+    "\001S"  /* U+1D5B2 */
+    "\001T"  /* U+1D5B3 */
+    "\001U"  /* U+1D5B4 */
+    "\001V"  /* U+1D5B5 */
+    "\001W"  /* U+1D5B6 */
+    "\001X"  /* U+1D5B7 */
+    "\001Y"  /* U+1D5B8 */
+    "\001Z"  /* U+1D5B9 */
+    "\001a"  /* U+1D5BA */
+    "\001b"  /* U+1D5BB */
+    "\001c"  /* U+1D5BC */
+    "\001d"  /* U+1D5BD */
+    "\001e"  /* U+1D5BE */
+    "\001f"  /* U+1D5BF */
+    "\001g"  /* U+1D5C0 */
+    "\001h"  /* U+1D5C1 */
+    "\001i"  /* U+1D5C2 */
+    "\001j"  /* U+1D5C3 */
+    "\001k"  /* U+1D5C4 */
+    "\001l"  /* U+1D5C5 */
+    "\001m"  /* U+1D5C6 */
+    "\001n"  /* U+1D5C7 */
+    "\001o"  /* U+1D5C8 */
+    "\001p"  /* U+1D5C9 */
+    "\001q"  /* U+1D5CA */
+    "\001r"  /* U+1D5CB */
+    "\001s"  /* U+1D5CC */
+    "\001t"  /* U+1D5CD */
+    "\001u"  /* U+1D5CE */
+    "\001v"  /* U+1D5CF */
+    "\001w"  /* U+1D5D0 */
+    "\001x"  /* U+1D5D1 */
+    "\001y"  /* U+1D5D2 */
+    "\001z"  /* U+1D5D3 */
+    "\001A"  /* U+1D5D4 */
+    "\001B"  /* U+1D5D5 */
+    "\001C"  /* U+1D5D6 */
+    "\001D"  /* U+1D5D7 */
+    "\001E"  /* U+1D5D8 */
+    "\001F"  /* U+1D5D9 */
+    "\001G"  /* U+1D5DA */
+    "\001H"  /* U+1D5DB */
+    "\001I"  /* U+1D5DC */
+    "\001J"  /* U+1D5DD */
+    "\001K"  /* U+1D5DE */
+    "\001L"  /* U+1D5DF */
+    "\001M"  /* U+1D5E0 */
+    "\001N"  /* U+1D5E1 */
+    "\001O"  /* U+1D5E2 */
+    "\001P"  /* U+1D5E3 */
+    "\001Q"  /* U+1D5E4 */
+    "\001R"  /* U+1D5E5 */
+    "\001S"  /* U+1D5E6 */
+    "\001T"  /* U+1D5E7 */
+    "\001U"  /* U+1D5E8 */
+    "\001V"  /* U+1D5E9 */
+    "\001W"  /* U+1D5EA */
+    "\001X"  /* U+1D5EB */
+    "\001Y"  /* U+1D5EC */
+    "\001Z"  /* U+1D5ED */
+    "\001a"  /* U+1D5EE */
+    "\001b"  /* U+1D5EF */
+    "\001c"  /* U+1D5F0 */
+    "\001d"  /* U+1D5F1 */
+    "\001e"  /* U+1D5F2 */
+    "\001f"  /* U+1D5F3 */
+    "\001g"  /* U+1D5F4 */
+    "\001h"  /* U+1D5F5 */
+    "\001i"  /* U+1D5F6 */
+    "\001j"  /* U+1D5F7 */
+    "\001k"  /* U+1D5F8 */
+    "\001l"  /* U+1D5F9 */
+    "\001m"  /* U+1D5FA */
+    "\001n"  /* U+1D5FB */
+    "\001o"  /* U+1D5FC */
+    "\001p"  /* U+1D5FD */
+    "\001q"  /* U+1D5FE */
+    "\001r"  /* U+1D5FF */
+    "\001s"  /* U+1D600 */
+    "\001t"  /* U+1D601 */
+    "\001u"  /* U+1D602 */
+    "\001v"  /* U+1D603 */
+    "\001w"  /* U+1D604 */
+    "\001x"  /* U+1D605 */
+    "\001y"  /* U+1D606 */
+    "\001z"  /* U+1D607 */
+    "\001A"  /* U+1D608 */
+    "\001B"  /* U+1D609 */
+    "\001C"  /* U+1D60A */
+    "\001D"  /* U+1D60B */
+    "\001E"  /* U+1D60C */
+    "\001F"  /* U+1D60D */
+    "\001G"  /* U+1D60E */
+    "\001H"  /* U+1D60F */
+    "\001I"  /* U+1D610 */
+    "\001J"  /* U+1D611 */
+    "\001K"  /* U+1D612 */
+    "\001L"  /* U+1D613 */
+    "\001M"  /* U+1D614 */
+    "\001N"  /* U+1D615 */
+    "\001O"  /* U+1D616 */
+    "\001P"  /* U+1D617 */
+    "\001Q"  /* U+1D618 */
+    "\001R"  /* U+1D619 */
+    "\001S"  /* U+1D61A */
+    "\001T"  /* U+1D61B */
+    "\001U"  /* U+1D61C */
+    "\001V"  /* U+1D61D */
+    "\001W"  /* U+1D61E */
+    "\001X"  /* U+1D61F */
+    "\001Y"  /* U+1D620 */
+    "\001Z"  /* U+1D621 */
+    "\001a"  /* U+1D622 */
+    "\001b"  /* U+1D623 */
+    "\001c"  /* U+1D624 */
+    "\001d"  /* U+1D625 */
+    "\001e"  /* U+1D626 */
+    "\001f"  /* U+1D627 */
+    "\001g"  /* U+1D628 */
+    "\001h"  /* U+1D629 */
+    "\001i"  /* U+1D62A */
+    "\001j"  /* U+1D62B */
+    "\001k"  /* U+1D62C */
+    "\001l"  /* U+1D62D */
+    "\001m"  /* U+1D62E */
+    "\001n"  /* U+1D62F */
+    "\001o"  /* U+1D630 */
+    "\001p"  /* U+1D631 */
+    "\001q"  /* U+1D632 */
+    "\001r"  /* U+1D633 */
+    "\001s"  /* U+1D634 */
+    "\001t"  /* U+1D635 */
+    "\001u"  /* U+1D636 */
+    "\001v"  /* U+1D637 */
+    "\001w"  /* U+1D638 */
+    "\001x"  /* U+1D639 */
+    "\001y"  /* U+1D63A */
+    "\001z"  /* U+1D63B */
+    "\001A"  /* U+1D63C */
+    "\001B"  /* U+1D63D */
+    "\001C"  /* U+1D63E */
+    "\001D"  /* U+1D63F */
+    "\001E"  /* U+1D640 */
+    "\001F"  /* U+1D641 */
+    "\001G"  /* U+1D642 */
+    "\001H"  /* U+1D643 */
+    "\001I"  /* U+1D644 */
+    "\001J"  /* U+1D645 */
+    "\001K"  /* U+1D646 */
+    "\001L"  /* U+1D647 */
+    "\001M"  /* U+1D648 */
+    "\001N"  /* U+1D649 */
+    "\001O"  /* U+1D64A */
+    "\001P"  /* U+1D64B */
+    "\001Q"  /* U+1D64C */
+    "\001R"  /* U+1D64D */
+    "\001S"  /* U+1D64E */
+    "\001T"  /* U+1D64F */
+    "\001U"  /* U+1D650 */
+    "\001V"  /* U+1D651 */
+    "\001W"  /* U+1D652 */
+    "\001X"  /* U+1D653 */
+    "\001Y"  /* U+1D654 */
+    "\001Z"  /* U+1D655 */
+    "\001a"  /* U+1D656 */
+    "\001b"  /* U+1D657 */
+    "\001c"  /* U+1D658 */
+    "\001d"  /* U+1D659 */
+    "\001e"  /* U+1D65A */
+    "\001f"  /* U+1D65B */
+    "\001g"  /* U+1D65C */
+    "\001h"  /* U+1D65D */
+    "\001i"  /* U+1D65E */
+    "\001j"  /* U+1D65F */
+    "\001k"  /* U+1D660 */
+    "\001l"  /* U+1D661 */
+    "\001m"  /* U+1D662 */
+    "\001n"  /* U+1D663 */
+    "\001o"  /* U+1D664 */
+    "\001p"  /* U+1D665 */
+    "\001q"  /* U+1D666 */
+    "\001r"  /* U+1D667 */
+    "\001s"  /* U+1D668 */
+    "\001t"  /* U+1D669 */
+    "\001u"  /* U+1D66A */
+    "\001v"  /* U+1D66B */
+    "\001w"  /* U+1D66C */
+    "\001x"  /* U+1D66D */
+    "\001y"  /* U+1D66E */
+    "\001z"  /* U+1D66F */
+    "\001A"  /* U+1D670 */
+    "\001B"  /* U+1D671 */
+    "\001C"  /* U+1D672 */
+    "\001D"  /* U+1D673 */
+    "\001E"  /* U+1D674 */
+    "\001F"  /* U+1D675 */
+    "\001G"  /* U+1D676 */
+    "\001H"  /* U+1D677 */
+    "\001I"  /* U+1D678 */
+    "\001J"  /* U+1D679 */
+    "\001K"  /* U+1D67A */
+    "\001L"  /* U+1D67B */
+    "\001M"  /* U+1D67C */
+    "\001N"  /* U+1D67D */
+    "\001O"  /* U+1D67E */
+    "\001P"  /* U+1D67F */
+    "\001Q"  /* U+1D680 */
+    "\001R"  /* U+1D681 */
+    "\001S"  /* U+1D682 */
+    "\001T"  /* U+1D683 */
+    "\001U"  /* U+1D684 */
+    "\001V"  /* U+1D685 */
+    "\001W"  /* U+1D686 */
+    "\001X"  /* U+1D687 */
+    "\001Y"  /* U+1D688 */
+    "\001Z"  /* U+1D689 */
+    "\001a"  /* U+1D68A */
+    "\001b"  /* U+1D68B */
+    "\001c"  /* U+1D68C */
+    "\001d"  /* U+1D68D */
+    "\001e"  /* U+1D68E */
+    "\001f"  /* U+1D68F */
+    "\001g"  /* U+1D690 */
+    "\001h"  /* U+1D691 */
+    "\001i"  /* U+1D692 */
+    "\001j"  /* U+1D693 */
+    "\001k"  /* U+1D694 */
+    "\001l"  /* U+1D695 */
+    "\001m"  /* U+1D696 */
+    "\001n"  /* U+1D697 */
+    "\001o"  /* U+1D698 */
+    "\001p"  /* U+1D699 */
+    "\001q"  /* U+1D69A */
+    "\001r"  /* U+1D69B */
+    "\001s"  /* U+1D69C */
+    "\001t"  /* U+1D69D */
+    "\001u"  /* U+1D69E */
+    "\001v"  /* U+1D69F */
+    "\001w"  /* U+1D6A0 */
+    "\001x"  /* U+1D6A1 */
+    "\001y"  /* U+1D6A2 */
+    "\001z"  /* U+1D6A3 */
+    "\001i"  /* U+1D6A4 */
+    "\001j"  /* U+1D6A5 */
+    "\001A"  /* U+1D6A8 */
+    "\001B"  /* U+1D6A9 */
+    "\001G"  /* U+1D6AA */
+    "\001D"  /* U+1D6AB */
+    "\001E"  /* U+1D6AC */
+    "\001Z"  /* U+1D6AD */
+    "\001E"  /* U+1D6AE */
+    "\002Th"  /* U+1D6AF */
+    "\001I"  /* U+1D6B0 */
+    "\001K"  /* U+1D6B1 */
+    "\001L"  /* U+1D6B2 */
+    "\001M"  /* U+1D6B3 */
+    "\001N"  /* U+1D6B4 */
+    "\001X"  /* U+1D6B5 */
+    "\001O"  /* U+1D6B6 */
+    "\001P"  /* U+1D6B7 */
+    "\001R"  /* U+1D6B8 */
+    "\002Th"  /* U+1D6B9 */
+    "\001S"  /* U+1D6BA */
+    "\001T"  /* U+1D6BB */
+    "\001Y"  /* U+1D6BC */
+    "\001F"  /* U+1D6BD */
+    "\002Ch"  /* U+1D6BE */
+    "\002Ps"  /* U+1D6BF */
+    "\001O"  /* U+1D6C0 */
+    "\001a"  /* U+1D6C2 */
+    "\001b"  /* U+1D6C3 */
+    "\001g"  /* U+1D6C4 */
+    "\001d"  /* U+1D6C5 */
+    "\001e"  /* U+1D6C6 */
+    "\001z"  /* U+1D6C7 */
+    "\001e"  /* U+1D6C8 */
+    "\002th"  /* U+1D6C9 */
+    "\001i"  /* U+1D6CA */
+    "\001k"  /* U+1D6CB */
+    "\001l"  /* U+1D6CC */
+    "\001m"  /* U+1D6CD */
+    "\001n"  /* U+1D6CE */
+    "\001x"  /* U+1D6CF */
+    "\001o"  /* U+1D6D0 */
+    "\001p"  /* U+1D6D1 */
+    "\001r"  /* U+1D6D2 */
+    "\001s"  /* U+1D6D3 */
+    "\001s"  /* U+1D6D4 */
+    "\001t"  /* U+1D6D5 */
+    "\001y"  /* U+1D6D6 */
+    "\001f"  /* U+1D6D7 */
+    "\002ch"  /* U+1D6D8 */
+    "\002ps"  /* U+1D6D9 */
+    "\001o"  /* U+1D6DA */
+    "\001e"  /* U+1D6DC */
+    "\002th"  /* U+1D6DD */
+    "\001k"  /* U+1D6DE */
+    "\001f"  /* U+1D6DF */
+    "\001r"  /* U+1D6E0 */
+    "\001p"  /* U+1D6E1 */
+    "\001A"  /* U+1D6E2 */
+    "\001B"  /* U+1D6E3 */
+    "\001G"  /* U+1D6E4 */
+    "\001D"  /* U+1D6E5 */
+    "\001E"  /* U+1D6E6 */
+    "\001Z"  /* U+1D6E7 */
+    "\001E"  /* U+1D6E8 */
+    "\002Th"  /* U+1D6E9 */
+    "\001I"  /* U+1D6EA */
+    "\001K"  /* U+1D6EB */
+    "\001L"  /* U+1D6EC */
+    "\001M"  /* U+1D6ED */
+    "\001N"  /* U+1D6EE */
+    "\001X"  /* U+1D6EF */
+    "\001O"  /* U+1D6F0 */
+    "\001P"  /* U+1D6F1 */
+    "\001R"  /* U+1D6F2 */
+    "\002Th"  /* U+1D6F3 */
+    "\001S"  /* U+1D6F4 */
+    "\001T"  /* U+1D6F5 */
+    "\001Y"  /* U+1D6F6 */
+    "\001F"  /* U+1D6F7 */
+    "\002Ch"  /* U+1D6F8 */
+    "\002Ps"  /* U+1D6F9 */
+    "\001O"  /* U+1D6FA */
+    "\001a"  /* U+1D6FC */
+    "\001b"  /* U+1D6FD */
+    "\001g"  /* U+1D6FE */
+    "\001d"  /* U+1D6FF */
+    "\001e"  /* U+1D700 */
+    "\001z"  /* U+1D701 */
+    "\001e"  /* U+1D702 */
+    "\002th"  /* U+1D703 */
+    "\001i"  /* U+1D704 */
+    "\001k"  /* U+1D705 */
+    "\001l"  /* U+1D706 */
+    "\001m"  /* U+1D707 */
+    "\001n"  /* U+1D708 */
+    "\001x"  /* U+1D709 */
+    "\001o"  /* U+1D70A */
+    "\001p"  /* U+1D70B */
+    "\001r"  /* U+1D70C */
+    "\001s"  /* U+1D70D */
+    "\001s"  /* U+1D70E */
+    "\001t"  /* U+1D70F */
+    "\001y"  /* U+1D710 */
+    "\001f"  /* U+1D711 */
+    "\002ch"  /* U+1D712 */
+    "\002ps"  /* U+1D713 */
+    "\001o"  /* U+1D714 */
+    "\001e"  /* U+1D716 */
+    "\002th"  /* U+1D717 */
+    "\001k"  /* U+1D718 */
+    "\001f"  /* U+1D719 */
+    "\001r"  /* U+1D71A */
+    "\001p"  /* U+1D71B */
+    "\001A"  /* U+1D71C */
+    "\001B"  /* U+1D71D */
+    "\001G"  /* U+1D71E */
+    "\001D"  /* U+1D71F */
+    "\001E"  /* U+1D720 */
+    "\001Z"  /* U+1D721 */
+    "\001E"  /* U+1D722 */
+    "\002Th"  /* U+1D723 */
+    "\001I"  /* U+1D724 */
+    "\001K"  /* U+1D725 */
+    "\001L"  /* U+1D726 */
+    "\001M"  /* U+1D727 */
+    "\001N"  /* U+1D728 */
+    "\001X"  /* U+1D729 */
+    "\001O"  /* U+1D72A */
+    "\001P"  /* U+1D72B */
+    "\001R"  /* U+1D72C */
+    "\002Th"  /* U+1D72D */
+    "\001S"  /* U+1D72E */
+    "\001T"  /* U+1D72F */
+    "\001Y"  /* U+1D730 */
+    "\001F"  /* U+1D731 */
+    "\002Ch"  /* U+1D732 */
+    "\002Ps"  /* U+1D733 */
+    "\001O"  /* U+1D734 */
+    "\001a"  /* U+1D736 */
+    "\001b"  /* U+1D737 */
+    "\001g"  /* U+1D738 */
+    "\001d"  /* U+1D739 */
+    "\001e"  /* U+1D73A */
+    "\001z"  /* U+1D73B */
+    "\001e"  /* U+1D73C */
+    "\002th"  /* U+1D73D */
+    "\001i"  /* U+1D73E */
+    "\001k"  /* U+1D73F */
+    "\001l"  /* U+1D740 */
+    "\001m"  /* U+1D741 */
+    "\001n"  /* U+1D742 */
+    "\001x"  /* U+1D743 */
+    "\001o"  /* U+1D744 */
+    "\001p"  /* U+1D745 */
+    "\001r"  /* U+1D746 */
+    "\001s"  /* U+1D747 */
+    "\001s"  /* U+1D748 */
+    "\001t"  /* U+1D749 */
+    "\001y"  /* U+1D74A */
+    "\001f"  /* U+1D74B */
+    "\002ch"  /* U+1D74C */
+    "\002ps"  /* U+1D74D */
+    "\001o"  /* U+1D74E */
+    "\001e"  /* U+1D750 */
+    "\002th"  /* U+1D751 */
+    "\001k"  /* U+1D752 */
+    "\001f"  /* U+1D753 */
+    "\001r"  /* U+1D754 */
+    "\001p"  /* U+1D755 */
+    "\001A"  /* U+1D756 */
+    "\001B"  /* U+1D757 */
+    "\001G"  /* U+1D758 */
+    "\001D"  /* U+1D759 */
+    "\001E"  /* U+1D75A */
+    "\001Z"  /* U+1D75B */
+    "\001E"  /* U+1D75C */
+    "\002Th"  /* U+1D75D */
+    "\001I"  /* U+1D75E */
+    "\001K"  /* U+1D75F */
+    "\001L"  /* U+1D760 */
+    "\001M"  /* U+1D761 */
+    "\001N"  /* U+1D762 */
+    "\001X"  /* U+1D763 */
+    "\001O"  /* U+1D764 */
+    "\001P"  /* U+1D765 */
+    "\001R"  /* U+1D766 */
+    "\002Th"  /* U+1D767 */
+    "\001S"  /* U+1D768 */
+    "\001T"  /* U+1D769 */
+    "\001Y"  /* U+1D76A */
+    "\001F"  /* U+1D76B */
+    "\002Ch"  /* U+1D76C */
+    "\002Ps"  /* U+1D76D */
+    "\001O"  /* U+1D76E */
+    "\001a"  /* U+1D770 */
+    "\001b"  /* U+1D771 */
+    "\001g"  /* U+1D772 */
+    "\001d"  /* U+1D773 */
+    "\001e"  /* U+1D774 */
+    "\001z"  /* U+1D775 */
+    "\001e"  /* U+1D776 */
+    "\002th"  /* U+1D777 */
+    "\001i"  /* U+1D778 */
+    "\001k"  /* U+1D779 */
+    "\001l"  /* U+1D77A */
+    "\001m"  /* U+1D77B */
+    "\001n"  /* U+1D77C */
+    "\001x"  /* U+1D77D */
+    "\001o"  /* U+1D77E */
+    "\001p"  /* U+1D77F */
+    "\001r"  /* U+1D780 */
+    "\001s"  /* U+1D781 */
+    "\001s"  /* U+1D782 */
+    "\001t"  /* U+1D783 */
+    "\001y"  /* U+1D784 */
+    "\001f"  /* U+1D785 */
+    "\002ch"  /* U+1D786 */
+    "\002ps"  /* U+1D787 */
+    "\001o"  /* U+1D788 */
+    "\001e"  /* U+1D78A */
+    "\002th"  /* U+1D78B */
+    "\001k"  /* U+1D78C */
+    "\001f"  /* U+1D78D */
+    "\001r"  /* U+1D78E */
+    "\001p"  /* U+1D78F */
+    "\001A"  /* U+1D790 */
+    "\001B"  /* U+1D791 */
+    "\001G"  /* U+1D792 */
+    "\001D"  /* U+1D793 */
+    "\001E"  /* U+1D794 */
+    "\001Z"  /* U+1D795 */
+    "\001E"  /* U+1D796 */
+    "\002Th"  /* U+1D797 */
+    "\001I"  /* U+1D798 */
+    "\001K"  /* U+1D799 */
+    "\001L"  /* U+1D79A */
+    "\001M"  /* U+1D79B */
+    "\001N"  /* U+1D79C */
+    "\001X"  /* U+1D79D */
+    "\001O"  /* U+1D79E */
+    "\001P"  /* U+1D79F */
+    "\001R"  /* U+1D7A0 */
+    "\002Th"  /* U+1D7A1 */
+    "\001S"  /* U+1D7A2 */
+    "\001T"  /* U+1D7A3 */
+    "\001Y"  /* U+1D7A4 */
+    "\001F"  /* U+1D7A5 */
+    "\002Ch"  /* U+1D7A6 */
+    "\002Ps"  /* U+1D7A7 */
+    "\001O"  /* U+1D7A8 */
+    "\001a"  /* U+1D7AA */
+    "\001b"  /* U+1D7AB */
+    "\001g"  /* U+1D7AC */
+    "\001d"  /* U+1D7AD */
+    "\001e"  /* U+1D7AE */
+    "\001z"  /* U+1D7AF */
+    "\001e"  /* U+1D7B0 */
+    "\002th"  /* U+1D7B1 */
+    "\001i"  /* U+1D7B2 */
+    "\001k"  /* U+1D7B3 */
+    "\001l"  /* U+1D7B4 */
+    "\001m"  /* U+1D7B5 */
+    "\001n"  /* U+1D7B6 */
+    "\001x"  /* U+1D7B7 */
+    "\001o"  /* U+1D7B8 */
+    "\001p"  /* U+1D7B9 */
+    "\001r"  /* U+1D7BA */
+    "\001s"  /* U+1D7BB */
+    "\001s"  /* U+1D7BC */
+    "\001t"  /* U+1D7BD */
+    "\001y"  /* U+1D7BE */
+    "\001f"  /* U+1D7BF */
+    "\002ch"  /* U+1D7C0 */
+    "\002ps"  /* U+1D7C1 */
+    "\001o"  /* U+1D7C2 */
+    "\001e"  /* U+1D7C4 */
+    "\002th"  /* U+1D7C5 */
+    "\001k"  /* U+1D7C6 */
+    "\001f"  /* U+1D7C7 */
+    "\001r"  /* U+1D7C8 */
+    "\001p"  /* U+1D7C9 */
+    "\0010"  /* U+1D7CE */
+    "\0011"  /* U+1D7CF */
+    "\0012"  /* U+1D7D0 */
+    "\0013"  /* U+1D7D1 */
+    "\0014"  /* U+1D7D2 */
+    "\0015"  /* U+1D7D3 */
+    "\0016"  /* U+1D7D4 */
+    "\0017"  /* U+1D7D5 */
+    "\0018"  /* U+1D7D6 */
+    "\0019"  /* U+1D7D7 */
+    "\0010"  /* U+1D7D8 */
+    "\0011"  /* U+1D7D9 */
+    "\0012"  /* U+1D7DA */
+    "\0013"  /* U+1D7DB */
+    "\0014"  /* U+1D7DC */
+    "\0015"  /* U+1D7DD */
+    "\0016"  /* U+1D7DE */
+    "\0017"  /* U+1D7DF */
+    "\0018"  /* U+1D7E0 */
+    "\0019"  /* U+1D7E1 */
+    "\0010"  /* U+1D7E2 */
+    "\0011"  /* U+1D7E3 */
+    "\0012"  /* U+1D7E4 */
+    "\0013"  /* U+1D7E5 */
+    "\0014"  /* U+1D7E6 */
+    "\0015"  /* U+1D7E7 */
+    "\0016"  /* U+1D7E8 */
+    "\0017"  /* U+1D7E9 */
+    "\0018"  /* U+1D7EA */
+    "\0019"  /* U+1D7EB */
+    "\0010"  /* U+1D7EC */
+    "\0011"  /* U+1D7ED */
+    "\0012"  /* U+1D7EE */
+    "\0013"  /* U+1D7EF */
+    "\0014"  /* U+1D7F0 */
+    "\0015"  /* U+1D7F1 */
+    "\0016"  /* U+1D7F2 */
+    "\0017"  /* U+1D7F3 */
+    "\0018"  /* U+1D7F4 */
+    "\0019"  /* U+1D7F5 */
+    "\0010"  /* U+1D7F6 */
+    "\0011"  /* U+1D7F7 */
+    "\0012"  /* U+1D7F8 */
+    "\0013"  /* U+1D7F9 */
+    "\0014"  /* U+1D7FA */
+    "\0015"  /* U+1D7FB */
+    "\0016"  /* U+1D7FC */
+    "\0017"  /* U+1D7FD */
+    "\0018"  /* U+1D7FE */
+    "\0019"  /* U+1D7FF */
+    "\0020."  /* U+1F100 */
+    "\0020,"  /* U+1F101 */
+    "\0021,"  /* U+1F102 */
+    "\0022,"  /* U+1F103 */
+    "\0023,"  /* U+1F104 */
+    "\0024,"  /* U+1F105 */
+    "\0025,"  /* U+1F106 */
+    "\0026,"  /* U+1F107 */
+    "\0027,"  /* U+1F108 */
+    "\0028,"  /* U+1F109 */
+    "\0029,"  /* U+1F10A */
+    "\003(A)"  /* U+1F110 */
+    "\003(B)"  /* U+1F111 */
+    "\003(C)"  /* U+1F112 */
+    "\003(D)"  /* U+1F113 */
+    "\003(E)"  /* U+1F114 */
+    "\003(F)"  /* U+1F115 */
+    "\003(G)"  /* U+1F116 */
+    "\003(H)"  /* U+1F117 */
+    "\003(I)"  /* U+1F118 */
+    "\003(J)"  /* U+1F119 */
+    "\003(K)"  /* U+1F11A */
+    "\003(L)"  /* U+1F11B */
+    "\003(M)"  /* U+1F11C */
+    "\003(N)"  /* U+1F11D */
+    "\003(O)"  /* U+1F11E */
+    "\003(P)"  /* U+1F11F */
+    "\003(Q)"  /* U+1F120 */
+    "\003(R)"  /* U+1F121 */
+    "\003(S)"  /* U+1F122 */
+    "\003(T)"  /* U+1F123 */
+    "\003(U)"  /* U+1F124 */
+    "\003(V)"  /* U+1F125 */
+    "\003(W)"  /* U+1F126 */
+    "\003(X)"  /* U+1F127 */
+    "\003(Y)"  /* U+1F128 */
+    "\003(Z)"  /* U+1F129 */
+    "\001C"  /* U+1F12B */
+    "\001R"  /* U+1F12C */
+    "\002CD"  /* U+1F12D */
+    "\002WZ"  /* U+1F12E */
+    "\001A"  /* U+1F130 */
+    "\001B"  /* U+1F131 */
+    "\001C"  /* U+1F132 */
+    "\001D"  /* U+1F133 */
+    "\001E"  /* U+1F134 */
+    "\001F"  /* U+1F135 */
+    "\001G"  /* U+1F136 */
+    "\001H"  /* U+1F137 */
+    "\001I"  /* U+1F138 */
+    "\001J"  /* U+1F139 */
+    "\001K"  /* U+1F13A */
+    "\001L"  /* U+1F13B */
+    "\001M"  /* U+1F13C */
+    "\001N"  /* U+1F13D */
+    "\001O"  /* U+1F13E */
+    "\001P"  /* U+1F13F */
+    "\001Q"  /* U+1F140 */
+    "\001R"  /* U+1F141 */
+    "\001S"  /* U+1F142 */
+    "\001T"  /* U+1F143 */
+    "\001U"  /* U+1F144 */
+    "\001V"  /* U+1F145 */
+    "\001W"  /* U+1F146 */
+    "\001X"  /* U+1F147 */
+    "\001Y"  /* U+1F148 */
+    "\001Z"  /* U+1F149 */
+    "\002HV"  /* U+1F14A */
+    "\002MV"  /* U+1F14B */
+    "\002SD"  /* U+1F14C */
+    "\002SS"  /* U+1F14D */
+    "\003PPV"  /* U+1F14E */
+    "\002WC"  /* U+1F14F */
+    "\002MC"  /* U+1F16A */
+    "\002MD"  /* U+1F16B */
+    "\002MR"  /* U+1F16C */
+    "\002DJ"  /* U+1F190 */
+    "\0010"  /* U+1FBF0 */
+    "\0011"  /* U+1FBF1 */
+    "\0012"  /* U+1FBF2 */
+    "\0013"  /* U+1FBF3 */
+    "\0014"  /* U+1FBF4 */
+    "\0015"  /* U+1FBF5 */
+    "\0016"  /* U+1FBF6 */
+    "\0017"  /* U+1FBF7 */
+    "\0018"  /* U+1FBF8 */
+    "\0019"  /* U+1FBF9 */
+    ;
+
+#endif /* STRATEGY_TABLES_H */
@@ -0,0 +1,94 @@
+#!/bin/sh
+# Record framing checks: the same records must come out the same whether
+# or not the input ends in a terminator. Then one round trip per output
+# path: each must give the results the plain run gives.
+# usage: test/records.sh ENCFORCE
+
+BIN=${1:-./encforce}
+IN=${TMPDIR:-/tmp}/encforce-records.$$
+OUT=$IN.out
+SOCK=$IN.sock
+trap 'rm -f "$IN" "$OUT" "$SOCK"' EXIT
+fail=0
+
+# check NAME EXPECTED OPTIONS..., input in $IN
+check() {
+    name=$1 want=$2
+    shift 2
+    got=$("$BIN" -j1 -m decode -e cp1252 "$@" < "$IN" 2>/dev/null | tr '\n' ' ')
+    if [ "$got" = "$want" ]; then
+        echo "ok    $name"
+    else
+        echo "FAIL  $name: got '$got', want '$want'"
+        fail=1
+    fi
+}
+
+# same NAME COMMAND EXPECTED_COMMAND: both must print the same, and something
+same() {
+    got=$(eval "$2" 2>/dev/null | od -An -tx1)
+    want=$(eval "$3" 2>/dev/null | od -An -tx1)
+    if [ -n "$want" ] && [ "$got" = "$want" ]; then
+        echo "ok    $1"
+    else
+        echo "FAIL  $1"
+        fail=1
+    fi
+}
+
+TWO='$HEX[61c3a9] $HEX[62c3a9] '
+
+printf 'a\351\nb\351\n' > "$IN"; check "lines, final newline" "$TWO"
+printf 'a\351\nb\351' > "$IN"; check "lines, no final newline" "$TWO"
+printf 'a\351\r\nb\351\r\n' > "$IN"; check "lines, CRLF" "$TWO"
+printf 'a\351\0b\351\0' > "$IN"; check "-0, final NUL" "$TWO" -0
+printf 'a\351\0b\351' > "$IN"; check "-0, no final NUL" "$TWO" -0
+printf 'a\351\0b\351\0' > "$IN"; check "-0 --stream, final NUL" "$TWO" -0 --stream
+printf '\2\0\0\0a\351\2\0\0\0b\351' > "$IN"; check "--length-prefixed" "$TWO" --length-prefixed
+
+RUN="\"$BIN\" -j1 -m both -e cp1252 -e iso-8859-1 -e utf-8 -e koi8-r"
+
+printf 'caf\303\251\nna\357ve\n\320\234\320\276\n' > "$IN"
+same "--stream" "cat \"$IN\" | $RUN --stream" "$RUN < \"$IN\""
+same "-F binary | --render" \
+    "$RUN -F binary < \"$IN\" > \"$OUT\" && \"$BIN\" --render \"$OUT\" -F tsv |
+        awk -F '\t' 'NR > 1 { print \$2, \$3, \$4, \$5, \$8 }'" \
+    "$RUN -F tsv < \"$IN\" | awk -F '\t' 'NR > 1 { print \$3, \$4, \$5, \$6, \$8 }'"
+
+printf 'caf\303\251 na\357ve' > "$IN"
+same "--whole-file" "$RUN --whole-file -f \"$IN\"" "$RUN -f \"$IN\""
+
+printf 'caf\303\251\nna\357ve\n\320\234\320\276\n' > "$IN"
+if python3 -c 'import pyarrow' 2>/dev/null; then
+    same "-F arrow" "$RUN -F arrow < \"$IN\" | python3 -c '
+import sys, pyarrow as pa
+for r in pa.ipc.open_stream(sys.stdin.buffer).read_all().to_pylist():
+    print(r[\"op\"], r[\"encoding\"], r[\"target\"] or \"\", r[\"strategy\"] or \"\", r[\"output\"].hex())'" \
+        "$RUN -F tsv < \"$IN\" | awk -F '\t' 'NR > 1 { gsub(/\"/, \"\", \$8); print \$3, \$4, \$5, \$6, \$8 }'"
+else
+    echo "skip  -F arrow (needs python3 with pyarrow)"
+fi
+
+if command -v python3 > /dev/null; then
+    "$BIN" -j2 --serve "$SOCK" 2>/dev/null &
+    server=$!
+    i=0
+    while [ ! -S "$SOCK" ] && [ $i -lt 50 ]; do sleep 0.1; i=$((i + 1)); done
+    same "--serve" "python3 -c '
+import socket, struct, sys
+s = socket.socket(socket.AF_UNIX)
+s.connect(sys.argv[1])
+recs = [b\"-m both -e cp1252 -e iso-8859-1 -e utf-8 -e koi8-r -F tsv\"] + open(sys.argv[2], \"rb\").read().split(b\"\\n\")[:-1]
+s.sendall(b\"\".join(struct.pack(\"<I\", len(r)) + r for r in recs))
+s.shutdown(socket.SHUT_WR)
+while True:
+    b = s.recv(65536)
+    if not b: break
+    sys.stdout.buffer.write(b)' \"$SOCK\" \"$IN\"" "$RUN -F tsv < \"$IN\""
+    kill $server
+    wait $server 2>/dev/null
+else
+    echo "skip  --serve (needs python3)"
+fi
+
+exit $fail